@@ -28,6 +28,82 @@ auto string_clone(rstd_bench::BenchContext& context) -> bool {
     return total == context.iterations() * source.len();
 }
 
+auto string_clone_short(rstd_bench::BenchContext& context) -> bool {
+    auto source = String::make("user_id:4817");
+    auto total  = std::uint64_t {};
+
+    for (std::uint64_t i = 0; i < context.iterations(); ++i) {
+        auto copy = source.clone();
+        if (! copy.is_inline() || copy.len() != source.len()) {
+            return false;
+        }
+        total += copy.len();
+        rstd::hint::black_box(total);
+    }
+
+    context.set_items_processed(context.iterations());
+    context.set_bytes_processed(context.iterations() * source.len());
+    return total == context.iterations() * source.len();
+}
+
+auto arc_str_clone(rstd_bench::BenchContext& context) -> bool {
+    auto source = rstd::string::ArcStr::make(
+        "benchmark string payload used by rstd clone measurements");
+    auto total = std::uint64_t {};
+
+    for (std::uint64_t i = 0; i < context.iterations(); ++i) {
+        auto copy = source.clone();
+        if (! copy.ptr_eq(source)) {
+            return false;
+        }
+        total += copy.len();
+        rstd::hint::black_box(total);
+    }
+
+    context.set_items_processed(context.iterations());
+    context.set_bytes_processed(context.iterations() * source.len());
+    return total == context.iterations() * source.len();
+}
+
+// Builds 64 short keys per iteration; reports key bytes on the heap per key through
+// bytes_processed so runs with and without the inline buffer can be compared.
+auto string_footprint_short_keys(rstd_bench::BenchContext& context) -> bool {
+    auto heap_bytes = std::uint64_t {};
+
+    for (std::uint64_t i = 0; i < context.iterations(); ++i) {
+        auto keys = Vec<String>::with_capacity(64);
+        for (int k = 0; k < 64; ++k) {
+            keys.push(rstd::format("key-{}", k));
+        }
+        for (auto& key : keys) {
+            if (! key.is_inline()) heap_bytes += key.capacity();
+        }
+        rstd::hint::black_box(keys.len());
+    }
+
+    context.set_items_processed(context.iterations() * 64);
+    context.set_bytes_processed(context.iterations() * 64 * sizeof(String) + heap_bytes);
+    return heap_bytes == 0;
+}
+
+auto interner_hit(rstd_bench::BenchContext& context) -> bool {
+    auto interner = rstd::string::Interner::make();
+    auto expected = interner.intern("content-type");
+    (void)interner.intern("content-length");
+    (void)interner.intern("host");
+
+    for (std::uint64_t i = 0; i < context.iterations(); ++i) {
+        auto sym = interner.intern("content-type");
+        if (sym != expected) {
+            return false;
+        }
+        rstd::hint::black_box(sym.as_u32());
+    }
+
+    context.set_items_processed(context.iterations());
+    return interner.len() == 3;
+}
+
 auto vec_push_reserved(rstd_bench::BenchContext& context) -> bool {
     auto total = std::uint64_t {};
 
@@ -48,6 +124,53 @@ auto vec_push_reserved(rstd_bench::BenchContext& context) -> bool {
     return total == context.iterations() * 64;
 }
 
+// Collects a 1024-element range and maps it in place through `into_iter().map(..)`.
+auto vec_collect_map_1k(rstd_bench::BenchContext& context) -> bool {
+    auto total = std::uint64_t {};
+
+    for (std::uint64_t i = 0; i < context.iterations(); ++i) {
+        auto vec     = rstd::iter::range(0, 1024).collect<Vec<int>>();
+        auto doubled = rstd::move(vec).into_iter().map([](int x) { return unsigned(x) * 2; })
+                           .collect<Vec<unsigned>>();
+        if (doubled.len() != 1024 || doubled[1023] != 2046) {
+            return false;
+        }
+        total += doubled.len();
+        rstd::hint::black_box(total);
+    }
+
+    context.set_items_processed(context.iterations() * 1024);
+    return total == context.iterations() * 1024;
+}
+
+// 64 KiB of mostly-ASCII text with a multi-byte character every 61 bytes.
+auto utf8_validate_mixed(rstd_bench::BenchContext& context) -> bool {
+    constexpr usize LEN = 64 * 1024;
+    auto            buf = Vec<u8>::with_capacity(LEN);
+    while (buf.len() + 3 <= LEN) {
+        if (buf.len() % 61 == 0) {
+            buf.push(0xE2);
+            buf.push(0x82);
+            buf.push(0xAC);
+        } else {
+            buf.push(u8('a' + buf.len() % 26));
+        }
+    }
+    auto total = std::uint64_t {};
+
+    for (std::uint64_t i = 0; i < context.iterations(); ++i) {
+        auto valid = rstd::str_::validate_utf8(rstd::hint::black_box(buf.as_slice()));
+        if (valid.is_err()) {
+            return false;
+        }
+        total += buf.len();
+    }
+
+    context.set_items_processed(context.iterations());
+    context.set_bytes_processed(total);
+    return total == context.iterations() * buf.len();
+}
+
 auto bytes_extend_freeze(rstd_bench::BenchContext& context) -> bool {
     const u8 payload[] = {
         0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
@@ -72,10 +195,99 @@ auto bytes_extend_freeze(rstd_bench::BenchContext& context) -> bool {
     return total == context.iterations() * 64;
 }
 
+// Count-by-key over 1k distinct keys: one `entry` probe per row instead of a lookup plus an
+// insert.
+auto hash_map_entry_count_1k(rstd_bench::BenchContext& context) -> bool {
+    auto counts = collections::HashMap<std::uint64_t, std::uint64_t>::with_capacity(1024);
+    auto total  = std::uint64_t {};
+
+    for (std::uint64_t i = 0; i < context.iterations(); ++i) {
+        auto key = rstd::hint::black_box((i * 2654435761u) % 1024);
+        *counts.entry(key).or_insert(0) += 1;
+        total += 1;
+    }
+
+    context.set_items_processed(context.iterations());
+    auto sum    = std::uint64_t {};
+    auto values = counts.values();
+    for (auto value = values.next(); value.is_some(); value = values.next()) sum += **value;
+    return sum == total;
+}
+
+// A FIFO of 64 in-flight items: each iteration enqueues one and retires the oldest.
+auto vec_deque_push_pop(rstd_bench::BenchContext& context) -> bool {
+    auto queue = collections::VecDeque<std::uint64_t>::with_capacity(64);
+    for (std::uint64_t i = 0; i < 64; ++i) queue.push_back(i);
+    auto total = std::uint64_t {};
+
+    for (std::uint64_t i = 0; i < context.iterations(); ++i) {
+        queue.push_back(i + 64);
+        auto oldest = queue.pop_front();
+        if (oldest.is_none() || *oldest != i) {
+            return false;
+        }
+        total += 1;
+        rstd::hint::black_box(total);
+    }
+
+    context.set_items_processed(context.iterations());
+    return total == context.iterations() && queue.len() == 64;
+}
+
+// A min-heap of 1k timer deadlines: pop the earliest and re-arm it later.
+auto binary_heap_push_pop_1k(rstd_bench::BenchContext& context) -> bool {
+    struct Earlier {
+        auto operator()(std::uint64_t left, std::uint64_t right) const noexcept -> bool {
+            return right < left;
+        }
+    };
+    auto heap = collections::BinaryHeap<std::uint64_t, Earlier>::with_capacity(1024);
+    for (std::uint64_t i = 0; i < 1024; ++i) heap.push((i * 7919) % 1024);
+    auto total = std::uint64_t {};
+
+    for (std::uint64_t i = 0; i < context.iterations(); ++i) {
+        auto earliest = heap.pop();
+        if (earliest.is_none()) {
+            return false;
+        }
+        heap.push(*earliest + 1024);
+        total += 1;
+        rstd::hint::black_box(total);
+    }
+
+    context.set_items_processed(context.iterations());
+    return total == context.iterations() && heap.len() == 1024;
+}
+
+// Iterate the members of a 4096-bit set with one bit in eight set.
+auto bit_set_iter_4k(rstd_bench::BenchContext& context) -> bool {
+    auto set = collections::BitSet::with_capacity(4096);
+    for (usize i = 0; i < 4096; i += 8) (void)set.insert(i);
+    auto total = std::uint64_t {};
+
+    for (std::uint64_t i = 0; i < context.iterations(); ++i) {
+        auto it = rstd::hint::black_box(set).iter();
+        for (auto member = it.next(); member.is_some(); member = it.next()) total += 1;
+    }
+
+    context.set_items_processed(context.iterations() * 512);
+    return total == context.iterations() * 512;
+}
+
 const rstd_bench::BenchCase CASES[] = {
     { "alloc", "string_clone", 200'000, 1'000, &string_clone },
+    { "alloc", "string_clone_short_inline", 200'000, 1'000, &string_clone_short },
+    { "alloc", "arc_str_clone", 200'000, 1'000, &arc_str_clone },
+    { "alloc", "string_footprint_short_keys_64", 20'000, 100, &string_footprint_short_keys },
+    { "alloc", "interner_hit", 200'000, 1'000, &interner_hit },
     { "alloc", "vec_push_reserved_64", 200'000, 1'000, &vec_push_reserved },
+    { "alloc", "vec_collect_map_1k", 20'000, 100, &vec_collect_map_1k },
+    { "alloc", "utf8_validate_mixed_64k", 20'000, 100, &utf8_validate_mixed },
     { "alloc", "bytes_extend_freeze_64", 200'000, 1'000, &bytes_extend_freeze },
+    { "alloc", "hash_map_entry_count_1k", 200'000, 1'000, &hash_map_entry_count_1k },
+    { "alloc", "vec_deque_push_pop_64", 200'000, 1'000, &vec_deque_push_pop },
+    { "alloc", "binary_heap_push_pop_1k", 200'000, 1'000, &binary_heap_push_pop_1k },
+    { "alloc", "bit_set_iter_4k", 20'000, 100, &bit_set_iter_4k },
 };
 
 } // namespace
@@ -53,6 +53,67 @@ async::coro<int> join_many_spawned_children() {
     co_return sum;
 }
 
+// Each producer runs on its own worker and spawns 32 children from there, so the spawns of
+// the four producers race against each other.
+async::coro<int> produce_children() {
+    auto handles = Vec<async::JoinHandle<int>>::make();
+    for (int i = 0; i < 32; ++i) {
+        handles.push(async::spawn(indexed_child_value(i)));
+    }
+
+    auto results = co_await async::join_all(rstd::move(handles));
+    int  sum     = 0;
+    for (usize i = 0; i < results.len(); ++i) {
+        sum += results[i].unwrap_unchecked();
+    }
+    co_return sum;
+}
+
+async::coro<int> multi_producer_spawn() {
+    auto producers = Vec<async::JoinHandle<int>>::make();
+    for (int i = 0; i < 4; ++i) {
+        producers.push(async::spawn(produce_children()));
+    }
+
+    auto results = co_await async::join_all(rstd::move(producers));
+    int  sum     = 0;
+    for (usize i = 0; i < results.len(); ++i) {
+        sum += results[i].unwrap_unchecked();
+    }
+    co_return sum;
+}
+
+// Forwards what arrives on `rx`, plus one, to `tx`. A chain of relays hands one message from
+// task to task, each hop a wake issued by the task that is running.
+async::coro<void> relay(async::oneshot::Receiver<int> rx, async::oneshot::Sender<int> tx) {
+    auto received = co_await rstd::move(rx);
+    (void)tx.send(received.unwrap_unchecked() + 1);
+}
+
+async::coro<int> relay_chain() {
+    auto first  = async::oneshot::channel<int>();
+    auto head   = rstd::move(first.get<0>());
+    auto rx     = rstd::move(first.get<1>());
+    auto relays = Vec<async::JoinHandle<void>>::make();
+    for (int i = 0; i < 32; ++i) {
+        auto next = async::oneshot::channel<int>();
+        relays.push(async::spawn(relay(rstd::move(rx), rstd::move(next.get<0>()))));
+        rx = rstd::move(next.get<1>());
+    }
+
+    (void)head.send(0);
+    auto received = co_await rstd::move(rx);
+    (void)co_await async::join_all(rstd::move(relays));
+    co_return received.unwrap_unchecked();
+}
+
+async::coro<int> nested_frames(int depth) {
+    if (depth == 0) {
+        co_return 1;
+    }
+    co_return 1 + co_await nested_frames(depth - 1);
+}
+
 async::coro<int> sleep_zero() {
     co_await async::sleep(time::Duration::from_millis(0));
     co_return 1;
@@ -84,6 +145,20 @@ auto current_thread_spawn_local_join(rstd_bench::BenchContext& context) -> bool
     return sum == context.iterations();
 }
 
+// Nine frames per root, all released before the next root allocates them again.
+auto current_thread_nested_frames(rstd_bench::BenchContext& context) -> bool {
+    auto runtime = async::Runtime {};
+    auto sum     = std::uint64_t {};
+
+    for (std::uint64_t i = 0; i < context.iterations(); ++i) {
+        sum += runtime.block_on(nested_frames(8));
+        rstd::hint::black_box(sum);
+    }
+
+    context.set_items_processed(context.iterations() * 9);
+    return sum == context.iterations() * 9;
+}
+
 auto thread_pool_spawn_join(rstd_bench::BenchContext& context) -> bool {
     auto runtime_result = async::RuntimeBuilder::multi_thread().worker_threads(2).build();
     if (runtime_result.is_err()) {
@@ -118,6 +193,40 @@ auto thread_pool_join_many(rstd_bench::BenchContext& context) -> bool {
     return sum == context.iterations() * 496;
 }
 
+auto thread_pool_multi_spawn(rstd_bench::BenchContext& context) -> bool {
+    auto runtime_result = async::RuntimeBuilder::multi_thread().worker_threads(4).build();
+    if (runtime_result.is_err()) {
+        return false;
+    }
+
+    auto runtime = rstd::move(runtime_result).unwrap_unchecked();
+    auto sum     = std::uint64_t {};
+    for (std::uint64_t i = 0; i < context.iterations(); ++i) {
+        sum += runtime.block_on(multi_producer_spawn());
+        rstd::hint::black_box(sum);
+    }
+
+    context.set_items_processed(context.iterations() * (4 + 4 * 32));
+    return sum == context.iterations() * 4 * 496;
+}
+
+auto thread_pool_relay_chain(rstd_bench::BenchContext& context) -> bool {
+    auto runtime_result = async::RuntimeBuilder::multi_thread().worker_threads(2).build();
+    if (runtime_result.is_err()) {
+        return false;
+    }
+
+    auto runtime = rstd::move(runtime_result).unwrap_unchecked();
+    auto sum     = std::uint64_t {};
+    for (std::uint64_t i = 0; i < context.iterations(); ++i) {
+        sum += runtime.block_on(relay_chain());
+        rstd::hint::black_box(sum);
+    }
+
+    context.set_items_processed(context.iterations() * 32);
+    return sum == context.iterations() * 32;
+}
+
 auto timer_sleep_zero(rstd_bench::BenchContext& context) -> bool {
     auto runtime = async::Runtime {};
     auto sum     = std::uint64_t {};
@@ -134,8 +243,11 @@ auto timer_sleep_zero(rstd_bench::BenchContext& context) -> bool {
 const rstd_bench::BenchCase CASES[] = {
     { "async", "current_thread_ready", 200'000, 1'000, &current_thread_ready },
     { "async", "current_thread_spawn_local_join", 50'000, 500, &current_thread_spawn_local_join },
+    { "async", "current_thread_nested_frames_8", 50'000, 500, &current_thread_nested_frames },
     { "async", "thread_pool_spawn_join_2", 20'000, 200, &thread_pool_spawn_join },
     { "async", "thread_pool_join_many_4x32", 2'000, 20, &thread_pool_join_many },
+    { "async", "thread_pool_multi_spawn_4x32", 2'000, 20, &thread_pool_multi_spawn },
+    { "async", "thread_pool_relay_chain_32", 2'000, 20, &thread_pool_relay_chain },
     { "async", "timer_sleep_zero", 100'000, 500, &timer_sleep_zero },
 };
 
@@ -52,7 +52,7 @@ auto parse_options(int argc, char** argv) -> Options {
         } else if (std::strcmp(argv[i], "--list") == 0) {
             options.m_list = true;
         } else if (std::strcmp(argv[i], "--help") == 0) {
-            std::printf("usage: rstd_bench [--suite all|alloc|sync|async|net] [--quick] "
+            std::printf("usage: rstd_bench [--suite all|alloc|sync|async|net|sort] [--quick] "
                         "[--iterations N] [--json PATH] [--list]\n");
             std::exit(0);
         }
@@ -153,15 +153,16 @@ void append_list(rstd_bench::BenchCase const* (&cases)[N],
 auto main(int argc, char** argv) -> int {
     auto options = parse_options(argc, argv);
 
-    rstd_bench::BenchCase const* suites[4] {};
-    std::size_t                  lens[4] {};
+    rstd_bench::BenchCase const* suites[5] {};
+    std::size_t                  lens[5] {};
     append_list(suites, lens, 0, rstd_bench::alloc_benchmarks());
     append_list(suites, lens, 1, rstd_bench::sync_benchmarks());
     append_list(suites, lens, 2, rstd_bench::async_benchmarks());
     append_list(suites, lens, 3, rstd_bench::net_benchmarks());
+    append_list(suites, lens, 4, rstd_bench::sort_benchmarks());
 
     if (options.m_list) {
-        for (std::size_t i = 0; i < 4; ++i) {
+        for (std::size_t i = 0; i < 5; ++i) {
             for (std::size_t j = 0; j < lens[i]; ++j) {
                 if (suite_matches(options, suites[i][j])) {
                     std::printf("%s.%s\n", suites[i][j].m_suite, suites[i][j].m_name);
@@ -179,7 +180,7 @@ auto main(int argc, char** argv) -> int {
         "%-8s %-32s %10s %20s %13s %s\n", "suite", "name", "iters", "time", "total", "status");
     std::printf("build=%s asan=%s\n", RSTD_BENCH_BUILD_TYPE, RSTD_BENCH_ASAN ? "true" : "false");
 
-    for (std::size_t i = 0; i < 4; ++i) {
+    for (std::size_t i = 0; i < 5; ++i) {
         for (std::size_t j = 0; j < lens[i]; ++j) {
             const auto& bench = suites[i][j];
             if (! suite_matches(options, bench)) {
@@ -38,5 +38,6 @@ BenchList alloc_benchmarks();
 BenchList sync_benchmarks();
 BenchList async_benchmarks();
 BenchList net_benchmarks();
+BenchList sort_benchmarks();
 
 } // namespace rstd_bench
@@ -124,8 +124,257 @@ auto loopback_roundtrip_4b(rstd_bench::BenchContext& context) -> bool {
     return true;
 }
 
+constexpr usize CHURN_CONNECTIONS = 16;
+
+async::coro<io::Result<usize>> connect_and_accept(net::TcpListener& listener,
+                                                  net::SocketAddr   addr) {
+    auto clients = Vec<net::TcpStream>::with_capacity(CHURN_CONNECTIONS);
+    for (usize i = 0; i < CHURN_CONNECTIONS; ++i) {
+        auto client = co_await net::TcpStream::connect(addr);
+        if (client.is_err()) {
+            co_return Err(rstd::move(client).unwrap_err_unchecked());
+        }
+        clients.push(rstd::move(client).unwrap_unchecked());
+    }
+
+    usize accepted = 0;
+    while (accepted < CHURN_CONNECTIONS) {
+        auto batch = co_await listener.accept_batch(CHURN_CONNECTIONS);
+        if (batch.is_err()) {
+            co_return Err(rstd::move(batch).unwrap_err_unchecked());
+        }
+        accepted += batch->len();
+    }
+    co_return Ok(accepted);
+}
+
+auto accept_churn_16(rstd_bench::BenchContext& context) -> bool {
+    auto runtime  = async::Runtime {};
+    auto listener = net::TcpListener::bind_with_backlog(net::SocketAddr::ipv4_loopback(0), 256);
+    if (listener.is_err()) {
+        return false;
+    }
+    auto tcp_listener = rstd::move(listener).unwrap_unchecked();
+    auto addr         = tcp_listener.local_addr();
+    if (addr.is_err()) {
+        return false;
+    }
+    auto local = rstd::move(addr).unwrap_unchecked();
+
+    for (std::uint64_t i = 0; i < context.iterations(); ++i) {
+        auto result = runtime.block_on(connect_and_accept(tcp_listener, local));
+        if (result.is_err() || rstd::move(result).unwrap_unchecked() != CHURN_CONNECTIONS) {
+            return false;
+        }
+    }
+
+    context.set_items_processed(context.iterations() * CHURN_CONNECTIONS);
+    return true;
+}
+
+constexpr usize UDP_DATAGRAMS     = 32;
+constexpr usize UDP_DATAGRAM_SIZE = 64;
+
+struct UdpPair {
+    net::UdpSocket  sender;
+    net::UdpSocket  receiver;
+    net::SocketAddr target;
+};
+
+auto udp_pair() -> Option<UdpPair> {
+    auto sender   = net::UdpSocket::bind(net::SocketAddr::ipv4_loopback(0));
+    auto receiver = net::UdpSocket::bind(net::SocketAddr::ipv4_loopback(0));
+    if (sender.is_err() || receiver.is_err()) {
+        return None();
+    }
+    auto target = receiver->local_addr();
+    if (target.is_err()) {
+        return None();
+    }
+    return Some(UdpPair {
+        rstd::move(sender).unwrap_unchecked(),
+        rstd::move(receiver).unwrap_unchecked(),
+        rstd::move(target).unwrap_unchecked(),
+    });
+}
+
+auto udp_datagrams() -> Vec<bytes::Bytes> {
+    u8   payload[UDP_DATAGRAM_SIZE] {};
+    auto datagrams = Vec<bytes::Bytes>::with_capacity(UDP_DATAGRAMS);
+    for (usize i = 0; i < UDP_DATAGRAMS; ++i) {
+        payload[0] = u8(i);
+        datagrams.push(
+            bytes::Bytes::copy_from_slice(slice<u8>::from_raw_parts(payload, UDP_DATAGRAM_SIZE)));
+    }
+    return datagrams;
+}
+
+async::coro<io::Result<usize>> udp_one_by_one(UdpPair&                 pair,
+                                              Vec<bytes::Bytes> const& datagrams,
+                                              bytes::BytesMut&         buf) {
+    for (usize i = 0; i < datagrams.len(); ++i) {
+        auto sent = co_await pair.sender.send_to(datagrams[i], pair.target);
+        if (sent.is_err()) {
+            co_return Err(rstd::move(sent).unwrap_err_unchecked());
+        }
+    }
+
+    usize received = 0;
+    while (received < datagrams.len()) {
+        buf.clear();
+        auto meta = co_await pair.receiver.recv_from(buf);
+        if (meta.is_err()) {
+            co_return Err(rstd::move(meta).unwrap_err_unchecked());
+        }
+        received += 1;
+    }
+    co_return Ok(received);
+}
+
+async::coro<io::Result<usize>> udp_batched(UdpPair&                 pair,
+                                           Vec<bytes::Bytes> const& datagrams,
+                                           Vec<bytes::BytesMut>&    bufs,
+                                           Vec<net::RecvMeta>&      metas) {
+    auto sent = co_await pair.sender.send_batch(datagrams, Some(pair.target));
+    if (sent.is_err()) {
+        co_return Err(rstd::move(sent).unwrap_err_unchecked());
+    }
+
+    usize received = 0;
+    while (received < *sent) {
+        for (usize i = 0; i < bufs.len(); ++i) bufs[i].clear();
+        auto batch = co_await pair.receiver.recv_batch(bufs, metas);
+        if (batch.is_err()) {
+            co_return Err(rstd::move(batch).unwrap_err_unchecked());
+        }
+        received += *batch;
+    }
+    co_return Ok(received);
+}
+
+auto udp_single_32x64b(rstd_bench::BenchContext& context) -> bool {
+    auto runtime = async::Runtime {};
+    auto pair    = udp_pair();
+    if (pair.is_none()) {
+        return false;
+    }
+    auto datagrams = udp_datagrams();
+    auto buf       = bytes::BytesMut::with_capacity(UDP_DATAGRAM_SIZE);
+
+    for (std::uint64_t i = 0; i < context.iterations(); ++i) {
+        auto result = runtime.block_on(udp_one_by_one(*pair, datagrams, buf));
+        if (result.is_err() || rstd::move(result).unwrap_unchecked() != UDP_DATAGRAMS) {
+            return false;
+        }
+    }
+
+    context.set_items_processed(context.iterations() * UDP_DATAGRAMS);
+    context.set_bytes_processed(context.iterations() * UDP_DATAGRAMS * UDP_DATAGRAM_SIZE);
+    return true;
+}
+
+auto udp_batch_32x64b(rstd_bench::BenchContext& context) -> bool {
+    auto runtime = async::Runtime {};
+    auto pair    = udp_pair();
+    if (pair.is_none()) {
+        return false;
+    }
+    auto datagrams = udp_datagrams();
+    auto bufs      = Vec<bytes::BytesMut>::with_capacity(UDP_DATAGRAMS);
+    auto metas     = Vec<net::RecvMeta>::with_capacity(UDP_DATAGRAMS);
+    for (usize i = 0; i < UDP_DATAGRAMS; ++i) {
+        bufs.push(bytes::BytesMut::with_capacity(UDP_DATAGRAM_SIZE));
+    }
+
+    for (std::uint64_t i = 0; i < context.iterations(); ++i) {
+        auto result = runtime.block_on(udp_batched(*pair, datagrams, bufs, metas));
+        if (result.is_err() || rstd::move(result).unwrap_unchecked() != UDP_DATAGRAMS) {
+            return false;
+        }
+    }
+
+    context.set_items_processed(context.iterations() * UDP_DATAGRAMS);
+    context.set_bytes_processed(context.iterations() * UDP_DATAGRAMS * UDP_DATAGRAM_SIZE);
+    return true;
+}
+
+constexpr usize ECHO_PAIRS = 64;
+
+async::coro<io::Result<empty>> echo_byte(net::UnixStream& server, bytes::Bytes const& payload) {
+    auto buf  = bytes::BytesMut::with_capacity(1);
+    auto read = co_await async::io::read_exact(server, buf, 1);
+    if (read.is_err()) {
+        co_return Err(rstd::move(read).unwrap_err_unchecked());
+    }
+    co_return co_await async::io::write_all(server, payload);
+}
+
+// One byte through each of `ECHO_PAIRS` connections at once: the clients park on their echoes,
+// so each round is delivered as batches of readiness events to waiting tasks.
+async::coro<io::Result<usize>> echo_round(Vec<net::UnixStream>& clients,
+                                          Vec<net::UnixStream>& servers,
+                                          bytes::Bytes const&   payload) {
+    auto handles = Vec<async::JoinHandle<io::Result<empty>>>::with_capacity(servers.len());
+    for (usize i = 0; i < servers.len(); ++i) {
+        handles.push(async::spawn(echo_byte(servers[i], payload)));
+    }
+    for (usize i = 0; i < clients.len(); ++i) {
+        auto written = co_await async::io::write_all(clients[i], payload);
+        if (written.is_err()) {
+            co_return Err(rstd::move(written).unwrap_err_unchecked());
+        }
+    }
+
+    usize echoed = 0;
+    for (usize i = 0; i < clients.len(); ++i) {
+        auto buf  = bytes::BytesMut::with_capacity(1);
+        auto read = co_await async::io::read_exact(clients[i], buf, 1);
+        if (read.is_err()) {
+            co_return Err(rstd::move(read).unwrap_err_unchecked());
+        }
+        auto joined = co_await rstd::move(handles[i]);
+        if (joined.is_err() || rstd::move(joined).unwrap().is_err()) {
+            co_return Err(
+                io::error::Error::from_kind(io::error::ErrorKind { io::error::ErrorKind::Other }));
+        }
+        echoed += 1;
+    }
+    co_return Ok(echoed);
+}
+
+auto unix_echo_64_pairs(rstd_bench::BenchContext& context) -> bool {
+    auto runtime = async::Runtime {};
+    auto clients = Vec<net::UnixStream>::with_capacity(ECHO_PAIRS);
+    auto servers = Vec<net::UnixStream>::with_capacity(ECHO_PAIRS);
+    for (usize i = 0; i < ECHO_PAIRS; ++i) {
+        auto pair = net::UnixStream::pair();
+        if (pair.is_err()) {
+            return false;
+        }
+        auto ends = rstd::move(pair).unwrap_unchecked();
+        clients.push(rstd::move(ends.template get<0>()));
+        servers.push(rstd::move(ends.template get<1>()));
+    }
+    const u8 byte[]  = { 'e' };
+    auto     payload = bytes::Bytes::copy_from_slice(slice<u8>::from_raw_parts(byte, 1));
+
+    for (std::uint64_t i = 0; i < context.iterations(); ++i) {
+        auto result = runtime.block_on(echo_round(clients, servers, payload));
+        if (result.is_err() || rstd::move(result).unwrap_unchecked() != ECHO_PAIRS) {
+            return false;
+        }
+    }
+
+    context.set_items_processed(context.iterations() * ECHO_PAIRS);
+    return true;
+}
+
 const rstd_bench::BenchCase CASES[] = {
     { "net", "loopback_roundtrip_4b", 500, 5, &loopback_roundtrip_4b },
+    { "net", "accept_churn_16", 100, 5, &accept_churn_16 },
+    { "net", "udp_single_32x64b", 500, 5, &udp_single_32x64b },
+    { "net", "udp_batch_32x64b", 500, 5, &udp_batch_32x64b },
+    { "net", "unix_echo_64_pairs", 200, 5, &unix_echo_64_pairs },
 };
 
 } // namespace
@@ -0,0 +1,77 @@
+#include "benchmark.hpp"
+
+import rstd;
+
+using namespace rstd;
+using namespace rstd::prelude;
+using ::alloc::vec::Vec;
+
+namespace
+{
+
+constexpr usize SORT_LEN = 100'000;
+
+enum class Shape { Random, Sorted, Reversed, FewUnique };
+enum class Algo { Unstable, Stable, Radix, Parallel };
+
+auto make_input(Shape shape) -> Vec<u64> {
+    auto v     = Vec<u64>::with_capacity(SORT_LEN);
+    u64  state = 0x9e3779b97f4a7c15ull;
+    for (usize i = 0; i < SORT_LEN; ++i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        switch (shape) {
+        case Shape::Random: v.push(state); break;
+        case Shape::Sorted: v.push(u64(i)); break;
+        case Shape::Reversed: v.push(u64(SORT_LEN - i)); break;
+        case Shape::FewUnique: v.push(state % 16); break;
+        }
+    }
+    return v;
+}
+
+// Every iteration restores the unsorted input with one memcpy, which is included in the time.
+template<Shape S, Algo A>
+auto sort_case(rstd_bench::BenchContext& context) -> bool {
+    auto source = make_input(S);
+    auto work   = make_input(S);
+
+    for (std::uint64_t i = 0; i < context.iterations(); ++i) {
+        rstd::mem::memcpy(work.deref_mut().p, source.as_slice().p, SORT_LEN * sizeof(u64));
+        if constexpr (A == Algo::Unstable) rstd::slice_::sort_unstable(work.deref_mut());
+        if constexpr (A == Algo::Stable) rstd::slice_::sort(work.deref_mut());
+        if constexpr (A == Algo::Radix) rstd::slice_::radix_sort(work.deref_mut());
+        if constexpr (A == Algo::Parallel) rstd::slice_::par_sort(work.deref_mut(), 4);
+        rstd::hint::black_box(work[SORT_LEN / 2]);
+    }
+
+    context.set_items_processed(context.iterations() * SORT_LEN);
+    context.set_bytes_processed(context.iterations() * SORT_LEN * sizeof(u64));
+    return rstd::slice_::is_sorted(work.as_slice());
+}
+
+const rstd_bench::BenchCase CASES[] = {
+    { "sort", "unstable_random_100k", 50, 2, &sort_case<Shape::Random, Algo::Unstable> },
+    { "sort", "unstable_sorted_100k", 50, 2, &sort_case<Shape::Sorted, Algo::Unstable> },
+    { "sort", "unstable_reversed_100k", 50, 2, &sort_case<Shape::Reversed, Algo::Unstable> },
+    { "sort", "unstable_few_unique_100k", 50, 2, &sort_case<Shape::FewUnique, Algo::Unstable> },
+    { "sort", "stable_random_100k", 50, 2, &sort_case<Shape::Random, Algo::Stable> },
+    { "sort", "stable_sorted_100k", 50, 2, &sort_case<Shape::Sorted, Algo::Stable> },
+    { "sort", "stable_reversed_100k", 50, 2, &sort_case<Shape::Reversed, Algo::Stable> },
+    { "sort", "stable_few_unique_100k", 50, 2, &sort_case<Shape::FewUnique, Algo::Stable> },
+    { "sort", "radix_random_100k", 50, 2, &sort_case<Shape::Random, Algo::Radix> },
+    { "sort", "radix_few_unique_100k", 50, 2, &sort_case<Shape::FewUnique, Algo::Radix> },
+    { "sort", "par_sort_random_100k_x4", 50, 2, &sort_case<Shape::Random, Algo::Parallel> },
+};
+
+} // namespace
+
+namespace rstd_bench
+{
+
+auto sort_benchmarks() -> BenchList {
+    return BenchList { CASES, sizeof(CASES) / sizeof(CASES[0]) };
+}
+
+} // namespace rstd_bench
@@ -0,0 +1,186 @@
+module;
+#include <rstd/macro.hpp>
+export module rstd.alloc:arc_str;
+export import :alloc;
+export import :string;
+export import rstd.core;
+
+using rstd::alloc::Layout;
+using rstd::sync::atomic::Atomic;
+using rstd::sync::atomic::Ordering;
+namespace ffi = rstd::ffi;
+using namespace rstd::prelude;
+
+namespace alloc::string
+{
+
+/// An immutable, atomically reference-counted UTF-8 string.
+///
+/// The handle is a single pointer to one allocation holding the count, the length and the
+/// bytes, so `clone` is one relaxed increment and never copies or allocates. Use it for strings
+/// that are built once and then shared widely: keys, names, interned identifiers. The empty
+/// string is a null handle and owns nothing.
+export class ArcStr {
+    struct Header {
+        Atomic<usize> strong { 1 };
+        usize         len;
+    };
+
+    Header* m_ptr { nullptr };
+
+    explicit ArcStr(Header* p) noexcept: m_ptr(p) {}
+
+    static auto layout_for(usize len) -> Layout {
+        // One trailing NUL so `as_ref` can hand the bytes to C.
+        return Layout::from_size_align(sizeof(Header) + len + 1, alignof(Header)).unwrap();
+    }
+
+    auto bytes_ptr() const noexcept -> const u8* {
+        return reinterpret_cast<const u8*>(m_ptr + 1);
+    }
+
+    void release() noexcept {
+        if (m_ptr == nullptr) return;
+        if (m_ptr->strong.fetch_sub(1, Ordering::Release) == 1) {
+            rstd::sync::atomic::fence(Ordering::Acquire);
+            auto layout = layout_for(m_ptr->len);
+            rstd::destroy_at(m_ptr);
+            ::alloc::dealloc(mut_ptr<u8>::from_raw_parts(reinterpret_cast<u8*>(m_ptr)), layout);
+        }
+        m_ptr = nullptr;
+    }
+
+public:
+    USE_TRAIT(ArcStr)
+
+    constexpr ArcStr() noexcept = default;
+    ArcStr(const ArcStr&)            = delete;
+    ArcStr& operator=(const ArcStr&) = delete;
+    ArcStr(ArcStr&& o) noexcept: m_ptr(rstd::exchange(o.m_ptr, nullptr)) {}
+    ArcStr& operator=(ArcStr&& o) noexcept {
+        if (this != &o) {
+            release();
+            m_ptr = rstd::exchange(o.m_ptr, nullptr);
+        }
+        return *this;
+    }
+    ~ArcStr() { release(); }
+
+    /// Copies `s` into a new shared allocation.
+    static auto make(ref<str> s) -> ArcStr {
+        if (s.size() == 0) return {};
+        auto layout = layout_for(s.size());
+        auto raw    = ::alloc::alloc(layout).as_raw_ptr();
+        if (raw == nullptr) ::alloc::handle_alloc_error(layout);
+
+        auto* header = rstd::construct_at(reinterpret_cast<Header*>(raw));
+        header->len = s.size();
+        rstd::mem::memcpy(raw + sizeof(Header), s.data(), s.size());
+        raw[sizeof(Header) + s.size()] = 0;
+        return ArcStr { header };
+    }
+
+    /// Copies a null-terminated C string into a new shared allocation.
+    static auto make(const char* s) -> ArcStr { return make(ref<str>(s)); }
+
+    /// Copies the contents of `s` into a new shared allocation.
+    static auto from(const String& s) -> ArcStr { return make(s.as_str()); }
+
+    /// Returns another handle to the same bytes.
+    auto clone() const noexcept -> ArcStr {
+        if (m_ptr != nullptr) {
+            [[maybe_unused]]
+            auto old = m_ptr->strong.fetch_add(1, Ordering::Relaxed);
+            debug_assert(old < rstd::numeric_limits<usize>::max() / 2);
+        }
+        return ArcStr { m_ptr };
+    }
+
+    void clone_from(const ArcStr& source) { *this = source.clone(); }
+
+    /// Returns an owned, mutable copy.
+    auto to_string() const -> String { return String::make(as_str()); }
+
+    /// Returns the byte length.
+    auto len() const noexcept -> usize { return m_ptr == nullptr ? 0 : m_ptr->len; }
+    /// Returns `true` if the string has no bytes.
+    auto is_empty() const noexcept -> bool { return len() == 0; }
+
+    /// Number of handles sharing this allocation; 0 for the empty string.
+    auto strong_count() const noexcept -> usize {
+        return m_ptr == nullptr ? 0 : m_ptr->strong.load(Ordering::Acquire);
+    }
+
+    /// Returns `true` if both handles point at the same allocation.
+    auto ptr_eq(const ArcStr& other) const noexcept -> bool { return m_ptr == other.m_ptr; }
+
+    auto as_str() const noexcept -> ref<str> {
+        if (m_ptr == nullptr) return ref<str>("");
+        return ref<str>::from_raw_parts(bytes_ptr(), m_ptr->len);
+    }
+    operator ref<str>() const noexcept { return as_str(); }
+
+    /// Returns a `CStr` view; the bytes are always followed by a NUL.
+    auto as_ref() const noexcept -> ref<ffi::CStr> {
+        auto s = as_str();
+        return ref<ffi::CStr>::from_raw_parts(as_cast<ffi::CStr const*>(s.data()), s.size());
+    }
+
+    auto as_raw_ptr() const noexcept -> const u8* { return as_str().data(); }
+    auto begin() const noexcept -> const char* {
+        return rstd::bit_cast<const char*>(as_raw_ptr());
+    }
+    auto end() const noexcept -> const char* { return begin() + len(); }
+    auto data() const noexcept -> const char* { return begin(); }
+    auto size() const noexcept -> usize { return len(); }
+
+    friend auto operator<=>(const ArcStr& a, const ArcStr& b) noexcept {
+        auto x = a.as_str();
+        auto y = b.as_str();
+        return rstd::lexicographical_compare_three_way(x.begin(), x.end(), y.begin(), y.end());
+    }
+    friend bool operator==(const ArcStr& a, const ArcStr& b) noexcept {
+        return a.ptr_eq(b) ||
+               (a.len() == b.len() && rstd::mem::memcmp(a.begin(), b.begin(), a.len()) == 0);
+    }
+    friend bool operator==(const ArcStr& a, ref<str> b) noexcept {
+        return a.len() == b.size() && rstd::mem::memcmp(a.begin(), b.begin(), a.len()) == 0;
+    }
+    friend bool operator==(ref<str> a, const ArcStr& b) noexcept { return b == a; }
+};
+
+/// Alias matching the name used by other string-sharing libraries.
+export using SharedStr = ArcStr;
+
+} // namespace alloc::string
+
+using ::alloc::string::ArcStr;
+
+namespace rstd
+{
+template<>
+struct Impl<hash::Hash, ArcStr> : ImplBase<ArcStr> {
+    void hash(hash::DefaultHasher& state) const noexcept {
+        state.write(this->self().as_raw_ptr(), this->self().size());
+    }
+};
+
+template<>
+struct Impl<fmt::Display, ArcStr> : ImplBase<ArcStr> {
+    auto fmt(fmt::Formatter& f) const -> bool { return f.pad(this->self().as_str()); }
+};
+
+template<>
+struct Impl<fmt::Debug, ArcStr> : ImplBase<ArcStr> {
+    auto fmt(fmt::Formatter& f) const -> bool {
+        auto value = this->self().as_str();
+        return as<fmt::Debug>(value).fmt(f);
+    }
+};
+
+template<mtp::same_as<cmp::PartialEq<ArcStr>> T, mtp::same_as<ArcStr> A>
+struct Impl<T, A> : DefaultInImpl<T, A> {
+    auto eq(const ArcStr& other) const noexcept -> bool { return this->self() == other; }
+};
+
+} // namespace rstd
@@ -0,0 +1,313 @@
+module;
+#include <rstd/macro.hpp>
+
+export module rstd.alloc:collections.binary_heap;
+export import :vec;
+export import :collections.slab;
+export import rstd.core;
+
+using ::alloc::vec::Vec;
+using namespace rstd::prelude;
+
+namespace alloc::collections
+{
+
+export template<typename T>
+struct DefaultLess {
+    auto operator()(const T& left, const T& right) const noexcept -> bool { return left < right; }
+};
+
+export template<typename T, typename Less = DefaultLess<T>>
+class BinaryHeap;
+
+/// Mutable access to the greatest element of a `BinaryHeap`; the heap is repaired when the
+/// guard is dropped, so the element may be changed freely through it.
+export template<typename T, typename Less>
+class PeekMut {
+    BinaryHeap<T, Less>* heap;
+
+    explicit PeekMut(BinaryHeap<T, Less>* owner) noexcept: heap(owner) {}
+
+    friend class BinaryHeap<T, Less>;
+
+public:
+    USE_TRAIT(PeekMut)
+
+    using Target = T;
+
+    PeekMut(const PeekMut&)            = delete;
+    PeekMut& operator=(const PeekMut&) = delete;
+    PeekMut(PeekMut&& other) noexcept: heap(rstd::exchange(other.heap, nullptr)) {}
+    PeekMut& operator=(PeekMut&&)      = delete;
+    ~PeekMut() {
+        if (heap != nullptr) heap->sift_down_range(0, heap->len());
+    }
+
+    auto deref() const noexcept -> rstd::ref<T> {
+        return rstd::ref<T>::from_raw_parts(heap->data.data());
+    }
+    auto deref_mut() const noexcept -> rstd::mut_ref<T> {
+        return rstd::mut_ref<T>::from_raw_parts(heap->data.data());
+    }
+
+    /// Removes the peeked element from the heap and returns it.
+    auto pop() && -> T {
+        auto* owner = rstd::exchange(heap, nullptr);
+        return owner->pop().unwrap_unchecked();
+    }
+};
+
+/// A priority queue implemented as a binary max-heap over a `Vec`.
+///
+/// `Less` orders the elements and the greatest one is on top; pass a reversed comparison for
+/// a min-heap. `push` and `pop` are O(log n), `peek` is O(1), and building from a `Vec` is
+/// O(n). Elements are moved through a hole while sifting, so each level costs one move rather
+/// than a swap.
+export template<typename T, typename Less>
+class BinaryHeap {
+    Vec<T> data;
+    Less   less;
+
+    friend class PeekMut<T, Less>;
+
+    void sift_up(usize pos) {
+        T* d    = data.data();
+        T  elem = rstd::move(d[pos]);
+        while (pos > 0) {
+            usize parent = (pos - 1) / 2;
+            if (! less(d[parent], elem)) break;
+            d[pos] = rstd::move(d[parent]);
+            pos    = parent;
+        }
+        d[pos] = rstd::move(elem);
+    }
+
+    void sift_down_range(usize pos, usize end) {
+        if (pos >= end) return;
+        T*    d     = data.data();
+        T     elem  = rstd::move(d[pos]);
+        usize child = 2 * pos + 1;
+        while (child < end) {
+            if (child + 1 < end && less(d[child], d[child + 1])) ++child;
+            if (! less(elem, d[child])) break;
+            d[pos] = rstd::move(d[child]);
+            pos    = child;
+            child  = 2 * pos + 1;
+        }
+        d[pos] = rstd::move(elem);
+    }
+
+    void rebuild() {
+        usize n = data.len();
+        for (usize i = n / 2; i-- > 0;) sift_down_range(i, n);
+    }
+
+public:
+    USE_TRAIT(BinaryHeap)
+
+    BinaryHeap(): data(Vec<T>::make()), less() {}
+    explicit BinaryHeap(Less order): data(Vec<T>::make()), less(rstd::move(order)) {}
+    BinaryHeap(const BinaryHeap&)                = delete;
+    BinaryHeap& operator=(const BinaryHeap&)     = delete;
+    BinaryHeap(BinaryHeap&&) noexcept            = default;
+    BinaryHeap& operator=(BinaryHeap&&) noexcept = default;
+
+    static auto make() -> BinaryHeap { return {}; }
+    static auto with_capacity(usize capacity) -> BinaryHeap {
+        auto heap = BinaryHeap {};
+        heap.data = Vec<T>::with_capacity(capacity);
+        return heap;
+    }
+
+    /// Turns `values` into a heap in place, in O(n).
+    static auto from_vec(Vec<T> values) -> BinaryHeap {
+        auto heap = BinaryHeap {};
+        heap.data = rstd::move(values);
+        heap.rebuild();
+        return heap;
+    }
+
+    auto len() const noexcept -> usize { return data.len(); }
+    auto is_empty() const noexcept -> bool { return data.is_empty(); }
+    auto capacity() const noexcept -> usize { return data.capacity(); }
+
+    void reserve(usize additional) { data.reserve(additional); }
+    void clear() { data.clear(); }
+
+    void push(T value) {
+        data.push(rstd::move(value));
+        sift_up(data.len() - 1);
+    }
+
+    auto pop() -> Option<T> {
+        auto last = data.pop();
+        if (last.is_none() || data.is_empty()) return last;
+        auto top = rstd::move(data[0]);
+        data[0]  = rstd::move(*last);
+        sift_down_range(0, data.len());
+        return Some(rstd::move(top));
+    }
+
+    auto peek() const -> Option<rstd::ref<T>> {
+        if (data.is_empty()) return None();
+        return Some(rstd::ref<T>::from_raw_parts(data.data()));
+    }
+
+    auto peek_mut() -> Option<PeekMut<T, Less>> {
+        if (data.is_empty()) return None();
+        return Some(PeekMut<T, Less>(this));
+    }
+
+    /// The elements in heap order, which is unspecified beyond the top being first.
+    auto as_slice() const -> slice<T> { return slice<T>::from_raw_parts(data.data(), data.len()); }
+    auto iter() const -> rstd::iter::SliceIter<T> { return data.iter(); }
+
+    auto into_vec() && -> Vec<T> { return rstd::move(data); }
+
+    /// Consumes the heap and returns its elements sorted ascending under `Less`, in place.
+    auto into_sorted_vec() && -> Vec<T> {
+        T* d = data.data();
+        for (usize end = data.len(); end > 1;) {
+            --end;
+            T top  = rstd::move(d[0]);
+            d[0]   = rstd::move(d[end]);
+            d[end] = rstd::move(top);
+            sift_down_range(0, end);
+        }
+        return rstd::move(data);
+    }
+};
+
+/// A binary heap whose elements keep a stable handle, so any of them can be re-prioritized
+/// or removed in O(log n) after insertion (decrease-key).
+///
+/// Handles are `SlotKey`s: a handle whose element was popped or removed simply stops
+/// matching. Suited to timer queues, where a deadline is cancelled or moved long after it
+/// was armed.
+export template<typename T, typename Less = DefaultLess<T>>
+class HandleHeap {
+    struct Entry {
+        T       value;
+        SlotKey handle;
+    };
+
+    Vec<Entry>     heap;
+    SlotMap<usize> positions;
+    Less           less;
+
+    void place(usize pos, Entry entry) {
+        *positions.get_mut(entry.handle).unwrap_unchecked() = pos;
+        heap[pos]                                           = rstd::move(entry);
+    }
+
+    void sift_up(usize pos) {
+        Entry elem = rstd::move(heap[pos]);
+        while (pos > 0) {
+            usize parent = (pos - 1) / 2;
+            if (! less(heap[parent].value, elem.value)) break;
+            place(pos, rstd::move(heap[parent]));
+            pos = parent;
+        }
+        place(pos, rstd::move(elem));
+    }
+
+    void sift_down(usize pos) {
+        usize end   = heap.len();
+        Entry elem  = rstd::move(heap[pos]);
+        usize child = 2 * pos + 1;
+        while (child < end) {
+            if (child + 1 < end && less(heap[child].value, heap[child + 1].value)) ++child;
+            if (! less(elem.value, heap[child].value)) break;
+            place(pos, rstd::move(heap[child]));
+            pos   = child;
+            child = 2 * pos + 1;
+        }
+        place(pos, rstd::move(elem));
+    }
+
+    void repair(usize pos) {
+        if (pos > 0 && less(heap[(pos - 1) / 2].value, heap[pos].value)) {
+            sift_up(pos);
+        } else {
+            sift_down(pos);
+        }
+    }
+
+    auto remove_at(usize pos) -> T {
+        auto last = heap.pop().unwrap_unchecked();
+        if (pos == heap.len()) {
+            (void)positions.remove(last.handle);
+            return rstd::move(last.value);
+        }
+        auto removed = rstd::move(heap[pos]);
+        (void)positions.remove(removed.handle);
+        place(pos, rstd::move(last));
+        repair(pos);
+        return rstd::move(removed.value);
+    }
+
+public:
+    HandleHeap(): heap(Vec<Entry>::make()), positions(SlotMap<usize>::make()), less() {}
+    HandleHeap(const HandleHeap&)                = delete;
+    HandleHeap& operator=(const HandleHeap&)     = delete;
+    HandleHeap(HandleHeap&&) noexcept            = default;
+    HandleHeap& operator=(HandleHeap&&) noexcept = default;
+
+    static auto make() -> HandleHeap { return {}; }
+
+    auto len() const noexcept -> usize { return heap.len(); }
+    auto is_empty() const noexcept -> bool { return heap.is_empty(); }
+    auto contains(SlotKey handle) const noexcept -> bool { return positions.contains_key(handle); }
+
+    auto push(T value) -> SlotKey {
+        usize pos    = heap.len();
+        auto  handle = positions.insert(pos);
+        heap.push(Entry { rstd::move(value), handle });
+        sift_up(pos);
+        return handle;
+    }
+
+    auto peek() const -> Option<rstd::ref<T>> {
+        if (heap.is_empty()) return None();
+        return Some(rstd::ref<T>::from_raw_parts(rstd::addressof(heap[0].value)));
+    }
+
+    auto peek_handle() const -> Option<SlotKey> {
+        if (heap.is_empty()) return None();
+        return Some(heap[0].handle);
+    }
+
+    auto pop() -> Option<T> {
+        if (heap.is_empty()) return None();
+        return Some(remove_at(0));
+    }
+
+    auto get(SlotKey handle) const -> Option<rstd::ref<T>> {
+        auto pos = positions.get(handle);
+        if (pos.is_none()) return None();
+        return Some(rstd::ref<T>::from_raw_parts(rstd::addressof(heap[**pos].value)));
+    }
+
+    /// Replaces the element behind `handle` and restores heap order; returns the old value.
+    auto update(SlotKey handle, T value) -> Option<T> {
+        auto pos = positions.get(handle);
+        if (pos.is_none()) return None();
+        usize at  = **pos;
+        auto  old = rstd::exchange(heap[at].value, rstd::move(value));
+        repair(at);
+        return Some(rstd::move(old));
+    }
+
+    auto remove(SlotKey handle) -> Option<T> {
+        auto pos = positions.get(handle);
+        if (pos.is_none()) return None();
+        return Some(remove_at(**pos));
+    }
+
+    void clear() {
+        heap.clear();
+        positions.clear();
+    }
+};
+
+} // namespace alloc::collections
@@ -0,0 +1,272 @@
+module;
+#include <rstd/macro.hpp>
+
+export module rstd.alloc:collections.bit_set;
+export import :vec;
+export import rstd.core;
+
+using ::alloc::vec::Vec;
+using namespace rstd::prelude;
+
+namespace alloc::collections
+{
+
+inline constexpr usize WORD_BITS = 64;
+
+inline constexpr auto words_for(usize bits) noexcept -> usize {
+    return (bits + WORD_BITS - 1) / WORD_BITS;
+}
+
+inline constexpr auto bit_mask(usize index) noexcept -> u64 {
+    return u64(1) << (index % WORD_BITS);
+}
+
+/// Yields the indices of the set bits of a word slice, lowest first, one word at a time.
+export class BitOnes : public rstd::DefaultInClass<BitOnes, rstd::iter::Iterator> {
+    const u64* words;
+    usize      word_count;
+    usize      word_index { 0 };
+    u64        current { 0 };
+
+public:
+    using Item = usize;
+
+    BitOnes(const u64* source, usize count): words(source), word_count(count) {
+        if (word_count != 0) current = words[0];
+    }
+
+    auto next() -> Option<usize> {
+        while (current == 0) {
+            if (++word_index >= word_count) return None();
+            current = words[word_index];
+        }
+        usize bit = usize(__builtin_ctzll(current));
+        current &= current - 1;
+        return Some(word_index * WORD_BITS + bit);
+    }
+};
+
+/// A growable vector of bits packed 64 to a word.
+///
+/// Bits past `len` in the last word are kept clear, so whole-word operations such as
+/// `count_ones` never need masking.
+export class BitVec {
+    Vec<u64> words;
+    usize    length { 0 };
+
+    void clear_tail() {
+        if (length % WORD_BITS != 0) words[words.len() - 1] &= bit_mask(length) - 1;
+    }
+
+public:
+    BitVec(): words(Vec<u64>::make()) {}
+    BitVec(const BitVec&)                = delete;
+    BitVec& operator=(const BitVec&)     = delete;
+    BitVec(BitVec&&) noexcept            = default;
+    BitVec& operator=(BitVec&&) noexcept = default;
+
+    static auto make() -> BitVec { return {}; }
+
+    /// A vector of `len` bits, all equal to `value`.
+    static auto repeat(bool value, usize len) -> BitVec {
+        auto bits = BitVec {};
+        bits.words.resize(words_for(len), value ? ~u64(0) : u64(0));
+        bits.length = len;
+        bits.clear_tail();
+        return bits;
+    }
+
+    auto clone() const -> BitVec {
+        auto bits   = BitVec {};
+        bits.words  = words.clone();
+        bits.length = length;
+        return bits;
+    }
+
+    auto len() const noexcept -> usize { return length; }
+    auto is_empty() const noexcept -> bool { return length == 0; }
+
+    auto get(usize index) const noexcept -> Option<bool> {
+        if (index >= length) return None();
+        return Some((words[index / WORD_BITS] & bit_mask(index)) != 0);
+    }
+
+    /// Sets bit `index`, panicking if out of bounds.
+    void set(usize index, bool value) {
+        if (index >= length) rstd::panic { "BitVec index out of bounds" };
+        u64 mask = bit_mask(index);
+        if (value) {
+            words[index / WORD_BITS] |= mask;
+        } else {
+            words[index / WORD_BITS] &= ~mask;
+        }
+    }
+
+    void push(bool value) {
+        if (length % WORD_BITS == 0) words.push(0);
+        ++length;
+        set(length - 1, value);
+    }
+
+    auto pop() -> Option<bool> {
+        if (length == 0) return None();
+        auto value = get(length - 1);
+        --length;
+        if (length % WORD_BITS == 0) {
+            (void)words.pop();
+        } else {
+            clear_tail();
+        }
+        return value;
+    }
+
+    /// Grows or shrinks to `new_len` bits, filling new ones with `value`.
+    void resize(usize new_len, bool value) {
+        if (new_len < length) {
+            words.truncate(words_for(new_len));
+            length = new_len;
+            clear_tail();
+            return;
+        }
+        if (value) {
+            // Fill the unused top of the current last word before adding whole words.
+            if (length % WORD_BITS != 0) words[words.len() - 1] |= ~(bit_mask(length) - 1);
+        }
+        words.resize(words_for(new_len), value ? ~u64(0) : u64(0));
+        length = new_len;
+        clear_tail();
+    }
+
+    void fill(bool value) {
+        for (auto& word : words) word = value ? ~u64(0) : u64(0);
+        clear_tail();
+    }
+
+    void clear() {
+        words.clear();
+        length = 0;
+    }
+
+    auto count_ones() const noexcept -> usize {
+        usize count = 0;
+        for (auto word : words) count += usize(__builtin_popcountll(word));
+        return count;
+    }
+    auto count_zeros() const noexcept -> usize { return length - count_ones(); }
+
+    auto any() const noexcept -> bool {
+        for (auto word : words) {
+            if (word != 0) return true;
+        }
+        return false;
+    }
+
+    /// Indices of the set bits, lowest first.
+    auto iter_ones() const -> BitOnes { return BitOnes(words.data(), words.len()); }
+
+    auto as_words() const -> slice<u64> {
+        return slice<u64>::from_raw_parts(words.data(), words.len());
+    }
+};
+
+/// A set of small unsigned integers stored as one bit per possible member.
+///
+/// Membership tests and updates are a shift and a mask; `len` and iteration work a word at a
+/// time with popcount and count-trailing-zeros, and the set operations combine whole words.
+/// Memory is proportional to the largest member, so it suits dense ids such as worker or
+/// slot indices.
+export class BitSet {
+    Vec<u64> words;
+
+    void ensure_words(usize count) {
+        if (words.len() < count) words.resize(count, 0);
+    }
+
+public:
+    BitSet(): words(Vec<u64>::make()) {}
+    BitSet(const BitSet&)                = delete;
+    BitSet& operator=(const BitSet&)     = delete;
+    BitSet(BitSet&&) noexcept            = default;
+    BitSet& operator=(BitSet&&) noexcept = default;
+
+    static auto make() -> BitSet { return {}; }
+    static auto with_capacity(usize bits) -> BitSet {
+        auto set = BitSet {};
+        set.words.resize(words_for(bits), 0);
+        return set;
+    }
+
+    auto clone() const -> BitSet {
+        auto set  = BitSet {};
+        set.words = words.clone();
+        return set;
+    }
+
+    /// Adds `value`; returns `true` if it was not already present.
+    auto insert(usize value) -> bool {
+        ensure_words(value / WORD_BITS + 1);
+        u64& word  = words[value / WORD_BITS];
+        u64  mask  = bit_mask(value);
+        bool added = (word & mask) == 0;
+        word |= mask;
+        return added;
+    }
+
+    /// Removes `value`; returns `true` if it was present.
+    auto remove(usize value) -> bool {
+        if (value / WORD_BITS >= words.len()) return false;
+        u64& word    = words[value / WORD_BITS];
+        u64  mask    = bit_mask(value);
+        bool present = (word & mask) != 0;
+        word &= ~mask;
+        return present;
+    }
+
+    auto contains(usize value) const noexcept -> bool {
+        return value / WORD_BITS < words.len() && (words[value / WORD_BITS] & bit_mask(value)) != 0;
+    }
+
+    auto len() const noexcept -> usize {
+        usize count = 0;
+        for (auto word : words) count += usize(__builtin_popcountll(word));
+        return count;
+    }
+
+    auto is_empty() const noexcept -> bool {
+        for (auto word : words) {
+            if (word != 0) return false;
+        }
+        return true;
+    }
+
+    void clear() { words.clear(); }
+
+    void union_with(const BitSet& other) {
+        ensure_words(other.words.len());
+        for (usize i = 0; i < other.words.len(); ++i) words[i] |= other.words[i];
+    }
+
+    void intersect_with(const BitSet& other) {
+        for (usize i = 0; i < words.len(); ++i) {
+            words[i] &= i < other.words.len() ? other.words[i] : u64(0);
+        }
+    }
+
+    void difference_with(const BitSet& other) {
+        usize n = words.len() < other.words.len() ? words.len() : other.words.len();
+        for (usize i = 0; i < n; ++i) words[i] &= ~other.words[i];
+    }
+
+    auto is_subset(const BitSet& other) const noexcept -> bool {
+        for (usize i = 0; i < words.len(); ++i) {
+            u64 theirs = i < other.words.len() ? other.words[i] : u64(0);
+            if ((words[i] & ~theirs) != 0) return false;
+        }
+        return true;
+    }
+
+    /// Members in ascending order.
+    auto iter() const -> BitOnes { return BitOnes(words.data(), words.len()); }
+};
+
+} // namespace alloc::collections
@@ -6,7 +6,6 @@ export import :vec;
 export import :collections.btree_node;
 export import rstd.core;
 
-using ::alloc::boxed::Box;
 using ::alloc::vec::Vec;
 using namespace rstd::prelude;
 
@@ -33,6 +32,8 @@ export template<typename K, typename V>
 class BTreeMapValues;
 export template<typename K, typename V>
 class BTreeMapValuesMut;
+export template<typename K, typename V, typename Q>
+class BTreeMapRange;
 
 export template<typename K, typename V>
 class BTreeMapIter : public rstd::DefaultInClass<BTreeMapIter<K, V>, rstd::iter::Iterator> {
@@ -299,37 +300,137 @@ public:
     auto len() const -> usize { return inner.len(); }
 };
 
+/// Iterator over the entries whose keys lie in `[start, end)`, in ascending order.
+export template<typename K, typename V, typename Q>
+class BTreeMapRange : public rstd::DefaultInClass<BTreeMapRange<K, V, Q>, rstd::iter::Iterator> {
+    using TreeNode = Node<K, V>;
+    using Frame    = BTreeMapFrame<const TreeNode>;
+
+    Vec<Frame> front;
+    Q          end;
+
+    void push_left(const TreeNode* node) {
+        while (node != nullptr) {
+            front.push(Frame { node, 0 });
+            if (node->leaf) break;
+            node = node->child(0);
+        }
+    }
+
+public:
+    using Item = rstd::tuple<rstd::ref<K>, rstd::ref<V>>;
+
+    /// `stack` must already point at the first entry not less than the start bound.
+    BTreeMapRange(Vec<Frame> stack, Q upper): front(rstd::move(stack)), end(rstd::move(upper)) {}
+
+    auto next() -> Option<Item> {
+        while (! front.is_empty()) {
+            auto& frame = front[front.len() - 1];
+            auto* node  = frame.node;
+            if (frame.index == node->len) {
+                front.pop();
+                continue;
+            }
+            usize index = frame.index;
+            if (! (node->key(index) < end)) {
+                front.clear();
+                return None();
+            }
+            ++frame.index;
+            if (! node->leaf) push_left(node->child(index + 1));
+            return Some(Item(rstd::ref<K>::from_raw_parts(rstd::addressof(node->key(index))),
+                             rstd::ref<V>::from_raw_parts(rstd::addressof(node->value(index)))));
+        }
+        return None();
+    }
+};
+
+// Merges two ascending entry streams. On equal keys the left entry comes first, so a
+// last-wins consumer keeps the right one.
+template<typename K, typename V>
+class BTreeMergeIter : public rstd::DefaultInClass<BTreeMergeIter<K, V>, rstd::iter::Iterator> {
+    BTreeMapIntoIter<K, V>    left;
+    BTreeMapIntoIter<K, V>    right;
+    Option<rstd::tuple<K, V>> left_peek;
+    Option<rstd::tuple<K, V>> right_peek;
+
+public:
+    using Item = rstd::tuple<K, V>;
+
+    BTreeMergeIter(BTreeMapIntoIter<K, V> l, BTreeMapIntoIter<K, V> r)
+        : left(rstd::move(l)),
+          right(rstd::move(r)),
+          left_peek(left.next()),
+          right_peek(right.next()) {}
+
+    auto next() -> Option<Item> {
+        bool take_left =
+            left_peek.is_some() &&
+            (right_peek.is_none() ||
+             ! (right_peek->template get<0>() < left_peek->template get<0>()));
+        if (take_left) {
+            auto out  = left_peek.take();
+            left_peek = left.next();
+            return out;
+        }
+        if (right_peek.is_none()) return None();
+        auto out   = right_peek.take();
+        right_peek = right.next();
+        return out;
+    }
+};
+
 export template<typename K, typename V>
 class BTreeMap {
-    using TreeNode = Node<K, V>;
-    using Entry    = rstd::tuple<K, V>;
+    using TreeNode  = Node<K, V>;
+    using OwnedNode = BoxedNode<K, V>;
+    using Entry     = rstd::tuple<K, V>;
+
+    static constexpr usize B        = TreeNode::B;
+    static constexpr usize CAPACITY = TreeNode::CAPACITY;
 
-    Option<Box<TreeNode>> root;
-    usize                 length;
+    OwnedNode root;
+    usize     length;
 
     template<typename Q>
     static bool equivalent(const K& left, const Q& right) {
         return ! (left < right) && ! (right < left);
     }
 
+    /// Index of the first key in `node` that is not less than `key`.
     template<typename Q>
     static auto lower_bound(const TreeNode& node, const Q& key) -> usize {
-        usize index = 0;
-        while (index < node.len && node.key(index) < key) ++index;
-        return index;
+        if constexpr (rstd::mtp::is_int<K> && rstd::mtp::same_as<Q, K>) {
+            // Counting the smaller keys has no data-dependent branch, and the loop vectorizes
+            // over the contiguous key array.
+            const K* keys  = node.key_data();
+            usize    index = 0;
+            for (usize i = 0; i < node.len; ++i) index += usize(keys[i] < key);
+            return index;
+        } else {
+            // Other keys (strings, tuples) are costly to compare, so probe as few as possible.
+            usize low  = 0;
+            usize high = node.len;
+            while (low < high) {
+                usize mid = low + (high - low) / 2;
+                if (node.key(mid) < key)
+                    low = mid + 1;
+                else
+                    high = mid;
+            }
+            return low;
+        }
     }
 
-    auto root_node() noexcept -> TreeNode* { return root.is_some() ? root->get() : nullptr; }
-    auto root_node() const noexcept -> const TreeNode* {
-        return root.is_some() ? root->as_ptr().as_raw_ptr() : nullptr;
-    }
+    auto root_node() noexcept -> TreeNode* { return root.get(); }
+    auto root_node() const noexcept -> const TreeNode* { return root.get(); }
 
-    static void insert_edge(TreeNode& node, usize index, Box<TreeNode> edge, usize active) {
+    static void insert_edge(TreeNode& node, usize index, OwnedNode edge, usize active) {
         for (usize i = active; i > index; --i) node.move_edge(i - 1, i);
         node.write_edge(index, rstd::move(edge));
     }
 
-    static auto remove_edge(TreeNode& node, usize index, usize active) -> Box<TreeNode> {
+    static auto remove_edge(TreeNode& node, usize index, usize active) -> OwnedNode {
         auto removed = node.take_edge(index);
         for (usize i = index; i + 1 < active; ++i) node.move_edge(i + 1, i);
         return removed;
@@ -337,7 +438,7 @@ class BTreeMap {
 
     static void split_child(TreeNode& parent, usize child_index) {
         auto* child   = parent.child(child_index);
-        auto  sibling = Box<TreeNode>::make(child->leaf);
+        auto  sibling = OwnedNode::make(child->leaf);
 
         for (usize i = 0; i < B - 1; ++i) {
             auto entry = child->take_entry(B + i);
@@ -450,11 +551,30 @@ class BTreeMap {
             for (usize i = 0; i <= right_len; ++i) {
                 left->write_edge(first_edge + i, right->take_edge(i));
             }
-            right->leaf = true;
+            // `right` is now empty; a null edge lets it be freed without touching the moved ones.
+            right->write_edge(0, OwnedNode {});
         }
         return *left;
     }
 
+    // Repairs the children around `parent.key(index)` where a split or join left one of them
+    // underfull: they are merged when they fit in one node, otherwise the `fill_right` (or left)
+    // child is topped up to `B` entries from its sibling, so a merge one level down cannot
+    // underfill it again.
+    static void rebalance_border(TreeNode& parent, usize index, bool fill_right) {
+        auto* left  = parent.child(index);
+        auto* right = parent.child(index + 1);
+        if (left->len + 1 + right->len <= CAPACITY) {
+            (void)merge_children(parent, index);
+            return;
+        }
+        if (fill_right) {
+            while (right->len < B) borrow_from_previous(parent, index + 1);
+        } else {
+            while (left->len < B) borrow_from_next(parent, index);
+        }
+    }
+
     static auto remove_min(TreeNode& node) -> Entry {
         if (node.leaf) return node.remove_entry(0);
         auto* child = node.child(0);
@@ -532,13 +652,118 @@ class BTreeMap {
     void normalize_root() {
         auto* current = root_node();
         if (current == nullptr || current->len != 0 || current->leaf) return;
-        auto old_root  = rstd::move(*root.take());
-        auto new_root  = old_root->take_edge(0);
-        old_root->leaf = true;
-        root           = Some(rstd::move(new_root));
+        auto new_root = current->take_edge(0);
+        current->write_edge(0, OwnedNode {});
+        root = rstd::move(new_root);
+    }
+
+    // Drops empty internal roots left behind by a cut or a merge.
+    void fix_top() {
+        while (root.get() != nullptr && ! root->leaf && root->len == 0) normalize_root();
+    }
+
+    // A cut leaves the right spine of the lower half with underfull or empty nodes; each level
+    // is repaired from its left sibling before descending.
+    void fix_right_border() {
+        fix_top();
+        for (auto* node = root_node(); ! node->leaf; node = node->child(node->len)) {
+            rebalance_border(*node, node->len - 1, true);
+        }
+        fix_top();
+    }
+
+    void fix_left_border() {
+        fix_top();
+        for (auto* node = root_node(); ! node->leaf; node = node->child(0)) {
+            rebalance_border(*node, 0, false);
+        }
+        fix_top();
+    }
+
+    auto height() const -> usize {
+        usize levels = 0;
+        for (auto* node = root_node(); ! node->leaf; node = node->child(0)) ++levels;
+        return levels;
+    }
+
+    static auto count_entries(const TreeNode& node) -> usize {
+        usize count = node.len;
+        if (! node.leaf) {
+            for (usize i = 0; i <= node.len; ++i) count += count_entries(*node.child(i));
+        }
+        return count;
+    }
+
+    void split_full_root() {
+        auto new_root = OwnedNode::make(false);
+        new_root->write_edge(0, rstd::move(root));
+        split_child(*new_root.get(), 0);
+        root = rstd::move(new_root);
+    }
+
+    // Joins `lower`, `separator` and `upper`, whose keys must ascend in that order, by hanging
+    // the shorter tree off the spine of the taller one. Both maps must be non-empty.
+    static auto join(BTreeMap lower, Entry separator, BTreeMap upper) -> BTreeMap {
+        usize total        = lower.length + 1 + upper.length;
+        usize lower_height = lower.height();
+        usize upper_height = upper.height();
+
+        if (lower_height == upper_height) {
+            // Either root may be underfull; the shorter one is topped up from the other.
+            bool fill_right = upper.root->len < lower.root->len;
+            auto new_root   = OwnedNode::make(false);
+            new_root->write_edge(0, rstd::move(lower.root));
+            new_root->write_edge(1, rstd::move(upper.root));
+            new_root->write_entry(0,
+                                  rstd::move(separator.template get<0>()),
+                                  rstd::move(separator.template get<1>()));
+            new_root->len = 1;
+            rebalance_border(*new_root.get(), 0, fill_right);
+            lower.root   = rstd::move(new_root);
+            lower.length = total;
+            lower.fix_top();
+            return lower;
+        }
+
+        bool  into_lower = lower_height > upper_height;
+        auto& tall       = into_lower ? lower : upper;
+        auto& small      = into_lower ? upper : lower;
+        usize target     = into_lower ? upper_height : lower_height;
+        if (tall.root_node()->len == CAPACITY) tall.split_full_root();
+
+        // Walk the facing spine of the taller tree down to the parent of the graft point,
+        // splitting full nodes on the way so the graft never overflows.
+        auto* node = tall.root_node();
+        for (usize level = tall.height(); level > target + 1; --level) {
+            usize index = into_lower ? node->len : 0;
+            if (node->child(index)->len == CAPACITY) {
+                split_child(*node, index);
+                if (into_lower) ++index;
+            }
+            node = node->child(index);
+        }
+
+        if (into_lower) {
+            node->write_entry(node->len,
+                              rstd::move(separator.template get<0>()),
+                              rstd::move(separator.template get<1>()));
+            node->write_edge(node->len + 1, rstd::move(small.root));
+            ++node->len;
+            rebalance_border(*node, node->len - 1, true);
+        } else {
+            node->insert_entry(0,
+                               rstd::move(separator.template get<0>()),
+                               rstd::move(separator.template get<1>()));
+            insert_edge(*node, 0, rstd::move(small.root), node->len);
+            rebalance_border(*node, 0, false);
+        }
+        small.length = 0;
+        tall.length  = total;
+        tall.fix_top();
+        return rstd::move(tall);
     }
 
-    static void drain_node(Box<TreeNode> node, Vec<Entry>& output) {
+    static void drain_node(OwnedNode node, Vec<Entry>& output) {
         if (node->leaf) {
             while (node->len != 0) output.push(node->remove_entry(0));
             return;
@@ -550,7 +775,7 @@ class BTreeMap {
             output.push(node->remove_entry(0));
         }
         auto child = node->take_edge(0);
-        node->leaf = true;
+        node->write_edge(0, OwnedNode {});
         drain_node(rstd::move(child), output);
     }
 
@@ -594,8 +819,68 @@ class BTreeMap {
         return true;
     }
 
+    // Bulk building appends entries in key order along the right spine (root first, leaf
+    // last). Every node left of the spine is closed only once full, so the underfull spine can
+    // later be topped up from its left siblings.
+    auto bulk_begin() -> Vec<TreeNode*> {
+        clear();
+        root       = OwnedNode::make(true);
+        auto spine = Vec<TreeNode*>::with_capacity(8);
+        spine.push(root.get());
+        return spine;
+    }
+
+    auto bulk_push(Vec<TreeNode*>& spine, K key, V value) -> BTreeMapFrame<TreeNode> {
+        auto* leaf = spine[spine.len() - 1];
+        if (leaf->len < CAPACITY) {
+            leaf->write_entry(leaf->len, rstd::move(key), rstd::move(value));
+            ++length;
+            return { leaf, leaf->len++ };
+        }
+
+        // The entry becomes a separator in the lowest ancestor with room; a full spine grows
+        // a new root.
+        usize level = spine.len() - 1;
+        while (level > 0 && spine[level - 1]->len == CAPACITY) --level;
+        if (level == 0) {
+            auto new_root = OwnedNode::make(false);
+            new_root->write_edge(0, rstd::move(root));
+            root       = rstd::move(new_root);
+            auto grown = Vec<TreeNode*>::with_capacity(spine.len() + 1);
+            grown.push(root.get());
+            for (auto* node : spine) grown.push(rstd::move(node));
+            spine = rstd::move(grown);
+            level = 1;
+        }
+
+        auto* parent = spine[level - 1];
+        parent->write_entry(parent->len, rstd::move(key), rstd::move(value));
+        ++length;
+        auto placed = BTreeMapFrame<TreeNode> { parent, parent->len++ };
+
+        // Open a fresh, empty spine below the new separator.
+        for (usize i = level; i < spine.len(); ++i) {
+            auto fresh = OwnedNode::make(i + 1 == spine.len());
+            spine[i]   = fresh.get();
+            spine[i - 1]->write_edge(spine[i - 1]->len, rstd::move(fresh));
+        }
+        return placed;
+    }
+
+    void bulk_finish(Vec<TreeNode*>& spine) {
+        if (length == 0) {
+            clear();
+            return;
+        }
+        for (usize i = 0; i + 1 < spine.len(); ++i) {
+            auto* parent = spine[i];
+            while (spine[i + 1]->len < B - 1) borrow_from_previous(*parent, parent->len);
+        }
+        debug_assert(valid());
+    }
+
     bool valid() const {
-        if (root.is_none()) return length == 0;
+        if (root.get() == nullptr) return length == 0;
         usize leaf_depth = 0;
         usize count      = 0;
         bool  saw_leaf   = false;
@@ -607,16 +892,16 @@ class BTreeMap {
 public:
     USE_TRAIT(BTreeMap)
 
-    BTreeMap(): root(None()), length(0) {}
+    BTreeMap(): root(), length(0) {}
     BTreeMap(const BTreeMap&)            = delete;
     BTreeMap& operator=(const BTreeMap&) = delete;
-    BTreeMap(BTreeMap&& other) noexcept: root(other.root.take()), length(other.length) {
+    BTreeMap(BTreeMap&& other) noexcept: root(rstd::move(other.root)), length(other.length) {
         other.length = 0;
     }
     BTreeMap& operator=(BTreeMap&& other) noexcept {
         if (this != rstd::addressof(other)) {
             clear();
-            root         = other.root.take();
+            root         = rstd::move(other.root);
             length       = other.length;
             other.length = 0;
         }
@@ -647,19 +932,13 @@ public:
     }
 
     void clear() {
-        root   = None();
+        root   = OwnedNode {};
         length = 0;
     }
 
     auto insert(K key, V value) -> Option<V> {
-        if (root.is_none()) root = Some(Box<TreeNode>::make(true));
-        if (root_node()->len == CAPACITY) {
-            auto old_root = rstd::move(*root.take());
-            auto new_root = Box<TreeNode>::make(false);
-            new_root->write_edge(0, rstd::move(old_root));
-            split_child(*new_root.get(), 0);
-            root = Some(rstd::move(new_root));
-        }
+        if (root.get() == nullptr) root = OwnedNode::make(true);
+        if (root_node()->len == CAPACITY) split_full_root();
         auto old = insert_non_full(*root_node(), rstd::move(key), rstd::move(value));
         debug_assert(valid());
         return old;
@@ -741,7 +1020,7 @@ public:
             borrowed < stored;
         }
     {
-        if (root.is_none()) return None();
+        if (root.get() == nullptr) return None();
         auto removed = remove_from_node(*root_node(), key);
         if (removed.is_some()) --length;
         normalize_root();
@@ -798,6 +1077,145 @@ public:
         return Some(rstd::move(entry));
     }
 
+    /// Builds a map from entries in ascending key order in O(n), filling nodes left to right
+    /// instead of searching from the root for each entry. When a key repeats, the last value
+    /// wins. Out-of-order input is a caller bug and trips a debug assertion.
+    template<typename It>
+    static auto from_sorted_iter(It iter) -> BTreeMap {
+        auto map   = BTreeMap::make();
+        auto spine = map.bulk_begin();
+        auto last  = BTreeMapFrame<TreeNode> { nullptr, 0 };
+        for (auto item = iter.next(); item.is_some(); item = iter.next()) {
+            auto& key = item->template get<0>();
+            if (last.node != nullptr) {
+                const auto& previous = last.node->key(last.index);
+                debug_assert(! (key < previous));
+                if (! (previous < key)) {
+                    last.node->value(last.index) = rstd::move(item->template get<1>());
+                    continue;
+                }
+            }
+            last = map.bulk_push(spine, rstd::move(key), rstd::move(item->template get<1>()));
+        }
+        map.bulk_finish(spine);
+        return map;
+    }
+
+    /// Iterates over the entries with keys in `[start, end)`. Positioning costs one descent
+    /// from the root; each step after that is amortized O(1).
+    template<typename Q>
+    auto range(const Q& start, Q end) const -> BTreeMapRange<K, V, Q>
+        requires requires(const K& stored, const Q& borrowed) {
+            stored < borrowed;
+            borrowed < stored;
+        }
+    {
+        auto stack = Vec<BTreeMapFrame<const TreeNode>>::make();
+        for (auto* node = root_node(); node != nullptr;) {
+            usize index = lower_bound(*node, start);
+            stack.push(BTreeMapFrame<const TreeNode> { node, index });
+            if (node->leaf) break;
+            node = node->child(index);
+        }
+        return BTreeMapRange<K, V, Q>(rstd::move(stack), rstd::move(end));
+    }
+
+    /// Moves every entry of `other` into `self`, leaving `other` empty; on equal keys the value
+    /// from `other` wins. When the key ranges do not overlap the trees are joined node-wise in
+    /// O(log n). Overlapping ranges interleave, so both maps are streamed in order and rebuilt
+    /// bottom-up in O(n + m), with no per-entry search.
+    void append(BTreeMap& other) {
+        if (other.is_empty()) return;
+        if (is_empty()) {
+            *this = rstd::move(other);
+            return;
+        }
+
+        const K& first       = *first_key_value()->template get<0>();
+        const K& last        = *last_key_value()->template get<0>();
+        const K& other_first = *other.first_key_value()->template get<0>();
+        const K& other_last  = *other.last_key_value()->template get<0>();
+        bool     after       = last < other_first;
+        bool     before      = other_last < first;
+        if (after || before) {
+            auto lower     = after ? rstd::move(*this) : rstd::move(other);
+            auto upper     = after ? rstd::move(other) : rstd::move(*this);
+            auto separator = lower.pop_last().unwrap_unchecked();
+            if (lower.is_empty()) {
+                upper.insert(rstd::move(separator.template get<0>()),
+                             rstd::move(separator.template get<1>()));
+                *this = rstd::move(upper);
+            } else {
+                *this = join(rstd::move(lower), rstd::move(separator), rstd::move(upper));
+            }
+            debug_assert(valid());
+            return;
+        }
+
+        auto merged = BTreeMergeIter<K, V>(into_iter(), other.into_iter());
+        *this       = from_sorted_iter(rstd::move(merged));
+    }
+
+    /// Moves the entries with keys `>= key` into a new map. The tree is cut along the search
+    /// path and the two borders are repaired level by level, in O(log n); `len()` of the halves
+    /// is then settled by summing the node lengths of the shorter one.
+    template<typename Q>
+    auto split_off(const Q& key) -> BTreeMap
+        requires requires(const K& stored, const Q& borrowed) {
+            stored < borrowed;
+            borrowed < stored;
+        }
+    {
+        if (is_empty()) return {};
+        if (! (*first_key_value()->template get<0>() < key)) {
+            auto whole = rstd::move(*this);
+            return whole;
+        }
+        if (*last_key_value()->template get<0>() < key) return {};
+
+        // Both halves keep the full height: at every level the entries from the cut on move to
+        // a fresh node whose first edge receives the right part of the next level down.
+        auto  upper = BTreeMap::make();
+        upper.root  = OwnedNode::make(root->leaf);
+        auto* left  = root_node();
+        auto* right = upper.root_node();
+        for (;;) {
+            usize index = lower_bound(*left, key);
+            usize moved = left->len - index;
+            for (usize i = 0; i < moved; ++i) {
+                auto entry = left->take_entry(index + i);
+                right->write_entry(
+                    i, rstd::move(entry.template get<0>()), rstd::move(entry.template get<1>()));
+            }
+            if (! left->leaf) {
+                for (usize i = 1; i <= moved; ++i) {
+                    right->write_edge(i, left->take_edge(index + i));
+                }
+            }
+            left->len  = index;
+            right->len = moved;
+            if (left->leaf) break;
+
+            right->write_edge(0, OwnedNode::make(left->child(index)->leaf));
+            left  = left->child(index);
+            right = right->child(0);
+        }
+
+        fix_right_border();
+        upper.fix_left_border();
+
+        usize total = length;
+        if (height() < upper.height()) {
+            length = count_entries(*root_node());
+        } else {
+            length = total - count_entries(*upper.root_node());
+        }
+        upper.length = total - length;
+        debug_assert(valid());
+        debug_assert(upper.valid());
+        return upper;
+    }
+
     auto iter() const -> BTreeMapIter<K, V> { return { root_node(), length }; }
     auto iter_mut() -> BTreeMapIterMut<K, V> { return { root_node(), length }; }
     auto keys() const -> BTreeMapKeys<K, V> { return BTreeMapKeys<K, V>(iter()); }
@@ -807,7 +1225,7 @@ public:
     using IntoIter = BTreeMapIntoIter<K, V>;
     auto into_iter() -> IntoIter {
         auto entries = Vec<Entry>::with_capacity(length);
-        if (root.is_some()) drain_node(rstd::move(*root.take()), entries);
+        if (root.get() != nullptr) drain_node(rstd::move(root), entries);
         length = 0;
         return IntoIter(rstd::move(entries));
     }
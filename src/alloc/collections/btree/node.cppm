@@ -9,19 +9,91 @@ using ::alloc::boxed::Box;
 using rstd::mem::maybe_uninit::MaybeUninit;
 using namespace rstd::prelude;
 
-inline constexpr usize B          = 6;
-inline constexpr usize CAPACITY   = 2 * B - 1;
-inline constexpr usize EDGE_COUNT = 2 * B;
+inline constexpr usize CACHE_LINE = 64;
 
+// Bytes a leaf may spend on its key and value arrays. The fanout is the largest one that fits,
+// so small keys get wide nodes and every level of a search costs few cache lines.
+inline constexpr usize NODE_BUDGET = 8 * CACHE_LINE;
+inline constexpr usize MIN_B       = 3;
+inline constexpr usize MAX_B       = 32;
+
+template<typename K, typename V>
+consteval auto node_b() -> usize {
+    constexpr usize header   = 2 * sizeof(usize);
+    constexpr usize entry    = sizeof(K) + sizeof(V);
+    constexpr usize capacity = (NODE_BUDGET - header) / entry;
+    constexpr usize b        = (capacity + 1) / 2;
+    return b < MIN_B ? MIN_B : (b > MAX_B ? MAX_B : b);
+}
+
+template<typename K, typename V>
+class Node;
+template<typename K, typename V>
+class InternalNode;
+
+/// Owning pointer to a tree node. A node is allocated as a `Node` when it is a leaf and as an
+/// `InternalNode` otherwise; this handle frees it as the type it was created with. A
+/// default-constructed handle is null and owns nothing.
+template<typename K, typename V>
+class BoxedNode {
+    Node<K, V>* m_ptr { nullptr };
+
+    explicit BoxedNode(Node<K, V>* p) noexcept: m_ptr(p) {}
+
+public:
+    BoxedNode() noexcept                   = default;
+    BoxedNode(const BoxedNode&)            = delete;
+    BoxedNode& operator=(const BoxedNode&) = delete;
+    BoxedNode(BoxedNode&& o) noexcept: m_ptr(rstd::exchange(o.m_ptr, nullptr)) {}
+    BoxedNode& operator=(BoxedNode&& o) noexcept {
+        if (this != rstd::addressof(o)) {
+            reset();
+            m_ptr = rstd::exchange(o.m_ptr, nullptr);
+        }
+        return *this;
+    }
+    ~BoxedNode() { reset(); }
+
+    /// Allocates an empty leaf or internal node.
+    static auto make(bool leaf) -> BoxedNode {
+        if (leaf) return BoxedNode { Box<Node<K, V>>::make(true).into_raw().as_raw_ptr() };
+        return BoxedNode { Box<InternalNode<K, V>>::make().into_raw().as_raw_ptr() };
+    }
+
+    void reset() noexcept;
+
+    auto get() const noexcept -> Node<K, V>* { return m_ptr; }
+    auto operator->() const noexcept -> Node<K, V>* { return m_ptr; }
+};
+
+/// Leaf layout, and the leading part of every internal node.
+///
+/// Keys come first so a search reads one contiguous array from the start of the allocation;
+/// values are only touched once the key is found. Leaves carry no edge storage.
 template<typename K, typename V>
-class Node {
-    MaybeUninit<K>         keys[CAPACITY];
-    MaybeUninit<V>         values[CAPACITY];
-    MaybeUninit<Box<Node>> edges[EDGE_COUNT];
+class alignas(CACHE_LINE) Node {
+public:
+    static constexpr usize B          = node_b<K, V>();
+    static constexpr usize CAPACITY   = 2 * B - 1;
+    static constexpr usize EDGE_COUNT = 2 * B;
+
+private:
+    MaybeUninit<K> keys[CAPACITY];
+    MaybeUninit<V> values[CAPACITY];
+
+    auto internal() noexcept -> InternalNode<K, V>* {
+        debug_assert(! leaf);
+        return static_cast<InternalNode<K, V>*>(this);
+    }
+    auto internal() const noexcept -> const InternalNode<K, V>* {
+        debug_assert(! leaf);
+        return static_cast<const InternalNode<K, V>*>(this);
+    }
 
 public:
     usize len;
-    bool  leaf;
+    /// Fixed at construction: it selects which type the node was allocated as.
+    const bool leaf;
 
     explicit Node(bool is_leaf): len(0), leaf(is_leaf) {}
     Node(const Node&)            = delete;
@@ -31,24 +103,22 @@ public:
 
     ~Node() {
         for (usize i = 0; i < len; ++i) destroy_entry(i);
-        if (! leaf) {
-            for (usize i = 0; i <= len; ++i) edges[i].assume_init_drop();
-        }
     }
 
     auto key(usize index) noexcept -> K& { return keys[index].assume_init_mut(); }
     auto key(usize index) const noexcept -> const K& { return keys[index].assume_init_ref(); }
     auto value(usize index) noexcept -> V& { return values[index].assume_init_mut(); }
     auto value(usize index) const noexcept -> const V& { return values[index].assume_init_ref(); }
-    auto edge(usize index) noexcept -> Box<Node>& { return edges[index].assume_init_mut(); }
-    auto edge(usize index) const noexcept -> const Box<Node>& {
-        return edges[index].assume_init_ref();
-    }
-    auto child(usize index) noexcept -> Node* { return edge(index).get(); }
-    auto child(usize index) const noexcept -> const Node* {
-        return edge(index).as_ptr().as_raw_ptr();
+
+    /// Pointer to the first key. Keys `[0, len)` are initialized and contiguous.
+    auto key_data() const noexcept -> const K* {
+        return reinterpret_cast<const K*>(static_cast<const void*>(keys));
     }
 
+    auto edge(usize index) noexcept -> BoxedNode<K, V>&;
+    auto edge(usize index) const noexcept -> const BoxedNode<K, V>&;
+    auto child(usize index) const noexcept -> Node* { return edge(index).get(); }
+
     void write_entry(usize index, K key, V value) {
         keys[index].write(rstd::move(key));
         values[index].write(rstd::move(value));
@@ -85,13 +155,57 @@ public:
         return removed;
     }
 
-    void write_edge(usize index, Box<Node> edge) { edges[index].write(rstd::move(edge)); }
+    void write_edge(usize index, BoxedNode<K, V> edge);
+    auto take_edge(usize index) -> BoxedNode<K, V>;
+    void move_edge(usize source, usize destination) { write_edge(destination, take_edge(source)); }
+};
 
-    auto take_edge(usize index) -> Box<Node> {
-        Box<Node> out = rstd::move(edge(index));
-        edges[index].assume_init_drop();
-        return out;
-    }
+/// A node with children. Edges `[0, len]` are initialized.
+template<typename K, typename V>
+class InternalNode : public Node<K, V> {
+    friend class Node<K, V>;
 
-    void move_edge(usize source, usize destination) { write_edge(destination, take_edge(source)); }
+    MaybeUninit<BoxedNode<K, V>> edges[Node<K, V>::EDGE_COUNT];
+
+public:
+    InternalNode(): Node<K, V>(false) {}
+
+    ~InternalNode() {
+        for (usize i = 0; i <= this->len; ++i) edges[i].assume_init_drop();
+    }
 };
+
+template<typename K, typename V>
+void BoxedNode<K, V>::reset() noexcept {
+    auto* p = rstd::exchange(m_ptr, nullptr);
+    if (p == nullptr) return;
+    if (p->leaf) {
+        (void)Box<Node<K, V>>::from_raw(mut_ptr<Node<K, V>>::from_raw_parts(p));
+    } else {
+        auto* internal = static_cast<InternalNode<K, V>*>(p);
+        (void)Box<InternalNode<K, V>>::from_raw(
+            mut_ptr<InternalNode<K, V>>::from_raw_parts(internal));
+    }
+}
+
+template<typename K, typename V>
+auto Node<K, V>::edge(usize index) noexcept -> BoxedNode<K, V>& {
+    return internal()->edges[index].assume_init_mut();
+}
+
+template<typename K, typename V>
+auto Node<K, V>::edge(usize index) const noexcept -> const BoxedNode<K, V>& {
+    return internal()->edges[index].assume_init_ref();
+}
+
+template<typename K, typename V>
+void Node<K, V>::write_edge(usize index, BoxedNode<K, V> edge) {
+    internal()->edges[index].write(rstd::move(edge));
+}
+
+template<typename K, typename V>
+auto Node<K, V>::take_edge(usize index) -> BoxedNode<K, V> {
+    BoxedNode<K, V> out = rstd::move(edge(index));
+    internal()->edges[index].assume_init_drop();
+    return out;
+}
@@ -35,6 +35,10 @@ export template<typename K, typename V>
 class HashMapValues;
 export template<typename K, typename V>
 class HashMapValuesMut;
+export template<typename K, typename V>
+class HashMapEntry;
+export template<typename K, typename V>
+class HashMapRawEntry;
 
 export template<typename K, typename V>
 class HashMapIter : public rstd::DefaultInClass<HashMapIter<K, V>, rstd::iter::Iterator> {
@@ -152,6 +156,142 @@ public:
     auto len() const noexcept -> usize { return table.len(); }
 };
 
+/// One key's place in a `HashMap`, located by a single probe.
+///
+/// An occupied entry points at the stored value; a vacant one holds the key together with the
+/// bucket an insert will take, so insert-or-update never hashes or probes twice. The entry
+/// borrows the map and must be consumed before the map is touched again.
+export template<typename K, typename V>
+class HashMapEntry {
+    RawTable<K, V>* table;
+    u64             hash;
+    usize           index;
+    Option<K>       vacant_key;
+
+    auto value_at(usize at) const noexcept -> rstd::mut_ref<V> {
+        return rstd::mut_ref<V>::from_raw_parts(rstd::addressof(table->bucket(at).value()));
+    }
+
+    auto fill(V value) -> rstd::mut_ref<V> {
+        index = table->insert_in_slot(
+            index, hash, vacant_key.take().unwrap_unchecked(), rstd::move(value));
+        return value_at(index);
+    }
+
+public:
+    HashMapEntry(RawTable<K, V>* source, u64 entry_hash, usize at, Option<K> key)
+        : table(source), hash(entry_hash), index(at), vacant_key(rstd::move(key)) {}
+
+    auto is_occupied() const noexcept -> bool { return vacant_key.is_none(); }
+    auto is_vacant() const noexcept -> bool { return vacant_key.is_some(); }
+
+    auto key() const noexcept -> const K& {
+        return is_occupied() ? table->bucket(index).key() : *vacant_key;
+    }
+
+    /// The stored value, if the entry is occupied.
+    auto get() const -> Option<rstd::mut_ref<V>> {
+        if (is_vacant()) return None();
+        return Some(value_at(index));
+    }
+
+    auto or_insert(V value) && -> rstd::mut_ref<V> {
+        if (is_occupied()) return value_at(index);
+        return fill(rstd::move(value));
+    }
+
+    /// Returns the stored value, inserting `make()` first if the entry is vacant.
+    template<typename F>
+    auto or_insert_with(F&& make) && -> rstd::mut_ref<V> {
+        if (is_occupied()) return value_at(index);
+        return fill(make());
+    }
+
+    /// Like `or_insert_with`, but `make` receives the key.
+    template<typename F>
+    auto or_insert_with_key(F&& make) && -> rstd::mut_ref<V> {
+        if (is_occupied()) return value_at(index);
+        return fill(make(static_cast<const K&>(*vacant_key)));
+    }
+
+    auto or_default() && -> rstd::mut_ref<V> {
+        if (is_occupied()) return value_at(index);
+        return fill(V {});
+    }
+
+    /// Calls `f` on the stored value if the entry is occupied, and passes the entry on.
+    template<typename F>
+    auto and_modify(F&& f) && -> HashMapEntry {
+        if (is_occupied()) f(table->bucket(index).value());
+        return rstd::move(*this);
+    }
+
+    /// Stores `value` whether or not the entry was occupied.
+    auto insert(V value) && -> rstd::mut_ref<V> {
+        if (is_vacant()) return fill(rstd::move(value));
+        (void)table->bucket(index).replace_value(rstd::move(value));
+        return value_at(index);
+    }
+
+    /// Removes the stored value, if any.
+    auto remove() && -> Option<V> {
+        if (is_vacant()) return None();
+        auto entry = table->remove(index);
+        return Some(rstd::move(entry.template get<1>()));
+    }
+};
+
+/// The result of `HashMap::raw_entry_mut`: a lookup by a hash the caller computed.
+///
+/// The hash must be the one the map's hasher gives the key that is eventually stored, or
+/// later lookups will miss it. A vacant entry keeps the probed bucket, so inserting after the
+/// lookup costs no second probe.
+export template<typename K, typename V>
+class HashMapRawEntry {
+    RawTable<K, V>* table;
+    u64             hash;
+    usize           index;
+    bool            found;
+
+    auto value_at(usize at) const noexcept -> rstd::mut_ref<V> {
+        return rstd::mut_ref<V>::from_raw_parts(rstd::addressof(table->bucket(at).value()));
+    }
+
+public:
+    HashMapRawEntry(RawTable<K, V>* source, u64 entry_hash, usize at, bool occupied)
+        : table(source), hash(entry_hash), index(at), found(occupied) {}
+
+    auto is_occupied() const noexcept -> bool { return found; }
+    auto is_vacant() const noexcept -> bool { return ! found; }
+
+    auto key() const -> Option<rstd::ref<K>> {
+        if (! found) return None();
+        return Some(rstd::ref<K>::from_raw_parts(rstd::addressof(table->bucket(index).key())));
+    }
+
+    auto get() const -> Option<rstd::mut_ref<V>> {
+        if (! found) return None();
+        return Some(value_at(index));
+    }
+
+    /// Returns the stored value, inserting `key` and `value` first if the entry is vacant.
+    auto or_insert(K key, V value) && -> rstd::mut_ref<V> {
+        if (found) return value_at(index);
+        index = table->insert_in_slot(index, hash, rstd::move(key), rstd::move(value));
+        return value_at(index);
+    }
+
+    /// Like `or_insert`, with the key and value built by `make()` only when vacant.
+    template<typename F>
+    auto or_insert_with(F&& make) && -> rstd::mut_ref<V> {
+        if (found) return value_at(index);
+        auto entry = make();
+        index      = table->insert_in_slot(
+            index, hash, rstd::move(entry.template get<0>()), rstd::move(entry.template get<1>()));
+        return value_at(index);
+    }
+};
+
 export template<typename K, typename V, typename S, typename Eq>
 class HashMap {
     using Entry = rstd::tuple<K, V>;
@@ -201,18 +341,53 @@ public:
     void shrink_to(usize minimum) { table.shrink_to(minimum); }
     void clear() noexcept { table.clear(); }
 
+    /// The hash the map stores `key` under, for use with `raw_entry` and `raw_entry_mut`.
+    auto hash_of(const K& key) const noexcept -> u64 { return hash_key(key); }
+
     auto insert(K key, V value) -> Option<V> {
         u64  hash  = hash_key(key);
-        auto found = table.find(hash, [&](const K& stored) {
+        auto probe = table.probe(hash, [&](const K& stored) {
             return equal(stored, key);
         });
-        if (found.is_some()) {
-            return Some(table.bucket(*found).replace_value(rstd::move(value)));
+        if (probe.found) {
+            return Some(table.bucket(probe.index).replace_value(rstd::move(value)));
         }
-        table.insert(hash, rstd::move(key), rstd::move(value));
+        (void)table.insert_in_slot(probe.index, hash, rstd::move(key), rstd::move(value));
         return None();
     }
 
+    /// Looks `key` up once and returns its entry for in-place insert-or-update.
+    auto entry(K key) -> HashMapEntry<K, V> {
+        u64  hash  = hash_key(key);
+        auto probe = table.probe(hash, [&](const K& stored) {
+            return equal(stored, key);
+        });
+        auto* raw = rstd::addressof(table);
+        if (probe.found) return HashMapEntry<K, V>(raw, hash, probe.index, None());
+        return HashMapEntry<K, V>(raw, hash, probe.index, Some(rstd::move(key)));
+    }
+
+    /// Looks up the entry under `hash` whose key satisfies `is_match`, without hashing.
+    ///
+    /// Lets a caller hash once and reuse the hash, or probe with a borrowed form of the key
+    /// and build the owned key only on a miss.
+    template<typename F>
+    auto raw_entry_mut(u64 hash, F&& is_match) -> HashMapRawEntry<K, V> {
+        auto probe = table.probe(hash, is_match);
+        return HashMapRawEntry<K, V>(rstd::addressof(table), hash, probe.index, probe.found);
+    }
+
+    template<typename F>
+    auto raw_entry(u64 hash, F&& is_match) const
+        -> Option<rstd::tuple<rstd::ref<K>, rstd::ref<V>>> {
+        auto found = table.find(hash, is_match);
+        if (found.is_none()) return None();
+        const auto& bucket = table.bucket(*found);
+        return Some(rstd::tuple<rstd::ref<K>, rstd::ref<V>>(
+            rstd::ref<K>::from_raw_parts(rstd::addressof(bucket.key())),
+            rstd::ref<V>::from_raw_parts(rstd::addressof(bucket.value()))));
+    }
+
     auto get(const K& key) const -> Option<rstd::ref<V>> {
         auto found = find_index(key);
         if (found.is_none()) return None();
@@ -237,6 +412,25 @@ public:
 
     auto contains_key(const K& key) const -> bool { return find_index(key).is_some(); }
 
+    /// Mutable references to the values of `N` distinct keys at once; `None` if any key is
+    /// missing or two of them are equal.
+    template<usize N>
+    auto get_many_mut(const K (&keys)[N]) -> Option<rstd::array<rstd::mut_ref<V>, N>> {
+        usize found[N];
+        for (usize i = 0; i < N; ++i) {
+            auto index = find_index(keys[i]);
+            if (index.is_none()) return None();
+            found[i] = *index;
+            for (usize j = 0; j < i; ++j) {
+                if (found[j] == found[i]) return None();
+            }
+        }
+        return Some(rstd::array<rstd::mut_ref<V>, N>::from_fn([&](usize i) {
+            auto& value = table.bucket(found[i]).value();
+            return rstd::mut_ref<V>::from_raw_parts(rstd::addressof(value));
+        }));
+    }
+
     auto remove_entry(const K& key) -> Option<Entry> {
         auto found = find_index(key);
         return found.is_some() ? Some(table.remove(*found)) : None();
@@ -247,13 +441,24 @@ public:
         return entry.is_some() ? Some(rstd::move(entry->template get<1>())) : None();
     }
 
+    /// Keeps only the entries `predicate` accepts, in one pass and without rehashing.
     template<typename F>
     void retain(F predicate) {
-        for (usize i = 0; i < table.bucket_count(); ++i) {
-            auto& bucket = table.bucket(i);
-            if (bucket.state == BucketState::Full && ! predicate(bucket.key(), bucket.value())) {
-                (void)table.remove(i);
-            }
+        table.retain(predicate);
+    }
+
+    /// Inserts every pair `iter` yields.
+    ///
+    /// Room is reserved from the size hint up front: all of it into an empty map, half of it
+    /// otherwise, since some keys may already be present.
+    template<typename I>
+        requires rstd::iter::has_next<I>
+    void extend(I iter) {
+        auto  hint  = as<rstd::iter::Iterator>(iter).size_hint();
+        usize lower = hint.template get<0>();
+        table.reserve(is_empty() ? lower : (lower + 1) / 2);
+        for (auto item = iter.next(); item.is_some(); item = iter.next()) {
+            (void)insert(rstd::move(item->template get<0>()), rstd::move(item->template get<1>()));
         }
     }
 
@@ -276,9 +481,7 @@ struct Impl<iter::FromIterator<tuple<K, V>>, ::alloc::collections::HashMap<K, V,
     template<typename It>
     static auto from_iter(It iter) -> ::alloc::collections::HashMap<K, V, S, Eq> {
         auto map = ::alloc::collections::HashMap<K, V, S, Eq>::make();
-        for (auto item = iter.next(); item.is_some(); item = iter.next()) {
-            map.insert(rstd::move(item->template get<0>()), rstd::move(item->template get<1>()));
-        }
+        map.extend(rstd::move(iter));
         return map;
     }
 };
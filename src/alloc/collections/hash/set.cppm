@@ -0,0 +1,179 @@
+module;
+#include <rstd/macro.hpp>
+
+export module rstd.alloc:collections.hash_set;
+export import :collections.hash_map;
+export import rstd.core;
+
+using namespace rstd::prelude;
+
+namespace alloc::collections
+{
+
+export template<typename K,
+                typename S  = rstd::hash::RandomState,
+                typename Eq = DefaultHashEqual<K>>
+class HashSet;
+
+export template<typename K>
+class HashSetIntoIter : public rstd::DefaultInClass<HashSetIntoIter<K>, rstd::iter::Iterator> {
+    HashMapIntoIter<K, empty> inner;
+
+public:
+    using Item = K;
+    explicit HashSetIntoIter(HashMapIntoIter<K, empty> iter): inner(rstd::move(iter)) {}
+    auto next() -> Option<Item> {
+        auto item = inner.next();
+        if (item.is_none()) return None();
+        return Some(rstd::move(item->template get<0>()));
+    }
+    auto size_hint() const -> rstd::iter::SizeHint { return inner.size_hint(); }
+    auto len() const noexcept -> usize { return inner.len(); }
+};
+
+/// A hash set: a `HashMap` with no values.
+///
+/// Shares the map's table, probing and hashing, including single-probe inserts and the
+/// caller-supplied-hash lookups.
+export template<typename K, typename S, typename Eq>
+class HashSet {
+    using Map = HashMap<K, empty, S, Eq>;
+
+    Map map;
+
+public:
+    USE_TRAIT(HashSet)
+    using Iter     = HashMapKeys<K, empty>;
+    using IntoIter = HashSetIntoIter<K>;
+
+    HashSet(): map() {}
+    HashSet(const HashSet&)                = delete;
+    HashSet& operator=(const HashSet&)     = delete;
+    HashSet(HashSet&&) noexcept            = default;
+    HashSet& operator=(HashSet&&) noexcept = default;
+
+    static auto make() -> HashSet { return {}; }
+    static auto with_capacity(usize capacity) -> HashSet {
+        auto set = HashSet {};
+        set.map  = Map::with_capacity(capacity);
+        return set;
+    }
+    static auto with_hasher(S hasher) -> HashSet {
+        auto set = HashSet {};
+        set.map  = Map::with_hasher(rstd::move(hasher));
+        return set;
+    }
+
+    auto len() const noexcept -> usize { return map.len(); }
+    auto is_empty() const noexcept -> bool { return map.is_empty(); }
+    auto capacity() const noexcept -> usize { return map.capacity(); }
+    auto hasher() const noexcept -> const S& { return map.hasher(); }
+    auto hash_of(const K& value) const noexcept -> u64 { return map.hash_of(value); }
+
+    void reserve(usize additional) { map.reserve(additional); }
+    void shrink_to_fit() { map.shrink_to_fit(); }
+    void shrink_to(usize minimum) { map.shrink_to(minimum); }
+    void clear() noexcept { map.clear(); }
+
+    /// Adds `value`; returns `true` if it was not already present.
+    auto insert(K value) -> bool {
+        auto entry = map.entry(rstd::move(value));
+        if (entry.is_occupied()) return false;
+        (void)rstd::move(entry).or_insert(empty {});
+        return true;
+    }
+
+    auto contains(const K& value) const -> bool { return map.contains_key(value); }
+
+    auto get(const K& value) const -> Option<rstd::ref<K>> {
+        auto found = map.get_key_value(value);
+        if (found.is_none()) return None();
+        return Some(found->template get<0>());
+    }
+
+    /// Looks a member up by a hash the caller computed; see `HashMap::raw_entry`.
+    template<typename F>
+    auto get_with_hash(u64 hash, F&& is_match) const -> Option<rstd::ref<K>> {
+        auto found = map.raw_entry(hash, is_match);
+        if (found.is_none()) return None();
+        return Some(found->template get<0>());
+    }
+
+    /// Removes `value`; returns `true` if it was present.
+    auto remove(const K& value) -> bool { return map.remove(value).is_some(); }
+
+    /// Removes and returns the stored member equal to `value`.
+    auto take(const K& value) -> Option<K> {
+        auto entry = map.remove_entry(value);
+        if (entry.is_none()) return None();
+        return Some(rstd::move(entry->template get<0>()));
+    }
+
+    /// Keeps only the members `predicate` accepts, without rehashing.
+    template<typename F>
+    void retain(F predicate) {
+        map.retain([&](const K& value, empty&) {
+            return predicate(value);
+        });
+    }
+
+    /// Inserts every value `iter` yields, reserving from its size hint first.
+    template<typename I>
+        requires rstd::iter::has_next<I>
+    void extend(I iter) {
+        auto  hint  = as<rstd::iter::Iterator>(iter).size_hint();
+        usize lower = hint.template get<0>();
+        map.reserve(is_empty() ? lower : (lower + 1) / 2);
+        for (auto item = iter.next(); item.is_some(); item = iter.next()) {
+            (void)insert(rstd::move(*item));
+        }
+    }
+
+    auto is_subset(const HashSet& other) const -> bool {
+        if (len() > other.len()) return false;
+        auto it = iter();
+        for (auto value = it.next(); value.is_some(); value = it.next()) {
+            if (! other.contains(**value)) return false;
+        }
+        return true;
+    }
+
+    auto is_disjoint(const HashSet& other) const -> bool {
+        const auto& smaller = len() <= other.len() ? *this : other;
+        const auto& larger  = len() <= other.len() ? other : *this;
+        auto        it      = smaller.iter();
+        for (auto value = it.next(); value.is_some(); value = it.next()) {
+            if (larger.contains(**value)) return false;
+        }
+        return true;
+    }
+
+    auto iter() const -> Iter { return map.keys(); }
+    auto into_iter() -> IntoIter { return IntoIter(map.into_iter()); }
+};
+
+} // namespace alloc::collections
+
+namespace rstd
+{
+
+template<typename K, typename S, typename Eq>
+struct Impl<iter::FromIterator<K>, ::alloc::collections::HashSet<K, S, Eq>>
+    : ImplBase<::alloc::collections::HashSet<K, S, Eq>> {
+    template<typename It>
+    static auto from_iter(It iter) -> ::alloc::collections::HashSet<K, S, Eq> {
+        auto set = ::alloc::collections::HashSet<K, S, Eq>::make();
+        set.extend(rstd::move(iter));
+        return set;
+    }
+};
+
+template<typename K, typename S, typename Eq>
+struct Impl<iter::IntoIterator, ::alloc::collections::HashSet<K, S, Eq>>
+    : ImplBase<::alloc::collections::HashSet<K, S, Eq>> {
+    auto into_iter() -> ::alloc::collections::HashSetIntoIter<K> {
+        return this->self().into_iter();
+    }
+};
+
+} // namespace rstd
@@ -112,18 +112,23 @@ class RawTable {
         deleted = 0;
     }
 
-    void insert_rehashed(u64 hash, K key, V value) {
+    // First bucket on the probe sequence of `hash` that is not full. One always exists, since
+    // the load factor keeps at least an eighth of the buckets out of use.
+    auto find_free(u64 hash) const noexcept -> usize {
         usize index  = static_cast<usize>(hash) & (buckets - 1);
         usize stride = 0;
-        for (;;) {
-            if (data[index].state != BucketState::Full) {
-                if (data[index].state == BucketState::Deleted) --deleted;
-                data[index].write(hash, rstd::move(key), rstd::move(value));
-                ++items;
-                return;
-            }
-            index = (index + ++stride) & (buckets - 1);
-        }
+        while (data[index].state == BucketState::Full) index = (index + ++stride) & (buckets - 1);
+        return index;
+    }
+
+    void place(usize index, u64 hash, K key, V value) {
+        if (data[index].state == BucketState::Deleted) --deleted;
+        data[index].write(hash, rstd::move(key), rstd::move(value));
+        ++items;
+    }
+
+    void insert_rehashed(u64 hash, K key, V value) {
+        place(find_free(hash), hash, rstd::move(key), rstd::move(value));
     }
 
     void rehash(usize count) {
@@ -201,6 +206,50 @@ public:
         return None();
     }
 
+    /// Outcome of `probe`: the matching bucket when `found`, otherwise the bucket an insert of
+    /// the probed hash should take (`bucket_count()` if none was seen).
+    struct Probe {
+        usize index;
+        bool  found;
+    };
+
+    /// Looks `hash` up and, on a miss, remembers the first reusable bucket on the way, so an
+    /// insert after a failed lookup does not probe again.
+    template<typename Equal>
+    auto probe(u64 hash, Equal equal) const -> Probe {
+        usize slot = buckets;
+        if (buckets == 0) return { slot, false };
+        usize index  = static_cast<usize>(hash) & (buckets - 1);
+        usize stride = 0;
+        for (usize visited = 0; visited < buckets; ++visited) {
+            const auto& entry = data[index];
+            if (entry.state == BucketState::Empty) {
+                return { slot == buckets ? index : slot, false };
+            }
+            if (entry.state == BucketState::Deleted) {
+                if (slot == buckets) slot = index;
+            } else if (entry.hash == hash && equal(entry.key())) {
+                return { index, true };
+            }
+            index = (index + ++stride) & (buckets - 1);
+        }
+        return { slot, false };
+    }
+
+    /// Inserts into the slot a missed `probe` returned, growing first when taking it would
+    /// break the load factor. Returns the bucket the entry landed in.
+    auto insert_in_slot(usize slot, u64 hash, K key, V value) -> usize {
+        bool usable = slot < buckets && (data[slot].state == BucketState::Deleted ||
+                                         items + deleted < capacity());
+        if (! usable) {
+            reserve(1);
+            slot = find_free(hash);
+        }
+        place(slot, hash, rstd::move(key), rstd::move(value));
+        debug_assert(valid());
+        return slot;
+    }
+
     void reserve(usize additional) {
         usize required = items + additional;
         if (required <= capacity() && items + deleted + additional <= capacity()) return;
@@ -224,6 +273,22 @@ public:
         return entry;
     }
 
+    /// Drops every entry `keep` rejects, in one pass and without rehashing.
+    template<typename F>
+    void retain(F& keep) {
+        for (usize i = 0; i < buckets && items != 0; ++i) {
+            auto& entry = data[i];
+            if (entry.state != BucketState::Full || keep(entry.key(), entry.value())) continue;
+            entry.clear();
+            entry.state = BucketState::Deleted;
+            --items;
+            ++deleted;
+        }
+        // With nothing left, tombstones only lengthen later probes.
+        if (items == 0) clear();
+        debug_assert(valid());
+    }
+
     void clear() noexcept {
         for (usize i = 0; i < buckets; ++i) data[i].clear();
         items   = 0;
@@ -0,0 +1,177 @@
+module;
+#include <rstd/macro.hpp>
+
+export module rstd.alloc:collections.intrusive_list;
+export import rstd.core;
+
+using namespace rstd::prelude;
+
+namespace alloc::collections
+{
+
+export template<typename T, typename Tag>
+class IntrusiveList;
+
+/// The links an element embeds to sit in an `IntrusiveList`.
+///
+/// Derive from `IntrusiveLink<T, Tag>` once per list the element can be in at the same time;
+/// `Tag` tells the links apart. An element is in at most one list per tag, and must be
+/// unlinked before it is destroyed.
+export template<typename T, typename Tag = void>
+class IntrusiveLink {
+    IntrusiveLink* prev { nullptr };
+    IntrusiveLink* next { nullptr };
+    bool           linked { false };
+
+    friend class IntrusiveList<T, Tag>;
+
+public:
+    IntrusiveLink() noexcept                               = default;
+    IntrusiveLink(const IntrusiveLink&)                    = delete;
+    auto operator=(const IntrusiveLink&) -> IntrusiveLink& = delete;
+
+    auto is_linked() const noexcept -> bool { return linked; }
+};
+
+/// A doubly linked list threaded through links stored in its elements.
+///
+/// The list owns nothing: it never allocates, and pushing or unlinking an element is O(1)
+/// given only a reference to it, which is what registries of live tasks and waiters need to
+/// drop one entry among many without a scan. Elements must outlive their membership.
+export template<typename T, typename Tag = void>
+class IntrusiveList {
+    using Link = IntrusiveLink<T, Tag>;
+
+    Link* head { nullptr };
+    Link* tail { nullptr };
+    usize length { 0 };
+
+    static auto link_of(T& value) noexcept -> Link& { return static_cast<Link&>(value); }
+    static auto value_of(Link* link) noexcept -> rstd::mut_ref<T> {
+        return rstd::mut_ref<T>::from_raw_parts(static_cast<T*>(link));
+    }
+
+public:
+    IntrusiveList() noexcept                               = default;
+    IntrusiveList(const IntrusiveList&)                    = delete;
+    auto operator=(const IntrusiveList&) -> IntrusiveList& = delete;
+    IntrusiveList(IntrusiveList&& other) noexcept
+        : head(rstd::exchange(other.head, nullptr)),
+          tail(rstd::exchange(other.tail, nullptr)),
+          length(rstd::exchange(other.length, 0)) {}
+    auto operator=(IntrusiveList&& other) noexcept -> IntrusiveList& {
+        if (this != &other) {
+            clear();
+            head   = rstd::exchange(other.head, nullptr);
+            tail   = rstd::exchange(other.tail, nullptr);
+            length = rstd::exchange(other.length, 0);
+        }
+        return *this;
+    }
+    ~IntrusiveList() { clear(); }
+
+    static auto make() noexcept -> IntrusiveList { return {}; }
+
+    auto len() const noexcept -> usize { return length; }
+    auto is_empty() const noexcept -> bool { return length == 0; }
+
+    void push_back(T& value) noexcept {
+        auto& link = link_of(value);
+        debug_assert(! link.linked);
+        link.prev   = tail;
+        link.next   = nullptr;
+        link.linked = true;
+        if (tail != nullptr) {
+            tail->next = &link;
+        } else {
+            head = &link;
+        }
+        tail = &link;
+        ++length;
+    }
+
+    void push_front(T& value) noexcept {
+        auto& link = link_of(value);
+        debug_assert(! link.linked);
+        link.prev   = nullptr;
+        link.next   = head;
+        link.linked = true;
+        if (head != nullptr) {
+            head->prev = &link;
+        } else {
+            tail = &link;
+        }
+        head = &link;
+        ++length;
+    }
+
+    /// Unlinks `value`, which must be in this list or in none; returns whether it was linked.
+    auto remove(T& value) noexcept -> bool {
+        auto& link = link_of(value);
+        if (! link.linked) return false;
+        if (link.prev != nullptr) {
+            link.prev->next = link.next;
+        } else {
+            head = link.next;
+        }
+        if (link.next != nullptr) {
+            link.next->prev = link.prev;
+        } else {
+            tail = link.prev;
+        }
+        link.prev   = nullptr;
+        link.next   = nullptr;
+        link.linked = false;
+        --length;
+        return true;
+    }
+
+    auto front() const noexcept -> Option<rstd::mut_ref<T>> {
+        if (head == nullptr) return None();
+        return Some(value_of(head));
+    }
+
+    auto back() const noexcept -> Option<rstd::mut_ref<T>> {
+        if (tail == nullptr) return None();
+        return Some(value_of(tail));
+    }
+
+    auto pop_front() noexcept -> Option<rstd::mut_ref<T>> {
+        if (head == nullptr) return None();
+        auto value = value_of(head);
+        (void)remove(*value);
+        return Some(value);
+    }
+
+    auto pop_back() noexcept -> Option<rstd::mut_ref<T>> {
+        if (tail == nullptr) return None();
+        auto value = value_of(tail);
+        (void)remove(*value);
+        return Some(value);
+    }
+
+    /// Calls `f` on every element front to back. `f` may unlink the element it is given.
+    template<typename F>
+    void for_each(F&& f) {
+        for (auto* link = head; link != nullptr;) {
+            auto* next = link->next;
+            f(*value_of(link));
+            link = next;
+        }
+    }
+
+    /// Unlinks every element.
+    void clear() noexcept {
+        while (head != nullptr) {
+            auto* link   = head;
+            head         = link->next;
+            link->prev   = nullptr;
+            link->next   = nullptr;
+            link->linked = false;
+        }
+        tail   = nullptr;
+        length = 0;
+    }
+};
+
+} // namespace alloc::collections
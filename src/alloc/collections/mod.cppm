@@ -1,3 +1,9 @@
 export module rstd.alloc:collections;
 export import :collections.btree_map;
 export import :collections.hash_map;
+export import :collections.hash_set;
+export import :collections.slab;
+export import :collections.intrusive_list;
+export import :collections.vec_deque;
+export import :collections.binary_heap;
+export import :collections.bit_set;
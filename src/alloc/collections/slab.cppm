@@ -0,0 +1,279 @@
+module;
+#include <rstd/macro.hpp>
+
+export module rstd.alloc:collections.slab;
+export import :vec;
+export import rstd.core;
+
+using ::alloc::vec::Vec;
+using namespace rstd::prelude;
+
+namespace alloc::collections
+{
+
+export template<typename T>
+class Slab;
+export template<typename T>
+class SlabIter;
+export template<typename T>
+class SlotMap;
+export template<typename T>
+class SlotMapIter;
+
+template<typename T>
+struct SlabEntry {
+    Option<T> value;
+    usize     next_vacant;
+};
+
+export template<typename T>
+class SlabIter : public rstd::DefaultInClass<SlabIter<T>, rstd::iter::Iterator> {
+    const Vec<SlabEntry<T>>* entries;
+    usize                    index;
+    usize                    remaining;
+
+public:
+    using Item = rstd::tuple<usize, rstd::ref<T>>;
+    SlabIter(const Vec<SlabEntry<T>>* source, usize len)
+        : entries(source), index(0), remaining(len) {}
+
+    auto next() -> Option<Item> {
+        while (remaining != 0 && index < entries->len()) {
+            usize current = index++;
+            auto& entry   = (*entries)[current];
+            if (entry.value.is_none()) continue;
+            --remaining;
+            return Some(Item(current, rstd::ref<T>::from_raw_parts(rstd::addressof(*entry.value))));
+        }
+        return None();
+    }
+    auto size_hint() const -> rstd::iter::SizeHint { return { remaining, Some(usize(remaining)) }; }
+    auto len() const noexcept -> usize { return remaining; }
+};
+
+/// Pre-allocated storage addressed by `usize` keys.
+///
+/// Removed slots are threaded onto a free list and handed out again by the next `insert`, so
+/// insertion, lookup and removal are all O(1) and the storage never shifts. Keys are reused
+/// as soon as their slot is vacated; use `SlotMap` when a stale key must not reach a newer
+/// value.
+export template<typename T>
+class Slab {
+    Vec<SlabEntry<T>> entries;
+    usize             length { 0 };
+    usize             next_vacant { 0 };
+
+public:
+    using Iter = SlabIter<T>;
+
+    Slab(): entries(Vec<SlabEntry<T>>::make()) {}
+    Slab(const Slab&)                = delete;
+    Slab& operator=(const Slab&)     = delete;
+    Slab(Slab&&) noexcept            = default;
+    Slab& operator=(Slab&&) noexcept = default;
+
+    static auto make() -> Slab { return {}; }
+    static auto with_capacity(usize capacity) -> Slab {
+        auto slab    = Slab {};
+        slab.entries = Vec<SlabEntry<T>>::with_capacity(capacity);
+        return slab;
+    }
+
+    auto len() const noexcept -> usize { return length; }
+    auto is_empty() const noexcept -> bool { return length == 0; }
+
+    void reserve(usize additional) {
+        usize vacant = entries.len() - length;
+        if (additional > vacant) entries.reserve(additional - vacant);
+    }
+
+    /// Returns the key the next `insert` will use.
+    auto vacant_key() const noexcept -> usize { return next_vacant; }
+
+    auto insert(T value) -> usize {
+        usize key = next_vacant;
+        if (key == entries.len()) {
+            entries.push(SlabEntry<T> { Some(rstd::move(value)), 0 });
+            next_vacant = key + 1;
+        } else {
+            auto& entry = entries[key];
+            next_vacant = entry.next_vacant;
+            entry.value = Some(rstd::move(value));
+        }
+        ++length;
+        return key;
+    }
+
+    auto contains(usize key) const noexcept -> bool {
+        return key < entries.len() && entries[key].value.is_some();
+    }
+
+    auto get(usize key) const -> Option<rstd::ref<T>> {
+        if (! contains(key)) return None();
+        return Some(rstd::ref<T>::from_raw_parts(rstd::addressof(*entries[key].value)));
+    }
+
+    auto get_mut(usize key) -> Option<rstd::mut_ref<T>> {
+        if (! contains(key)) return None();
+        return Some(rstd::mut_ref<T>::from_raw_parts(rstd::addressof(*entries[key].value)));
+    }
+
+    auto try_remove(usize key) -> Option<T> {
+        if (! contains(key)) return None();
+        auto& entry       = entries[key];
+        auto  value       = entry.value.take();
+        entry.next_vacant = next_vacant;
+        next_vacant       = key;
+        --length;
+        return value;
+    }
+
+    /// Removes the value at `key`; panics if the slot is vacant.
+    auto remove(usize key) -> T {
+        auto value = try_remove(key);
+        if (value.is_none()) rstd::panic { "Slab::remove on a vacant key" };
+        return rstd::move(value).unwrap_unchecked();
+    }
+
+    template<typename F>
+    void retain(F predicate) {
+        for (usize i = 0; i < entries.len(); ++i) {
+            auto& entry = entries[i];
+            if (entry.value.is_some() && ! predicate(i, *entry.value)) (void)try_remove(i);
+        }
+    }
+
+    void clear() {
+        entries.clear();
+        length      = 0;
+        next_vacant = 0;
+    }
+
+    auto iter() const -> Iter { return Iter { rstd::addressof(entries), length }; }
+};
+
+/// A key into a `SlotMap`: a slot index and the generation of the value stored there.
+export struct SlotKey {
+    u32 index { rstd::numeric_limits<u32>::max() };
+    u32 generation { 0 };
+
+    /// A key that never refers to a value.
+    static constexpr auto null() noexcept -> SlotKey { return {}; }
+
+    constexpr auto is_null() const noexcept -> bool {
+        return index == rstd::numeric_limits<u32>::max();
+    }
+
+    friend constexpr auto operator==(SlotKey, SlotKey) noexcept -> bool = default;
+};
+
+export template<typename T>
+class SlotMapIter : public rstd::DefaultInClass<SlotMapIter<T>, rstd::iter::Iterator> {
+    SlabIter<T>     inner;
+    const Vec<u32>* generations;
+
+public:
+    using Item = rstd::tuple<SlotKey, rstd::ref<T>>;
+    SlotMapIter(SlabIter<T> source, const Vec<u32>* gens)
+        : inner(rstd::move(source)), generations(gens) {}
+
+    auto next() -> Option<Item> {
+        auto item = inner.next();
+        if (item.is_none()) return None();
+        auto [index, value] = rstd::move(item).unwrap_unchecked();
+        return Some(Item(SlotKey { u32(index), (*generations)[index] }, value));
+    }
+    auto size_hint() const -> rstd::iter::SizeHint { return inner.size_hint(); }
+    auto len() const noexcept -> usize { return inner.len(); }
+};
+
+/// A `Slab` whose keys carry a generation, so a key outlives its value safely.
+///
+/// Every removal bumps the slot's generation; a key taken before the removal no longer
+/// matches and every lookup with it returns `None`, even after the slot is reused. Handy for
+/// handles given to code that may outlive the entry, such as task or timer ids.
+export template<typename T>
+class SlotMap {
+    Slab<T>  slab;
+    Vec<u32> generations;
+
+    auto live(SlotKey key) const noexcept -> bool {
+        return key.index < generations.len() && generations[key.index] == key.generation &&
+               slab.contains(key.index);
+    }
+
+public:
+    using Iter = SlotMapIter<T>;
+
+    SlotMap(): slab(), generations(Vec<u32>::make()) {}
+    SlotMap(const SlotMap&)                = delete;
+    SlotMap& operator=(const SlotMap&)     = delete;
+    SlotMap(SlotMap&&) noexcept            = default;
+    SlotMap& operator=(SlotMap&&) noexcept = default;
+
+    static auto make() -> SlotMap { return {}; }
+    static auto with_capacity(usize capacity) -> SlotMap {
+        auto map        = SlotMap {};
+        map.slab        = Slab<T>::with_capacity(capacity);
+        map.generations = Vec<u32>::with_capacity(capacity);
+        return map;
+    }
+
+    auto len() const noexcept -> usize { return slab.len(); }
+    auto is_empty() const noexcept -> bool { return slab.is_empty(); }
+
+    void reserve(usize additional) { slab.reserve(additional); }
+
+    /// Inserts the value built by `f`, which receives the key it will be stored under.
+    template<typename F>
+    auto insert_with_key(F&& f) -> SlotKey {
+        usize index = slab.vacant_key();
+        if (index >= usize(rstd::numeric_limits<u32>::max())) {
+            rstd::panic { "SlotMap capacity exceeded" };
+        }
+        if (index == generations.len()) generations.push(0);
+        auto key = SlotKey { u32(index), generations[index] };
+        (void)slab.insert(f(key));
+        return key;
+    }
+
+    auto insert(T value) -> SlotKey {
+        return insert_with_key([&](SlotKey) -> T { return rstd::move(value); });
+    }
+
+    auto contains_key(SlotKey key) const noexcept -> bool { return live(key); }
+
+    auto get(SlotKey key) const -> Option<rstd::ref<T>> {
+        if (! live(key)) return None();
+        return slab.get(key.index);
+    }
+
+    auto get_mut(SlotKey key) -> Option<rstd::mut_ref<T>> {
+        if (! live(key)) return None();
+        return slab.get_mut(key.index);
+    }
+
+    auto remove(SlotKey key) -> Option<T> {
+        if (! live(key)) return None();
+        ++generations[key.index];
+        return slab.try_remove(key.index);
+    }
+
+    template<typename F>
+    void retain(F predicate) {
+        slab.retain([&](usize index, T& value) {
+            auto key  = SlotKey { u32(index), generations[index] };
+            bool keep = predicate(key, value);
+            if (! keep) ++generations[index];
+            return keep;
+        });
+    }
+
+    void clear() {
+        retain([](SlotKey, T&) { return false; });
+    }
+
+    auto iter() const -> Iter { return Iter { slab.iter(), rstd::addressof(generations) }; }
+};
+
+} // namespace alloc::collections
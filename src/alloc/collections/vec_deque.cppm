@@ -0,0 +1,273 @@
+module;
+#include <rstd/macro.hpp>
+
+export module rstd.alloc:collections.vec_deque;
+export import :vec;
+export import rstd.core;
+
+using ::alloc::vec::Vec;
+using namespace rstd::prelude;
+
+namespace alloc::collections
+{
+
+export template<typename T>
+class VecDeque;
+
+export template<typename T>
+class VecDequeIter : public rstd::DefaultInClass<VecDequeIter<T>, rstd::iter::Iterator> {
+    const T* first;
+    usize    first_len;
+    const T* second;
+    usize    second_len;
+
+public:
+    using Item = rstd::ref<T>;
+    VecDequeIter(slice<T> front, slice<T> back)
+        : first(front.p), first_len(front.len()), second(back.p), second_len(back.len()) {}
+
+    auto next() -> Option<Item> {
+        if (first_len == 0) {
+            if (second_len == 0) return None();
+            first     = rstd::exchange(second, nullptr);
+            first_len = rstd::exchange(second_len, 0);
+        }
+        --first_len;
+        return Some(Item::from_raw_parts(first++));
+    }
+    auto size_hint() const -> rstd::iter::SizeHint {
+        usize n = first_len + second_len;
+        return { n, Some(usize(n)) };
+    }
+    auto len() const noexcept -> usize { return first_len + second_len; }
+};
+
+/// A double-ended queue over a growable ring buffer.
+///
+/// Pushing and popping at either end is amortized O(1) and never shifts the other elements.
+/// The contents occupy at most two contiguous runs of the buffer, exposed by `as_slices`;
+/// `make_contiguous` rotates them into one.
+export template<typename T>
+class VecDeque {
+    RawVec<T> m_buf;
+    usize     m_head { 0 };
+    usize     m_len { 0 };
+
+    auto buf() const noexcept -> T* { return m_buf.ptr.as_mut_ptr().as_raw_ptr(); }
+
+    // Maps a logical offset from the head (or any index below twice the capacity) to a slot.
+    auto wrap(usize index) const noexcept -> usize {
+        return index >= m_buf.cap ? index - m_buf.cap : index;
+    }
+
+    auto slot(usize index) const noexcept -> T* { return buf() + wrap(m_head + index); }
+
+    auto is_contiguous() const noexcept -> bool { return m_head + m_len <= m_buf.cap; }
+
+    // Start of the first run and length of the wrapped second run, which starts at slot 0.
+    auto raw_slices() const noexcept -> rstd::tuple<usize, usize> {
+        if (is_contiguous()) return rstd::tuple<usize, usize>(m_head, usize(0));
+        return rstd::tuple<usize, usize>(m_head, m_len - (m_buf.cap - m_head));
+    }
+
+    void grow_to(usize new_cap) {
+        usize old_cap = m_buf.cap;
+        m_buf.grow(new_cap);
+        if (m_head + m_len <= old_cap) return;
+
+        // The contents wrapped: [m_head, old_cap) then [0, tail_len). Move the shorter run so
+        // it joins the other one across the enlarged buffer.
+        usize head_len = old_cap - m_head;
+        usize tail_len = m_len - head_len;
+        if (tail_len <= head_len && tail_len <= new_cap - old_cap) {
+            ::alloc::vec::relocate(buf() + old_cap, buf(), tail_len);
+        } else {
+            usize new_head = new_cap - head_len;
+            ::alloc::vec::relocate(buf() + new_head, buf() + m_head, head_len);
+            m_head = new_head;
+        }
+    }
+
+    void grow_for_push() {
+        if (m_len == m_buf.cap) grow_to(m_buf.cap == 0 ? 4 : m_buf.cap * 2);
+    }
+
+public:
+    USE_TRAIT(VecDeque)
+
+    VecDeque(): m_buf() {}
+    VecDeque(const VecDeque&)            = delete;
+    VecDeque& operator=(const VecDeque&) = delete;
+    VecDeque(VecDeque&& other) noexcept
+        : m_buf(other.m_buf),
+          m_head(rstd::exchange(other.m_head, 0)),
+          m_len(rstd::exchange(other.m_len, 0)) {
+        other.m_buf.reset_ptr();
+    }
+    VecDeque& operator=(VecDeque&& other) noexcept {
+        if (this != &other) {
+            clear();
+            m_buf.drop();
+            m_buf  = other.m_buf;
+            m_head = rstd::exchange(other.m_head, 0);
+            m_len  = rstd::exchange(other.m_len, 0);
+            other.m_buf.reset_ptr();
+        }
+        return *this;
+    }
+    ~VecDeque() {
+        clear();
+        m_buf.drop();
+    }
+
+    static auto make() -> VecDeque { return {}; }
+    static auto with_capacity(usize capacity) -> VecDeque {
+        auto deque  = VecDeque {};
+        deque.m_buf = RawVec<T>::with_capacity(capacity);
+        return deque;
+    }
+
+    /// Takes over the buffer of `vec` without moving its elements.
+    static auto from_vec(Vec<T> vec) -> VecDeque {
+        auto [p, length, capacity] = rstd::move(vec).into_raw_parts();
+        auto deque                 = VecDeque {};
+        if (capacity != 0) {
+            deque.m_buf.ptr = rstd::ptr_::non_null::NonNull<T>::make_unchecked(
+                mut_ptr<T>::from_raw_parts(p));
+            deque.m_buf.cap = capacity;
+        }
+        deque.m_len = length;
+        return deque;
+    }
+
+    auto len() const noexcept -> usize { return m_len; }
+    auto is_empty() const noexcept -> bool { return m_len == 0; }
+    auto capacity() const noexcept -> usize { return m_buf.cap; }
+
+    void reserve(usize additional) {
+        usize required = m_len + additional;
+        if (required <= m_buf.cap) return;
+        usize new_cap = m_buf.cap == 0 ? usize { 4 } : m_buf.cap;
+        while (new_cap < required) new_cap *= 2;
+        grow_to(new_cap);
+    }
+
+    void push_back(T value) {
+        grow_for_push();
+        rstd::construct_at(slot(m_len), rstd::move(value));
+        ++m_len;
+    }
+
+    void push_front(T value) {
+        grow_for_push();
+        m_head = m_head == 0 ? m_buf.cap - 1 : m_head - 1;
+        rstd::construct_at(buf() + m_head, rstd::move(value));
+        ++m_len;
+    }
+
+    auto pop_front() -> Option<T> {
+        if (m_len == 0) return None();
+        T* p     = buf() + m_head;
+        T  value = rstd::move(*p);
+        rstd::destroy_at(p);
+        m_head = wrap(m_head + 1);
+        --m_len;
+        return Some(rstd::move(value));
+    }
+
+    auto pop_back() -> Option<T> {
+        if (m_len == 0) return None();
+        --m_len;
+        T* p     = slot(m_len);
+        T  value = rstd::move(*p);
+        rstd::destroy_at(p);
+        return Some(rstd::move(value));
+    }
+
+    auto get(usize index) const -> Option<rstd::ref<T>> {
+        if (index >= m_len) return None();
+        return Some(rstd::ref<T>::from_raw_parts(slot(index)));
+    }
+
+    auto get_mut(usize index) -> Option<rstd::mut_ref<T>> {
+        if (index >= m_len) return None();
+        return Some(rstd::mut_ref<T>::from_raw_parts(slot(index)));
+    }
+
+    auto front() const -> Option<rstd::ref<T>> { return get(0); }
+    auto back() const -> Option<rstd::ref<T>> {
+        if (m_len == 0) return None();
+        return get(m_len - 1);
+    }
+    auto front_mut() -> Option<rstd::mut_ref<T>> { return get_mut(0); }
+    auto back_mut() -> Option<rstd::mut_ref<T>> {
+        if (m_len == 0) return None();
+        return get_mut(m_len - 1);
+    }
+
+    /// Indexes from the front, panicking if out of bounds.
+    T& operator[](usize index) {
+        if (index >= m_len) rstd::panic { "VecDeque index out of bounds" };
+        return *slot(index);
+    }
+    const T& operator[](usize index) const {
+        if (index >= m_len) rstd::panic { "VecDeque index out of bounds" };
+        return *slot(index);
+    }
+
+    /// Returns the contents in order as two slices; the second is empty unless they wrap.
+    auto as_slices() const -> rstd::tuple<slice<T>, slice<T>> {
+        auto [front, back] = raw_slices();
+        return rstd::tuple<slice<T>, slice<T>>(
+            slice<T>::from_raw_parts(buf() + front, m_len - back),
+            slice<T>::from_raw_parts(buf(), back));
+    }
+
+    auto as_mut_slices() -> rstd::tuple<mut_ref<T[]>, mut_ref<T[]>> {
+        auto [front, back] = raw_slices();
+        return rstd::tuple<mut_ref<T[]>, mut_ref<T[]>>(
+            mut_ref<T[]>::from_raw_parts(buf() + front, m_len - back),
+            mut_ref<T[]>::from_raw_parts(buf(), back));
+    }
+
+    /// Rearranges the buffer so the contents form one slice, and returns it.
+    auto make_contiguous() -> mut_ref<T[]> {
+        if (! is_contiguous()) {
+            usize head_len = m_buf.cap - m_head;
+            usize tail_len = m_len - head_len;
+            if (m_buf.cap - m_len >= head_len) {
+                // The gap fits the head run: shift the tail run up, then bring the head run down.
+                ::alloc::vec::relocate(buf() + head_len, buf(), tail_len);
+                ::alloc::vec::relocate(buf(), buf() + m_head, head_len);
+            } else {
+                auto  fresh = RawVec<T>::with_capacity(m_buf.cap);
+                auto* dst   = fresh.ptr.as_mut_ptr().as_raw_ptr();
+                ::alloc::vec::relocate(dst, buf() + m_head, head_len);
+                ::alloc::vec::relocate(dst + head_len, buf(), tail_len);
+                m_buf.drop();
+                m_buf = fresh;
+            }
+            m_head = 0;
+        }
+        return mut_ref<T[]>::from_raw_parts(buf() + m_head, m_len);
+    }
+
+    void truncate(usize new_len) {
+        while (m_len > new_len) (void)pop_back();
+    }
+
+    void clear() {
+        auto [front, back] = as_mut_slices();
+        for (usize i = 0; i < front.len(); ++i) rstd::destroy_at(front.p + i);
+        for (usize i = 0; i < back.len(); ++i) rstd::destroy_at(back.p + i);
+        m_head = 0;
+        m_len  = 0;
+    }
+
+    auto iter() const -> VecDequeIter<T> {
+        auto [front, back] = as_slices();
+        return VecDequeIter<T>(front, back);
+    }
+};
+
+} // namespace alloc::collections
@@ -4,8 +4,10 @@ export import :rc;
 export import :str;
 export import :boxed;
 export import :vec;
+export import :slice;
 export import :ffi;
 export import :string;
+export import :arc_str;
 export import :sync;
 export import :collections;
 export import :hash.random;
@@ -0,0 +1,132 @@
+module;
+#include <rstd/macro.hpp>
+export module rstd.alloc:slice;
+export import :alloc;
+export import rstd.core;
+
+using rstd::alloc::Layout;
+namespace sort_detail = rstd::slice_::sort_detail;
+using namespace rstd::prelude;
+
+namespace alloc::slice_
+{
+
+/// Uninitialized scratch storage for `n` elements, freed on scope exit. Sort routines use it for
+/// merge buffers; it never constructs or destroys elements.
+export template<typename T>
+class ScratchBuf {
+    T*     m_ptr { nullptr };
+    Layout m_layout {};
+
+public:
+    explicit ScratchBuf(usize n) {
+        if (n == 0) return;
+        m_layout = Layout::array<T>(n).unwrap();
+        auto raw = ::alloc::alloc(m_layout).as_raw_ptr();
+        if (raw == nullptr) ::alloc::handle_alloc_error(m_layout);
+        m_ptr = reinterpret_cast<T*>(raw);
+    }
+    ScratchBuf(const ScratchBuf&)            = delete;
+    ScratchBuf& operator=(const ScratchBuf&) = delete;
+    ~ScratchBuf() {
+        if (m_ptr != nullptr)
+            ::alloc::dealloc(mut_ptr<u8>::from_raw_parts(reinterpret_cast<u8*>(m_ptr)), m_layout);
+    }
+
+    auto get() const noexcept -> T* { return m_ptr; }
+};
+
+/// Stable sort of `v[0, n)` with a strict-weak-order predicate. Allocates `n / 2` elements of
+/// scratch space for inputs long enough to need merging.
+export template<typename T, typename F>
+void stable_sort_by_less(T* v, usize n, F& is_less) {
+    if (n <= sort_detail::INSERTION_THRESHOLD) {
+        sort_detail::insertion_sort(v, n, is_less);
+        return;
+    }
+    ScratchBuf<T> buf(n / 2);
+    sort_detail::merge_sort(v, n, buf.get(), is_less);
+}
+
+/// Sorts the slice in ascending order with `<`, keeping equal elements in their original order.
+///
+/// Run-adaptive merge sort: natural runs, ascending or descending, are found and merged, so
+/// sorted, reversed and concatenated-sorted inputs take O(n). Allocates up to `len / 2`
+/// elements of scratch; use `sort_unstable` to avoid the allocation.
+export template<typename T>
+void sort(mut_ref<T[]> v) {
+    auto is_less = [](const T& a, const T& b) { return a < b; };
+    stable_sort_by_less(v.p, v.length, is_less);
+}
+
+/// Stable sort with a three-way comparator returning an ordering (`a <=> b` style).
+export template<typename T, typename F>
+void sort_by(mut_ref<T[]> v, F&& compare) {
+    auto is_less = [&compare](const T& a, const T& b) { return compare(a, b) < 0; };
+    stable_sort_by_less(v.p, v.length, is_less);
+}
+
+/// Stable sort by the key `key(x)`. The key is recomputed on every comparison.
+export template<typename T, typename F>
+void sort_by_key(mut_ref<T[]> v, F&& key) {
+    auto is_less = [&key](const T& a, const T& b) { return key(a) < key(b); };
+    stable_sort_by_less(v.p, v.length, is_less);
+}
+
+// Below this length a comparison sort wins over the fixed cost of the histograms.
+inline constexpr usize RADIX_THRESHOLD = 64;
+
+/// Sorts integers with an LSD radix sort, one byte per pass.
+///
+/// All byte histograms are built in one read of the input, and passes whose byte is the same
+/// for every element are skipped, so narrow value ranges cost fewer than `sizeof(T)` passes.
+/// O(n * sizeof(T)) with no comparisons; allocates `len` elements of scratch. Signed values
+/// sort in numeric order.
+export template<mtp::is_int T>
+void radix_sort(mut_ref<T[]> v) {
+    static_assert(sizeof(T) <= sizeof(u64));
+    constexpr usize BYTES  = sizeof(T);
+    constexpr bool  SIGNED = T(-1) < T(0);
+
+    usize n = v.length;
+    if (n <= RADIX_THRESHOLD) {
+        rstd::slice_::sort_unstable(v);
+        return;
+    }
+
+    auto digit = [](T x, usize byte) -> usize {
+        auto d = usize((u64(x) >> (8 * byte)) & 0xFF);
+        if constexpr (SIGNED) {
+            if (byte == BYTES - 1) d ^= 0x80;
+        }
+        return d;
+    };
+
+    usize counts[BYTES][256] {};
+    for (usize i = 0; i < n; ++i) {
+        for (usize b = 0; b < BYTES; ++b) ++counts[b][digit(v.p[i], b)];
+    }
+
+    ScratchBuf<T> buf(n);
+    T*            src = v.p;
+    T*            dst = buf.get();
+    for (usize b = 0; b < BYTES; ++b) {
+        auto& count = counts[b];
+        if (count[digit(src[0], b)] == n) continue;
+
+        usize offset = 0;
+        for (usize d = 0; d < 256; ++d) {
+            usize c  = count[d];
+            count[d] = offset;
+            offset += c;
+        }
+        for (usize i = 0; i < n; ++i) dst[count[digit(src[i], b)]++] = src[i];
+
+        T* tmp = src;
+        src    = dst;
+        dst    = tmp;
+    }
+    if (src != v.p) rstd::mem::memcpy(v.p, src, n * sizeof(T));
+}
+
+} // namespace alloc::slice_
@@ -42,30 +42,135 @@ export struct Chars : rstd::DefaultInClass<Chars, rstd::iter::Iterator> {
 };
 
 /// A UTF-8 encoded, growable string, analogous to Rust's `String`.
+///
+/// Strings of up to `INLINE_CAP` bytes live inside the object itself, so short keys, names and
+/// formatted numbers never touch the allocator. The last byte of the representation is the tag:
+/// the inline length, or `HEAP_TAG` when the bytes live in a heap buffer laid out as
+/// `[ptr | len | cap]`. An all-zero representation is the empty string.
 export class String {
-    Vec<u8> vec;
+    static constexpr usize WORD     = sizeof(usize);
+    static constexpr usize REPR     = 24;
+    static constexpr usize TAG      = REPR - 1;
+    static constexpr u8    HEAP_TAG = 0xFF;
+    // Capacity bytes between `len` and the tag; 7 on 64-bit targets, a full word on 32-bit.
+    static constexpr usize CAP_BYTES = TAG - 2 * WORD < WORD ? TAG - 2 * WORD : WORD;
 
-    constexpr String(Vec<u8>&& p): vec(rstd::move(p)) {}
+    static_assert(3 * WORD <= REPR);
+
+    alignas(usize) u8 m_repr[REPR] {};
+
+    constexpr auto is_heap() const noexcept -> bool { return m_repr[TAG] == HEAP_TAG; }
+
+    auto heap_ptr() const noexcept -> u8* {
+        u8* p;
+        rstd::mem::memcpy(&p, m_repr, WORD);
+        return p;
+    }
+    auto heap_len() const noexcept -> usize {
+        usize n;
+        rstd::mem::memcpy(&n, m_repr + WORD, WORD);
+        return n;
+    }
+    auto heap_cap() const noexcept -> usize {
+        usize cap = 0;
+        for (usize i = 0; i < CAP_BYTES; ++i) cap |= usize(m_repr[2 * WORD + i]) << (8 * i);
+        return cap;
+    }
+
+    void set_len(usize n) noexcept {
+        if (is_heap()) {
+            rstd::mem::memcpy(m_repr + WORD, &n, WORD);
+        } else {
+            m_repr[TAG] = u8(n);
+        }
+    }
+
+    /// Takes ownership of `bytes`' buffer. `*this` must not own a heap buffer.
+    void adopt(Vec<u8>&& bytes) {
+        auto [p, n, cap] = rstd::move(bytes).into_raw_parts();
+        if (p == nullptr) {
+            m_repr[TAG] = 0;
+            return;
+        }
+        debug_assert(CAP_BYTES == WORD || (cap >> (8 * CAP_BYTES - 1) >> 1) == 0);
+        rstd::mem::memcpy(m_repr, &p, WORD);
+        rstd::mem::memcpy(m_repr + WORD, &n, WORD);
+        for (usize i = 0; i < CAP_BYTES; ++i) m_repr[2 * WORD + i] = u8(cap >> (8 * i));
+        m_repr[TAG] = HEAP_TAG;
+    }
+
+    /// Moves the heap buffer out as a `Vec<u8>`, leaving `*this` empty and inline.
+    auto take_heap() noexcept -> Vec<u8> {
+        auto out = Vec<u8>::from_raw_parts(heap_ptr(), heap_len(), heap_cap());
+        rstd::mem::memset(m_repr, 0, REPR);
+        return out;
+    }
+
+    void release() noexcept {
+        if (is_heap()) (void)take_heap();
+    }
+
+    /// Moves the contents to a heap buffer of at least `new_cap` bytes.
+    void grow(usize new_cap) {
+        if (is_heap()) {
+            auto v = take_heap();
+            v.reserve(new_cap - v.len());
+            adopt(rstd::move(v));
+        } else {
+            auto v = Vec<u8>::with_capacity(new_cap);
+            v.extend_from_slice(m_repr, len());
+            adopt(rstd::move(v));
+        }
+    }
+
+    auto raw_end() const noexcept -> const u8* { return as_raw_ptr() + len(); }
+
+    void append(const u8* p, usize n) {
+        if (n == 0) return;
+        reserve(n);
+        auto old = len();
+        rstd::mem::memcpy(as_mut_raw_ptr() + old, p, n);
+        set_len(old + n);
+    }
 
 public:
     USE_TRAIT(String)
-    constexpr String()                 = default;
-    constexpr String(Self&&) noexcept  = default;
-    String& operator=(Self&&) noexcept = default;
+
+    /// Longest string stored without a heap allocation.
+    static constexpr usize INLINE_CAP = TAG;
+
+    constexpr String() = default;
+    String(Self&& o) noexcept {
+        rstd::mem::memcpy(m_repr, o.m_repr, REPR);
+        rstd::mem::memset(o.m_repr, 0, REPR);
+    }
+    String& operator=(Self&& o) noexcept {
+        if (this != &o) {
+            release();
+            rstd::mem::memcpy(m_repr, o.m_repr, REPR);
+            rstd::mem::memset(o.m_repr, 0, REPR);
+        }
+        return *this;
+    }
+    ~String() { release(); }
 
     using value_type = u8;
 
     /// Creates a new empty `String`.
     static auto make() -> String { return {}; }
 
+    /// Creates an empty `String` that can hold `capacity` bytes without reallocating.
+    static auto with_capacity(usize capacity) -> String {
+        auto s = String {};
+        if (capacity > INLINE_CAP) s.adopt(Vec<u8>::with_capacity(capacity));
+        return s;
+    }
+
     /// Creates a `String` from a string slice (copies the bytes).
     static auto make(ref<str> s) -> String {
-        auto v = Vec<u8>::with_capacity(s.size());
-        for (usize i = 0; i < s.size(); i++) {
-            u8 b = s.data()[i];
-            v.push(rstd::move(b));
-        }
-        return String { rstd::move(v) };
+        auto out = with_capacity(s.size());
+        out.append(s.data(), s.size());
+        return out;
     }
 
     /// Creates a `String` from a null-terminated C string (copies the bytes).
@@ -76,128 +181,190 @@ public:
     void clone_from(String& source) { *this = source.clone(); }
 
     /// Creates a new `String` from a byte vector without checking UTF-8 validity.
+    ///
+    /// The vector's buffer is adopted as is; no bytes are copied.
     static auto from_utf8_unchecked(Vec<u8>&& bytes) -> String {
-        return String { rstd::move(bytes) };
+        auto s = String {};
+        s.adopt(rstd::move(bytes));
+        return s;
     }
 
     /// Creates a new `String` from owned bytes after validating UTF-8.
     static auto from_utf8(Vec<u8>&& bytes) -> Result<String, rstd::str_::Utf8Error> {
         auto validation = rstd::str_::validate_utf8(bytes.as_slice());
         if (validation.is_err()) return Err(rstd::move(validation).unwrap_err());
-        return Ok(String { rstd::move(bytes) });
+        return Ok(from_utf8_unchecked(rstd::move(bytes)));
+    }
+
+    /// Consumes the string and returns its bytes. A heap buffer is handed over without copying.
+    auto into_bytes() && -> Vec<u8> {
+        if (is_heap()) return take_heap();
+        auto v = Vec<u8>::with_capacity(len());
+        v.extend_from_slice(m_repr, len());
+        m_repr[TAG] = 0;
+        return v;
     }
 
     /// Returns a reference to the string as a `CStr`.
     /// \return A `ref<CStr>` view of the string data.
     auto as_ref() const noexcept -> ref<ffi::CStr> {
-        auto p = as_cast<ffi::CStr const*>(vec.as_ptr().as_raw_ptr());
-        return ref<ffi::CStr>::from_raw_parts(p, vec.len());
+        auto p = as_cast<ffi::CStr const*>(as_raw_ptr());
+        return ref<ffi::CStr>::from_raw_parts(p, len());
     }
 
     /// Converts the `String` to a `ref<str>` string slice.
-    constexpr operator ref<str>() const {
-        return ref<str>::from_raw_parts(vec.as_ptr().as_raw_ptr(), vec.len());
+    operator ref<str>() const { return as_str(); }
+
+    /// Ensures room for at least `additional` more bytes, doubling the capacity when growing.
+    void reserve(usize additional) {
+        auto required = len() + additional;
+        auto cap      = capacity();
+        if (required <= cap) return;
+        grow(rstd::max(required, cap * 2));
+    }
+
+    /// Drops excess capacity, moving back inline when the contents fit.
+    void shrink_to_fit() {
+        if (! is_heap() || heap_cap() == heap_len()) return;
+        auto old = take_heap();
+        if (old.len() <= INLINE_CAP) {
+            rstd::mem::memcpy(m_repr, old.begin(), old.len());
+            m_repr[TAG] = u8(old.len());
+        } else {
+            auto v = Vec<u8>::with_capacity(old.len());
+            v.extend_from_slice(old.begin(), old.len());
+            adopt(rstd::move(v));
+        }
     }
 
     /// Appends a `char` to the end of this string.
-    void push_back(char c) { vec.push(static_cast<u8>(c)); }
+    void push_back(char c) { push_back(static_cast<u8>(c)); }
     /// Appends a byte to the end of this string.
-    void push_back(u8 c) { vec.push(rstd::move(c)); }
+    void push_back(u8 c) {
+        reserve(1);
+        auto old              = len();
+        as_mut_raw_ptr()[old] = c;
+        set_len(old + 1);
+    }
 
     /// Appends a UTF-8 string slice.
-    void push_str(ref<str> value) {
-        if (value.size() == 0) return;
-        vec.extend_from_slice(slice<u8>::from_raw_parts(value.data(), value.size()));
-    }
+    void push_str(ref<str> value) { append(value.data(), value.size()); }
 
     /// Appends a Unicode code point, encoding as UTF-8.
     void push(char32_t cp) {
         u8   buf[4];
         auto n = rstd::char_::encode_utf8(cp, buf);
-        for (usize i = 0; i < n; i++) {
-            u8 b = buf[i];
-            vec.push(rstd::move(b));
-        }
+        append(buf, n);
     }
 
     /// Returns a string slice of the entire `String`.
-    constexpr auto as_str() const noexcept -> ref<str> {
-        return ref<str>::from_raw_parts(vec.as_ptr().as_raw_ptr(), vec.len());
+    auto as_str() const noexcept -> ref<str> {
+        return ref<str>::from_raw_parts(as_raw_ptr(), len());
     }
 
     /// Returns the byte length of this string.
-    constexpr auto len() const noexcept -> usize { return vec.len(); }
+    auto len() const noexcept -> usize { return is_heap() ? heap_len() : usize(m_repr[TAG]); }
     /// Returns `true` if this string contains no bytes.
-    constexpr auto is_empty() const noexcept -> bool { return vec.len() == 0; }
-    /// Returns the current capacity in bytes.
-    constexpr auto capacity() const noexcept -> usize { return vec.capacity(); }
+    auto is_empty() const noexcept -> bool { return len() == 0; }
+    /// Returns the current capacity in bytes; at least `INLINE_CAP`.
+    auto capacity() const noexcept -> usize { return is_heap() ? heap_cap() : INLINE_CAP; }
+    /// Returns `true` if the bytes are stored inside the object rather than on the heap.
+    auto is_inline() const noexcept -> bool { return ! is_heap(); }
     /// Clears the string, removing all bytes.
-    constexpr void clear() { vec.clear(); }
+    void clear() noexcept { set_len(0); }
 
     /// Truncates the string to `new_len` bytes.
     ///
     /// Panics if `new_len` is not on a UTF-8 character boundary.
     void truncate(usize new_len) {
-        if (new_len < vec.len()) {
-            rstd_assert(rstd::char_::is_char_boundary(vec.begin(), vec.len(), new_len));
-            while (vec.len() > new_len) vec.pop();
+        if (new_len < len()) {
+            rstd_assert(rstd::char_::is_char_boundary(as_raw_ptr(), len(), new_len));
+            set_len(new_len);
         }
     }
 
-    friend constexpr auto operator<=>(const String& a, const String& b) noexcept {
+    /// Converts ASCII letters to lowercase in place; other bytes are unchanged.
+    void make_ascii_lowercase() noexcept {
+        rstd::str_::validations::make_ascii_lowercase(as_mut_raw_ptr(), len());
+    }
+    /// Converts ASCII letters to uppercase in place; other bytes are unchanged.
+    void make_ascii_uppercase() noexcept {
+        rstd::str_::validations::make_ascii_uppercase(as_mut_raw_ptr(), len());
+    }
+    /// Returns a copy with ASCII letters converted to lowercase.
+    auto to_ascii_lowercase() const -> String {
+        auto out = clone();
+        out.make_ascii_lowercase();
+        return out;
+    }
+    /// Returns a copy with ASCII letters converted to uppercase.
+    auto to_ascii_uppercase() const -> String {
+        auto out = clone();
+        out.make_ascii_uppercase();
+        return out;
+    }
+    /// Returns `true` if all bytes are ASCII.
+    auto is_ascii() const noexcept -> bool { return rstd::str_::is_ascii(as_str()); }
+    /// Compares with `other`, treating ASCII letters case-insensitively.
+    auto eq_ignore_ascii_case(ref<str> other) const noexcept -> bool {
+        return rstd::str_::eq_ignore_ascii_case(as_str(), other);
+    }
+
+    friend auto operator<=>(const String& a, const String& b) noexcept {
         return rstd::lexicographical_compare_three_way(
-            a.vec.begin(), a.vec.end(), b.vec.begin(), b.vec.end());
+            a.as_raw_ptr(), a.raw_end(), b.as_raw_ptr(), b.raw_end());
     }
-    friend constexpr auto operator<=>(const String& a, slice<u8> b) noexcept {
+    friend auto operator<=>(const String& a, slice<u8> b) noexcept {
         auto ptr = &*b;
         return rstd::lexicographical_compare_three_way(
-            a.vec.begin(), a.vec.end(), ptr, ptr + b.len());
+            a.as_raw_ptr(), a.raw_end(), ptr, ptr + b.len());
     }
-    friend constexpr auto operator<=>(const String& a, ref<str> b) noexcept {
+    friend auto operator<=>(const String& a, ref<str> b) noexcept {
         return rstd::lexicographical_compare_three_way(
-            a.vec.begin(), a.vec.end(), b.begin(), b.end());
+            a.as_raw_ptr(), a.raw_end(), b.begin(), b.end());
     }
-    friend constexpr auto operator<=>(ref<str> a, const String& b) noexcept {
+    friend auto operator<=>(ref<str> a, const String& b) noexcept {
         return rstd::lexicographical_compare_three_way(
-            a.begin(), a.end(), b.vec.begin(), b.vec.end());
+            a.begin(), a.end(), b.as_raw_ptr(), b.raw_end());
     }
-    friend constexpr bool operator==(const String& a, ref<str> b) noexcept {
+    friend bool operator==(const String& a, ref<str> b) noexcept {
         return a.size() == b.size() && rstd::mem::memcmp(a.begin(), b.begin(), a.size()) == 0;
     }
-    friend constexpr bool operator==(ref<str> a, const String& b) noexcept { return b == a; }
-    friend bool           operator==(char const* b, const String& a) noexcept {
+    friend bool operator==(ref<str> a, const String& b) noexcept { return b == a; }
+    friend bool operator==(char const* b, const String& a) noexcept {
         const usize length = rstd::strlen(b);
-        return a.vec.len() == length &&
-               rstd::mem::memcmp(a.vec.begin(), reinterpret_cast<const u8*>(b), length) == 0;
+        return a.len() == length &&
+               rstd::mem::memcmp(a.as_raw_ptr(), reinterpret_cast<const u8*>(b), length) == 0;
     }
 
     /// Returns a raw pointer to the underlying byte buffer.
     /// \return A const pointer to the first byte.
-    constexpr auto as_raw_ptr() const noexcept -> const u8* { return vec.begin(); }
-
+    auto as_raw_ptr() const noexcept -> const u8* { return is_heap() ? heap_ptr() : m_repr; }
+    /// Returns a mutable raw pointer to the underlying byte buffer.
+    ///
+    /// Writes must keep the contents valid UTF-8.
+    auto as_mut_raw_ptr() noexcept -> u8* { return is_heap() ? heap_ptr() : m_repr; }
     /// Returns a const iterator to the beginning of the string.
-    constexpr auto begin() const noexcept -> const char* {
-        return rstd::bit_cast<const char*>(vec.begin());
+    auto begin() const noexcept -> const char* {
+        return rstd::bit_cast<const char*>(as_raw_ptr());
     }
     /// Returns a const iterator to the end of the string.
-    constexpr auto end() const noexcept -> const char* {
-        return rstd::bit_cast<const char*>(vec.end());
-    }
+    auto end() const noexcept -> const char* { return rstd::bit_cast<const char*>(raw_end()); }
     /// Returns a pointer to the string data as a char array.
     /// \return A const `char*` pointer to the data.
-    constexpr auto data() const noexcept -> const char* {
-        return rstd::bit_cast<const char*>(vec.as_ptr().as_raw_ptr());
-    }
+    auto data() const noexcept -> const char* { return begin(); }
     /// Returns the length of the string in bytes.
     /// \return The number of bytes in the string.
-    constexpr auto size() const noexcept -> usize { return vec.len(); }
+    auto size() const noexcept -> usize { return len(); }
 
     /// Returns an iterator over the bytes (`u8`) of the string.
-    auto bytes() const { return rstd::iter::SliceIter<u8>(vec.begin(), vec.end()).copied(); }
+    auto bytes() const { return rstd::iter::SliceIter<u8>(as_raw_ptr(), raw_end()).copied(); }
     /// Returns an iterator over the Unicode scalar values of the string.
-    auto chars() const -> Chars { return Chars(vec.begin(), vec.end()); }
+    auto chars() const -> Chars { return Chars(as_raw_ptr(), raw_end()); }
 };
 
+static_assert(sizeof(String) == 24);
+
 /// A trait for converting a value to a `String`.
 export struct ToString {
     template<typename T, typename = void>
@@ -226,10 +393,7 @@ struct Impl<hash::Hash, String> : ImplBase<String> {
 template<>
 struct Impl<fmt::Write, String> : ImplBase<String> {
     auto write_str(const u8* p, usize len) -> bool {
-        auto& self = this->self();
-        for (usize i = 0; i < len; ++i) {
-            self.push_back(p[i]);
-        }
+        this->self().push_str(ref<str>::from_raw_parts(p, len));
         return true;
     }
 };
@@ -471,10 +635,7 @@ struct Impl<T, A> : DefaultInImpl<T, A> {
 
 template<mtp::same_as<Into<Vec<u8>>> T, mtp::same_as<String> A>
 struct Impl<T, A> : ImplBase<A> {
-    auto into() -> Vec<u8> {
-        auto& a = this->self();
-        return rstd::move(a.vec);
-    }
+    auto into() -> Vec<u8> { return rstd::move(this->self()).into_bytes(); }
 };
 
 /// Converts a value that implements `ToString` into a `String`.
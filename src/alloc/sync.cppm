@@ -84,6 +84,19 @@ auto arc_allocate_value(Args&&... args) -> mut_ptr<T> {
     return mut_ptr<T>::from_raw_parts(value);
 }
 
+// Allocates the counts followed by room for `len` elements, which are left unconstructed.
+template<typename E>
+auto arc_allocate_array(usize len) -> mut_ptr<E[]> {
+    auto value_layout = Layout::array<E>(len).unwrap();
+    auto allocation   = arc_allocation_layout(value_layout);
+    auto result       = rstd::as<Allocator>(::alloc::GLOBAL).allocate(allocation.layout);
+    if (result.is_err()) ::alloc::handle_alloc_error(allocation.layout);
+
+    auto* base = result.unwrap_unchecked().as_mut_ptr().as_raw_ptr();
+    rstd::construct_at(reinterpret_cast<ArcHeader*>(base));
+    return mut_ptr<E[]>::from_raw_parts(reinterpret_cast<E*>(base + allocation.value_offset), len);
+}
+
 template<typename T>
 void arc_deallocate(mut_ptr<T> pointer) noexcept {
     auto  allocation = arc_allocation_layout(pointer);
@@ -231,6 +244,45 @@ public:
         return Arc<MaybeUninit<T>>::make(MaybeUninit<T>::uninit());
     }
 
+    /// Allocates `len` uninitialized elements in the same allocation as the counts.
+    static auto make_uninit_slice(usize len) -> Arc<MaybeUninit<mtp::rm_ext<T>>[]>
+        requires mtp::DSTArray<T>
+    {
+        using Slot   = MaybeUninit<mtp::rm_ext<T>>;
+        auto pointer = arc_allocate_array<Slot>(len);
+        for (usize i = 0; i < len; ++i) {
+            rstd::construct_at(pointer.as_raw_ptr() + i, Slot::uninit());
+        }
+        return Arc<Slot[]> { ArcData<Slot[]> { .pointer = pointer } };
+    }
+
+    /// Builds a shared slice of `len` elements, element `i` constructed from `f(i)`, in one
+    /// allocation together with the counts.
+    template<typename F>
+    static auto from_fn(usize len, F&& f) -> Arc
+        requires mtp::DSTArray<T>
+    {
+        auto pointer = arc_allocate_array<mtp::rm_ext<T>>(len);
+        for (usize i = 0; i < len; ++i) rstd::construct_at(pointer.as_raw_ptr() + i, f(i));
+        return Arc { ArcData<T> { .pointer = pointer } };
+    }
+
+    /// Copies `values` into a shared slice allocated together with the counts.
+    static auto from_slice(slice<mtp::rm_ext<T>> values) -> Arc
+        requires mtp::DSTArray<T>
+    {
+        using Element = mtp::rm_ext<T>;
+        if constexpr (mtp::triv_copy<Element>) {
+            auto pointer = arc_allocate_array<Element>(values.len());
+            if (values.len() != 0) {
+                rstd::mem::memcpy(pointer.as_raw_ptr(), values.p, values.len() * sizeof(Element));
+            }
+            return Arc { ArcData<T> { .pointer = pointer } };
+        } else {
+            return from_fn(values.len(), [&](usize i) { return Element(values[i]); });
+        }
+    }
+
     static auto from_raw(ArcRaw<T> raw) noexcept -> Arc {
         return Arc { ArcData<T> { .pointer = raw.into_ptr() } };
     }
@@ -244,9 +296,50 @@ public:
         return Arc<Value> { ArcData<Value> { .pointer = pointer } };
     }
 
+    /// Converts a slice of initialized `MaybeUninit` elements in place.
+    auto assume_init()
+        requires mtp::DSTArray<T> &&
+                 (! mtp::same_as<typename maybe_uninit_traits<mtp::rm_ext<T>>::value_type, void>)
+    {
+        using Value  = maybe_uninit_traits<mtp::rm_ext<T>>::value_type;
+        auto pointer = mut_ptr<Value[]>::from_raw_parts(
+            reinterpret_cast<Value*>(self.pointer.as_raw_ptr()), self.pointer.len());
+        self.pointer.reset();
+        return Arc<Value[]> { ArcData<Value[]> { .pointer = pointer } };
+    }
+
     auto deref() const noexcept -> ref<T> { return self.pointer.as_ref(); }
     auto deref_mut() const noexcept -> mut_ref<T> { return self.pointer.as_mut_ref(); }
 
+    /// Returns a mutable reference, cloning the value into a fresh allocation first if other
+    /// `Arc`s share it (copy-on-write).
+    ///
+    /// When this is the only `Arc` but `Weak`s remain, the value is moved to a new allocation
+    /// instead, and the weak references can no longer upgrade.
+    auto make_mut() -> mut_ref<T>
+        requires Impled<T, Sized> && Impled<T, rstd::clone::Clone>
+    {
+        auto* header   = arc_header(self.pointer);
+        usize expected = 1;
+        if (header->strong.compare_exchange_strong(expected,
+                                                   0,
+                                                   rstd::sync::atomic::Ordering::Acquire,
+                                                   rstd::sync::atomic::Ordering::Relaxed)) {
+            // With strong at 0 no `Weak` can upgrade, so the weak count is stable to read.
+            if (header->weak.load(rstd::sync::atomic::Ordering::Relaxed) == 1) {
+                header->strong.store(1, rstd::sync::atomic::Ordering::Release);
+            } else {
+                auto fresh = arc_allocate_value<T>(rstd::move(*self.pointer));
+                rstd::ptr_::drop_in_place(self.pointer);
+                arc_drop_weak(self.pointer);
+                self.pointer = fresh;
+            }
+        } else {
+            *this = Arc::make(rstd::as<rstd::clone::Clone>(*self.pointer).clone());
+        }
+        return self.pointer.as_mut_ref();
+    }
+
     explicit operator bool() const noexcept { return self.pointer != nullptr; }
 
     usize strong_count() const noexcept {
@@ -391,4 +484,218 @@ auto Arc<T>::downgrade() const noexcept -> Weak<T> {
     return result;
 }
 
+// Identifies the calling thread for the ownership checks of `LocalArc`.
+inline thread_local u8 LOCAL_ARC_THREAD_TAG {};
+
+/// A handle to an `Arc` allocation that is cloned and dropped without atomics on the thread
+/// that created it (biased reference counting).
+///
+/// All `LocalArc`s cloned from one another share a small owner-thread block holding a plain
+/// counter and one `Arc`; only creating the block and dropping the last local handle touch
+/// the atomic count. Use it where one thread clones and drops a shared value on a hot path,
+/// and call `share` to hand a regular `Arc` to other threads. A `LocalArc` must stay on the
+/// thread that created it; debug builds check this.
+export template<typename T>
+class LocalArc : public DefaultInClass<LocalArc<T>, Clone> {
+    struct Block {
+        usize       count;
+        const void* owner;
+        Arc<T>      shared;
+    };
+
+    Block* m_block { nullptr };
+
+    explicit LocalArc(Block* block) noexcept: m_block(block) {}
+
+    void release() noexcept {
+        if (m_block == nullptr) return;
+        debug_assert(m_block->owner == &LOCAL_ARC_THREAD_TAG);
+        if (--m_block->count == 0) {
+            rstd::destroy_at(m_block);
+            auto pointer = NonNull<u8>::make_unchecked(
+                mut_ptr<u8>::from_raw_parts(reinterpret_cast<u8*>(m_block)));
+            rstd::as<Allocator>(::alloc::GLOBAL).deallocate(pointer, Layout::make<Block>());
+        }
+        m_block = nullptr;
+    }
+
+public:
+    USE_TRAIT(LocalArc)
+
+    using Target = T;
+
+    LocalArc(const LocalArc&)            = delete;
+    LocalArc& operator=(const LocalArc&) = delete;
+    LocalArc(LocalArc&& other) noexcept: m_block(rstd::exchange(other.m_block, nullptr)) {}
+    LocalArc& operator=(LocalArc&& other) noexcept {
+        if (this != &other) {
+            release();
+            m_block = rstd::exchange(other.m_block, nullptr);
+        }
+        return *this;
+    }
+    ~LocalArc() { release(); }
+
+    /// Takes over `arc` as the shared reference behind a new set of local handles.
+    static auto from(Arc<T> arc) -> LocalArc {
+        auto layout = Layout::make<Block>();
+        auto result = rstd::as<Allocator>(::alloc::GLOBAL).allocate(layout);
+        if (result.is_err()) ::alloc::handle_alloc_error(layout);
+
+        auto* raw   = result.unwrap_unchecked().as_mut_ptr().as_raw_ptr();
+        auto* block = rstd::construct_at(
+            reinterpret_cast<Block*>(raw), Block { 1, &LOCAL_ARC_THREAD_TAG, rstd::move(arc) });
+        return LocalArc { block };
+    }
+
+    template<typename... Args>
+    static auto make(Args&&... args) -> LocalArc
+        requires Impled<T, Sized>
+    {
+        return from(Arc<T>::make(rstd::forward<Args>(args)...));
+    }
+
+    /// Returns another local handle; a plain increment.
+    auto clone() const -> LocalArc {
+        if (m_block != nullptr) {
+            debug_assert(m_block->owner == &LOCAL_ARC_THREAD_TAG);
+            ++m_block->count;
+        }
+        return LocalArc { m_block };
+    }
+
+    /// Returns an `Arc` to the same value that may be sent to other threads.
+    auto share() const -> Arc<T> { return m_block->shared.clone(); }
+
+    auto deref() const noexcept -> ref<T> { return m_block->shared.deref(); }
+    auto deref_mut() const noexcept -> mut_ref<T> { return m_block->shared.deref_mut(); }
+    auto as_ptr() const noexcept -> mut_ptr<T> { return m_block->shared.as_ptr(); }
+
+    explicit operator bool() const noexcept { return m_block != nullptr; }
+
+    /// Number of local handles sharing this handle's block.
+    auto local_count() const noexcept -> usize { return m_block == nullptr ? 0 : m_block->count; }
+
+    /// Number of `Arc`s to the value; every set of local handles counts as one.
+    auto strong_count() const noexcept -> usize {
+        return m_block == nullptr ? 0 : m_block->shared.strong_count();
+    }
+};
+
+/// A thread-safe reference-counted header and slice behind a single thin pointer.
+///
+/// The count, the header, the length and the elements share one allocation, and the handle is
+/// one pointer wide, so it fits wherever a `voidp` does (waker data, intrusive slots) and
+/// reading the length needs no extra indirection.
+export template<typename H, typename T>
+class ThinArc : public DefaultInClass<ThinArc<H, T>, Clone> {
+    struct Inner {
+        Atomic<usize> strong { 1 };
+        H             header;
+        usize         len;
+
+        Inner(H header, usize len): header(rstd::move(header)), len(len) {}
+    };
+
+    Inner* m_ptr { nullptr };
+
+    explicit ThinArc(Inner* inner) noexcept: m_ptr(inner) {}
+
+    static auto layout_for(usize len, usize& items_offset) -> Layout {
+        auto layout =
+            Layout::make<Inner>().extend(Layout::array<T>(len).unwrap(), items_offset).unwrap();
+        return layout.pad_to_align();
+    }
+
+    auto items() const noexcept -> T* {
+        usize offset = 0;
+        (void)layout_for(0, offset);
+        return reinterpret_cast<T*>(reinterpret_cast<u8*>(m_ptr) + offset);
+    }
+
+    void release() noexcept {
+        if (m_ptr == nullptr) return;
+        if (m_ptr->strong.fetch_sub(1, rstd::sync::atomic::Ordering::Release) == 1) {
+            rstd::sync::atomic::fence(rstd::sync::atomic::Ordering::Acquire);
+            usize offset = 0;
+            auto  layout = layout_for(m_ptr->len, offset);
+            auto* data   = items();
+            for (usize i = 0; i < m_ptr->len; ++i) rstd::destroy_at(data + i);
+            rstd::destroy_at(m_ptr);
+            auto pointer = NonNull<u8>::make_unchecked(
+                mut_ptr<u8>::from_raw_parts(reinterpret_cast<u8*>(m_ptr)));
+            rstd::as<Allocator>(::alloc::GLOBAL).deallocate(pointer, layout);
+        }
+        m_ptr = nullptr;
+    }
+
+public:
+    USE_TRAIT(ThinArc)
+
+    ThinArc(const ThinArc&)            = delete;
+    ThinArc& operator=(const ThinArc&) = delete;
+    ThinArc(ThinArc&& other) noexcept: m_ptr(rstd::exchange(other.m_ptr, nullptr)) {}
+    ThinArc& operator=(ThinArc&& other) noexcept {
+        if (this != &other) {
+            release();
+            m_ptr = rstd::exchange(other.m_ptr, nullptr);
+        }
+        return *this;
+    }
+    ~ThinArc() { release(); }
+
+    /// Allocates `header` and `len` elements, element `i` constructed from `f(i)`.
+    template<typename F>
+    static auto from_header_and_fn(H header, usize len, F&& f) -> ThinArc {
+        usize offset = 0;
+        auto  layout = layout_for(len, offset);
+        auto  result = rstd::as<Allocator>(::alloc::GLOBAL).allocate(layout);
+        if (result.is_err()) ::alloc::handle_alloc_error(layout);
+
+        auto* raw   = result.unwrap_unchecked().as_mut_ptr().as_raw_ptr();
+        auto* inner = rstd::construct_at(reinterpret_cast<Inner*>(raw), rstd::move(header), len);
+        auto* data  = reinterpret_cast<T*>(raw + offset);
+        for (usize i = 0; i < len; ++i) rstd::construct_at(data + i, f(i));
+        return ThinArc { inner };
+    }
+
+    /// Allocates `header` followed by copies of `items`.
+    static auto from_header_and_slice(H header, slice<T> items) -> ThinArc {
+        return from_header_and_fn(
+            rstd::move(header), items.len(), [&](usize i) { return T(items[i]); });
+    }
+
+    auto clone() const noexcept -> ThinArc {
+        if (m_ptr != nullptr) {
+            [[maybe_unused]]
+            auto old = m_ptr->strong.fetch_add(1, rstd::sync::atomic::Ordering::Relaxed);
+            debug_assert(old < ARC_MAX_REFCOUNT);
+        }
+        return ThinArc { m_ptr };
+    }
+
+    auto header() const noexcept -> const H& { return m_ptr->header; }
+    auto len() const noexcept -> usize { return m_ptr->len; }
+    auto as_slice() const noexcept -> slice<T> {
+        return slice<T>::from_raw_parts(items(), m_ptr->len);
+    }
+    auto as_mut_slice() const noexcept -> mut_ref<T[]> {
+        return mut_ref<T[]>::from_raw_parts(items(), m_ptr->len);
+    }
+
+    auto strong_count() const noexcept -> usize {
+        return m_ptr == nullptr ? 0 : m_ptr->strong.load(rstd::sync::atomic::Ordering::Acquire);
+    }
+
+    static bool ptr_eq(const ThinArc& left, const ThinArc& right) noexcept {
+        return left.m_ptr == right.m_ptr;
+    }
+
+    /// Releases the handle as one pointer; `from_raw` takes it back.
+    auto into_raw() && noexcept -> voidp { return rstd::exchange(m_ptr, nullptr); }
+    static auto from_raw(voidp raw) noexcept -> ThinArc {
+        return ThinArc { static_cast<Inner*>(raw) };
+    }
+};
+
 } // namespace alloc::sync
@@ -11,6 +11,7 @@ using ::alloc::boxed::Box;
 using rstd::alloc::Allocator;
 using rstd::alloc::Layout;
 using rstd::ptr_::non_null::NonNull;
+namespace mtp = rstd::mtp;
 
 using namespace rstd::prelude;
 
@@ -82,6 +83,28 @@ namespace alloc::vec
 
 export template<typename T>
 struct VecIntoIter;
+export template<typename T>
+struct Drain;
+
+// Moves `n` live elements from `src` to `dst` and ends their lifetime at `src`. The ranges
+// may overlap in either direction; trivially copyable types move with one memmove.
+template<typename T>
+void relocate(T* dst, T* src, usize n) {
+    if (n == 0 || dst == src) return;
+    if constexpr (mtp::triv_copy<T>) {
+        rstd::mem::memmove(dst, src, n * sizeof(T));
+    } else if (dst < src) {
+        for (usize i = 0; i < n; ++i) {
+            rstd::construct_at(dst + i, rstd::move(src[i]));
+            rstd::destroy_at(src + i);
+        }
+    } else {
+        for (usize i = n; i-- > 0;) {
+            rstd::construct_at(dst + i, rstd::move(src[i]));
+            rstd::destroy_at(src + i);
+        }
+    }
+}
 
 /// A contiguous growable array type, analogous to Rust's `Vec<T>`.
 /// \tparam T The element type, which must be `Sized`.
@@ -141,6 +164,32 @@ public:
         return Vec { RawVec<T>::with_capacity(capacity), 0 };
     }
 
+    /// Rebuilds a `Vec` from parts previously returned by `into_raw_parts`.
+    ///
+    /// `ptr` must come from the global allocator with room for exactly `capacity` elements, of
+    /// which the first `length` are initialized. A null `ptr` requires `capacity == 0`.
+    static auto from_raw_parts(T* ptr, usize length, usize capacity) -> Self {
+        debug_assert(length <= capacity);
+        if (ptr == nullptr) {
+            debug_assert(capacity == 0);
+            return {};
+        }
+        auto buf = RawVec<T> { .ptr = NonNull<T>::make_unchecked(mut_ptr<T>::from_raw_parts(ptr)),
+                               .cap = capacity };
+        return Vec { buf, length };
+    }
+
+    /// Releases the buffer without dropping elements or deallocating.
+    /// \return `(ptr, len, capacity)`; `ptr` is null when nothing was allocated.
+    auto into_raw_parts() && -> rstd::tuple<T*, usize, usize> {
+        auto out = rstd::tuple<T*, usize, usize> { m_buf.cap == 0 ? nullptr : begin(),
+                                                   m_len,
+                                                   m_buf.cap };
+        m_buf.reset_ptr();
+        m_len = 0;
+        return out;
+    }
+
     /// Ensures that at least `additional` more elements can be inserted without reallocating.
     void reserve(usize additional) {
         auto required = m_len + additional;
@@ -153,6 +202,13 @@ public:
         m_buf.grow(new_cap);
     }
 
+    /// Reserves capacity for exactly `additional` more elements, without rounding up.
+    void reserve_exact(usize additional) {
+        auto required = m_len + additional;
+        if (required <= m_buf.cap) return;
+        m_buf.grow(required);
+    }
+
     /// Returns a slice containing the entire vector.
     /// \return An immutable `slice<T>` over all elements.
     constexpr auto as_slice() const noexcept -> slice<T> {
@@ -270,16 +326,123 @@ public:
     /// Removes the last element from the vector, discarding it.
     constexpr void pop_back() { (void)pop(); }
 
-    /// Appends a copy of all elements in `values`.
+    /// Appends a copy of all elements in `values`. Trivially copyable elements are copied with
+    /// one memcpy.
     void extend_from_slice(slice<T> values) {
+        if (values.len() == 0) return;
         reserve(values.len());
         auto* p = m_buf.ptr.as_mut_ptr().as_raw_ptr() + m_len;
-        for (usize i = 0; i < values.len(); ++i) {
-            new (p + i) T(values[i]);
+        if constexpr (mtp::triv_copy<T>) {
+            rstd::mem::memcpy(p, &*values, values.len() * sizeof(T));
+        } else {
+            for (usize i = 0; i < values.len(); ++i) {
+                new (p + i) T(values[i]);
+            }
         }
         m_len += values.len();
     }
 
+    /// Appends copies of the elements in `[start, end)` of this vector.
+    void extend_from_within(usize start, usize end)
+        requires mtp::copy<T>
+    {
+        if (start > end || end > m_len) rstd::panic { "Vec::extend_from_within out of bounds" };
+        // Reserve first: growing moves the buffer, and the source range lives in it.
+        reserve(end - start);
+        auto* p = m_buf.ptr.as_mut_ptr().as_raw_ptr();
+        if constexpr (mtp::triv_copy<T>) {
+            rstd::mem::memcpy(p + m_len, p + start, (end - start) * sizeof(T));
+        } else {
+            for (usize i = start; i < end; ++i) {
+                new (p + m_len + (i - start)) T(p[i]);
+            }
+        }
+        m_len += end - start;
+    }
+
+    /// Appends every item produced by `iter`.
+    ///
+    /// Capacity for the iterator's lower size-hint bound is reserved up front, with the same
+    /// amortized growth as `push`, so repeated extends stay linear. When the hint is exact the
+    /// items are written straight into spare capacity without per-item checks.
+    template<typename I>
+        requires rstd::iter::has_next<I>
+    void extend(I iter) {
+        auto hint  = as<rstd::iter::Iterator>(iter).size_hint();
+        auto lower = hint.template get<0>();
+        auto upper = hint.template get<1>();
+        reserve(lower);
+        if (upper.is_some() && *upper == lower) {
+            auto* p = m_buf.ptr.as_mut_ptr().as_raw_ptr();
+            for (usize i = 0; i < lower; ++i) {
+                auto x = iter.next();
+                if (x.is_none()) return;
+                new (p + m_len) T(rstd::move(*x));
+                m_len++;
+            }
+        }
+        for (auto x = iter.next(); x.is_some(); x = iter.next()) push(rstd::move(*x));
+    }
+
+    /// Moves all elements of `other` to the end of this vector, leaving `other` empty.
+    void append(Vec& other) {
+        if (other.m_len == 0) return;
+        reserve(other.m_len);
+        relocate(end(), other.begin(), other.m_len);
+        m_len += other.m_len;
+        other.m_len = 0;
+    }
+
+    /// Removes `[start, end)` and returns an iterator over the removed elements.
+    ///
+    /// The tail after `end` is moved down once, when the iterator is dropped; elements the
+    /// iterator did not yield are dropped then as well.
+    auto drain(usize start, usize end) -> Drain<T> {
+        if (start > end || end > m_len) rstd::panic { "Vec::drain out of bounds" };
+        return Drain<T>(this, start, end);
+    }
+
+    /// Replaces `[start, end)` with the items of `replace_with` and returns the removed
+    /// elements.
+    ///
+    /// The tail after `end` is moved at most once, directly to its final position; when the
+    /// vector has to grow, the prefix, the new items and the tail go straight into the new
+    /// buffer.
+    template<typename I>
+        requires rstd::iter::has_next<I>
+    auto splice(usize start, usize end, I replace_with) -> Vec {
+        if (start > end || end > m_len) rstd::panic { "Vec::splice out of bounds" };
+        auto  removed = Vec::with_capacity(end - start);
+        auto* p       = begin();
+        relocate(removed.begin(), p + start, end - start);
+        removed.m_len = end - start;
+
+        auto incoming = Vec::make();
+        incoming.extend(rstd::move(replace_with));
+
+        usize tail    = m_len - end;
+        usize new_len = start + incoming.m_len + tail;
+        m_len = start;
+        if (new_len > m_buf.cap) {
+            auto grown = Vec::make();
+            grown.reserve(new_len);
+            auto* q = grown.begin();
+            relocate(q, p, start);
+            relocate(q + start + incoming.m_len, p + end, tail);
+            relocate(q + start, incoming.begin(), incoming.m_len);
+            incoming.m_len = 0;
+            m_len          = 0;
+            grown.m_len    = new_len;
+            *this          = rstd::move(grown);
+            return removed;
+        }
+        relocate(p + start + incoming.m_len, p + end, tail);
+        relocate(p + start, incoming.begin(), incoming.m_len);
+        incoming.m_len = 0;
+        m_len          = new_len;
+        return removed;
+    }
+
     /// Appends a copy of `count` elements starting at `values`.
     void extend_from_slice(const T* values, usize count) {
         if (count == 0) return;
@@ -319,8 +482,13 @@ public:
         requires rstd::Impled<T, rstd::clone::Clone>
     {
         auto result = Vec::with_capacity(m_len);
-        for (usize i = 0; i < m_len; ++i) {
-            result.push(rstd::as<rstd::clone::Clone>((*this)[i]).clone());
+        if constexpr (mtp::triv_copy<T>) {
+            if (m_len > 0) rstd::mem::memcpy(result.begin(), begin(), m_len * sizeof(T));
+            result.m_len = m_len;
+        } else {
+            for (usize i = 0; i < m_len; ++i) {
+                result.push(rstd::as<rstd::clone::Clone>((*this)[i]).clone());
+            }
         }
         return result;
     }
@@ -429,6 +597,66 @@ struct VecIntoIter : rstd::DefaultInClass<VecIntoIter<T>, rstd::iter::Iterator>
     auto len() const -> usize { return vec.len() - idx; }
 };
 
+/// Draining iterator returned by `Vec::drain`, yielding the removed elements by value.
+///
+/// While it lives the vector's length excludes the drained range and the tail; dropping it
+/// drops whatever was not yielded and moves the tail down to close the gap.
+export template<typename T>
+struct Drain : rstd::DefaultInClass<Drain<T>, rstd::iter::Iterator> {
+    using Item = T;
+    Vec<T>* vec;
+    usize   idx;
+    usize   end;
+    usize   tail_start;
+    usize   tail_len;
+
+    Drain(Vec<T>* v, usize start, usize stop)
+        : vec(v), idx(start), end(stop), tail_start(stop), tail_len(v->len() - stop) {
+        v->set_len_unchecked(start);
+    }
+    Drain(const Drain&)            = delete;
+    Drain& operator=(const Drain&) = delete;
+    Drain(Drain&& o) noexcept
+        : vec(rstd::exchange(o.vec, nullptr)),
+          idx(o.idx),
+          end(o.end),
+          tail_start(o.tail_start),
+          tail_len(o.tail_len) {}
+    Drain& operator=(Drain&&) = delete;
+
+    ~Drain() {
+        if (vec == nullptr) return;
+        auto* p = vec->begin();
+        for (; idx < end; ++idx) rstd::destroy_at(p + idx);
+        auto len = vec->len();
+        relocate(p + len, p + tail_start, tail_len);
+        vec->set_len_unchecked(len + tail_len);
+    }
+
+    auto next() -> rstd::Option<Item> {
+        if (idx == end) return rstd::None();
+        T* slot  = vec->begin() + idx++;
+        T  value = rstd::move(*slot);
+        rstd::destroy_at(slot);
+        return rstd::Some(rstd::move(value));
+    }
+
+    auto next_back() -> rstd::Option<Item> {
+        if (idx == end) return rstd::None();
+        T* slot  = vec->begin() + --end;
+        T  value = rstd::move(*slot);
+        rstd::destroy_at(slot);
+        return rstd::Some(rstd::move(value));
+    }
+
+    auto size_hint() const -> rstd::iter::SizeHint {
+        usize n = end - idx;
+        return { n, rstd::Some(n) };
+    }
+
+    auto len() const -> usize { return end - idx; }
+};
+
 } // namespace alloc::vec
 
 namespace rstd
@@ -457,15 +685,53 @@ struct Impl<T, ::alloc::vec::Vec<A>> : ImplBase<::alloc::vec::Vec<A>> {
     }
 };
 
-// collect<Vec<A>>() builds a Vec by draining any iterator of A.
+// collect<Vec<A>>() builds a Vec by draining any iterator of A, reserving from its size hint.
+//
+// `vec.into_iter().collect()` hands the remaining buffer back, and `vec.into_iter().map(f)
+// .collect()` writes the mapped values over the source elements when both types have the same
+// size and alignment, so neither allocates.
 template<typename A>
 struct Impl<iter::FromIterator<A>, ::alloc::vec::Vec<A>> : ImplBase<::alloc::vec::Vec<A>> {
     template<typename It>
     static auto from_iter(It it) -> ::alloc::vec::Vec<A> {
-        auto vec = ::alloc::vec::Vec<A>::make();
-        for (auto x = it.next(); x.is_some(); x = it.next()) vec.push(rstd::move(*x));
+        // A fresh vector is sized exactly when the hint is exact; `extend` then never grows it.
+        auto hint  = as<iter::Iterator>(it).size_hint();
+        auto lower = hint.template get<0>();
+        auto upper = hint.template get<1>();
+        auto vec   = upper.is_some() && *upper == lower ? ::alloc::vec::Vec<A>::with_capacity(lower)
+                                                        : ::alloc::vec::Vec<A>::make();
+        vec.extend(rstd::move(it));
         return vec;
     }
+
+    static auto from_iter(::alloc::vec::VecIntoIter<A> it) -> ::alloc::vec::Vec<A> {
+        if (it.idx == 0) return rstd::move(it.vec);
+        auto* p   = it.vec.begin();
+        auto  len = it.vec.len();
+        for (usize i = 0; i < it.idx; ++i) rstd::destroy_at(p + i);
+        ::alloc::vec::relocate(p, p + it.idx, len - it.idx);
+        it.vec.set_len_unchecked(len - it.idx);
+        return rstd::move(it.vec);
+    }
+
+    template<typename S, typename F>
+        requires(sizeof(S) == sizeof(A) && alignof(S) == alignof(A))
+    static auto from_iter(iter::Map<::alloc::vec::VecIntoIter<S>, F> it) -> ::alloc::vec::Vec<A> {
+        auto& source              = it.i;
+        auto [raw, len, capacity] = rstd::move(source.vec).into_raw_parts();
+        S*    src                 = raw;
+        A*    dst                 = reinterpret_cast<A*>(static_cast<void*>(raw));
+        usize written             = 0;
+        for (usize i = 0; i < source.idx; ++i) rstd::destroy_at(src + i);
+        for (usize i = source.idx; i < len; ++i) {
+            S item = rstd::move(src[i]);
+            rstd::destroy_at(src + i);
+            // Slot `written` <= `i` has been vacated, so the new value may reuse it.
+            rstd::construct_at(dst + written, it.f(rstd::move(item)));
+            ++written;
+        }
+        return ::alloc::vec::Vec<A>::from_raw_parts(dst, written, capacity);
+    }
 };
 
 template<typename A>
@@ -7,8 +7,9 @@ namespace rstd::iter
 {
 
 // Adapter types live in :iter.adapters; the default-method Impl below needs their
-// names to spell its return types, so forward declare them here.
-template<class I, class F>
+// names to spell its return types, so forward declare them here. `Map` is exported so
+// collections can recognize `into_iter().map(..)` pipelines and collect them in place.
+export template<class I, class F>
 struct Map;
 template<class I, class F>
 struct MapWhile;
@@ -50,6 +50,15 @@ export auto memcpy(voidp dst, const_voidp src, usize len) noexcept -> voidp {
     return __builtin_memcpy(dst, src, len);
 }
 
+/// Copies `len` bytes from `src` to `dst`; regions may overlap.
+/// \param dst Destination pointer.
+/// \param src Source pointer.
+/// \param len Number of bytes to copy.
+/// \return The destination pointer `dst`.
+export auto memmove(voidp dst, const_voidp src, usize len) noexcept -> voidp {
+    return __builtin_memmove(dst, src, len);
+}
+
 /// Checks whether all bytes of `src` are equal to `val`.
 /// \tparam T The type of the value to check.
 /// \param src The value to inspect.
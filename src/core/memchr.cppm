@@ -5,16 +5,18 @@ namespace rstd::memchr
 {
 
 /// Searches for the first occurrence of a byte in a slice.
+///
+/// Lowers to the platform `memchr`, which scans a vector register at a time and picks the widest
+/// instruction set available at load time.
 /// \param needle The byte value to search for.
 /// \param haystack The byte slice to search within.
 /// \return The index of the first match, or `None` if not found.
 export auto memchr(u8 needle, slice<u8> haystack) noexcept -> Option<usize> {
-    for (usize i = 0; i != haystack.len(); ++i) {
-        if (haystack[i] == needle) {
-            return Some(i);
-        }
-    }
-    return None();
+    if (haystack.len() == 0) return None();
+    auto const* base = haystack.p;
+    auto const* hit  = static_cast<const u8*>(__builtin_memchr(base, needle, haystack.len()));
+    if (hit == nullptr) return None();
+    return Some(usize(hit - base));
 }
 
-} // namespace rstd::memchr
\ No newline at end of file
+} // namespace rstd::memchr
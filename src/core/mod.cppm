@@ -11,6 +11,7 @@ export import :fmt.floating;
 export import :num.dec2flt;
 export import :convert;
 export import :slice;
+export import :slice.sort;
 export import :alloc;
 
 export import :ops;
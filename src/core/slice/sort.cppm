@@ -0,0 +1,496 @@
+module;
+#include <rstd/macro.hpp>
+export module rstd.core:slice.sort;
+export import :slice;
+export import :result;
+
+namespace rstd::slice_::sort_detail
+{
+
+// Below this length insertion sort beats any partitioning scheme.
+export inline constexpr usize INSERTION_THRESHOLD = 20;
+// Above this length the pivot is the median of three medians (Tukey's ninther).
+inline constexpr usize NINTHER_THRESHOLD = 128;
+// A partition that needed no swaps gets a bounded insertion sort; this many shifts abort it.
+inline constexpr usize PARTIAL_INSERTION_LIMIT = 8;
+// Natural runs shorter than this are extended with insertion sort before merging.
+inline constexpr usize MIN_RUN = 32;
+// Run lengths on the merge stack grow at least like Fibonacci numbers, so 96 covers any usize.
+inline constexpr usize MAX_RUNS = 96;
+
+template<typename T>
+inline void swap_at(T* a, T* b) {
+    T tmp = rstd::move(*a);
+    *a    = rstd::move(*b);
+    *b    = rstd::move(tmp);
+}
+
+inline constexpr auto log2_floor(usize n) noexcept -> u32 {
+    u32 r = 0;
+    while (n >>= 1) ++r;
+    return r;
+}
+
+/// Sorts `v[0, n)` assuming `v[0, offset)` is already sorted.
+export template<typename T, typename F>
+void insertion_sort(T* v, usize n, F& is_less, usize offset = 1) {
+    for (usize i = offset < 1 ? 1 : offset; i < n; ++i) {
+        if (! is_less(v[i], v[i - 1])) continue;
+        T     tmp = rstd::move(v[i]);
+        usize j   = i;
+        do {
+            v[j] = rstd::move(v[j - 1]);
+            --j;
+        } while (j > 0 && is_less(tmp, v[j - 1]));
+        v[j] = rstd::move(tmp);
+    }
+}
+
+template<typename T, typename F>
+void sift_down(T* v, usize n, usize node, F& is_less) {
+    while (true) {
+        usize child = 2 * node + 1;
+        if (child >= n) return;
+        if (child + 1 < n && is_less(v[child], v[child + 1])) ++child;
+        if (! is_less(v[node], v[child])) return;
+        swap_at(v + node, v + child);
+        node = child;
+    }
+}
+
+/// Guaranteed O(n log n) fallback once quicksort keeps picking bad pivots.
+export template<typename T, typename F>
+void heapsort(T* v, usize n, F& is_less) {
+    if (n < 2) return;
+    for (usize i = n / 2; i-- > 0;) sift_down(v, n, i, is_less);
+    for (usize end = n - 1; end > 0; --end) {
+        swap_at(v, v + end);
+        sift_down(v, end, 0, is_less);
+    }
+}
+
+// Orders v[a] <= v[b] <= v[c].
+template<typename T, typename F>
+void sort3(T* v, usize a, usize b, usize c, F& is_less) {
+    if (is_less(v[b], v[a])) swap_at(v + a, v + b);
+    if (is_less(v[c], v[b])) swap_at(v + b, v + c);
+    if (is_less(v[b], v[a])) swap_at(v + a, v + b);
+}
+
+// Moves the chosen pivot to v[0].
+template<typename T, typename F>
+void choose_pivot(T* v, usize n, F& is_less) {
+    usize mid = n / 2;
+    if (n > NINTHER_THRESHOLD) {
+        sort3(v, 0, mid, n - 1, is_less);
+        sort3(v, 1, mid - 1, n - 2, is_less);
+        sort3(v, 2, mid + 1, n - 3, is_less);
+        sort3(v, mid - 1, mid, mid + 1, is_less);
+        swap_at(v, v + mid);
+    } else {
+        sort3(v, mid, 0, n - 1, is_less);
+    }
+}
+
+// Scatters a few elements so that adversarial patterns do not keep producing bad pivots.
+template<typename T>
+void break_patterns(T* v, usize n) {
+    u64 seed = u64(n);
+    auto gen = [&seed]() -> u64 {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        return seed;
+    };
+    usize mask = 1;
+    while (mask < n) mask <<= 1;
+    mask -= 1;
+
+    usize pos = n / 4 * 2;
+    for (usize i = 0; i < 3; ++i) {
+        usize other = usize(gen()) & mask;
+        if (other >= n) other -= n;
+        swap_at(v + pos - 1 + i, v + other);
+    }
+}
+
+struct Partition {
+    usize mid;
+    bool  was_partitioned;
+};
+
+// Partitions around the pivot in v[0]: [0, mid) < pivot <= (mid, n). The pivot ends at mid.
+template<typename T, typename F>
+auto partition_right(T* v, usize n, F& is_less) -> Partition {
+    T     pivot = rstd::move(v[0]);
+    usize first = 1;
+    usize last  = n;
+    while (first < last && is_less(v[first], pivot)) ++first;
+    while (last > first && ! is_less(v[last - 1], pivot)) --last;
+
+    bool was_partitioned = first >= last;
+    while (first < last) {
+        swap_at(v + first, v + last - 1);
+        ++first;
+        --last;
+        while (first < last && is_less(v[first], pivot)) ++first;
+        while (last > first && ! is_less(v[last - 1], pivot)) --last;
+    }
+
+    usize mid = first - 1;
+    v[0]      = rstd::move(v[mid]);
+    v[mid]    = rstd::move(pivot);
+    return { mid, was_partitioned };
+}
+
+// Partitions around the pivot in v[0]: [0, mid] <= pivot < (mid, n). Used when the pivot equals
+// the previous one, which means everything on the left is equal and needs no more work.
+template<typename T, typename F>
+auto partition_left(T* v, usize n, F& is_less) -> usize {
+    T     pivot = rstd::move(v[0]);
+    usize first = 1;
+    usize last  = n;
+    while (last > first && is_less(pivot, v[last - 1])) --last;
+    while (first < last && ! is_less(pivot, v[first])) ++first;
+    while (first < last) {
+        swap_at(v + first, v + last - 1);
+        ++first;
+        --last;
+        while (last > first && is_less(pivot, v[last - 1])) --last;
+        while (first < last && ! is_less(pivot, v[first])) ++first;
+    }
+
+    usize mid = last - 1;
+    v[0]      = rstd::move(v[mid]);
+    v[mid]    = rstd::move(pivot);
+    return mid;
+}
+
+// Insertion sort that gives up after a few shifts; returns `true` if it finished.
+template<typename T, typename F>
+auto partial_insertion_sort(T* v, usize n, F& is_less) -> bool {
+    usize moved = 0;
+    for (usize i = 1; i < n; ++i) {
+        if (! is_less(v[i], v[i - 1])) continue;
+        T     tmp = rstd::move(v[i]);
+        usize j   = i;
+        do {
+            v[j] = rstd::move(v[j - 1]);
+            --j;
+        } while (j > 0 && is_less(tmp, v[j - 1]));
+        v[j] = rstd::move(tmp);
+
+        moved += i - j;
+        if (moved > PARTIAL_INSERTION_LIMIT) return false;
+    }
+    return true;
+}
+
+template<typename T, typename F>
+void pdqsort_loop(T* v, usize n, F& is_less, const T* pred, u32 bad_allowed) {
+    while (true) {
+        if (n <= INSERTION_THRESHOLD) {
+            insertion_sort(v, n, is_less);
+            return;
+        }
+
+        choose_pivot(v, n, is_less);
+
+        if (pred != nullptr && ! is_less(*pred, v[0])) {
+            usize mid = partition_left(v, n, is_less);
+            v += mid + 1;
+            n -= mid + 1;
+            continue;
+        }
+
+        auto [mid, was_partitioned] = partition_right(v, n, is_less);
+        usize left  = mid;
+        usize right = n - mid - 1;
+
+        if (left < n / 8 || right < n / 8) {
+            if (--bad_allowed == 0) {
+                heapsort(v, n, is_less);
+                return;
+            }
+            if (left >= INSERTION_THRESHOLD) break_patterns(v, left);
+            if (right >= INSERTION_THRESHOLD) break_patterns(v + mid + 1, right);
+        } else if (was_partitioned) {
+            if (partial_insertion_sort(v, left, is_less) &&
+                partial_insertion_sort(v + mid + 1, right, is_less))
+                return;
+        }
+
+        // Recurse into the shorter side so the stack stays O(log n).
+        if (left < right) {
+            pdqsort_loop(v, left, is_less, pred, bad_allowed);
+            pred = v + mid;
+            v += mid + 1;
+            n = right;
+        } else {
+            pdqsort_loop(v + mid + 1, right, is_less, v + mid, bad_allowed);
+            n = left;
+        }
+    }
+}
+
+/// Pattern-defeating quicksort: O(n) on sorted, reversed and all-equal input, O(n log n) worst
+/// case through the heapsort fallback. Not stable.
+export template<typename T, typename F>
+void quicksort(T* v, usize n, F& is_less) {
+    if (n < 2) return;
+    pdqsort_loop(v, n, is_less, static_cast<const T*>(nullptr), log2_floor(n) + 1);
+}
+
+/// Reorders `v[0, n)` so that `v[index]` holds the element it would hold after sorting.
+export template<typename T, typename F>
+void select(T* v, usize n, usize index, F& is_less) {
+    u32      bad_allowed = log2_floor(n) + 1;
+    const T* pred        = nullptr;
+    while (n > INSERTION_THRESHOLD) {
+        if (bad_allowed == 0) {
+            heapsort(v, n, is_less);
+            return;
+        }
+
+        choose_pivot(v, n, is_less);
+
+        if (pred != nullptr && ! is_less(*pred, v[0])) {
+            usize mid = partition_left(v, n, is_less);
+            if (index <= mid) return;
+            v += mid + 1;
+            n -= mid + 1;
+            index -= mid + 1;
+            continue;
+        }
+
+        auto [mid, was_partitioned] = partition_right(v, n, is_less);
+        (void)was_partitioned;
+        bool unbalanced = mid < n / 8 || n - mid - 1 < n / 8;
+        if (index == mid) return;
+        if (index < mid) {
+            n = mid;
+        } else {
+            pred = v + mid;
+            v += mid + 1;
+            n -= mid + 1;
+            index -= mid + 1;
+        }
+        if (unbalanced) {
+            --bad_allowed;
+            if (n >= INSERTION_THRESHOLD) break_patterns(v, n);
+        }
+    }
+    insertion_sort(v, n, is_less);
+}
+
+/// Merges the sorted runs `v[0, mid)` and `v[mid, n)`, copying the shorter one into `buf`, which
+/// has room for at least `min(mid, n - mid)` elements. Ties take the left element, so it is stable.
+export template<typename T, typename F>
+void merge(T* v, usize mid, usize n, T* buf, F& is_less) {
+    if (mid == 0 || mid == n || ! is_less(v[mid], v[mid - 1])) return;
+
+    if (mid <= n - mid) {
+        for (usize i = 0; i < mid; ++i) rstd::construct_at(buf + i, rstd::move(v[i]));
+        usize i = 0, j = mid, k = 0;
+        while (i < mid && j < n) {
+            if (is_less(v[j], buf[i])) v[k++] = rstd::move(v[j++]);
+            else v[k++] = rstd::move(buf[i++]);
+        }
+        while (i < mid) v[k++] = rstd::move(buf[i++]);
+        for (usize x = 0; x < mid; ++x) rstd::destroy_at(buf + x);
+    } else {
+        usize right = n - mid;
+        for (usize j = 0; j < right; ++j) rstd::construct_at(buf + j, rstd::move(v[mid + j]));
+        usize i = mid, j = right, k = n;
+        while (i > 0 && j > 0) {
+            if (is_less(buf[j - 1], v[i - 1])) v[--k] = rstd::move(v[--i]);
+            else v[--k] = rstd::move(buf[--j]);
+        }
+        while (j > 0) v[--k] = rstd::move(buf[--j]);
+        for (usize x = 0; x < right; ++x) rstd::destroy_at(buf + x);
+    }
+}
+
+// Length of the natural run at the start of v[0, n). Strictly descending runs are reversed, so
+// equal elements never swap places.
+template<typename T, typename F>
+auto find_run(T* v, usize n, F& is_less) -> usize {
+    if (n < 2) return n;
+    usize end = 2;
+    if (is_less(v[1], v[0])) {
+        while (end < n && is_less(v[end], v[end - 1])) ++end;
+        for (usize a = 0, b = end - 1; a < b; ++a, --b) swap_at(v + a, v + b);
+    } else {
+        while (end < n && ! is_less(v[end], v[end - 1])) ++end;
+    }
+    return end;
+}
+
+/// Run-adaptive stable merge sort over `v[0, n)`.
+///
+/// Natural ascending and descending runs are detected and merged under the TimSort stack
+/// invariants, so presorted and concatenated inputs cost O(n). `buf` is uninitialized storage
+/// for at least `n / 2` elements; it is left uninitialized on return.
+export template<typename T, typename F>
+void merge_sort(T* v, usize n, T* buf, F& is_less) {
+    if (n < 2) return;
+    if (n <= INSERTION_THRESHOLD) {
+        insertion_sort(v, n, is_less);
+        return;
+    }
+
+    struct Run {
+        usize start;
+        usize len;
+    };
+    Run   runs[MAX_RUNS];
+    usize count = 0;
+
+    auto merge_at = [&](usize k) {
+        auto& a = runs[k];
+        auto& b = runs[k + 1];
+        merge(v + a.start, a.len, a.len + b.len, buf, is_less);
+        a.len += b.len;
+        for (usize i = k + 1; i + 1 < count; ++i) runs[i] = runs[i + 1];
+        --count;
+    };
+
+    usize start = 0;
+    while (start < n) {
+        usize len = find_run(v + start, n - start, is_less);
+        if (len < MIN_RUN) {
+            usize forced = n - start < MIN_RUN ? n - start : MIN_RUN;
+            insertion_sort(v + start, forced, is_less, len);
+            len = forced;
+        }
+        runs[count++] = { start, len };
+        start += len;
+
+        while (count > 1) {
+            usize k = count - 2;
+            if ((k > 0 && runs[k - 1].len <= runs[k].len + runs[k + 1].len) ||
+                (k > 1 && runs[k - 2].len <= runs[k - 1].len + runs[k].len)) {
+                if (runs[k - 1].len < runs[k + 1].len) --k;
+            } else if (runs[k].len > runs[k + 1].len) {
+                break;
+            }
+            merge_at(k);
+        }
+    }
+    while (count > 1) merge_at(count - 2);
+}
+
+} // namespace rstd::slice_::sort_detail
+
+namespace rstd::slice_
+{
+
+/// Sorts the slice in ascending order with `<`, without preserving the order of equal elements.
+///
+/// Pattern-defeating quicksort: O(n log n) worst case, O(n) on already sorted, reversed or
+/// all-equal input, and no allocation.
+export template<typename T>
+void sort_unstable(mut_ref<T[]> v) {
+    auto is_less = [](const T& a, const T& b) { return a < b; };
+    sort_detail::quicksort(v.p, v.length, is_less);
+}
+
+/// Sorts the slice with a three-way comparator, without preserving the order of equal elements.
+/// \param compare Called as `compare(a, b)`; returns an ordering (`a <=> b` style).
+export template<typename T, typename F>
+void sort_unstable_by(mut_ref<T[]> v, F&& compare) {
+    auto is_less = [&compare](const T& a, const T& b) { return compare(a, b) < 0; };
+    sort_detail::quicksort(v.p, v.length, is_less);
+}
+
+/// Sorts the slice by the key `key(x)`, without preserving the order of equal elements.
+export template<typename T, typename F>
+void sort_unstable_by_key(mut_ref<T[]> v, F&& key) {
+    auto is_less = [&key](const T& a, const T& b) { return key(a) < key(b); };
+    sort_detail::quicksort(v.p, v.length, is_less);
+}
+
+/// Reorders the slice so the element at `index` is the one that would be there after sorting,
+/// everything before it is `<=` and everything after it is `>=`. Expected O(n).
+/// \return The element now at `index`. Panics if `index >= len`.
+export template<typename T>
+auto select_nth_unstable(mut_ref<T[]> v, usize index) -> T& {
+    rstd_assert(index < v.length);
+    auto is_less = [](const T& a, const T& b) { return a < b; };
+    sort_detail::select(v.p, v.length, index, is_less);
+    return v.p[index];
+}
+
+/// `select_nth_unstable` with a three-way comparator.
+export template<typename T, typename F>
+auto select_nth_unstable_by(mut_ref<T[]> v, usize index, F&& compare) -> T& {
+    rstd_assert(index < v.length);
+    auto is_less = [&compare](const T& a, const T& b) { return compare(a, b) < 0; };
+    sort_detail::select(v.p, v.length, index, is_less);
+    return v.p[index];
+}
+
+/// Returns `true` if every element is `<=` the next one.
+export template<typename T>
+auto is_sorted(slice<T> s) -> bool {
+    for (usize i = 1; i < s.len(); ++i) {
+        if (s[i] < s[i - 1]) return false;
+    }
+    return true;
+}
+
+/// Binary searches a sorted slice with a probe.
+///
+/// \param f Called with an element; returns its ordering relative to the target.
+/// \return `Ok(index)` of a matching element, or `Err(index)` where the target could be
+/// inserted to keep the slice sorted. If several elements match, any of them may be returned.
+export template<typename T, typename F>
+auto binary_search_by(slice<T> s, F&& f) -> Result<usize, usize> {
+    usize size = s.len();
+    if (size == 0) return Err(usize(0));
+
+    // Halving with a conditional move keeps the loop free of unpredictable branches.
+    usize base = 0;
+    while (size > 1) {
+        usize half = size / 2;
+        usize mid  = base + half;
+        base       = f(s[mid]) > 0 ? base : mid;
+        size -= half;
+    }
+
+    auto c = f(s[base]);
+    if (c == 0) return Ok(usize(base));
+    return Err(usize(base + (c < 0 ? 1 : 0)));
+}
+
+/// Binary searches a sorted slice for `x`. See `binary_search_by`.
+export template<typename T>
+auto binary_search(slice<T> s, const T& x) -> Result<usize, usize> {
+    return binary_search_by(s, [&x](const T& e) { return e <=> x; });
+}
+
+/// Binary searches a slice sorted by `key` for the key `b`. See `binary_search_by`.
+export template<typename T, typename B, typename F>
+auto binary_search_by_key(slice<T> s, const B& b, F&& key) -> Result<usize, usize> {
+    return binary_search_by(s, [&b, &key](const T& e) { return key(e) <=> b; });
+}
+
+/// Returns the index of the first element for which `pred` is `false`, assuming the slice is
+/// partitioned so that `pred` holds for a prefix and fails for the rest.
+export template<typename T, typename P>
+auto partition_point(slice<T> s, P&& pred) -> usize {
+    usize base = 0;
+    usize size = s.len();
+    while (size > 0) {
+        usize half = size / 2;
+        if (pred(s[base + half])) {
+            base += half + 1;
+            size -= half + 1;
+        } else {
+            size = half;
+        }
+    }
+    return base;
+}
+
+} // namespace rstd::slice_
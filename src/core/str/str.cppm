@@ -5,6 +5,7 @@ export import :core;
 export import :fmt;
 export import :marker;
 export import :char_;
+export import :str.validations;
 
 namespace rstd::str_
 {
@@ -196,12 +197,14 @@ export constexpr auto is_empty(ref<str> s) noexcept -> bool {
     return s.size() == 0;
 }
 
-/// Returns `true` if all bytes are ASCII.
+/// Returns `true` if all bytes are ASCII. Scans 32 bytes per step.
 export constexpr auto is_ascii(ref<str> s) noexcept -> bool {
-    for (usize i = 0; i < s.size(); i++) {
-        if (s.data()[i] > 0x7F) return false;
-    }
-    return true;
+    return validations::ascii_prefix_len(s.data(), s.size()) == s.size();
+}
+
+/// Returns `true` if the two strings are equal when ASCII letters are compared case-insensitively.
+export constexpr auto eq_ignore_ascii_case(ref<str> a, ref<str> b) noexcept -> bool {
+    return a.size() == b.size() && validations::eq_ignore_ascii_case(a.data(), b.data(), a.size());
 }
 
 /// Returns `true` if `pos` is on a UTF-8 character boundary.
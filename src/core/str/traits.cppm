@@ -50,16 +50,12 @@ private:
 };
 
 /// Validates a byte slice as UTF-8 and returns the first invalid byte offset on failure.
+///
+/// ASCII runs are skipped 32 bytes at a time, so mostly-ASCII text validates at close to
+/// memory bandwidth.
 export constexpr auto validate_utf8(slice<u8> bytes) noexcept -> Result<empty, Utf8Error> {
-    usize offset = 0;
-    while (offset < bytes.len()) {
-        auto [code_point, consumed] =
-            char_::decode_utf8(bytes.as_raw_ptr() + offset, bytes.len() - offset);
-        if (code_point == char_::REPLACEMENT && consumed <= 1 && bytes[offset] > 0x7F) {
-            return Err(Utf8Error { offset });
-        }
-        offset += consumed;
-    }
+    auto valid = validations::utf8_valid_up_to(bytes.as_raw_ptr(), bytes.len());
+    if (valid != bytes.len()) return Err(Utf8Error { valid });
     return Ok(empty {});
 }
 
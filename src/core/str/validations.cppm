@@ -0,0 +1,133 @@
+export module rstd.core:str.validations;
+export import :core;
+
+// Byte kernels behind UTF-8 validation and the ASCII helpers.
+//
+// The hot loops work on 64-bit words (SWAR) and consume 32 bytes per step. They are written so
+// the compiler can keep them in vector registers for whatever target the library is built for;
+// constant evaluation takes the plain byte loops instead.
+namespace rstd::str_::validations
+{
+
+inline constexpr u64 ONES = 0x0101010101010101ull;
+inline constexpr u64 HIGH = 0x8080808080808080ull;
+
+// Bytes examined per step of the ASCII scans.
+inline constexpr usize BLOCK = 4 * sizeof(u64);
+
+inline auto load(const u8* p) noexcept -> u64 {
+    u64 w;
+    __builtin_memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+inline void store(u8* p, u64 w) noexcept { __builtin_memcpy(p, &w, sizeof(w)); }
+
+// Sets the high bit of every byte in 'A'..='Z' (or 'a'..='z'); non-ASCII bytes never match.
+inline constexpr auto letter_mask(u64 w, u8 first) noexcept -> u64 {
+    u64 heptets = w & ~HIGH;
+    u64 past    = heptets + (0x7F - u64(first + 25)) * ONES;
+    u64 reached = heptets + (0x80 - u64(first)) * ONES;
+    return reached & ~past & ~w & HIGH;
+}
+
+inline constexpr auto lower_word(u64 w) noexcept -> u64 { return w | (letter_mask(w, 'A') >> 2); }
+inline constexpr auto upper_word(u64 w) noexcept -> u64 { return w ^ (letter_mask(w, 'a') >> 2); }
+
+constexpr auto lower_byte(u8 b) noexcept -> u8 { return b >= 'A' && b <= 'Z' ? u8(b | 0x20) : b; }
+constexpr auto upper_byte(u8 b) noexcept -> u8 { return b >= 'a' && b <= 'z' ? u8(b ^ 0x20) : b; }
+
+/// Returns the length of the leading run of ASCII bytes in `p[0, len)`.
+export constexpr auto ascii_prefix_len(const u8* p, usize len) noexcept -> usize {
+    usize i = 0;
+    if (! mtp::is_constant_evaluated()) {
+        for (; i + BLOCK <= len; i += BLOCK) {
+            u64 any = load(p + i) | load(p + i + 8) | load(p + i + 16) | load(p + i + 24);
+            if (any & HIGH) break;
+        }
+        for (; i + sizeof(u64) <= len; i += sizeof(u64)) {
+            if (load(p + i) & HIGH) break;
+        }
+    }
+    while (i < len && p[i] < 0x80) ++i;
+    return i;
+}
+
+/// Returns how many leading bytes of `p[0, len)` form valid UTF-8; `len` if all of them do.
+///
+/// ASCII runs are skipped a block at a time. Multi-byte sequences are checked against the
+/// well-formed byte ranges of Unicode Table 3-7, which rejects overlong forms, surrogates and
+/// code points above U+10FFFF without decoding. On failure the result is the offset of the
+/// first byte of the offending sequence.
+export constexpr auto utf8_valid_up_to(const u8* p, usize len) noexcept -> usize {
+    usize i = 0;
+    while (i < len) {
+        u8 first = p[i];
+        if (first < 0x80) {
+            i += ascii_prefix_len(p + i, len - i);
+            continue;
+        }
+
+        usize start = i;
+        auto  cont  = [&](usize k) { return start + k < len && (p[start + k] & 0xC0) == 0x80; };
+        if (first >= 0xC2 && first <= 0xDF) {
+            if (! cont(1)) return start;
+            i += 2;
+        } else if (first >= 0xE0 && first <= 0xEF) {
+            if (start + 1 >= len) return start;
+            u8   second = p[start + 1];
+            bool ok     = first == 0xE0   ? (second >= 0xA0 && second <= 0xBF)
+                          : first == 0xED ? (second >= 0x80 && second <= 0x9F)
+                                          : (second >= 0x80 && second <= 0xBF);
+            if (! ok || ! cont(2)) return start;
+            i += 3;
+        } else if (first >= 0xF0 && first <= 0xF4) {
+            if (start + 1 >= len) return start;
+            u8   second = p[start + 1];
+            bool ok     = first == 0xF0   ? (second >= 0x90 && second <= 0xBF)
+                          : first == 0xF4 ? (second >= 0x80 && second <= 0x8F)
+                                          : (second >= 0x80 && second <= 0xBF);
+            if (! ok || ! cont(2) || ! cont(3)) return start;
+            i += 4;
+        } else {
+            return start;
+        }
+    }
+    return len;
+}
+
+/// Maps `A`-`Z` to `a`-`z` in place; every other byte is left alone.
+export constexpr void make_ascii_lowercase(u8* p, usize len) noexcept {
+    usize i = 0;
+    if (! mtp::is_constant_evaluated()) {
+        for (; i + sizeof(u64) <= len; i += sizeof(u64)) store(p + i, lower_word(load(p + i)));
+    }
+    for (; i < len; ++i) p[i] = lower_byte(p[i]);
+}
+
+/// Maps `a`-`z` to `A`-`Z` in place; every other byte is left alone.
+export constexpr void make_ascii_uppercase(u8* p, usize len) noexcept {
+    usize i = 0;
+    if (! mtp::is_constant_evaluated()) {
+        for (; i + sizeof(u64) <= len; i += sizeof(u64)) store(p + i, upper_word(load(p + i)));
+    }
+    for (; i < len; ++i) p[i] = upper_byte(p[i]);
+}
+
+/// Compares `a[0, len)` and `b[0, len)` ignoring ASCII case.
+export constexpr auto eq_ignore_ascii_case(const u8* a, const u8* b, usize len) noexcept -> bool {
+    usize i = 0;
+    if (! mtp::is_constant_evaluated()) {
+        for (; i + 2 * sizeof(u64) <= len; i += 2 * sizeof(u64)) {
+            u64 d0 = lower_word(load(a + i)) ^ lower_word(load(b + i));
+            u64 d1 = lower_word(load(a + i + 8)) ^ lower_word(load(b + i + 8));
+            if (d0 | d1) return false;
+        }
+    }
+    for (; i < len; ++i) {
+        if (lower_byte(a[i]) != lower_byte(b[i])) return false;
+    }
+    return true;
+}
+
+} // namespace rstd::str_::validations
@@ -82,6 +82,9 @@ public:
             rstd::move(*waker).wake();
         }
     }
+
+    /// Takes the registered waker without waking it, for a waiter that gives up.
+    auto take() -> Option<task::Waker> { return take_waker(); }
 };
 
 } // namespace rstd::async
@@ -217,6 +217,20 @@ public:
         });
     }
 
+    /// Poll-style counterpart of `co_await`, for hand-written `poll_*` functions. Registers
+    /// `cx`'s waker while pending; after it returns `Ready` the completion is spent.
+    auto poll_complete(task::Context& cx) -> task::Poll<Output> {
+        if (! m_active || ! m_state) {
+            return task::Poll<Output>::Ready(Err(CompletionError<E>::canceled()));
+        }
+
+        auto out = m_state->wait(cx.waker());
+        if (out.is_none()) return task::Poll<Output>::Pending();
+
+        m_active = false;
+        return task::Poll<Output>::Ready(rstd::move(out).unwrap_unchecked());
+    }
+
     void close() {
         if (m_active && m_state) {
             m_active = false;
@@ -45,6 +45,17 @@ export class Runtime;
 
 export class RuntimeHandle;
 
+/// Where a thread-pool runtime places a task spawned from one of its own workers.
+///
+/// Spawns from outside the runtime are always placed by load.
+export enum class SpawnPlacement
+{
+    /// On the spawning worker, next to the task that spawned it.
+    Local,
+    /// On a lightly loaded worker, preferring one that is parked.
+    Balanced,
+};
+
 export class AtomicWaker;
 
 export struct IntoFuture;
@@ -0,0 +1,129 @@
+export module rstd:async.frame;
+export import :async.forward;
+import rstd.alloc;
+
+using namespace rstd;
+using rstd::alloc::Layout;
+
+namespace rstd::async
+{
+
+/// Coroutine frame allocation counters of the calling thread.
+export struct FrameStats {
+    /// Frames allocated on this thread, recycled or not.
+    u64 allocated { 0 };
+    /// Allocations served from this thread's free lists without the global allocator.
+    u64 recycled { 0 };
+};
+
+} // namespace rstd::async
+
+// Frames are recycled in 64-byte size classes up to 1 KiB, which covers typical handler and
+// I/O coroutines; bigger frames go straight to the global allocator.
+constexpr usize FRAME_CLASS_SIZE { 64 };
+constexpr usize FRAME_CLASSES { 16 };
+// Frames cached per class and thread, bounding what an idle thread holds on to.
+constexpr usize FRAME_CLASS_DEPTH { 32 };
+constexpr usize FRAME_ALIGN { __STDCPP_DEFAULT_NEW_ALIGNMENT__ };
+
+struct FreeFrame {
+    FreeFrame* next;
+};
+
+// Trivially destructible, so a frame freed while the thread's destructors run still finds it;
+// `closed` then sends such frames straight back to the global allocator.
+struct FramePool {
+    FreeFrame*        heads[FRAME_CLASSES];
+    usize             depths[FRAME_CLASSES];
+    async::FrameStats stats;
+    bool              guarded;
+    bool              closed;
+};
+
+inline thread_local FramePool FRAME_POOL {};
+
+inline auto frame_class(usize size) noexcept -> usize {
+    return (size + FRAME_CLASS_SIZE - 1) / FRAME_CLASS_SIZE - 1;
+}
+
+inline auto frame_layout(usize size) noexcept -> Layout {
+    usize index = frame_class(size);
+    return Layout::from_size_align_unchecked(
+        index < FRAME_CLASSES ? (index + 1) * FRAME_CLASS_SIZE : size, FRAME_ALIGN);
+}
+
+inline void release_frame(void* frame, usize size) noexcept {
+    ::alloc::dealloc(mut_ptr<u8>::from_raw_parts(static_cast<u8*>(frame)), frame_layout(size));
+}
+
+struct FramePoolGuard {
+    ~FramePoolGuard() {
+        auto& pool  = FRAME_POOL;
+        pool.closed = true;
+        for (usize i = 0; i < FRAME_CLASSES; ++i) {
+            while (pool.heads[i] != nullptr) {
+                auto* frame   = pool.heads[i];
+                pool.heads[i] = frame->next;
+                release_frame(frame, (i + 1) * FRAME_CLASS_SIZE);
+            }
+            pool.depths[i] = 0;
+        }
+    }
+};
+
+inline auto allocate_frame(usize size) -> void* {
+    auto& pool = FRAME_POOL;
+    pool.stats.allocated += 1;
+
+    usize index = frame_class(size);
+    if (index < FRAME_CLASSES && pool.heads[index] != nullptr) {
+        auto* frame       = pool.heads[index];
+        pool.heads[index] = frame->next;
+        pool.depths[index] -= 1;
+        pool.stats.recycled += 1;
+        return frame;
+    }
+
+    auto layout = frame_layout(size);
+    auto raw    = ::alloc::alloc(layout).as_raw_ptr();
+    if (raw == nullptr) ::alloc::handle_alloc_error(layout);
+    return raw;
+}
+
+// A frame may be freed on another thread than the one that allocated it, for example when a
+// runtime shuts down; it then joins the freeing thread's lists, which is fine as the classes
+// are the same everywhere.
+inline void deallocate_frame(void* frame, usize size) noexcept {
+    auto& pool  = FRAME_POOL;
+    usize index = frame_class(size);
+    if (index >= FRAME_CLASSES || pool.closed || pool.depths[index] >= FRAME_CLASS_DEPTH) {
+        release_frame(frame, size);
+        return;
+    }
+    if (! pool.guarded) {
+        thread_local FramePoolGuard GUARD;
+        (void)GUARD;
+        pool.guarded = true;
+    }
+
+    auto* free        = static_cast<FreeFrame*>(frame);
+    free->next        = pool.heads[index];
+    pool.heads[index] = free;
+    pool.depths[index] += 1;
+}
+
+// Promise types inherit the frame allocation functions from here.
+struct PooledFrame {
+    static auto operator new(usize size) -> void* { return allocate_frame(size); }
+    static void operator delete(void* frame, usize size) noexcept {
+        deallocate_frame(frame, size);
+    }
+};
+
+namespace rstd::async
+{
+
+/// Returns the frame counters of the calling thread.
+export auto frame_stats() noexcept -> FrameStats { return FRAME_POOL.stats; }
+
+} // namespace rstd::async
@@ -0,0 +1,111 @@
+export module rstd:async.metrics;
+export import :async.forward;
+export import :time;
+import rstd.alloc;
+
+using namespace rstd;
+using ::alloc::vec::Vec;
+using rstd::sync::atomic::Atomic;
+using rstd::sync::atomic::Ordering;
+
+namespace rstd::async
+{
+
+/// Buckets of the poll-time histogram: bucket 0 counts polls under 1us and bucket `i` those
+/// in [2^(i-1), 2^i) us, the last one also taking everything slower.
+export inline constexpr usize POLL_TIME_BUCKETS { 16 };
+
+/// Counters of one runtime worker, read without stopping it.
+export struct WorkerMetrics {
+    /// Task polls run.
+    u64 polls { 0 };
+    /// Polls of a task taken from the LIFO slot.
+    u64 lifo_polls { 0 };
+    /// Wakes queued straight into the LIFO slot by the task being polled.
+    u64 lifo_schedules { 0 };
+    /// Tickets received through the inbox, from other threads or outside a poll.
+    u64 inbox_schedules { 0 };
+    /// Times the worker ran out of its cooperative budget with tasks still ready.
+    u64 budget_exhausted { 0 };
+    /// Times the worker parked in its poller with nothing to run.
+    u64 parks { 0 };
+    /// Times work arrived while the worker spun before parking, so it never parked.
+    u64 spin_wakeups { 0 };
+    /// Tickets scheduled on the worker and not yet run, at the time of the snapshot.
+    usize queue_depth { 0 };
+    /// Whether the worker was parked at the time of the snapshot.
+    bool parked { false };
+    /// Poll durations, when the runtime was built with the histogram enabled.
+    u64 poll_times[POLL_TIME_BUCKETS] {};
+};
+
+/// A snapshot of a runtime's scheduler counters; see `RuntimeBuilder::enable_metrics`.
+///
+/// Counters stay zero unless metrics are enabled; `live_tasks`, `queue_depth` and `parked`
+/// are always filled in.
+export struct RuntimeMetrics {
+    /// Tasks spawned since the runtime was built.
+    u64 spawned_tasks { 0 };
+    /// Tasks spawned and not yet retired.
+    usize live_tasks { 0 };
+    /// One entry per worker, by worker index.
+    Vec<WorkerMetrics> workers;
+};
+
+/// Callbacks for a local tracing sink, each optional. `task` is an id that is unique while
+/// the task lives and `worker` the index of the worker involved. Hooks run inline on runtime
+/// threads, so they must be cheap and must not block.
+export struct RuntimeHooks {
+    voidp context { nullptr };
+    void (*on_task_spawn)(voidp context, usize task, usize worker) { nullptr };
+    void (*on_poll_start)(voidp context, usize task, usize worker) { nullptr };
+    void (*on_poll_end)(voidp context, usize task, usize worker, time::Duration elapsed) {
+        nullptr
+    };
+    void (*on_park)(voidp context, usize worker) { nullptr };
+    void (*on_unpark)(voidp context, usize worker) { nullptr };
+};
+
+} // namespace rstd::async
+
+inline auto poll_time_bucket(time::Duration elapsed) noexcept -> usize {
+    u64 micros = elapsed.as_micros();
+    if (micros == 0) return 0;
+    usize bucket = usize(64 - __builtin_clzll(micros));
+    return bucket < async::POLL_TIME_BUCKETS ? bucket : async::POLL_TIME_BUCKETS - 1;
+}
+
+// The live counters behind `WorkerMetrics`. Only the owning worker writes them, so a bump is
+// a relaxed load and store rather than a locked read-modify-write; readers may see a count
+// one behind.
+struct WorkerCounters {
+    Atomic<u64> polls { 0 };
+    Atomic<u64> lifo_polls { 0 };
+    Atomic<u64> lifo_schedules { 0 };
+    Atomic<u64> inbox_schedules { 0 };
+    Atomic<u64> budget_exhausted { 0 };
+    Atomic<u64> parks { 0 };
+    Atomic<u64> spin_wakeups { 0 };
+    Atomic<u64> poll_times[async::POLL_TIME_BUCKETS] {};
+
+    static void bump(Atomic<u64>& counter) noexcept {
+        counter.store(counter.load(Ordering::Relaxed) + 1, Ordering::Relaxed);
+    }
+
+    void record_poll_time(time::Duration elapsed) noexcept {
+        bump(poll_times[poll_time_bucket(elapsed)]);
+    }
+
+    void snapshot_into(async::WorkerMetrics& out) const noexcept {
+        out.polls            = polls.load(Ordering::Relaxed);
+        out.lifo_polls       = lifo_polls.load(Ordering::Relaxed);
+        out.lifo_schedules   = lifo_schedules.load(Ordering::Relaxed);
+        out.inbox_schedules  = inbox_schedules.load(Ordering::Relaxed);
+        out.budget_exhausted = budget_exhausted.load(Ordering::Relaxed);
+        out.parks            = parks.load(Ordering::Relaxed);
+        out.spin_wakeups     = spin_wakeups.load(Ordering::Relaxed);
+        for (usize i = 0; i < async::POLL_TIME_BUCKETS; ++i) {
+            out.poll_times[i] = poll_times[i].load(Ordering::Relaxed);
+        }
+    }
+};
@@ -3,9 +3,11 @@ export import :async.forward;
 export import :async.atomic_waker;
 export import :async.executor;
 export import :async.awaitable;
+export import :async.frame;
 export import :async.task;
 export import :async.coro_driver;
 export import :async.join;
+export import :async.metrics;
 export import :async.select;
 export import :async.oneshot;
 export import :async.io;
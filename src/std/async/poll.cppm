@@ -12,6 +12,9 @@ import :sync;
 import rstd.alloc;
 
 using namespace rstd;
+using ::alloc::collections::HandleHeap;
+using ::alloc::collections::HashMap;
+using ::alloc::collections::SlotKey;
 using ::alloc::vec::Vec;
 namespace libc = rstd::sys::libc;
 
@@ -279,6 +282,7 @@ public:
 export class PollEvent {
     PollEventData          m_data;
     Option<PollEventOwner> m_owner;
+    const PollEventOwner*  m_borrowed { nullptr };
 
     PollEvent(PollEventData data, Option<PollEventOwner> owner)
         : m_data(rstd::move(data)), m_owner(rstd::move(owner)) {}
@@ -292,6 +296,15 @@ public:
         return PollEvent { rstd::move(data), Some(rstd::move(owner)) };
     }
 
+    /// An event for an owner held elsewhere, which must outlive the dispatch. `Poll` uses it
+    /// for registration readiness: a registration only goes away when a command is applied,
+    /// never while a batch is being dispatched, so no per-event reference count is taken.
+    static auto borrowed(PollEventData data, const PollEventOwner& owner) -> PollEvent {
+        auto event       = PollEvent { rstd::move(data), None() };
+        event.m_borrowed = rstd::addressof(owner);
+        return event;
+    }
+
     PollEvent(const PollEvent&)                        = delete;
     auto operator=(const PollEvent&) -> PollEvent&     = delete;
     PollEvent(PollEvent&&) noexcept                    = default;
@@ -303,6 +316,8 @@ public:
     void dispatch() {
         if (m_owner.is_some()) {
             m_owner->dispatch(rstd::move(m_data));
+        } else if (m_borrowed != nullptr) {
+            m_borrowed->dispatch(rstd::move(m_data));
         }
     }
 };
@@ -434,19 +449,33 @@ public:
     auto take_error() -> io::Error { return m_error.take().unwrap_unchecked(); }
 };
 
+/// Events gathered by one `Poll::poll`, consumed front to back.
+///
+/// A worker keeps one batch for its lifetime: popping only advances a cursor, and the storage
+/// is rewound rather than freed once the batch drains, so steady-state polling does not
+/// allocate.
 export class PollBatch {
     Vec<PollEvent> m_events;
+    usize          m_head { 0 };
 
 public:
     PollBatch(): m_events(Vec<PollEvent>::make()) {}
 
-    auto is_empty() const noexcept -> bool { return m_events.is_empty(); }
-    auto len() const noexcept -> usize { return m_events.len(); }
+    auto is_empty() const noexcept -> bool { return m_head == m_events.len(); }
+    auto len() const noexcept -> usize { return m_events.len() - m_head; }
     void push(PollEvent event) { m_events.push(rstd::move(event)); }
 
     auto pop_front() -> Option<PollEvent> {
-        if (m_events.is_empty()) return None();
-        return Some(m_events.remove(0));
+        if (is_empty()) return None();
+        auto event = rstd::move(m_events[m_head++]);
+        if (is_empty()) clear();
+        return Some(rstd::move(event));
+    }
+
+    /// Drops the events not yet popped, keeping the storage.
+    void clear() {
+        m_events.clear();
+        m_head = 0;
     }
 };
 
@@ -506,13 +535,24 @@ struct PollTimer {
         : key(key), deadline(deadline), owner(rstd::move(owner)) {}
 };
 
+// Orders timers so the earliest deadline sits on top of the heap.
+struct PollTimerLater {
+    auto operator()(const PollTimer& left, const PollTimer& right) const noexcept -> bool {
+        return right.deadline < left.deadline;
+    }
+};
+
 export class PollState {
-    PollStateKind         m_kind { PollStateKind::Closed };
-    sys::fd::OwnedFd      m_poll_fd {};
-    sys::fd::OwnedFd      m_wake_fd {};
-    sys::fd::OwnedFd      m_timer_fd {};
-    Vec<PollRegistration> m_registrations;
-    Vec<PollTimer>        m_timers;
+    PollStateKind    m_kind { PollStateKind::Closed };
+    sys::fd::OwnedFd m_poll_fd {};
+    sys::fd::OwnedFd m_wake_fd {};
+    sys::fd::OwnedFd m_timer_fd {};
+    // Sources by key value, looked up once per backend event.
+    HashMap<u64, PollRegistration> m_registrations;
+    // Armed timers by deadline, plus the heap handle of each timer key so a cancel or a
+    // duplicate check does not scan the heap.
+    HandleHeap<PollTimer, PollTimerLater> m_timers;
+    HashMap<u64, SlotKey>                 m_timer_handles;
 #if RSTD_OS_LINUX
     Vec<libc::epoll_event> m_backend_events;
 #endif
@@ -522,8 +562,9 @@ export class PollState {
           m_poll_fd(rstd::move(poll_fd)),
           m_wake_fd(rstd::move(wake_fd)),
           m_timer_fd(rstd::move(timer_fd)),
-          m_registrations(Vec<PollRegistration>::make()),
-          m_timers(Vec<PollTimer>::make())
+          m_registrations(HashMap<u64, PollRegistration>::make()),
+          m_timers(HandleHeap<PollTimer, PollTimerLater>::make()),
+          m_timer_handles(HashMap<u64, SlotKey>::make())
 #if RSTD_OS_LINUX
           ,
           m_backend_events(Vec<libc::epoll_event>::make())
@@ -618,11 +659,9 @@ export class Poll {
     }
 
     static auto find_registration(PollState& state, PollKey key) -> PollRegistration* {
-        for (usize i = 0; i < state.m_registrations.len(); ++i) {
-            if (state.m_registrations[i].key == key)
-                return rstd::addressof(state.m_registrations[i]);
-        }
-        return nullptr;
+        auto found = state.m_registrations.get_mut(key.value);
+        if (found.is_none()) return nullptr;
+        return rstd::addressof(**found);
     }
 
     static auto update_registration(PollState&        state,
@@ -648,8 +687,10 @@ export class Poll {
             return Ok(empty {});
         }
 
+        // Edge-triggered: the reactor keeps readiness until a syscall reports `WouldBlock`, so
+        // a source is registered once and never re-armed per event.
         auto event     = libc::epoll_event {};
-        event.events   = events | libc::EPOLLERR | libc::EPOLLHUP;
+        event.events   = events | libc::EPOLLERR | libc::EPOLLHUP | libc::EPOLLET;
         event.data.u64 = registration.key.value;
         auto operation =
             registration.backend_registered ? libc::EPOLL_CTL_MOD : libc::EPOLL_CTL_ADD;
@@ -672,14 +713,8 @@ export class Poll {
     static auto update_timer(PollState& state) -> io::Result<empty> {
 #if RSTD_OS_LINUX
         auto spec = libc::itimerspec_t {};
-        if (! state.m_timers.is_empty()) {
-            auto deadline = state.m_timers[0].deadline;
-            for (usize i = 1; i < state.m_timers.len(); ++i) {
-                if (state.m_timers[i].deadline < deadline) {
-                    deadline = state.m_timers[i].deadline;
-                }
-            }
-
+        if (auto next = state.m_timers.peek(); next.is_some()) {
+            auto deadline = (*next)->deadline;
             auto now      = time::Instant::now();
             auto duration = deadline <= now ? time::Duration::from_nanos(1) : deadline - now;
             spec.it_value = duration_to_timespec(duration);
@@ -697,14 +732,12 @@ export class Poll {
 
     static auto collect_expired_timers(PollState& state, PollBatch& batch) -> io::Result<empty> {
         auto now = time::Instant::now();
-        for (usize i = 0; i < state.m_timers.len();) {
-            if (state.m_timers[i].deadline <= now) {
-                auto timer = state.m_timers.remove(i);
-                batch.push(
-                    PollEvent::owned(PollEventData::timer(timer.key), rstd::move(timer.owner)));
-            } else {
-                ++i;
-            }
+        while (true) {
+            auto next = state.m_timers.peek();
+            if (next.is_none() || now < (*next)->deadline) break;
+            auto timer = state.m_timers.pop().unwrap_unchecked();
+            (void)state.m_timer_handles.remove(timer.key.value);
+            batch.push(PollEvent::owned(PollEventData::timer(timer.key), rstd::move(timer.owner)));
         }
         return update_timer(state);
     }
@@ -783,7 +816,7 @@ public:
                 return PollApplyResult::rejected(rstd::move(command),
                                                  rstd::move(updated).unwrap_err_unchecked());
             }
-            state.m_registrations.push(rstd::move(registration));
+            (void)state.m_registrations.insert(command.key().value, rstd::move(registration));
             return PollApplyResult::accepted();
         }
         case PollCommandKind::UpdateInterest: {
@@ -801,16 +834,14 @@ public:
             return PollApplyResult::accepted();
         }
         case PollCommandKind::DeregisterSource: {
-            for (usize i = 0; i < state.m_registrations.len(); ++i) {
-                if (state.m_registrations[i].key != command.key()) continue;
-                auto updated = update_registration(state, state.m_registrations[i], Interest {});
-                if (updated.is_err()) {
-                    return PollApplyResult::rejected(rstd::move(command),
-                                                     rstd::move(updated).unwrap_err_unchecked());
-                }
-                state.m_registrations.remove(i);
-                return PollApplyResult::accepted();
+            auto* registration = find_registration(state, command.key());
+            if (registration == nullptr) return PollApplyResult::accepted();
+            auto updated = update_registration(state, *registration, Interest {});
+            if (updated.is_err()) {
+                return PollApplyResult::rejected(rstd::move(command),
+                                                 rstd::move(updated).unwrap_err_unchecked());
             }
+            (void)state.m_registrations.remove(command.key().value);
             return PollApplyResult::accepted();
         }
         case PollCommandKind::SubmitOperation:
@@ -827,41 +858,44 @@ public:
                     rstd::move(command),
                     io::Error::from_kind(io::ErrorKind { io::ErrorKind::InvalidInput }));
             }
-            for (usize i = 0; i < state.m_timers.len(); ++i) {
-                if (state.m_timers[i].key == command.key()) {
-                    return PollApplyResult::rejected(
-                        rstd::move(command),
-                        io::Error::from_kind(io::ErrorKind { io::ErrorKind::InvalidInput }));
-                }
+            if (state.m_timer_handles.contains_key(command.key().value)) {
+                return PollApplyResult::rejected(
+                    rstd::move(command),
+                    io::Error::from_kind(io::ErrorKind { io::ErrorKind::InvalidInput }));
             }
 
-            state.m_timers.push(
+            auto handle = state.m_timers.push(
                 PollTimer { command.key(), command.deadline(), command.owner().clone() });
+            (void)state.m_timer_handles.insert(command.key().value, handle);
             auto updated = update_timer(state);
             if (updated.is_err()) {
-                state.m_timers.pop();
+                (void)state.m_timers.remove(handle);
+                (void)state.m_timer_handles.remove(command.key().value);
                 return PollApplyResult::rejected(rstd::move(command),
                                                  rstd::move(updated).unwrap_err_unchecked());
             }
             return PollApplyResult::accepted();
         }
-        case PollCommandKind::CancelTimer:
-            for (usize i = 0; i < state.m_timers.len(); ++i) {
-                if (state.m_timers[i].key != command.key()) continue;
-                state.m_timers.remove(i);
-                auto updated = update_timer(state);
-                if (updated.is_err()) {
-                    return PollApplyResult::rejected(rstd::move(command),
-                                                     rstd::move(updated).unwrap_err_unchecked());
-                }
-                return PollApplyResult::accepted();
+        case PollCommandKind::CancelTimer: {
+            if (command.key().kind != PollKeyKind::Timer) return PollApplyResult::accepted();
+            auto handle = state.m_timer_handles.remove(command.key().value);
+            if (handle.is_none()) return PollApplyResult::accepted();
+            (void)state.m_timers.remove(*handle);
+            auto updated = update_timer(state);
+            if (updated.is_err()) {
+                return PollApplyResult::rejected(rstd::move(command),
+                                                 rstd::move(updated).unwrap_err_unchecked());
             }
             return PollApplyResult::accepted();
         }
+        }
         return PollApplyResult::unsupported(rstd::move(command));
     }
 
-    static auto poll(PollState& state, PollTimeout timeout) -> io::Result<PollBatch> {
+    /// Waits for backend events and appends them to `batch`, which the caller reuses across
+    /// polls. Readiness events borrow their registration's owner; see `PollEvent::borrowed`.
+    static auto poll(PollState& state, PollTimeout timeout, PollBatch& batch)
+        -> io::Result<empty> {
 #if RSTD_OS_LINUX
         if (state.m_kind == PollStateKind::Closed) {
             return Err(io::Error::from_kind(io::ErrorKind { io::ErrorKind::NotConnected }));
@@ -880,7 +914,6 @@ public:
 
         if (count < 0) return Err(last_os_error());
 
-        auto batch = PollBatch {};
         for (int i = 0; i < count; ++i) {
             auto& event = state.m_backend_events[usize(i)];
             if (event.data.u64 == POLL_WAKE_KEY) {
@@ -902,15 +935,16 @@ public:
             if (registration != nullptr) {
                 auto ready = backend_ready(event.events);
                 if (! ready.is_empty()) {
-                    batch.push(PollEvent::owned(PollEventData::readiness(key, ready),
-                                                registration->owner.clone()));
+                    batch.push(PollEvent::borrowed(PollEventData::readiness(key, ready),
+                                                   registration->owner));
                 }
             }
         }
-        return Ok(rstd::move(batch));
+        return Ok(empty {});
 #else
         (void)state;
         (void)timeout;
+        (void)batch;
         return Err(io::Error::from_kind(io::ErrorKind { io::ErrorKind::Unsupported }));
 #endif
     }
@@ -919,14 +953,17 @@ public:
         auto batch = PollBatch {};
         if (state.m_kind == PollStateKind::Closed) return batch;
         state.m_kind = PollStateKind::Draining;
-        while (! state.m_registrations.is_empty()) {
-            auto registration = state.m_registrations.pop().unwrap_unchecked();
+        auto registrations = state.m_registrations.into_iter();
+        for (auto entry = registrations.next(); entry.is_some(); entry = registrations.next()) {
+            auto& registration = entry->get<1>();
             batch.push(PollEvent::owned(
                 PollEventData::backend_error(
                     registration.key,
                     io::Error::from_kind(io::ErrorKind { io::ErrorKind::NotConnected })),
                 rstd::move(registration.owner)));
         }
+        state.m_registrations = HashMap<u64, PollRegistration>::make();
+        state.m_timer_handles.clear();
         while (! state.m_timers.is_empty()) {
             auto timer = state.m_timers.pop().unwrap_unchecked();
             batch.push(PollEvent::owned(
@@ -6,6 +6,7 @@ export import :async.forward;
 export import :async.readiness;
 export import :io.error;
 export import :time;
+import :async.atomic_waker;
 import :async.awaitable;
 import :async.poll;
 import :async.runtime_core;
@@ -14,7 +15,10 @@ import :sync;
 import rstd.alloc;
 
 using namespace rstd;
-using ::alloc::vec::Vec;
+using ::alloc::collections::IntrusiveLink;
+using ::alloc::collections::IntrusiveList;
+using rstd::sync::atomic::Atomic;
+using rstd::sync::atomic::Ordering;
 
 namespace rstd::async
 {
@@ -35,34 +39,50 @@ export struct ReadyEvent {
 
 inline constexpr usize READINESS_FACILITY_ID { rstd::numeric_limits<usize>::max() - 1 };
 
-struct ReadinessFacilityWaiter {
-    usize                   id;
-    Interest                interest;
-    FacilityCompletionToken token;
+// `RegistrationState::readiness` packs the sticky `Ready` bits into the low byte, a closed
+// flag above them and the event tick into the high bits, so the event path and the waiters
+// agree on readiness through a single atomic word.
+inline constexpr usize READINESS_READY_MASK { 0xff };
+inline constexpr usize READINESS_CLOSED { usize(1) << 8 };
+inline constexpr usize READINESS_TICK_SHIFT { 16 };
+inline constexpr usize READINESS_TICK_ONE { usize(1) << READINESS_TICK_SHIFT };
 
-    ReadinessFacilityWaiter(usize id, Interest interest, FacilityCompletionToken token)
-        : id(id), interest(interest), token(rstd::move(token)) {}
-};
+// The readiness bits that end a wait in each direction.
+inline constexpr u8 READ_READY_BITS { u8(Ready::READABLE | Ready::READ_CLOSED | Ready::ERROR) };
+inline constexpr u8 WRITE_READY_BITS { u8(Ready::WRITABLE | Ready::WRITE_CLOSED | Ready::ERROR) };
+
+constexpr auto readiness_ready(usize word) noexcept -> Ready {
+    return Ready { u8(word & READINESS_READY_MASK) };
+}
+
+constexpr auto readiness_tick(usize word) noexcept -> usize { return word >> READINESS_TICK_SHIFT; }
 
+struct ReadinessFacilityWaiter;
+
+// What only the binding, closing and facility paths touch.
 struct RegistrationFields {
-    Ready                        ready {};
-    usize                        tick { 1 };
-    Option<task::Waker>          read_waker {};
-    Option<task::Waker>          write_waker {};
-    usize                        read_waiter_id {};
-    usize                        write_waiter_id {};
-    usize                        next_waiter_id { 1 };
-    Option<WorkerHandle>         worker {};
-    Option<PollKey>              key {};
-    Option<io::Error>            error {};
-    bool                         closed { false };
-    Vec<ReadinessFacilityWaiter> facility_waiters;
-
-    RegistrationFields(): facility_waiters(Vec<ReadinessFacilityWaiter>::make()) {}
+    Option<WorkerHandle>                   worker {};
+    Option<PollKey>                        key {};
+    Option<io::Error>                      error {};
+    IntrusiveList<ReadinessFacilityWaiter> facility_waiters {};
 };
 
+// The source is registered edge-triggered for both directions on its first wait, so an event
+// only folds into `readiness` and wakes the inline waker slots; `fields` is locked on that
+// path only while facility waiters are parked. `read_tick` and `write_tick` hold the tick last
+// handed out per direction, which `Registration::clear_readiness(Ready)` clears against.
 struct RegistrationState {
     sys::fd::RawFd                  fd;
+    Atomic<usize>                   readiness { READINESS_TICK_ONE };
+    AtomicWaker                     read_waker;
+    AtomicWaker                     write_waker;
+    Atomic<usize>                   read_waiter_id { 0 };
+    Atomic<usize>                   write_waiter_id { 0 };
+    Atomic<usize>                   read_tick { 0 };
+    Atomic<usize>                   write_tick { 0 };
+    Atomic<usize>                   next_waiter_id { 1 };
+    Atomic<usize>                   facility_count { 0 };
+    Atomic<bool>                    bound { false };
     sync::Mutex<RegistrationFields> fields;
 
     explicit RegistrationState(sys::fd::RawFd fd): fd(fd), fields(RegistrationFields {}) {}
@@ -89,55 +109,89 @@ struct TimerState {
 using RegistrationArc = sync::Arc<RegistrationState>;
 using TimerArc        = sync::Arc<TimerState>;
 
+// A parked facility waiter. It doubles as the cancellation handed to the facility, so a cancel
+// unlinks it without a scan. While linked, `facility_waiters` owns one strong reference, which
+// `unlink_facility_waiter` takes back; the links, `interest` and `token` are guarded by `fields`.
+struct ReadinessFacilityWaiter : IntrusiveLink<ReadinessFacilityWaiter> {
+    RegistrationArc                 registration;
+    usize                           id;
+    Interest                        interest;
+    Option<FacilityCompletionToken> token;
+
+    ReadinessFacilityWaiter(RegistrationArc         registration,
+                            usize                   id,
+                            Interest                interest,
+                            FacilityCompletionToken token)
+        : registration(rstd::move(registration)),
+          id(id),
+          interest(interest),
+          token(Some(rstd::move(token))) {}
+};
+
+using ReadinessWaiterArc = sync::Arc<ReadinessFacilityWaiter>;
+
 auto make_registration_owner(const RegistrationArc& state) -> PollEventOwner;
 auto make_timer_owner(const TimerArc& state) -> PollEventOwner;
 
-auto registration_interest(const RegistrationFields& fields) noexcept -> Interest {
-    auto interest = Interest {};
-    if (fields.read_waker.is_some()) interest = interest | Interest::readable();
-    if (fields.write_waker.is_some()) interest = interest | Interest::writable();
-    for (usize i = 0; i < fields.facility_waiters.len(); ++i) {
-        interest = interest | fields.facility_waiters[i].interest;
-    }
-    return interest;
+// Unlinks a waiter with `fields` locked and returns the list's reference to it, which the
+// caller drops after unlocking.
+auto unlink_facility_waiter(const RegistrationArc&   state,
+                            RegistrationFields&      fields,
+                            ReadinessFacilityWaiter& waiter) -> ReadinessWaiterArc {
+    (void)fields.facility_waiters.remove(waiter);
+    state->facility_count.fetch_sub(1, Ordering::SeqCst);
+    return ReadinessWaiterArc::from_raw(::alloc::sync::ArcRaw<ReadinessFacilityWaiter>::from_raw(
+        static_cast<voidp>(rstd::addressof(waiter))));
+}
+
+// Takes one facility waiter `ready` satisfies, or any waiter without a filter.
+auto take_facility_waiter(const RegistrationArc& state, Option<Ready> ready)
+    -> Option<FacilityCompletionToken> {
+    auto taken = Option<ReadinessWaiterArc> {};
+    auto token = Option<FacilityCompletionToken> {};
+    {
+        auto fields = state->fields.lock().unwrap_unchecked();
+        fields->facility_waiters.for_each([&](ReadinessFacilityWaiter& waiter) {
+            if (taken.is_some()) return;
+            if (ready.is_some() && ready->for_interest(waiter.interest).is_empty()) return;
+            token = waiter.token.take();
+            taken = Some(unlink_facility_waiter(state, *fields, waiter));
+        });
+    }
+    return token;
 }
 
-void wake_all(Vec<task::Waker>& wakers) {
-    while (! wakers.is_empty()) {
-        rstd::move(wakers.pop().unwrap_unchecked()).wake();
+// Completes the waiters one at a time, so no token sits in a temporary vector and none is
+// completed under the lock.
+void complete_facility_waiters(const RegistrationArc& state, PollKey key, Ready ready) {
+    while (true) {
+        auto token = take_facility_waiter(state, Some(ready));
+        if (token.is_none()) return;
+        (void)rstd::move(token).unwrap_unchecked().complete_poll(
+            PollEventData::readiness(key, ready));
     }
 }
 
 void fail_registration(const RegistrationArc& state, io::Error error) {
-    auto wakers           = Vec<task::Waker>::make();
-    auto tokens           = Vec<FacilityCompletionToken>::make();
-    auto key              = PollKey {};
-    auto completion_error = io::Error { error };
+    auto key = PollKey {};
     {
-        auto fields = state->fields.lock().unwrap_unchecked();
-        if (fields->closed) return;
-        fields->closed = true;
-        fields->error  = Some(rstd::move(error));
-        if (fields->read_waker.is_some()) {
-            wakers.push(rstd::move(fields->read_waker).unwrap_unchecked());
-        }
-        if (fields->write_waker.is_some()) {
-            wakers.push(rstd::move(fields->write_waker).unwrap_unchecked());
-        }
-        fields->read_waiter_id  = 0;
-        fields->write_waiter_id = 0;
+        // Closed under the lock, so a facility waiter is either parked before and drained
+        // below, or rejected.
+        auto fields   = state->fields.lock().unwrap_unchecked();
+        auto previous = state->readiness.fetch_or(READINESS_CLOSED, Ordering::SeqCst);
+        if ((previous & READINESS_CLOSED) != 0) return;
+        fields->error = Some(io::Error { error });
         if (fields->key.is_some()) {
             key = *fields->key;
         }
-        while (! fields->facility_waiters.is_empty()) {
-            tokens.push(rstd::move(fields->facility_waiters.pop()).unwrap_unchecked().token);
-        }
     }
-    wake_all(wakers);
-    while (! tokens.is_empty()) {
-        auto token = rstd::move(tokens.pop()).unwrap_unchecked();
-        (void)token.complete_poll(
-            PollEventData::backend_error(key, io::Error { completion_error }));
+    state->read_waker.wake();
+    state->write_waker.wake();
+    while (true) {
+        auto token = take_facility_waiter(state, None());
+        if (token.is_none()) return;
+        (void)rstd::move(token).unwrap_unchecked().complete_poll(
+            PollEventData::backend_error(key, io::Error { error }));
     }
 }
 
@@ -150,50 +204,88 @@ auto submit_registration_command(const RegistrationArc& state,
     return false;
 }
 
-struct ReadinessCancellationState {
-    RegistrationArc registration;
-    usize           waiter_id;
-
-    ReadinessCancellationState(RegistrationArc registration, usize waiter_id)
-        : registration(rstd::move(registration)), waiter_id(waiter_id) {}
-};
-
-using ReadinessCancellationArc = sync::Arc<ReadinessCancellationState>;
+// Binds the registration to the calling worker on its first wait and registers the source
+// there for both directions; later waits find it bound without locking. Returns false when
+// there is no worker to bind to.
+auto bind_registration(const RegistrationArc& state) -> io::Result<bool> {
+    if (state->bound.load(Ordering::Acquire)) return Ok(true);
+    if (CURRENT_RUNTIME == nullptr || ! has_current_runtime_worker()) return Ok(false);
 
-void cancel_readiness_waiter(const ReadinessCancellationArc& cancellation) {
-    auto  token   = Option<FacilityCompletionToken> {};
-    auto  worker  = Option<WorkerHandle> {};
-    auto  command = Option<PollCommand> {};
-    auto& state   = cancellation->registration;
+    auto worker  = Option<WorkerHandle> {};
+    auto command = Option<PollCommand> {};
     {
         auto fields = state->fields.lock().unwrap_unchecked();
-        for (usize i = 0; i < fields->facility_waiters.len(); ++i) {
-            if (fields->facility_waiters[i].id != cancellation->waiter_id) {
-                continue;
-            }
-            token = Some(rstd::move(fields->facility_waiters.remove(i)).token);
-            if (! fields->closed && fields->worker.is_some() && fields->key.is_some()) {
-                worker  = Some(fields->worker->clone());
-                command = Some(PollCommand::update_interest(
-                    *fields->key, registration_interest(*fields), make_registration_owner(state)));
-            }
-            break;
+        if (! state->bound.load(Ordering::Relaxed)) {
+            auto current = CURRENT_RUNTIME->current_poll_worker();
+            if (current.is_err()) return Err(rstd::move(current).unwrap_err_unchecked());
+
+            auto bound     = rstd::move(current).unwrap_unchecked();
+            auto key       = bound.allocate_poll_key(PollKeyKind::Registration);
+            fields->worker = Some(bound.clone());
+            fields->key    = Some(key);
+            worker         = Some(rstd::move(bound));
+            command        = Some(PollCommand::register_source(
+                key, state->fd, Interest::read_write(), make_registration_owner(state)));
+            state->bound.store(true, Ordering::Release);
+        }
+    }
+
+    if (command.is_some() &&
+        ! submit_registration_command(state, *worker, rstd::move(command).unwrap_unchecked())) {
+        return Err(io::Error::from_kind(io::ErrorKind { io::ErrorKind::NotConnected }));
+    }
+    return Ok(true);
+}
+
+auto registration_closed_error(const RegistrationArc& state) -> io::Error {
+    auto fields = state->fields.lock().unwrap_unchecked();
+    return fields->error.is_some()
+               ? io::Error { *fields->error }
+               : io::Error::from_kind(io::ErrorKind { io::ErrorKind::NotConnected });
+}
+
+// Records the tick handed out for each direction of `interest`.
+auto observe_readiness(const RegistrationArc& state, Interest interest, ReadyEvent event)
+    -> ReadyEvent {
+    if (interest.is_readable()) state->read_tick.store(event.tick(), Ordering::Relaxed);
+    if (interest.is_writable()) state->write_tick.store(event.tick(), Ordering::Relaxed);
+    return event;
+}
+
+// Clears `bits` unless an event arrived since `tick`, whose readiness must not be lost.
+void clear_registration_readiness(const RegistrationArc& state, u8 bits, usize tick) {
+    auto word = state->readiness.load(Ordering::Relaxed);
+    while (readiness_tick(word) == tick && (word & bits) != 0) {
+        if (state->readiness.compare_exchange_weak(
+                word, word & ~usize(bits), Ordering::AcqRel, Ordering::Relaxed)) {
+            return;
         }
     }
-    if (command.is_some()) {
-        (void)submit_registration_command(state, *worker, rstd::move(command).unwrap_unchecked());
+}
+
+void cancel_readiness_waiter(const ReadinessWaiterArc& cancellation) {
+    auto  taken = Option<ReadinessWaiterArc> {};
+    auto  token = Option<FacilityCompletionToken> {};
+    auto& state = cancellation->registration;
+    {
+        auto  fields = state->fields.lock().unwrap_unchecked();
+        auto& waiter = *cancellation.as_ptr().as_raw_ptr();
+        if (waiter.is_linked()) {
+            token = waiter.token.take();
+            taken = Some(unlink_facility_waiter(state, *fields, waiter));
+        }
     }
 }
 
 void readiness_cancellation_cancel(voidp data) {
-    auto cancellation = ReadinessCancellationArc::from_raw(
-        ::alloc::sync::ArcRaw<ReadinessCancellationState>::from_raw(data));
+    auto cancellation = ReadinessWaiterArc::from_raw(
+        ::alloc::sync::ArcRaw<ReadinessFacilityWaiter>::from_raw(data));
     cancel_readiness_waiter(cancellation);
 }
 
 void readiness_cancellation_drop(voidp data) {
-    auto cancellation = ReadinessCancellationArc::from_raw(
-        ::alloc::sync::ArcRaw<ReadinessCancellationState>::from_raw(data));
+    auto cancellation = ReadinessWaiterArc::from_raw(
+        ::alloc::sync::ArcRaw<ReadinessFacilityWaiter>::from_raw(data));
     (void)cancellation;
 }
 
@@ -202,15 +294,16 @@ const RawFacilityCancellationVTable READINESS_CANCELLATION_VTABLE {
     &readiness_cancellation_drop,
 };
 
-auto make_readiness_cancellation(const RegistrationArc& state, usize waiter_id, FacilityToken token)
+auto make_readiness_cancellation(ReadinessWaiterArc cancellation, FacilityToken token)
     -> FacilityCancellation {
-    auto cancellation = ReadinessCancellationArc::make(state.clone(), waiter_id);
     return FacilityCancellation::from_raw(
         token,
         RawFacilityCancellation::from_raw_parts(rstd::move(cancellation).into_raw().into_raw(),
                                                 rstd::addressof(READINESS_CANCELLATION_VTABLE)));
 }
 
+// Runs once per readiness event in a poll batch: one compare-and-swap on the readiness word and
+// a wake per satisfied direction, without locking or allocating.
 void handle_registration_event(const RegistrationArc& state, PollEventData data) {
     if (data.kind() == PollEventKind::BackendError) {
         auto error = data.has_backend_error()
@@ -222,50 +315,16 @@ void handle_registration_event(const RegistrationArc& state, PollEventData data)
     if (data.kind() != PollEventKind::Readiness) return;
 
     auto ready = data.readiness();
-    auto key   = data.key();
+    auto word  = state->readiness.load(Ordering::Relaxed);
+    do {
+        if ((word & READINESS_CLOSED) != 0) return;
+    } while (! state->readiness.compare_exchange_weak(
+        word, (word + READINESS_TICK_ONE) | ready.m_bits, Ordering::SeqCst, Ordering::Relaxed));
 
-    auto wakers  = Vec<task::Waker>::make();
-    auto tokens  = Vec<FacilityCompletionToken>::make();
-    auto worker  = Option<WorkerHandle> {};
-    auto command = Option<PollCommand> {};
-    {
-        auto fields = state->fields.lock().unwrap_unchecked();
-        if (fields->closed) return;
-
-        fields->ready |= ready;
-        ++fields->tick;
-        if ((ready.is_readable() || ready.is_read_closed() || ready.is_error()) &&
-            fields->read_waker.is_some()) {
-            wakers.push(rstd::move(fields->read_waker).unwrap_unchecked());
-            fields->read_waiter_id = 0;
-        }
-        if ((ready.is_writable() || ready.is_write_closed() || ready.is_error()) &&
-            fields->write_waker.is_some()) {
-            wakers.push(rstd::move(fields->write_waker).unwrap_unchecked());
-            fields->write_waiter_id = 0;
-        }
-        for (usize i = 0; i < fields->facility_waiters.len();) {
-            if (ready.for_interest(fields->facility_waiters[i].interest).is_empty()) {
-                ++i;
-                continue;
-            }
-            tokens.push(rstd::move(fields->facility_waiters.remove(i)).token);
-        }
-
-        if (fields->worker.is_some() && fields->key.is_some()) {
-            worker  = Some(fields->worker->clone());
-            command = Some(PollCommand::update_interest(
-                *fields->key, registration_interest(*fields), make_registration_owner(state)));
-        }
-    }
-
-    if (command.is_some()) {
-        (void)submit_registration_command(state, *worker, rstd::move(command).unwrap_unchecked());
-    }
-    wake_all(wakers);
-    while (! tokens.is_empty()) {
-        auto token = rstd::move(tokens.pop()).unwrap_unchecked();
-        (void)token.complete_poll(PollEventData::readiness(key, ready));
+    if ((ready.m_bits & READ_READY_BITS) != 0) state->read_waker.wake();
+    if ((ready.m_bits & WRITE_READY_BITS) != 0) state->write_waker.wake();
+    if (state->facility_count.load(Ordering::SeqCst) != 0) {
+        complete_facility_waiters(state, data.key(), ready);
     }
 }
 
@@ -363,83 +422,65 @@ auto make_timer_owner(const TimerArc& state) -> PollEventOwner {
 
 auto try_registration_readiness(const RegistrationArc& state, Interest interest)
     -> Option<io::Result<ReadyEvent>> {
-    auto fields = state->fields.lock().unwrap_unchecked();
-    auto ready  = fields->ready.for_interest(interest);
+    auto word  = state->readiness.load(Ordering::SeqCst);
+    auto ready = readiness_ready(word).for_interest(interest);
     if (! ready.is_empty()) {
-        return Some(io::Result<ReadyEvent>(Ok(ReadyEvent { ready, fields->tick })));
+        auto event = observe_readiness(state, interest, ReadyEvent { ready, readiness_tick(word) });
+        return Some(io::Result<ReadyEvent>(Ok(event)));
     }
-    if (fields->closed) {
-        auto error = fields->error.is_some()
-                         ? io::Error { *fields->error }
-                         : io::Error::from_kind(io::ErrorKind { io::ErrorKind::NotConnected });
-        return Some(io::Result<ReadyEvent>(Err(rstd::move(error))));
+    if ((word & READINESS_CLOSED) != 0) {
+        return Some(io::Result<ReadyEvent>(Err(registration_closed_error(state))));
     }
     return None();
 }
 
 auto registration_ready_event(const RegistrationArc& state, Interest interest, Ready ready)
     -> ReadyEvent {
-    auto fields = state->fields.lock().unwrap_unchecked();
-    return ReadyEvent { ready.for_interest(interest), fields->tick };
+    auto tick = readiness_tick(state->readiness.load(Ordering::Acquire));
+    return observe_readiness(state, interest, ReadyEvent { ready.for_interest(interest), tick });
 }
 
 auto submit_registration_readiness(const RegistrationArc&  state,
                                    FacilityCompletionToken token,
                                    Interest                interest,
                                    usize& waiter_id) -> FacilityCompletionSubmitResult {
-    auto identity        = token.token();
-    auto worker          = Option<WorkerHandle> {};
-    auto command         = Option<PollCommand> {};
-    bool register_source = false;
+    auto identity = token.token();
+    auto bound    = bind_registration(state);
+    if (bound.is_err() || ! *bound) {
+        return FacilityCompletionSubmitResult::rejected(rstd::move(token));
+    }
+
+    auto key    = PollKey {};
+    auto waiter = Option<ReadinessWaiterArc> {};
     {
         auto fields = state->fields.lock().unwrap_unchecked();
-        if (fields->closed) {
+        if ((state->readiness.load(Ordering::Relaxed) & READINESS_CLOSED) != 0) {
             return FacilityCompletionSubmitResult::rejected(rstd::move(token));
         }
         if (waiter_id == 0) {
-            waiter_id = fields->next_waiter_id++;
-        }
-        for (usize i = 0; i < fields->facility_waiters.len(); ++i) {
-            if (fields->facility_waiters[i].id == waiter_id) {
-                return FacilityCompletionSubmitResult::rejected(rstd::move(token));
-            }
-        }
-
-        if (fields->worker.is_some() && fields->key.is_some()) {
-            worker = Some(fields->worker->clone());
-        } else if (CURRENT_RUNTIME != nullptr && has_current_runtime_worker()) {
-            auto current = CURRENT_RUNTIME->current_poll_worker();
-            if (current.is_err()) {
-                return FacilityCompletionSubmitResult::rejected(rstd::move(token));
-            }
-            auto bound      = rstd::move(current).unwrap_unchecked();
-            auto key        = bound.allocate_poll_key(PollKeyKind::Registration);
-            fields->worker  = Some(bound.clone());
-            fields->key     = Some(key);
-            worker          = Some(rstd::move(bound));
-            register_source = true;
-        } else {
-            return FacilityCompletionSubmitResult::rejected(rstd::move(token));
-        }
-
-        fields->facility_waiters.push(
-            ReadinessFacilityWaiter { waiter_id, interest, rstd::move(token) });
-        if (fields->key.is_none()) {
-            rstd::panic { "async readiness facility bound without a Poll key" };
-        }
-        auto key = *fields->key;
-        if (register_source) {
-            command = Some(PollCommand::register_source(
-                key, state->fd, registration_interest(*fields), make_registration_owner(state)));
-        } else {
-            command = Some(PollCommand::update_interest(
-                key, registration_interest(*fields), make_registration_owner(state)));
-        }
-    }
-
-    (void)submit_registration_command(state, *worker, rstd::move(command).unwrap_unchecked());
+            waiter_id = state->next_waiter_id.fetch_add(1, Ordering::Relaxed);
+        }
+        auto parked = false;
+        fields->facility_waiters.for_each([&](ReadinessFacilityWaiter& other) {
+            parked = parked || other.id == waiter_id;
+        });
+        if (parked) return FacilityCompletionSubmitResult::rejected(rstd::move(token));
+
+        auto made = ReadinessWaiterArc::make(state.clone(), waiter_id, interest, rstd::move(token));
+        fields->facility_waiters.push_back(*made.as_ptr().as_raw_ptr());
+        // The list's reference; `unlink_facility_waiter` takes it back.
+        (void)made.clone().into_raw();
+        state->facility_count.fetch_add(1, Ordering::SeqCst);
+        key    = *fields->key;
+        waiter = Some(rstd::move(made));
+    }
+
+    // An event that landed before the waiter was parked saw no facility waiter; the readiness
+    // it left behind completes the waiter instead.
+    auto ready = readiness_ready(state->readiness.load(Ordering::SeqCst)).for_interest(interest);
+    if (! ready.is_empty()) complete_facility_waiters(state, key, ready);
     return FacilityCompletionSubmitResult::accepted(
-        make_readiness_cancellation(state, waiter_id, identity));
+        make_readiness_cancellation(rstd::move(waiter).unwrap_unchecked(), identity));
 }
 
 auto poll_registration_readiness(const RegistrationArc& state,
@@ -454,83 +495,49 @@ auto poll_registration_readiness(const RegistrationArc& state,
         return task::Poll<io::Result<ReadyEvent>>::Ready(Ok(ReadyEvent {}));
     }
 
-    auto worker  = Option<WorkerHandle> {};
-    auto command = Option<PollCommand> {};
-    {
-        auto fields = state->fields.lock().unwrap_unchecked();
-        auto ready  = fields->ready.for_interest(interest);
-        if (! ready.is_empty()) {
-            return task::Poll<io::Result<ReadyEvent>>::Ready(
-                Ok(ReadyEvent { ready, fields->tick }));
-        }
-        if (fields->closed) {
-            auto error = fields->error.is_some()
-                             ? io::Error { *fields->error }
-                             : io::Error::from_kind(io::ErrorKind { io::ErrorKind::NotConnected });
-            return task::Poll<io::Result<ReadyEvent>>::Ready(Err(rstd::move(error)));
-        }
-
-        if (waiter_id == 0) waiter_id = fields->next_waiter_id++;
-        if (interest.is_readable()) {
-            fields->read_waker     = Some(cx.waker().clone());
-            fields->read_waiter_id = waiter_id;
-        }
-        if (interest.is_writable()) {
-            fields->write_waker     = Some(cx.waker().clone());
-            fields->write_waiter_id = waiter_id;
-        }
+    auto immediate = try_registration_readiness(state, interest);
+    if (immediate.is_some()) {
+        return task::Poll<io::Result<ReadyEvent>>::Ready(rstd::move(immediate).unwrap_unchecked());
+    }
 
-        if (fields->worker.is_some() && fields->key.is_some()) {
-            worker  = Some(fields->worker->clone());
-            command = Some(PollCommand::update_interest(
-                *fields->key, registration_interest(*fields), make_registration_owner(state)));
-        } else if (CURRENT_RUNTIME != nullptr && has_current_runtime_worker()) {
-            auto current = CURRENT_RUNTIME->current_poll_worker();
-            if (current.is_err()) {
-                return task::Poll<io::Result<ReadyEvent>>::Ready(
-                    Err(rstd::move(current).unwrap_err_unchecked()));
-            }
-            auto bound     = rstd::move(current).unwrap_unchecked();
-            auto key       = bound.allocate_poll_key(PollKeyKind::Registration);
-            fields->worker = Some(bound.clone());
-            fields->key    = Some(key);
-            worker         = Some(rstd::move(bound));
-            command        = Some(PollCommand::register_source(
-                key, state->fd, registration_interest(*fields), make_registration_owner(state)));
-        }
+    if (waiter_id == 0) waiter_id = state->next_waiter_id.fetch_add(1, Ordering::Relaxed);
+    if (interest.is_readable()) {
+        state->read_waiter_id.store(waiter_id, Ordering::Relaxed);
+        state->read_waker.register_context(cx);
+    }
+    if (interest.is_writable()) {
+        state->write_waiter_id.store(waiter_id, Ordering::Relaxed);
+        state->write_waker.register_context(cx);
     }
 
-    if (command.is_some() &&
-        ! submit_registration_command(state, *worker, rstd::move(command).unwrap_unchecked())) {
+    auto bound = bind_registration(state);
+    if (bound.is_err()) {
         return task::Poll<io::Result<ReadyEvent>>::Ready(
-            Err(io::Error::from_kind(io::ErrorKind { io::ErrorKind::NotConnected })));
+            Err(rstd::move(bound).unwrap_err_unchecked()));
+    }
+
+    // An event may have landed between the first check and the waker registration.
+    auto raced = try_registration_readiness(state, interest);
+    if (raced.is_some()) {
+        return task::Poll<io::Result<ReadyEvent>>::Ready(rstd::move(raced).unwrap_unchecked());
     }
     return task::Poll<io::Result<ReadyEvent>>::Pending();
 }
 
+void clear_waker_slot(Atomic<usize>& slot_id, AtomicWaker& waker, usize waiter_id) {
+    auto expected = waiter_id;
+    if (slot_id.compare_exchange_strong(expected, 0, Ordering::AcqRel, Ordering::Relaxed)) {
+        (void)waker.take();
+    }
+}
+
 void clear_registration_waker(const RegistrationArc& state, Interest interest, usize waiter_id) {
     if (! state || waiter_id == 0) return;
-
-    auto worker  = Option<WorkerHandle> {};
-    auto command = Option<PollCommand> {};
-    {
-        auto fields = state->fields.lock().unwrap_unchecked();
-        if (interest.is_readable() && fields->read_waiter_id == waiter_id) {
-            fields->read_waker     = None();
-            fields->read_waiter_id = 0;
-        }
-        if (interest.is_writable() && fields->write_waiter_id == waiter_id) {
-            fields->write_waker     = None();
-            fields->write_waiter_id = 0;
-        }
-        if (! fields->closed && fields->worker.is_some() && fields->key.is_some()) {
-            worker  = Some(fields->worker->clone());
-            command = Some(PollCommand::update_interest(
-                *fields->key, registration_interest(*fields), make_registration_owner(state)));
-        }
+    if (interest.is_readable()) {
+        clear_waker_slot(state->read_waiter_id, state->read_waker, waiter_id);
     }
-    if (command.is_some()) {
-        (void)submit_registration_command(state, *worker, rstd::move(command).unwrap_unchecked());
+    if (interest.is_writable()) {
+        clear_waker_slot(state->write_waiter_id, state->write_waker, waiter_id);
     }
 }
 
@@ -567,41 +574,31 @@ public:
     void reset() {
         if (! m_state) return;
 
-        auto wakers  = Vec<task::Waker>::make();
-        auto tokens  = Vec<FacilityCompletionToken>::make();
+        bool closed  = false;
         auto worker  = Option<WorkerHandle> {};
         auto command = Option<PollCommand> {};
         {
-            auto fields = m_state->fields.lock().unwrap_unchecked();
-            if (! fields->closed) {
-                fields->closed = true;
-                if (fields->read_waker.is_some()) {
-                    wakers.push(rstd::move(fields->read_waker).unwrap_unchecked());
-                }
-                if (fields->write_waker.is_some()) {
-                    wakers.push(rstd::move(fields->write_waker).unwrap_unchecked());
-                }
-                fields->read_waiter_id  = 0;
-                fields->write_waiter_id = 0;
-                while (! fields->facility_waiters.is_empty()) {
-                    tokens.push(
-                        rstd::move(fields->facility_waiters.pop()).unwrap_unchecked().token);
-                }
-                if (fields->worker.is_some() && fields->key.is_some()) {
-                    worker  = Some(fields->worker->clone());
-                    command = Some(PollCommand::deregister_source(
-                        *fields->key, make_registration_owner(m_state)));
-                }
+            auto fields   = m_state->fields.lock().unwrap_unchecked();
+            auto previous = m_state->readiness.fetch_or(READINESS_CLOSED, Ordering::SeqCst);
+            closed        = (previous & READINESS_CLOSED) == 0;
+            if (closed && fields->worker.is_some() && fields->key.is_some()) {
+                worker  = Some(fields->worker->clone());
+                command = Some(
+                    PollCommand::deregister_source(*fields->key, make_registration_owner(m_state)));
             }
         }
 
         if (command.is_some()) {
             (void)worker->submit_poll(rstd::move(command).unwrap_unchecked());
         }
-        wake_all(wakers);
-        while (! tokens.is_empty()) {
-            auto token = rstd::move(tokens.pop()).unwrap_unchecked();
-            (void)token.complete(FacilityEventKind::Canceled);
+        if (closed) {
+            m_state->read_waker.wake();
+            m_state->write_waker.wake();
+            while (true) {
+                auto token = take_facility_waiter(m_state, None());
+                if (token.is_none()) break;
+                (void)rstd::move(token).unwrap_unchecked().complete(FacilityEventKind::Canceled);
+            }
         }
         m_state.reset();
     }
@@ -611,18 +608,22 @@ public:
         return poll_registration_readiness(m_state, cx, interest, waiter_id);
     }
 
+    /// Clears `ready` as of the readiness last handed out for each of its directions; bits an
+    /// event set since then stay, since with edge-triggered polling no later event would
+    /// restore them.
     void clear_readiness(Ready ready) {
         if (! m_state) return;
-        auto fields = m_state->fields.lock().unwrap_unchecked();
-        fields->ready.remove(ready);
+        clear_registration_readiness(m_state,
+                                     u8(ready.m_bits & READ_READY_BITS),
+                                     m_state->read_tick.load(Ordering::Relaxed));
+        clear_registration_readiness(m_state,
+                                     u8(ready.m_bits & WRITE_READY_BITS),
+                                     m_state->write_tick.load(Ordering::Relaxed));
     }
 
     void clear_readiness(ReadyEvent event) {
         if (! m_state) return;
-        auto fields = m_state->fields.lock().unwrap_unchecked();
-        if (fields->tick == event.tick()) {
-            fields->ready.remove(event.ready());
-        }
+        clear_registration_readiness(m_state, event.ready().m_bits, event.tick());
     }
 
     void clear_waker(Interest interest, usize waiter_id) {
@@ -1,6 +1,7 @@
 export module rstd:async.runtime;
 export import :async.awaitable;
 export import :async.runtime_core;
+import :async.metrics;
 import :async.runtime_driver;
 import :async.spawn;
 import :async.task;
@@ -43,6 +44,17 @@ public:
         auto driver = make_runtime_driver(into_coro(rstd::move(awaitable)));
         return ::spawn_driver_on(*inner.as_ptr().as_raw_ptr(), rstd::move(driver));
     }
+
+    /// Spawns `awaitable` bound to worker `shard`; see `Runtime::spawn_on`.
+    template<AwaitableInput A>
+    auto spawn_on(usize shard, A awaitable) const -> JoinHandle<await_output_t<A>> {
+        auto inner = m_inner.upgrade();
+        if (! inner) {
+            rstd::panic { "RuntimeHandle::spawn_on called after runtime shutdown" };
+        }
+        auto driver = make_runtime_driver(into_coro(rstd::move(awaitable)));
+        return ::spawn_driver_on(*inner.as_ptr().as_raw_ptr(), rstd::move(driver), Some(shard));
+    }
 };
 
 export class Runtime {
@@ -61,7 +73,13 @@ export class Runtime {
 
     static auto make_thread_pool(usize                 worker_threads,
                                  Option<String> const& thread_name,
+                                 bool                  pin_workers,
                                  RuntimeConfig         config) -> io::Result<Runtime> {
+        auto cpus = pin_workers ? thread::available_cpus() : Vec<usize>::make();
+        if (pin_workers && cpus.is_empty()) {
+            return Err(io::error::Error::from_kind(
+                io::error::ErrorKind { io::error::ErrorKind::Unsupported }));
+        }
         auto runtime = Runtime { RuntimeKind::ThreadPool, config, worker_threads };
 
         for (usize i = 0; i < worker_threads; ++i) {
@@ -70,9 +88,12 @@ export class Runtime {
             if (thread_name.is_some()) {
                 builder.name(rstd::as<rstd::clone::Clone>(*thread_name).clone());
             }
+            if (pin_workers) {
+                builder.affinity(cpus[i % cpus.len()]);
+            }
 
-            auto worker = builder.spawn([inner = rstd::move(inner), i] {
-                inner->worker_loop(RuntimeWorkerId { i });
+            auto worker = builder.spawn([inner = rstd::move(inner), i]() mutable {
+                RuntimeInner::worker_loop(rstd::move(inner), RuntimeWorkerId { i });
             });
 
             if (worker.is_err()) {
@@ -130,12 +151,26 @@ public:
 
     auto time_enabled() const -> bool { return m_inner->time_enabled(); }
 
+    /// Number of workers, which `spawn_on` indexes; 1 for a current-thread runtime.
+    auto shard_count() const -> usize { return m_inner->shard_count(); }
+
+    /// A snapshot of the scheduler counters; see `RuntimeBuilder::enable_metrics`.
+    auto metrics() const -> RuntimeMetrics { return m_inner->metrics(); }
+
     template<AwaitableInput A>
     auto spawn(A awaitable) -> JoinHandle<await_output_t<A>> {
         auto driver = make_runtime_driver(into_coro(rstd::move(awaitable)));
         return ::spawn_driver_on(*m_inner.as_ptr().as_raw_ptr(), rstd::move(driver));
     }
 
+    /// Spawns `awaitable` bound to worker `shard` for its whole life, so it runs on that
+    /// worker's thread, poller and timers. Panics if `shard` is not below `shard_count`.
+    template<AwaitableInput A>
+    auto spawn_on(usize shard, A awaitable) -> JoinHandle<await_output_t<A>> {
+        auto driver = make_runtime_driver(into_coro(rstd::move(awaitable)));
+        return ::spawn_driver_on(*m_inner.as_ptr().as_raw_ptr(), rstd::move(driver), Some(shard));
+    }
+
     template<AwaitableInput A>
     auto spawn_local(A awaitable) -> JoinHandle<await_output_t<A>> {
         if (m_inner->is_thread_pool()) {
@@ -218,12 +253,14 @@ export class RuntimeBuilder {
     RuntimeKind    m_kind;
     usize          m_worker_threads;
     Option<String> m_thread_name;
+    bool           m_pin_workers;
     RuntimeConfig  m_config;
 
     RuntimeBuilder(RuntimeKind kind, usize worker_threads)
         : m_kind(kind),
           m_worker_threads(worker_threads),
           m_thread_name(None()),
+          m_pin_workers(false),
           m_config(RuntimeConfig {}) {}
 
 public:
@@ -235,6 +272,16 @@ public:
         return RuntimeBuilder { RuntimeKind::ThreadPool, 1 };
     }
 
+    /// A shard-per-core thread pool: one worker per CPU the process may run on, each pinned to
+    /// its CPU. Every worker already owns its poller, timers, ready queue and frame free lists;
+    /// pinning keeps them in that CPU's caches and, allocated by the worker itself, on its
+    /// NUMA node. Spawns from a worker stay on it, and `spawn_on` hands work to another shard.
+    static auto thread_per_core() -> RuntimeBuilder {
+        auto builder = RuntimeBuilder { RuntimeKind::ThreadPool, thread::available_cpus().len() };
+        builder.m_pin_workers = true;
+        return builder;
+    }
+
     auto worker_threads(usize n) -> RuntimeBuilder& {
         m_worker_threads = n;
         return *this;
@@ -245,6 +292,13 @@ public:
         return *this;
     }
 
+    /// Pins worker `i` to the `i`-th CPU of `thread::available_cpus`, wrapping around when
+    /// there are more workers than CPUs.
+    auto pin_workers() -> RuntimeBuilder& {
+        m_pin_workers = true;
+        return *this;
+    }
+
     auto enable_io() -> RuntimeBuilder& {
         m_config.enable_io = true;
         return *this;
@@ -255,6 +309,50 @@ public:
         return *this;
     }
 
+    /// Sets where tasks spawned from a worker go; `SpawnPlacement::Local` by default.
+    auto spawn_placement(SpawnPlacement placement) -> RuntimeBuilder& {
+        m_config.spawn_placement = placement;
+        return *this;
+    }
+
+    /// Stops a task woken by the running task from being polled next on the same worker, so
+    /// every wake queues in FIFO order.
+    auto disable_lifo_slot() -> RuntimeBuilder& {
+        m_config.lifo_slot = false;
+        return *this;
+    }
+
+    /// Lets a worker that runs out of tasks spin for up to `max` before parking in its poller,
+    /// busy-polling its I/O sources meanwhile. Work that arrives during the spin needs no
+    /// wake-up syscall, and placement hands new tasks to spinning workers first. Each worker
+    /// sizes its spin from its recent idle periods and stops spinning while they mostly outlast
+    /// `max`. Off by default.
+    auto spin_before_park(time::Duration max) -> RuntimeBuilder& {
+        m_config.max_spin = max;
+        return *this;
+    }
+
+    /// Keeps per-worker scheduler counters for `Runtime::metrics`. When off, the scheduler
+    /// skips every counter update.
+    auto enable_metrics() -> RuntimeBuilder& {
+        m_config.enable_metrics = true;
+        return *this;
+    }
+
+    /// Also records a histogram of task poll durations, at the cost of two clock reads per
+    /// poll; implies `enable_metrics`.
+    auto enable_poll_time_histogram() -> RuntimeBuilder& {
+        m_config.enable_metrics      = true;
+        m_config.poll_time_histogram = true;
+        return *this;
+    }
+
+    /// Installs tracing callbacks; see `RuntimeHooks`.
+    auto hooks(RuntimeHooks hooks) -> RuntimeBuilder& {
+        m_config.hooks = hooks;
+        return *this;
+    }
+
     auto enable_all() -> RuntimeBuilder& {
         enable_io();
         enable_time();
@@ -271,7 +369,7 @@ public:
                 io::error::ErrorKind { io::error::ErrorKind::InvalidInput }));
         }
 
-        return Runtime::make_thread_pool(m_worker_threads, m_thread_name, m_config);
+        return Runtime::make_thread_pool(m_worker_threads, m_thread_name, m_pin_workers, m_config);
     }
 };
 
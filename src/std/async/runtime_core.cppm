@@ -2,6 +2,7 @@ export module rstd:async.runtime_core;
 import :async.awaitable;
 import :async.facility;
 import :async.forward;
+import :async.metrics;
 import :async.poll;
 import rstd.alloc;
 import :sync;
@@ -9,6 +10,9 @@ import :thread;
 
 using namespace rstd;
 
+using ::alloc::collections::SlotKey;
+using ::alloc::collections::SlotMap;
+using ::alloc::collections::VecDeque;
 using ::alloc::vec::Vec;
 using AsyncPoll = rstd::async::Poll;
 using rstd::async::PollApplyStatus;
@@ -26,6 +30,7 @@ using rstd::async::PollWake;
 struct RuntimeInner;
 struct TaskStateBase;
 class TaskRefControl;
+class RuntimeWorker;
 
 class TaskAccess {
     TaskRefControl* m_control { nullptr };
@@ -64,6 +69,8 @@ private:
     TaskStateBase*                    m_task { nullptr };
     voidp                             m_storage_owner { nullptr };
     DestroyFn                         m_destroy_storage { nullptr };
+    SlotKey                           m_registry_key {};
+    usize                             m_registry_shard { 0 };
 
     static void destroy_scoped_control(voidp owner) { delete static_cast<TaskRefControl*>(owner); }
 
@@ -119,6 +126,12 @@ public:
         return None();
     }
 
+    // Registry shard and slot of the task; only touched under that shard's lock.
+    auto registry_key() const noexcept -> SlotKey { return m_registry_key; }
+    auto registry_shard() const noexcept -> usize { return m_registry_shard; }
+    void set_registry_key(SlotKey key) noexcept { m_registry_key = key; }
+    void set_registry_shard(usize shard) noexcept { m_registry_shard = shard; }
+
     void release_access() noexcept {
         m_access_state.fetch_sub(ACCESS, rstd::sync::atomic::Ordering::Release);
     }
@@ -171,8 +184,13 @@ struct TaskControl {
 };
 
 inline thread_local RuntimeInner*   CURRENT_RUNTIME { nullptr };
+// The reference a pool worker holds on its runtime for as long as it runs; see `RuntimeRef`.
+inline thread_local const sync::LocalArc<RuntimeInner>* CURRENT_RUNTIME_ARC { nullptr };
 inline thread_local RuntimeWorkerId CURRENT_RUNTIME_WORKER {};
 inline thread_local bool            CURRENT_RUNTIME_WORKER_ACTIVE { false };
+// The worker whose task is being polled on this thread, if any; wakes it issues may skip the
+// inbox. See `TaskStateBase::apply`.
+inline thread_local RuntimeWorker* CURRENT_POLLING_WORKER { nullptr };
 
 inline thread_local async::ExecutionDomainKind CURRENT_EXECUTION_DOMAIN {
     async::ExecutionDomainKind::RuntimeWorker
@@ -222,8 +240,14 @@ enum class WorkerAttachResult
 };
 
 struct RuntimeConfig {
-    bool enable_io { false };
-    bool enable_time { false };
+    bool                        enable_io { false };
+    bool                        enable_time { false };
+    rstd::async::SpawnPlacement spawn_placement { rstd::async::SpawnPlacement::Local };
+    bool                        lifo_slot { true };
+    time::Duration              max_spin {};
+    bool                        enable_metrics { false };
+    bool                        poll_time_histogram { false };
+    rstd::async::RuntimeHooks   hooks {};
 
     static constexpr auto all() noexcept -> RuntimeConfig { return RuntimeConfig { true, true }; }
 };
@@ -276,6 +300,8 @@ public:
     auto owner() const noexcept -> RuntimeWorkerId { return m_owner; }
     auto generation() const noexcept -> u64 { return m_generation; }
     auto access_task() const -> Option<TaskAccess> { return m_task.access(); }
+    // The id hooks see: unique while the task is alive.
+    auto task_id() const noexcept -> usize { return reinterpret_cast<usize>(m_task.identity()); }
     auto take_task() -> TaskRef { return rstd::move(m_task); }
 };
 
@@ -799,23 +825,40 @@ public:
     auto completion_id() const noexcept -> FacilityId { return m_completion_id; }
 };
 
+// Tickets a worker has taken in, plus a one-ticket LIFO slot for the task most recently woken
+// by the task being polled. Message passing then runs the receiver next, while what it was sent
+// is still in cache, instead of behind everything already queued.
 struct ReadyQueue {
-    Vec<ScheduleTicket> m_tickets;
+    VecDeque<ScheduleTicket> m_tickets;
+    Option<ScheduleTicket>   m_lifo;
 
-    ReadyQueue(): m_tickets(Vec<ScheduleTicket>::make()) {}
+    ReadyQueue(): m_tickets(VecDeque<ScheduleTicket>::make()), m_lifo(None()) {}
 
-    auto is_empty() const -> bool { return m_tickets.is_empty(); }
+    auto is_empty() const -> bool { return m_lifo.is_none() && m_tickets.is_empty(); }
 
-    void push(ScheduleTicket ticket) { m_tickets.push(rstd::move(ticket)); }
+    void push(ScheduleTicket ticket) { m_tickets.push_back(rstd::move(ticket)); }
 
-    auto pop_front() -> Option<ScheduleTicket> {
-        if (m_tickets.is_empty()) {
-            return None();
-        }
-        return Some(m_tickets.remove(0));
+    // A ticket already in the slot keeps its turn at the back of the queue.
+    void push_lifo(ScheduleTicket ticket) {
+        auto displaced = m_lifo.take();
+        if (displaced.is_some()) push(rstd::move(displaced).unwrap_unchecked());
+        m_lifo = Some(rstd::move(ticket));
+    }
+
+    auto pop_lifo() -> Option<ScheduleTicket> { return m_lifo.take(); }
+
+    // Moves the LIFO ticket behind the queue, so it waits its turn like any other.
+    void demote_lifo() {
+        auto ticket = m_lifo.take();
+        if (ticket.is_some()) push(rstd::move(ticket).unwrap_unchecked());
     }
 
-    void clear() { m_tickets.clear(); }
+    auto pop_front() -> Option<ScheduleTicket> { return m_tickets.pop_front(); }
+
+    void clear() {
+        m_lifo = None();
+        m_tickets.clear();
+    }
 };
 
 enum class WorkerCommandKind
@@ -893,48 +936,51 @@ public:
 };
 
 struct WorkerInbox {
-    Vec<WorkerCommand> m_commands;
+    VecDeque<WorkerCommand> m_commands;
 
-    WorkerInbox(): m_commands(Vec<WorkerCommand>::make()) {}
+    WorkerInbox(): m_commands(VecDeque<WorkerCommand>::make()) {}
 
     auto is_empty() const -> bool { return m_commands.is_empty(); }
 
-    void push(WorkerCommand command) { m_commands.push(rstd::move(command)); }
+    void push(WorkerCommand command) { m_commands.push_back(rstd::move(command)); }
 
-    auto pop_front() -> Option<WorkerCommand> {
-        if (m_commands.is_empty()) {
-            return None();
-        }
-        return Some(m_commands.remove(0));
-    }
+    auto pop_front() -> Option<WorkerCommand> { return m_commands.pop_front(); }
 
     void clear() { m_commands.clear(); }
 };
 
+// Live tasks placed on one worker; a runtime keeps one registry per worker. Each task
+// remembers its shard and slot, so retiring one is O(1) however many are registered; the
+// generation in the key keeps a stale slot from retiring a newer task.
 struct TaskRegistry {
-    Vec<TaskRef> m_tasks;
+    SlotMap<TaskRef> m_tasks;
 
-    TaskRegistry(): m_tasks(Vec<TaskRef>::make()) {}
+    TaskRegistry(): m_tasks(SlotMap<TaskRef>::make()) {}
 
-    void insert(TaskRef task) { m_tasks.push(rstd::move(task)); }
+    void insert(TaskRef task, usize shard) {
+        auto* control = task.identity();
+        control->set_registry_shard(shard);
+        control->set_registry_key(m_tasks.insert(rstd::move(task)));
+    }
 
     auto is_empty() const -> bool { return m_tasks.is_empty(); }
 
     auto clone_all() const -> Vec<TaskRef> {
-        auto tasks = Vec<TaskRef>::make();
-        for (usize i = 0; i < m_tasks.len(); ++i) {
-            tasks.push(m_tasks[i].clone());
+        auto tasks = Vec<TaskRef>::with_capacity(m_tasks.len());
+        auto it    = m_tasks.iter();
+        for (auto entry = it.next(); entry.is_some(); entry = it.next()) {
+            tasks.push(entry->template get<1>()->clone());
         }
         return tasks;
     }
 
-    void remove(TaskRefControl* task) {
-        for (usize i = 0; i < m_tasks.len(); ++i) {
-            if (m_tasks[i].identity() == task) {
-                m_tasks.remove(i);
-                return;
-            }
-        }
+    auto remove(TaskRefControl* task) -> bool {
+        auto key        = task->registry_key();
+        auto registered = m_tasks.get(key);
+        if (registered.is_none() || (*registered)->identity() != task) return false;
+        task->set_registry_key(SlotKey::null());
+        (void)m_tasks.remove(key);
+        return true;
     }
 };
 
@@ -953,8 +999,21 @@ struct WorkerFields {
 
 struct WorkerState {
     sync::Mutex<WorkerFields> m_fields;
-
-    WorkerState(): m_fields(WorkerFields {}) {}
+    // Tasks placed on this worker, under their own lock so spawns and retirements do not
+    // contend with inbox traffic or with other workers.
+    sync::Mutex<TaskRegistry> m_tasks;
+    // Tickets scheduled here and not yet taken to run, and whether the worker is parked in
+    // its poller. Placement reads both without locking, so they are hints, not invariants.
+    rstd::sync::atomic::Atomic<usize> m_queued { 0 };
+    rstd::sync::atomic::Atomic<bool>  m_parked { false };
+    // Whether the worker is spinning before it parks, and whether work arrived meanwhile.
+    // `m_spinning` only changes under the fields lock, which is what makes skipping the
+    // poller wake safe; placement also reads it as a hint.
+    rstd::sync::atomic::Atomic<bool> m_spinning { false };
+    rstd::sync::atomic::Atomic<bool> m_signaled { false };
+    WorkerCounters                   m_counters;
+
+    WorkerState(): m_fields(WorkerFields {}), m_tasks(TaskRegistry {}) {}
 };
 
 class WorkerHandle {
@@ -964,8 +1023,16 @@ class WorkerHandle {
     WorkerHandle(RuntimeWorkerId id, sync::Arc<WorkerState> state)
         : m_id(id), m_state(rstd::move(state)) {}
 
-    static void notify_locked(WorkerFields& fields) {
-        if (fields.m_poll_wake.is_some()) {
+    // Handles share the state through an `Arc`, which only gives const access; the load
+    // hints and counters are atomics meant to be updated through any handle.
+    auto shared() const noexcept -> WorkerState& { return *m_state.as_ptr().as_raw_ptr(); }
+
+    // A spinning worker watches `m_signaled` rather than its poller, so waking it costs no
+    // eventfd write.
+    void notify_locked(WorkerFields& fields) const {
+        if (m_state->m_spinning.load(rstd::sync::atomic::Ordering::Relaxed)) {
+            shared().m_signaled.store(true, rstd::sync::atomic::Ordering::Release);
+        } else if (fields.m_poll_wake.is_some()) {
             (void)fields.m_poll_wake->wake();
         } else {
             fields.m_pending_wake = true;
@@ -986,6 +1053,93 @@ public:
 
     auto id() const noexcept -> RuntimeWorkerId { return m_id; }
 
+    auto queued() const noexcept -> usize {
+        return m_state->m_queued.load(rstd::sync::atomic::Ordering::Relaxed);
+    }
+
+    auto is_parked() const noexcept -> bool {
+        return m_state->m_parked.load(rstd::sync::atomic::Ordering::Relaxed);
+    }
+
+    // Sequentially consistent, pairing with `RuntimeShared::try_wake_parked`: a worker that
+    // clears `m_parked` and then releases the searching slot, and placement that claims the
+    // slot and then re-reads `m_parked`, cannot both miss the other's store.
+    void set_parked(bool parked) const {
+        shared().m_parked.store(parked, rstd::sync::atomic::Ordering::SeqCst);
+    }
+
+    auto is_spinning() const noexcept -> bool {
+        return m_state->m_spinning.load(rstd::sync::atomic::Ordering::Relaxed);
+    }
+
+    // Starts routing wakes through `m_signaled`. Returns `true` when the inbox already holds
+    // work, whose wake went to the poller and would be missed by the spin.
+    auto begin_spin() const -> bool {
+        auto fields = m_state->m_fields.lock().unwrap_unchecked();
+        shared().m_signaled.store(false, rstd::sync::atomic::Ordering::Relaxed);
+        shared().m_spinning.store(true, rstd::sync::atomic::Ordering::Relaxed);
+        return ! fields->m_inbox.is_empty();
+    }
+
+    auto spin_signaled() const noexcept -> bool {
+        return m_state->m_signaled.load(rstd::sync::atomic::Ordering::Acquire);
+    }
+
+    // Sends wakes back to the poller. Returns whether one came in during the spin; if not,
+    // any later one writes the poller's eventfd, so the worker may park.
+    auto end_spin() const -> bool {
+        auto fields = m_state->m_fields.lock().unwrap_unchecked();
+        shared().m_spinning.store(false, rstd::sync::atomic::Ordering::Relaxed);
+        return shared().m_signaled.exchange(false, rstd::sync::atomic::Ordering::Acquire);
+    }
+
+    auto is_parked_seq_cst() const noexcept -> bool {
+        return m_state->m_parked.load(rstd::sync::atomic::Ordering::SeqCst);
+    }
+
+    void note_queued() const {
+        shared().m_queued.fetch_add(1, rstd::sync::atomic::Ordering::Relaxed);
+    }
+
+    void note_dequeued() const {
+        shared().m_queued.fetch_sub(1, rstd::sync::atomic::Ordering::Relaxed);
+    }
+
+    auto counters() const noexcept -> WorkerCounters& { return shared().m_counters; }
+
+    auto metrics() const -> async::WorkerMetrics {
+        auto metrics = async::WorkerMetrics {};
+        m_state->m_counters.snapshot_into(metrics);
+        metrics.queue_depth = queued();
+        metrics.parked      = is_parked();
+        return metrics;
+    }
+
+    // Registers `task` in this worker's shard unless the runtime stopped accepting tasks. The
+    // flag is read under the shard lock and shutdown clears it before collecting each shard,
+    // so every task is either collected for abort or refused here. `live` is counted before
+    // the task becomes visible, so an abort racing the spawn cannot retire it first.
+    auto register_task(TaskRef                                 task,
+                       const rstd::sync::atomic::Atomic<bool>& accepting,
+                       rstd::sync::atomic::Atomic<usize>&      live) const -> bool {
+        auto tasks = m_state->m_tasks.lock().unwrap_unchecked();
+        if (! accepting.load(rstd::sync::atomic::Ordering::Acquire)) return false;
+        live.fetch_add(1, rstd::sync::atomic::Ordering::SeqCst);
+        tasks->insert(rstd::move(task), m_id.as_usize());
+        return true;
+    }
+
+    auto retire_task(TaskRefControl* task) const -> bool {
+        auto tasks = m_state->m_tasks.lock().unwrap_unchecked();
+        return tasks->remove(task);
+    }
+
+    void clone_tasks_into(Vec<TaskRef>& out) const {
+        auto tasks = m_state->m_tasks.lock().unwrap_unchecked();
+        auto all   = tasks->clone_all();
+        out.append(all);
+    }
+
     auto attach(thread::ThreadId id) const -> WorkerAttachResult {
         auto fields = m_state->m_fields.lock().unwrap_unchecked();
         if (fields->m_lifecycle != WorkerLifecycle::Running) {
@@ -1041,6 +1195,7 @@ public:
             return Err(rstd::move(ticket));
         }
         fields->m_inbox.push(WorkerCommand::schedule(rstd::move(ticket)));
+        note_queued();
         notify_locked(*fields);
         return Ok(empty {});
     }
@@ -1184,15 +1339,24 @@ public:
 };
 
 struct RuntimeSharedState {
-    TaskRegistry      m_registry;
     RuntimeLifecycle  m_lifecycle { RuntimeLifecycle::Building };
-    usize             m_next_worker { 0 };
     usize             m_running_workers { 0 };
     Option<io::Error> m_worker_start_error {};
 };
 
 class RuntimeShared {
     Vec<WorkerHandle> m_workers;
+    // Spawning touches none of the state below the mutex: placement reads per-worker atomics,
+    // tasks register in the chosen worker's shard, and `m_accepting` mirrors whether the
+    // lifecycle is `Running`.
+    rstd::sync::atomic::Atomic<usize> m_next_worker { 0 };
+    rstd::sync::atomic::Atomic<usize> m_live_tasks { 0 };
+    rstd::sync::atomic::Atomic<bool>  m_accepting { false };
+    rstd::sync::atomic::Atomic<u64>   m_spawned_tasks { 0 };
+    // The parked worker placement last woke, plus one, until it resumes; 0 when none is on
+    // its way up. While one is, placement leaves the other parked workers alone, so a burst
+    // of spawns wakes one idle worker rather than every parked worker it samples.
+    rstd::sync::atomic::Atomic<usize> m_searching { 0 };
 
     auto normalize(RuntimeWorkerId worker) const -> usize {
         return worker.as_usize() % m_workers.len();
@@ -1215,6 +1379,7 @@ public:
             auto shared               = state.lock().unwrap_unchecked();
             shared->m_lifecycle       = RuntimeLifecycle::Running;
             shared->m_running_workers = 1;
+            set_accepting(true);
             m_workers[0].start_current();
         }
     }
@@ -1227,10 +1392,98 @@ public:
 
     auto worker_handle(RuntimeWorkerId id) const -> WorkerHandle { return worker(id).clone(); }
 
-    auto next_worker_locked(RuntimeSharedState& shared) const -> RuntimeWorkerId {
-        auto worker          = RuntimeWorkerId { shared.m_next_worker % m_workers.len() };
-        shared.m_next_worker = (shared.m_next_worker + 1) % m_workers.len();
-        return worker;
+    // Claims the searching slot for parked `worker`, if no other woken worker holds it.
+    auto try_wake_parked(usize worker) -> bool {
+        if (! m_workers[worker].is_parked()) return false;
+        usize idle = 0;
+        if (! m_searching.compare_exchange_strong(idle,
+                                                  worker + 1,
+                                                  rstd::sync::atomic::Ordering::SeqCst,
+                                                  rstd::sync::atomic::Ordering::Relaxed)) {
+            return false;
+        }
+        if (m_workers[worker].is_parked_seq_cst()) return true;
+        // The worker left its park between the two reads and may already have passed
+        // `finish_search`; give the slot back.
+        release_search(worker);
+        return false;
+    }
+
+    void release_search(usize worker) {
+        usize claimed = worker + 1;
+        (void)m_searching.compare_exchange_strong(claimed,
+                                                  0,
+                                                  rstd::sync::atomic::Ordering::SeqCst,
+                                                  rstd::sync::atomic::Ordering::Relaxed);
+    }
+
+    // Picks two workers from a round-robin ticket. A spinning one takes the task without a
+    // wake-up syscall; failing that, a parked one if no other parked worker is being woken.
+    // While one is, a task for two parked workers goes to that one too; otherwise the running
+    // worker is preferred, then the one with fewer queued tickets. Two samples avoid the worst
+    // of blind round-robin without every spawn scanning, and contending on, all workers.
+    auto next_worker() -> RuntimeWorkerId {
+        auto  ticket = m_next_worker.fetch_add(1, rstd::sync::atomic::Ordering::Relaxed);
+        usize count  = m_workers.len();
+        usize first  = ticket % count;
+        if (count == 1) return RuntimeWorkerId { first };
+
+        // Vary the partner from round to round so the pairs do not repeat.
+        usize second = (first + 1 + (ticket / count) % (count - 1)) % count;
+        if (m_workers[first].is_spinning()) return RuntimeWorkerId { first };
+        if (m_workers[second].is_spinning()) return RuntimeWorkerId { second };
+        if (try_wake_parked(first)) return RuntimeWorkerId { first };
+        if (try_wake_parked(second)) return RuntimeWorkerId { second };
+
+        bool first_parked  = m_workers[first].is_parked();
+        bool second_parked = m_workers[second].is_parked();
+        if (first_parked && second_parked) {
+            usize searching = m_searching.load(rstd::sync::atomic::Ordering::Relaxed);
+            if (searching != 0) return RuntimeWorkerId { searching - 1 };
+        }
+        if (first_parked != second_parked) return RuntimeWorkerId { first_parked ? second : first };
+        bool prefer_second = m_workers[second].queued() < m_workers[first].queued();
+        return RuntimeWorkerId { prefer_second ? second : first };
+    }
+
+    // Called by a worker back from its park, after its unpark hook, releasing the searching
+    // slot if placement woke it.
+    void finish_search(const WorkerHandle& worker) { release_search(worker.id().as_usize()); }
+
+    // Both flag updates happen under the state lock, next to the lifecycle change they mirror.
+    void set_accepting(bool accepting) {
+        m_accepting.store(accepting, rstd::sync::atomic::Ordering::SeqCst);
+    }
+
+    auto register_task(RuntimeWorkerId owner, TaskRef task) -> bool {
+        return worker(owner).register_task(rstd::move(task), m_accepting, m_live_tasks);
+    }
+
+    // Returns `true` when this retired the last live task of a runtime that is shutting down,
+    // which is the only moment `abort_all_tasks` waits for. The sequentially consistent pair
+    // here and in `set_accepting` keeps a retirement that still sees the runtime accepting
+    // ordered before the shutdown's own check of the count.
+    auto retire_task(TaskRefControl* task) -> bool {
+        auto owner = RuntimeWorkerId { task->registry_shard() };
+        if (! worker(owner).retire_task(task)) return false;
+        auto previous = m_live_tasks.fetch_sub(1, rstd::sync::atomic::Ordering::SeqCst);
+        return previous == 1 && ! m_accepting.load(rstd::sync::atomic::Ordering::SeqCst);
+    }
+
+    auto live_tasks() const -> usize {
+        return m_live_tasks.load(rstd::sync::atomic::Ordering::SeqCst);
+    }
+
+    void note_spawned() { m_spawned_tasks.fetch_add(1, rstd::sync::atomic::Ordering::Relaxed); }
+
+    auto spawned_tasks() const -> u64 {
+        return m_spawned_tasks.load(rstd::sync::atomic::Ordering::Relaxed);
+    }
+
+    auto clone_tasks() const -> Vec<TaskRef> {
+        auto tasks = Vec<TaskRef>::make();
+        for (usize i = 0; i < m_workers.len(); ++i) m_workers[i].clone_tasks_into(tasks);
+        return tasks;
     }
 
     void request_worker_stop() const {
@@ -1246,27 +1499,76 @@ public:
     }
 };
 
+// Sizes a worker's spin from how long its recent idle periods lasted. It keeps an exponential
+// average of them, clamping each at twice the cap, and spins for twice that average up to the
+// cap, or not at all once the average passes the cap: a worker that mostly sleeps long stops
+// burning its core, and a run of short gaps brings the spin back.
+class SpinTuner {
+    // Caps the configured spin so the arithmetic below cannot overflow.
+    static constexpr u64 MAX_SPIN_NANOS { 1'000'000'000 };
+
+    u64 m_max_nanos { 0 };
+    u64 m_average_nanos { 0 };
+
+public:
+    explicit SpinTuner(time::Duration max) noexcept
+        : m_max_nanos(max.as_nanos() < u128(MAX_SPIN_NANOS) ? u64(max.as_nanos())
+                                                             : MAX_SPIN_NANOS),
+          m_average_nanos(m_max_nanos / 2) {}
+
+    auto enabled() const noexcept -> bool { return m_max_nanos != 0; }
+
+    auto budget() const noexcept -> time::Duration {
+        if (m_average_nanos > m_max_nanos) return time::Duration::from_nanos(0);
+        u64 nanos = m_average_nanos * 2;
+        return time::Duration::from_nanos(nanos < m_max_nanos ? nanos : m_max_nanos);
+    }
+
+    void record(time::Duration idle) noexcept {
+        u64 limit       = m_max_nanos * 2;
+        u64 nanos       = idle.as_nanos() < u128(limit) ? u64(idle.as_nanos()) : limit;
+        m_average_nanos = (m_average_nanos * 7 + nanos) / 8;
+    }
+};
+
 class RuntimeWorker {
     static constexpr usize DEFAULT_COOPERATIVE_BUDGET { 64 };
 
+    // Pause instructions between two busy-polls of the poller while spinning.
+    static constexpr usize SPIN_PAUSES { 32 };
+
+    // Consecutive LIFO-slot polls allowed before the slot's task goes behind the queue, so a
+    // pair of tasks waking each other cannot starve the rest.
+    static constexpr usize MAX_LIFO_POLLS { 3 };
+
     RuntimeInner*     m_runtime;
     WorkerHandle      m_handle;
     ReadyQueue        m_ready;
     Option<PollState> m_poll_state;
     Option<io::Error> m_poll_init_error;
+    PollBatch         m_poll_batch;
+    SpinTuner         m_spin;
     usize             m_cooperative_budget { DEFAULT_COOPERATIVE_BUDGET };
     bool              m_stop_requested { false };
+    // Cached from the runtime's config: whether to count, and whether to time polls.
+    bool m_metrics { false };
+    bool m_timed_polls { false };
 
     void drain_inbox();
+    void run_task(RuntimeExecutionLease lease, usize task, bool from_lifo);
     void apply_poll(PollCommand command);
-    void dispatch_poll_batch(PollBatch batch);
+    void dispatch_poll_batch(PollBatch& batch);
     void poll_backend(PollTimeout timeout);
+    auto spin_for_work(time::Instant idle_since) -> bool;
+    void park();
 
 public:
     RuntimeWorker(RuntimeInner& runtime, WorkerHandle handle);
     ~RuntimeWorker();
 
     auto poll_initialized() const noexcept -> bool { return m_poll_state.is_some(); }
+    auto try_schedule_lifo(const RuntimeInner* runtime, ScheduleTicket ticket)
+        -> Result<empty, ScheduleTicket>;
     void drain_ready();
     void wait_for_work();
     void run();
@@ -1299,13 +1601,18 @@ struct RuntimeInner {
     auto current_poll_worker() -> io::Result<WorkerHandle>;
 
     void spawn(TaskRef task);
+    // Binds `task` to `owner` for its whole life, whichever thread spawns it.
+    void spawn_on(TaskRef task, RuntimeWorkerId owner);
+    auto shard_count() const -> usize { return is_thread_pool() ? m_shared.worker_count() : 1; }
+    auto shard_worker(usize shard) const -> RuntimeWorkerId;
     auto lifecycle() -> RuntimeLifecycle;
     auto is_running() -> bool;
     auto is_stopping() -> bool;
+    auto metrics() const -> async::RuntimeMetrics;
     void retire(TaskRefControl* task);
     auto complete_facility(FacilityEvent event) -> Result<empty, FacilityEvent>;
     auto complete_facility_batch(FacilityEventBatch batch) -> Result<empty, FacilityEventBatch>;
-    void worker_loop(RuntimeWorkerId worker);
+    static void worker_loop(sync::Arc<RuntimeInner> runtime, RuntimeWorkerId worker);
     void worker_started();
     void worker_start_failed(io::Error error);
     auto wait_for_startup() -> io::Result<empty>;
@@ -1315,6 +1622,39 @@ struct RuntimeInner {
     void abort_all_tasks();
 };
 
+// A strong reference to a task's runtime, held across one wake, poll or completion. On one of
+// the runtime's own pool workers it clones the worker's `LocalArc`, a plain increment, so those
+// paths do not bounce the runtime's shared count between cores; anywhere else it upgrades the
+// task's `Weak`.
+class RuntimeRef {
+    Option<sync::LocalArc<RuntimeInner>> m_local;
+    Option<sync::Arc<RuntimeInner>>      m_shared;
+    RuntimeInner*                        m_runtime { nullptr };
+
+public:
+    static auto upgrade(const sync::Weak<RuntimeInner>& runtime) -> RuntimeRef {
+        auto        result = RuntimeRef {};
+        const auto* local  = CURRENT_RUNTIME_ARC;
+        // A live `Weak` keeps its allocation, so an equal address is this very runtime.
+        if (local != nullptr && local->as_ptr().as_raw_ptr() == runtime.as_ptr().as_raw_ptr()) {
+            result.m_runtime = local->as_ptr().as_raw_ptr();
+            result.m_local   = Some(local->clone());
+            return result;
+        }
+        auto shared = runtime.upgrade();
+        if (shared) {
+            result.m_runtime = shared.as_ptr().as_raw_ptr();
+            result.m_shared  = Some(rstd::move(shared));
+        }
+        return result;
+    }
+
+    explicit operator bool() const noexcept { return m_runtime != nullptr; }
+
+    auto operator->() const noexcept -> RuntimeInner* { return m_runtime; }
+    auto get() const noexcept -> RuntimeInner* { return m_runtime; }
+};
+
 struct TaskStateBase {
     TaskRefControl*                           ref_control;
     sync::Weak<RuntimeInner>                  runtime;
@@ -1466,36 +1806,46 @@ inline TaskAccess::~TaskAccess() {
 }
 
 inline void RuntimeInner::spawn(TaskRef task) {
-    auto owner = Option<RuntimeWorkerId> {};
-    {
-        auto st = m_shared.state.lock().unwrap_unchecked();
-        if (st->m_lifecycle == RuntimeLifecycle::Running) {
-            st->m_registry.insert(task.clone());
-            auto worker = RuntimeWorkerId::current_thread();
-            if (is_thread_pool()) {
-                auto use_current_worker =
-                    has_current_runtime_worker() && CURRENT_RUNTIME == this &&
-                    current_execution_domain() == async::ExecutionDomainKind::RuntimeWorker;
-                worker = use_current_worker ? current_runtime_worker_id()
-                                            : m_shared.next_worker_locked(*st);
-            }
-            owner = Some(worker);
-        }
+    // Under `SpawnPlacement::Local` a spawn from one of this runtime's workers stays on that
+    // worker and its registry shard; every other spawn is placed by load.
+    auto owner = RuntimeWorkerId::current_thread();
+    if (is_thread_pool()) {
+        auto use_current_worker =
+            m_config.spawn_placement == async::SpawnPlacement::Local &&
+            has_current_runtime_worker() && CURRENT_RUNTIME == this &&
+            current_execution_domain() == async::ExecutionDomainKind::RuntimeWorker;
+        owner = use_current_worker ? current_runtime_worker_id() : m_shared.next_worker();
     }
+    spawn_on(rstd::move(task), owner);
+}
 
-    if (owner.is_none()) {
+inline void RuntimeInner::spawn_on(TaskRef task, RuntimeWorkerId owner) {
+    if (! m_shared.register_task(owner, task.clone())) {
         task.abort();
         return;
     }
+    if (m_config.enable_metrics) m_shared.note_spawned();
+    const auto& hooks = m_config.hooks;
+    if (hooks.on_task_spawn != nullptr) {
+        hooks.on_task_spawn(
+            hooks.context, reinterpret_cast<usize>(task.identity()), owner.as_usize());
+    }
 
     auto access = task.access();
     if (access.is_none()) {
         return;
     }
-    auto action = (*access)->activate(task.clone(), *owner);
+    auto action = (*access)->activate(task.clone(), owner);
     (*access)->apply(rstd::move(action));
 }
 
+inline auto RuntimeInner::shard_worker(usize shard) const -> RuntimeWorkerId {
+    if (shard >= shard_count()) {
+        rstd::panic { "async runtime shard index out of range" };
+    }
+    return RuntimeWorkerId { shard };
+}
+
 inline auto RuntimeInner::current_poll_worker() -> io::Result<WorkerHandle> {
     if (CURRENT_RUNTIME != this || ! has_current_runtime_worker() ||
         current_execution_domain() != async::ExecutionDomainKind::RuntimeWorker) {
@@ -1504,6 +1854,17 @@ inline auto RuntimeInner::current_poll_worker() -> io::Result<WorkerHandle> {
     return Ok(m_shared.worker_handle(current_runtime_worker_id()));
 }
 
+inline auto RuntimeInner::metrics() const -> async::RuntimeMetrics {
+    auto metrics          = async::RuntimeMetrics {};
+    metrics.spawned_tasks = m_shared.spawned_tasks();
+    metrics.live_tasks    = m_shared.live_tasks();
+    metrics.workers       = Vec<async::WorkerMetrics>::with_capacity(m_shared.worker_count());
+    for (usize i = 0; i < m_shared.worker_count(); ++i) {
+        metrics.workers.push(m_shared.worker(RuntimeWorkerId { i }).metrics());
+    }
+    return metrics;
+}
+
 inline auto RuntimeInner::lifecycle() -> RuntimeLifecycle {
     auto st = m_shared.state.lock().unwrap_unchecked();
     return st->m_lifecycle;
@@ -1519,10 +1880,9 @@ inline auto RuntimeInner::is_stopping() -> bool {
 }
 
 inline void RuntimeInner::retire(TaskRefControl* task) {
-    {
-        auto st = m_shared.state.lock().unwrap_unchecked();
-        st->m_registry.remove(task);
-    }
+    if (! m_shared.retire_task(task)) return;
+    // Passing through the state lock orders this wakeup after the waiter's check of the count.
+    (void)m_shared.state.lock();
     m_shared.task_cvar.notify_all();
 }
 
@@ -1536,7 +1896,7 @@ inline auto FacilityCompletionToken::complete(FacilityEventKind kind) -> bool {
     if (task.is_none()) {
         return false;
     }
-    auto rt = (*task)->runtime.upgrade();
+    auto rt = RuntimeRef::upgrade((*task)->runtime);
     if (! rt) {
         m_task.abort();
         return false;
@@ -1556,7 +1916,7 @@ inline auto FacilityCompletionToken::complete_poll(PollEventData event) -> bool
     if (task.is_none()) {
         return false;
     }
-    auto rt = (*task)->runtime.upgrade();
+    auto rt = RuntimeRef::upgrade((*task)->runtime);
     if (! rt) {
         m_task.abort();
         return false;
@@ -1619,12 +1979,20 @@ inline void TaskStateBase::apply(TaskAction action) {
     case TaskActionKind::Schedule: {
         auto ticket = action.take_ticket();
         auto owner  = ticket.owner();
-        auto rt     = runtime.upgrade();
+        auto rt     = RuntimeRef::upgrade(runtime);
         if (! rt) {
             auto task = ticket.take_task();
             task.abort();
             return;
         }
+        // A wake issued by the task its owner is polling goes straight to that worker's LIFO
+        // slot; anything else, or a ticket the worker declines, goes through the inbox.
+        auto* polling = CURRENT_POLLING_WORKER;
+        if (polling != nullptr) {
+            auto local = polling->try_schedule_lifo(rt.get(), rstd::move(ticket));
+            if (local.is_ok()) return;
+            ticket = rstd::move(local).unwrap_err_unchecked();
+        }
         auto submitted = rt->m_shared.worker(owner).schedule(rstd::move(ticket));
         if (submitted.is_err()) {
             auto rejected = rstd::move(submitted).unwrap_err_unchecked();
@@ -1663,7 +2031,7 @@ inline void TaskStateBase::apply(TaskAction action) {
             return;
         }
         (*access)->complete_value();
-        if (auto rt = (*access)->runtime.upgrade()) {
+        if (auto rt = RuntimeRef::upgrade((*access)->runtime)) {
             rt->retire(task.identity());
         }
         return;
@@ -1679,7 +2047,7 @@ inline void TaskStateBase::apply(TaskAction action) {
             return;
         }
         (*access)->complete_abort();
-        if (auto rt = (*access)->runtime.upgrade()) {
+        if (auto rt = RuntimeRef::upgrade((*access)->runtime)) {
             rt->retire(task.identity());
         }
         return;
@@ -1688,7 +2056,7 @@ inline void TaskStateBase::apply(TaskAction action) {
 }
 
 inline void TaskStateBase::schedule(TaskRef self) {
-    auto rt       = runtime.upgrade();
+    auto rt       = RuntimeRef::upgrade(runtime);
     bool stopping = ! rt || rt->is_stopping();
     auto action   = TaskAction::none();
     {
@@ -1785,7 +2153,7 @@ inline auto TaskStateBase::take_completion_event() -> Option<FacilityEvent> {
 
 inline auto TaskStateBase::end_runtime_execution(RuntimeExecutionLease lease,
                                                  TaskPollAction        outcome) -> TaskAction {
-    auto rt         = runtime.upgrade();
+    auto rt         = RuntimeRef::upgrade(runtime);
     bool stopping   = ! rt || rt->is_stopping();
     auto action     = TaskAction::none();
     auto generation = lease.generation();
@@ -1851,7 +2219,7 @@ inline auto TaskStateBase::end_runtime_execution(RuntimeExecutionLease lease,
 }
 
 inline void TaskStateBase::complete_facility(FacilityEvent event) {
-    auto rt           = runtime.upgrade();
+    auto rt           = RuntimeRef::upgrade(runtime);
     bool stopping     = ! rt || rt->is_stopping();
     auto metadata     = event.token();
     auto self         = event.take_task();
@@ -1892,7 +2260,7 @@ inline void TaskStateBase::complete_facility(FacilityEvent event) {
 
 inline auto TaskStateBase::begin_facility_execution(FacilityExecutionToken token, TaskAccess access)
     -> Option<FacilityExecutionLease> {
-    auto rt       = runtime.upgrade();
+    auto rt       = RuntimeRef::upgrade(runtime);
     bool stopping = ! rt || rt->is_stopping();
     auto metadata = token.token();
     auto self     = token.take_task();
@@ -1923,7 +2291,7 @@ inline auto TaskStateBase::begin_facility_execution(FacilityExecutionToken token
 }
 
 inline void TaskStateBase::cancel_facility_handoff(FacilityExecutionToken token) {
-    auto rt       = runtime.upgrade();
+    auto rt       = RuntimeRef::upgrade(runtime);
     bool stopping = ! rt || rt->is_stopping();
     auto metadata = token.token();
     auto self     = token.take_task();
@@ -1951,7 +2319,7 @@ inline void TaskStateBase::cancel_facility_handoff(FacilityExecutionToken token)
 
 inline auto TaskStateBase::end_facility_execution(FacilityExecutionLease lease,
                                                   TaskPollAction         outcome) -> TaskAction {
-    auto rt       = runtime.upgrade();
+    auto rt       = RuntimeRef::upgrade(runtime);
     bool stopping = ! rt || rt->is_stopping();
     auto metadata = lease.token();
     auto self     = lease.take_task();
@@ -2041,13 +2409,28 @@ inline auto make_task_waker(const TaskRef& task) -> task::Waker {
         task::RawWaker::from_raw_parts(control, rstd::addressof(TASK_WAKER_VTABLE)));
 }
 
-inline void poll_runtime_task(RuntimeExecutionLease lease) {
+struct PollingWorkerScope {
+    RuntimeWorker* previous;
+
+    explicit PollingWorkerScope(RuntimeWorker& worker): previous(CURRENT_POLLING_WORKER) {
+        CURRENT_POLLING_WORKER = rstd::addressof(worker);
+    }
+
+    ~PollingWorkerScope() { CURRENT_POLLING_WORKER = previous; }
+};
+
+// Only the poll itself runs inside the scope: a task waking itself is rescheduled once the
+// poll ends, through the inbox, so a yielding task cannot take the LIFO slot.
+inline void poll_runtime_task(RuntimeWorker& worker, RuntimeExecutionLease lease) {
     auto& task_ref   = lease.task();
     auto* task_state = rstd::addressof(lease.state());
     auto  waker      = make_task_waker(task_ref);
     auto  cx         = task::Context { waker };
-    auto  outcome    = task_state->poll(task_ref, cx);
-    auto  action     = task_state->end_runtime_execution(rstd::move(lease), rstd::move(outcome));
+    auto  outcome    = [&] {
+        auto scope = PollingWorkerScope { worker };
+        return task_state->poll(task_ref, cx);
+    }();
+    auto action = task_state->end_runtime_execution(rstd::move(lease), rstd::move(outcome));
     task_state->apply(rstd::move(action));
 }
 
@@ -2056,7 +2439,12 @@ inline RuntimeWorker::RuntimeWorker(RuntimeInner& runtime, WorkerHandle handle)
       m_handle(rstd::move(handle)),
       m_ready(),
       m_poll_state(None()),
-      m_poll_init_error(None()) {
+      m_poll_init_error(None()),
+      m_poll_batch(),
+      m_spin(runtime.m_config.max_spin),
+      m_metrics(runtime.m_config.enable_metrics),
+      m_timed_polls(runtime.m_config.poll_time_histogram ||
+                    runtime.m_config.hooks.on_poll_end != nullptr) {
     auto initialized = AsyncPoll::init();
     if (initialized.is_err()) {
         m_poll_init_error = Some(rstd::move(initialized).unwrap_err_unchecked());
@@ -2077,7 +2465,8 @@ inline RuntimeWorker::RuntimeWorker(RuntimeInner& runtime, WorkerHandle handle)
 inline RuntimeWorker::~RuntimeWorker() {
     m_handle.clear_poll();
     if (m_poll_state.is_some()) {
-        dispatch_poll_batch(AsyncPoll::shutdown(*m_poll_state));
+        auto batch = AsyncPoll::shutdown(*m_poll_state);
+        dispatch_poll_batch(batch);
     }
 }
 
@@ -2090,7 +2479,10 @@ inline void RuntimeWorker::drain_inbox() {
 
         auto value = rstd::move(command).unwrap_unchecked();
         switch (value.kind()) {
-        case WorkerCommandKind::Schedule: m_ready.push(value.take_ticket()); break;
+        case WorkerCommandKind::Schedule:
+            if (m_metrics) WorkerCounters::bump(m_handle.counters().inbox_schedules);
+            m_ready.push(value.take_ticket());
+            break;
         case WorkerCommandKind::FacilityComplete: {
             auto event = value.take_event();
             auto task  = event.access_task();
@@ -2135,22 +2527,67 @@ inline void RuntimeWorker::apply_poll(PollCommand command) {
     event.dispatch();
 }
 
+inline auto RuntimeWorker::try_schedule_lifo(const RuntimeInner* runtime, ScheduleTicket ticket)
+    -> Result<empty, ScheduleTicket> {
+    if (runtime != m_runtime || ! m_runtime->m_config.lifo_slot || m_stop_requested ||
+        ticket.owner() != m_handle.id()) {
+        return Err(rstd::move(ticket));
+    }
+    if (m_metrics) WorkerCounters::bump(m_handle.counters().lifo_schedules);
+    m_handle.note_queued();
+    m_ready.push_lifo(rstd::move(ticket));
+    return Ok(empty {});
+}
+
+inline void RuntimeWorker::run_task(RuntimeExecutionLease lease, usize task, bool from_lifo) {
+    const auto& hooks  = m_runtime->m_config.hooks;
+    usize       worker = m_handle.id().as_usize();
+    if (m_metrics) {
+        auto& counters = m_handle.counters();
+        WorkerCounters::bump(counters.polls);
+        if (from_lifo) WorkerCounters::bump(counters.lifo_polls);
+    }
+    if (hooks.on_poll_start != nullptr) hooks.on_poll_start(hooks.context, task, worker);
+    if (! m_timed_polls) {
+        poll_runtime_task(*this, rstd::move(lease));
+        return;
+    }
+
+    auto started = time::Instant::now();
+    poll_runtime_task(*this, rstd::move(lease));
+    auto elapsed = started.elapsed();
+    if (m_runtime->m_config.poll_time_histogram) m_handle.counters().record_poll_time(elapsed);
+    if (hooks.on_poll_end != nullptr) hooks.on_poll_end(hooks.context, task, worker, elapsed);
+}
+
 inline void RuntimeWorker::drain_ready() {
     drain_inbox();
     if (m_stop_requested) {
         m_ready.clear();
         return;
     }
-    auto remaining = m_cooperative_budget;
+    auto  remaining  = m_cooperative_budget;
+    usize lifo_polls = 0;
     while (remaining > 0) {
-        auto next = m_ready.pop_front();
+        auto next = Option<ScheduleTicket> {};
+        if (lifo_polls < MAX_LIFO_POLLS) next = m_ready.pop_lifo();
+        bool from_lifo = next.is_some();
+        if (from_lifo) {
+            lifo_polls += 1;
+        } else {
+            m_ready.demote_lifo();
+            lifo_polls = 0;
+            next       = m_ready.pop_front();
+        }
         if (next.is_none()) {
             return;
         }
         remaining -= 1;
+        m_handle.note_dequeued();
 
-        auto ticket = rstd::move(next).unwrap_unchecked();
-        auto task   = ticket.access_task();
+        auto ticket  = rstd::move(next).unwrap_unchecked();
+        auto task_id = ticket.task_id();
+        auto task    = ticket.access_task();
         if (task.is_none()) {
             continue;
         }
@@ -2160,13 +2597,59 @@ inline void RuntimeWorker::drain_ready() {
             continue;
         }
 
-        poll_runtime_task(rstd::move(lease).unwrap_unchecked());
+        run_task(rstd::move(lease).unwrap_unchecked(), task_id, from_lifo);
         drain_inbox();
     }
+    if (m_metrics && ! m_ready.is_empty()) {
+        WorkerCounters::bump(m_handle.counters().budget_exhausted);
+    }
 }
 
 inline void RuntimeWorker::wait_for_work() {
-    poll_backend(m_ready.is_empty() ? PollTimeout::Infinite : PollTimeout::Immediate);
+    if (! m_ready.is_empty()) {
+        poll_backend(PollTimeout::Immediate);
+        return;
+    }
+    if (! m_spin.enabled()) {
+        park();
+        return;
+    }
+
+    auto idle_since = time::Instant::now();
+    if (spin_for_work(idle_since)) {
+        if (m_metrics) WorkerCounters::bump(m_handle.counters().spin_wakeups);
+    } else {
+        park();
+    }
+    m_spin.record(idle_since.elapsed());
+}
+
+// Spins for the tuned budget, busy-polling the poller so that I/O readiness ends the spin too.
+// Returns whether work arrived, in which case the worker goes back to running without
+// parking.
+inline auto RuntimeWorker::spin_for_work(time::Instant idle_since) -> bool {
+    auto budget = m_spin.budget();
+    if (budget.is_zero()) return false;
+
+    bool found = m_handle.begin_spin();
+    while (! found && idle_since.elapsed() < budget) {
+        poll_backend(PollTimeout::Immediate);
+        for (usize i = 0; i < SPIN_PAUSES; ++i) rstd::hint::spin_loop();
+        found = m_handle.spin_signaled();
+    }
+    return m_handle.end_spin() || found;
+}
+
+inline void RuntimeWorker::park() {
+    const auto& hooks  = m_runtime->m_config.hooks;
+    usize       worker = m_handle.id().as_usize();
+    if (m_metrics) WorkerCounters::bump(m_handle.counters().parks);
+    if (hooks.on_park != nullptr) hooks.on_park(hooks.context, worker);
+    m_handle.set_parked(true);
+    poll_backend(PollTimeout::Infinite);
+    m_handle.set_parked(false);
+    if (hooks.on_unpark != nullptr) hooks.on_unpark(hooks.context, worker);
+    m_runtime->m_shared.finish_search(m_handle);
 }
 
 inline void RuntimeWorker::poll_backend(PollTimeout timeout) {
@@ -2174,15 +2657,15 @@ inline void RuntimeWorker::poll_backend(PollTimeout timeout) {
         rstd::panic { "async runtime worker Poll initialization failed" };
     }
 
-    auto polled = AsyncPoll::poll(*m_poll_state, timeout);
+    auto polled = AsyncPoll::poll(*m_poll_state, timeout, m_poll_batch);
     if (polled.is_err()) {
         rstd::panic { "async runtime worker Poll failed" };
     }
 
-    dispatch_poll_batch(rstd::move(polled).unwrap_unchecked());
+    dispatch_poll_batch(m_poll_batch);
 }
 
-inline void RuntimeWorker::dispatch_poll_batch(PollBatch batch) {
+inline void RuntimeWorker::dispatch_poll_batch(PollBatch& batch) {
     while (! batch.is_empty()) {
         auto event = rstd::move(batch.pop_front()).unwrap_unchecked();
         if (event.kind() != rstd::async::PollEventKind::Wake) {
@@ -2228,8 +2711,15 @@ struct ExecutionDomainScope {
     ~ExecutionDomainScope() { CURRENT_EXECUTION_DOMAIN = previous; }
 };
 
-inline void RuntimeInner::worker_loop(RuntimeWorkerId worker) {
-    RuntimeWorker { *this, m_shared.worker_handle(worker) }.run();
+// Runs a pool worker on the reference its thread was spawned with, turned into a `LocalArc`
+// that the wake and poll paths on this thread clone without atomics.
+inline void RuntimeInner::worker_loop(sync::Arc<RuntimeInner> runtime, RuntimeWorkerId worker) {
+    auto  local         = sync::LocalArc<RuntimeInner>::from(rstd::move(runtime));
+    auto& inner         = *local.as_ptr().as_raw_ptr();
+    auto  previous      = CURRENT_RUNTIME_ARC;
+    CURRENT_RUNTIME_ARC = &local;
+    RuntimeWorker { inner, inner.m_shared.worker_handle(worker) }.run();
+    CURRENT_RUNTIME_ARC = previous;
 }
 
 inline void RuntimeWorker::run() {
@@ -2258,7 +2748,7 @@ inline void RuntimeWorker::run() {
             m_handle.finish_stop();
             return;
         }
-        poll_backend(m_ready.is_empty() ? PollTimeout::Infinite : PollTimeout::Immediate);
+        wait_for_work();
     }
 }
 
@@ -2295,6 +2785,7 @@ inline auto RuntimeInner::wait_for_startup() -> io::Result<empty> {
         rstd::panic { "async runtime worker startup interrupted" };
     }
     state->m_lifecycle = RuntimeLifecycle::Running;
+    m_shared.set_accepting(true);
     return Ok(empty {});
 }
 
@@ -2305,6 +2796,7 @@ inline auto RuntimeInner::begin_shutdown() -> bool {
         return false;
     }
     state->m_lifecycle = RuntimeLifecycle::Stopping;
+    m_shared.set_accepting(false);
     m_shared.worker_cvar.notify_all();
     return true;
 }
@@ -2327,11 +2819,7 @@ inline void RuntimeInner::finish_shutdown() {
 }
 
 inline void RuntimeInner::abort_all_tasks() {
-    auto tasks = Vec<TaskRef>::make();
-    {
-        auto st = m_shared.state.lock().unwrap_unchecked();
-        tasks   = st->m_registry.clone_all();
-    }
+    auto tasks = m_shared.clone_tasks();
 
     while (! tasks.is_empty()) {
         auto task = rstd::move(tasks.pop()).unwrap_unchecked();
@@ -2340,8 +2828,8 @@ inline void RuntimeInner::abort_all_tasks() {
 
     {
         auto st = m_shared.state.lock().unwrap_unchecked();
-        m_shared.task_cvar.wait_while(st, [](RuntimeSharedState const& runtime_state) {
-            return ! runtime_state.m_registry.is_empty();
+        m_shared.task_cvar.wait_while(st, [this](RuntimeSharedState const&) {
+            return m_shared.live_tasks() != 0;
         });
     }
     m_shared.clear_inbox();
@@ -137,7 +137,9 @@ public:
 };
 
 template<typename T>
-auto spawn_driver_on(RuntimeInner& runtime, rstd::async::RuntimeCoroDriver<T> driver)
+auto spawn_driver_on(RuntimeInner&                     runtime,
+                     rstd::async::RuntimeCoroDriver<T> driver,
+                     Option<usize>                     shard = None())
     -> rstd::async::JoinHandle<T>;
 
 namespace rstd::async
@@ -382,15 +384,24 @@ public:
     void spawn(RuntimeInner& runtime) { runtime.spawn(owner.clone()); }
 };
 
+// With a `shard`, the task is bound to that worker instead of being placed by the runtime.
 template<typename T>
-auto spawn_driver_on(RuntimeInner& runtime, rstd::async::RuntimeCoroDriver<T> driver)
-    -> rstd::async::JoinHandle<T> {
+auto spawn_driver_on(RuntimeInner&                     runtime,
+                     rstd::async::RuntimeCoroDriver<T> driver,
+                     Option<usize>                     shard) -> rstd::async::JoinHandle<T> {
+    auto owner = Option<RuntimeWorkerId> {};
+    if (shard.is_some()) owner = Some(runtime.shard_worker(*shard));
+
     auto join    = sync::Arc<JoinState<T>>::make();
     auto storage = new HeapTaskStorage<DriverTaskState<T>>(
         runtime.weak(), rstd::move(driver), JoinStateOwner<T>::owned(join.clone()));
     auto task = storage->into_task();
     join->set_task(task.clone());
-    runtime.spawn(rstd::move(task));
+    if (owner.is_some()) {
+        runtime.spawn_on(rstd::move(task), *owner);
+    } else {
+        runtime.spawn(rstd::move(task));
+    }
 
     return JoinHandleFactory::make<T>(rstd::move(join));
 }
@@ -408,6 +419,28 @@ auto spawn(A awaitable) -> JoinHandle<await_output_t<A>> {
     return spawn_driver_on(*runtime, rstd::move(driver));
 }
 
+/// Spawns `awaitable` on worker `shard` of the current runtime and keeps it there; the way to
+/// hand work to another shard of a thread-per-core runtime. Panics if `shard` is not below
+/// the runtime's worker count.
+export template<AwaitableInput A>
+auto spawn_on(usize shard, A awaitable) -> JoinHandle<await_output_t<A>> {
+    auto* runtime = CURRENT_RUNTIME;
+    if (runtime == nullptr) {
+        rstd::panic { "spawn_on called without an async runtime" };
+    }
+    auto driver = make_runtime_driver(into_coro(rstd::move(awaitable)));
+    return spawn_driver_on(*runtime, rstd::move(driver), Some(shard));
+}
+
+/// Returns the index of the runtime worker the caller runs on, if it runs on one.
+export inline auto current_shard() -> Option<usize> {
+    if (CURRENT_RUNTIME == nullptr || ! has_current_runtime_worker() ||
+        current_execution_domain() != ExecutionDomainKind::RuntimeWorker) {
+        return None();
+    }
+    return Some(current_runtime_worker_id().as_usize());
+}
+
 export template<AwaitableInput A>
 auto spawn_local(A awaitable) -> JoinHandle<await_output_t<A>> {
     auto* runtime = CURRENT_RUNTIME;
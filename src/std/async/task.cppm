@@ -1,5 +1,6 @@
 export module rstd:async.task;
 export import :async.awaitable;
+import :async.frame;
 import :async.runtime_core;
 
 using namespace rstd;
@@ -71,10 +72,12 @@ namespace rstd::async
 template<typename T>
 struct CoroAccess;
 
+// Frames come from `PooledFrame`'s per-thread free lists, so a chain of awaited
+// sub-coroutines reuses the frames earlier calls released instead of reaching the allocator.
 export template<typename T>
 class RSTD_CORO_AWAIT_ELIDABLE coro {
 public:
-    struct promise_type {
+    struct promise_type : PooledFrame {
         AwaitingOperation awaiting {};
         Option<T>         result;
 
@@ -145,7 +148,7 @@ public:
 template<>
 class RSTD_CORO_AWAIT_ELIDABLE coro<void> {
 public:
-    struct promise_type {
+    struct promise_type : PooledFrame {
         AwaitingOperation awaiting {};
 
         auto get_return_object() noexcept -> coro {
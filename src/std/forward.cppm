@@ -38,6 +38,10 @@ export namespace string
 using rstd_alloc::string::String;
 /// A trait for converting a value to a String.
 using rstd_alloc::string::ToString;
+/// An immutable string with O(1) atomic clone.
+using rstd_alloc::string::ArcStr;
+/// Alias of `ArcStr`.
+using rstd_alloc::string::SharedStr;
 } // namespace string
 
 export namespace prelude
@@ -62,8 +66,41 @@ export namespace collections
 using rstd_alloc::collections::BTreeMap;
 /// A hash map using open addressing.
 using rstd_alloc::collections::HashMap;
+/// A hash set sharing `HashMap`'s table.
+using rstd_alloc::collections::HashSet;
+/// Storage with O(1) insert and remove, addressed by reused `usize` keys.
+using rstd_alloc::collections::Slab;
+/// A slab whose generational keys never alias a newer value.
+using rstd_alloc::collections::SlotMap;
+/// A key into a `SlotMap`.
+using rstd_alloc::collections::SlotKey;
+/// A non-owning doubly linked list threaded through its elements.
+using rstd_alloc::collections::IntrusiveList;
+/// The links an `IntrusiveList` element embeds.
+using rstd_alloc::collections::IntrusiveLink;
+/// A double-ended queue over a growable ring buffer.
+using rstd_alloc::collections::VecDeque;
+/// A priority queue over a binary max-heap.
+using rstd_alloc::collections::BinaryHeap;
+/// A binary heap whose elements can be updated or removed through handles.
+using rstd_alloc::collections::HandleHeap;
+/// A set of small integers stored as one bit each.
+using rstd_alloc::collections::BitSet;
+/// A growable vector of packed bits.
+using rstd_alloc::collections::BitVec;
 } // namespace collections
 
+/// Slice algorithms that need to allocate; the rest live in `rstd.core`.
+export namespace slice_
+{
+/// Stable, run-adaptive merge sort.
+using rstd_alloc::slice_::sort;
+using rstd_alloc::slice_::sort_by;
+using rstd_alloc::slice_::sort_by_key;
+/// LSD radix sort for integers.
+using rstd_alloc::slice_::radix_sort;
+} // namespace slice_
+
 // export namespace borrow = rstd_alloc::borrow;
 // export namespace rstd_alloc::fmt;
 // export namespace rstd_alloc::format;
@@ -5,6 +5,8 @@ export import :io;
 export import :path;
 export import :sys.fd;
 export import :sys.io.stdio;
+import :sys.io.kernel_copy;
+import :sys.fs.dir;
 export import :time;
 #if RSTD_OS_UNIX
 import :sys.libc.unix;
@@ -22,6 +24,8 @@ using rstd::sys::fd::OwnedFd;
 using rstd::sys::fd::RawFd;
 using rstd::io::Error;
 using rstd::io::ErrorKind;
+using rstd::io::IoSlice;
+using rstd::io::IoSliceMut;
 using rstd::io::SeekFrom;
 using namespace rstd::prelude;
 
@@ -247,6 +251,91 @@ public:
     auto size() const noexcept -> u64 { return len(); }
 };
 
+// ── AlignedBuf ────────────────────────────────────────────────────────────
+
+/// Default alignment for `OpenOptions::aligned_buffer`. `O_DIRECT` wants buffers, offsets and
+/// lengths aligned to the device's logical block size; 4096 covers every common device.
+export inline constexpr usize DIRECT_IO_ALIGN = 4096;
+
+/// Zero-filled heap buffer with a caller-chosen alignment: the memory `O_DIRECT` transfers
+/// need.
+export class AlignedBuf {
+    u8*   ptr_ { nullptr };
+    usize len_ { 0 };
+    usize align_ { 0 };
+
+    AlignedBuf(u8* ptr, usize len, usize align) noexcept: ptr_(ptr), len_(len), align_(align) {}
+
+public:
+    USE_TRAIT(AlignedBuf)
+    using Target = u8[];
+
+    AlignedBuf() noexcept = default;
+    AlignedBuf(AlignedBuf&& o) noexcept
+        : ptr_(rstd::exchange(o.ptr_, nullptr)),
+          len_(rstd::exchange(o.len_, 0)),
+          align_(rstd::exchange(o.align_, 0)) {}
+
+    auto operator=(AlignedBuf&& o) noexcept -> AlignedBuf& {
+        if (this != &o) {
+            release();
+            ptr_   = rstd::exchange(o.ptr_, nullptr);
+            len_   = rstd::exchange(o.len_, 0);
+            align_ = rstd::exchange(o.align_, 0);
+        }
+        return *this;
+    }
+
+    AlignedBuf(const AlignedBuf&)                    = delete;
+    auto operator=(const AlignedBuf&) -> AlignedBuf& = delete;
+
+    ~AlignedBuf() { release(); }
+
+    /// Allocates `len` zeroed bytes at an `align`-byte boundary. `align` must be a power of
+    /// two no smaller than a pointer.
+    static auto with_len(usize len, usize align = DIRECT_IO_ALIGN) -> FsResult<AlignedBuf> {
+        if (align < sizeof(void*) || (align & (align - 1)) != 0) {
+            return Err(Error::from_kind(ErrorKind { ErrorKind::InvalidInput }));
+        }
+        if (len == 0) return Ok(AlignedBuf { nullptr, 0, align });
+#if RSTD_OS_UNIX
+        void* raw = nullptr;
+        if (int err = libc::posix_memalign(&raw, align, len); err != 0) {
+            return Err(Error::from_raw_os_error(err));
+        }
+        rstd::mem::memset(raw, 0, len);
+        return Ok(AlignedBuf { static_cast<u8*>(raw), len, align });
+#else
+        return Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }));
+#endif
+    }
+
+    auto len() const noexcept -> usize { return len_; }
+    auto is_empty() const noexcept -> bool { return len_ == 0; }
+    auto align() const noexcept -> usize { return align_; }
+    auto as_ptr() const noexcept -> const u8* { return ptr_; }
+    auto as_mut_ptr() noexcept -> u8* { return ptr_; }
+    auto as_slice() const noexcept -> slice<u8> {
+        if (is_empty()) return {};
+        return slice<u8>::from_raw_parts(ptr_, len_);
+    }
+    auto as_mut_slice() noexcept -> mut_ptr<u8[]> {
+        if (is_empty()) return {};
+        return mut_ptr<u8[]>::from_raw_parts(ptr_, len_);
+    }
+    auto deref() const noexcept -> ref<Target> { return as_slice(); }
+    auto deref_mut() noexcept -> mut_ref<Target> { return as_mut_slice().as_mut_ref(); }
+
+private:
+    void release() noexcept {
+#if RSTD_OS_UNIX
+        if (ptr_) libc::free(ptr_);
+#endif
+        ptr_ = nullptr;
+        len_ = 0;
+    }
+};
+
 /// Builder for opening files. Mirrors `std::fs::OpenOptions`.
 export class OpenOptions {
 public:
@@ -256,6 +345,7 @@ public:
     bool truncate_ { false };
     bool create_ { false };
     bool create_new_ { false };
+    bool direct_ { false };
     i32  custom_flags_ { 0 };
     u32  mode_ { 0666 };
 
@@ -285,6 +375,13 @@ public:
         create_new_ = v;
         return *this;
     }
+    /// O_DIRECT: bypass the page cache. Buffers, offsets and lengths must then be aligned to
+    /// the device block size; see `aligned_buffer`. Opening fails with Unsupported where the
+    /// platform has no O_DIRECT.
+    auto direct(bool v) noexcept -> OpenOptions& {
+        direct_ = v;
+        return *this;
+    }
     auto custom_flags(i32 f) noexcept -> OpenOptions& {
         custom_flags_ = f;
         return *this;
@@ -297,6 +394,11 @@ public:
     /// Open the file at `path` according to the configured options.
     auto open(ref<Path> path) const -> FsResult<File>;
 
+    /// A zeroed buffer of `len` bytes aligned for `direct` I/O.
+    static auto aligned_buffer(usize len, usize align = DIRECT_IO_ALIGN) -> FsResult<AlignedBuf> {
+        return AlignedBuf::with_len(len, align);
+    }
+
 #if RSTD_OS_UNIX
     /// Compute the platform open(2) flags from the options. Returns Err if
     /// the combination is invalid (mirrors Rust's get_access_mode/get_creation_mode).
@@ -326,6 +428,36 @@ public:
 #endif
 };
 
+#if RSTD_OS_UNIX
+// The vectored calls hand IoSlice arrays straight to the kernel as iovecs.
+static_assert(sizeof(IoSlice) == sizeof(libc::iovec));
+static_assert(sizeof(IoSliceMut) == sizeof(libc::iovec));
+#endif
+
+/// Access-pattern hint for `File::advise`; maps onto posix_fadvise(2).
+export enum class FileAdvice : u8
+{
+    Normal,
+    Sequential,
+    Random,
+    NoReuse,
+    WillNeed,
+    DontNeed,
+};
+
+/// What `File::allocate` does to the range; maps onto fallocate(2) modes.
+export enum class AllocMode : u8
+{
+    /// Reserve blocks and extend the file size if the range ends past EOF.
+    Allocate,
+    /// Reserve blocks but leave the file size unchanged.
+    KeepSize,
+    /// Deallocate the range; reads return zeros. The size never changes.
+    PunchHole,
+    /// Zero the range, preferring unwritten extents over writing zeros.
+    ZeroRange,
+};
+
 /// An open filesystem file. Mirrors `std::fs::File`.
 export class File {
     OwnedFd fd_;
@@ -503,6 +635,156 @@ public:
         return Ok(empty {});
     }
 
+    /// readv(2) — fills `bufs` in order from the cursor. At most IOV_MAX buffers are used per
+    /// call. EINTR-retried.
+    auto read_vectored(slice<IoSliceMut> bufs) -> FsResult<usize> {
+#if RSTD_OS_UNIX
+        auto iov = reinterpret_cast<const libc::iovec*>(bufs.as_raw_ptr());
+        int  cnt = int(rstd::min(bufs.len(), usize(libc::IOV_MAX)));
+        while (true) {
+            libc::ssize_t n = libc::readv(fd_.as_raw_fd(), iov, cnt);
+            if (n >= 0) return Ok(usize(n));
+            if (libc::get_errno() == libc::EINTR) continue;
+            return Err(Error::from_raw_os_error(libc::get_errno()));
+        }
+#else
+        (void)bufs;
+        return Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }));
+#endif
+    }
+
+    /// writev(2) — writes `bufs` in order at the cursor with one syscall. EINTR-retried.
+    auto write_vectored(slice<IoSlice> bufs) -> FsResult<usize> {
+#if RSTD_OS_UNIX
+        auto iov = reinterpret_cast<const libc::iovec*>(bufs.as_raw_ptr());
+        int  cnt = int(rstd::min(bufs.len(), usize(libc::IOV_MAX)));
+        while (true) {
+            libc::ssize_t n = libc::writev(fd_.as_raw_fd(), iov, cnt);
+            if (n >= 0) return Ok(usize(n));
+            if (libc::get_errno() == libc::EINTR) continue;
+            return Err(Error::from_raw_os_error(libc::get_errno()));
+        }
+#else
+        (void)bufs;
+        return Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }));
+#endif
+    }
+
+    /// preadv(2) — positional `read_vectored` at `offset`; the cursor is untouched, so
+    /// concurrent readers need no lock. EINTR-retried.
+    auto read_vectored_at(slice<IoSliceMut> bufs, u64 offset) const -> FsResult<usize> {
+#if RSTD_OS_UNIX
+        auto iov = reinterpret_cast<const libc::iovec*>(bufs.as_raw_ptr());
+        int  cnt = int(rstd::min(bufs.len(), usize(libc::IOV_MAX)));
+        while (true) {
+            libc::ssize_t n = libc::preadv(fd_.as_raw_fd(), iov, cnt, libc::off_t(offset));
+            if (n >= 0) return Ok(usize(n));
+            if (libc::get_errno() == libc::EINTR) continue;
+            return Err(Error::from_raw_os_error(libc::get_errno()));
+        }
+#else
+        (void)bufs;
+        (void)offset;
+        return Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }));
+#endif
+    }
+
+    /// pwritev(2) — positional `write_vectored` at `offset`. EINTR-retried.
+    auto write_vectored_at(slice<IoSlice> bufs, u64 offset) const -> FsResult<usize> {
+#if RSTD_OS_UNIX
+        auto iov = reinterpret_cast<const libc::iovec*>(bufs.as_raw_ptr());
+        int  cnt = int(rstd::min(bufs.len(), usize(libc::IOV_MAX)));
+        while (true) {
+            libc::ssize_t n = libc::pwritev(fd_.as_raw_fd(), iov, cnt, libc::off_t(offset));
+            if (n >= 0) return Ok(usize(n));
+            if (libc::get_errno() == libc::EINTR) continue;
+            return Err(Error::from_raw_os_error(libc::get_errno()));
+        }
+#else
+        (void)bufs;
+        (void)offset;
+        return Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }));
+#endif
+    }
+
+    /// fallocate(2) — reserves, punches or zeroes `[offset, offset + len)` without writing
+    /// data. Preallocating a segment up front avoids extent fragmentation and ENOSPC midway.
+    auto allocate(u64 offset, u64 len, AllocMode mode = AllocMode::Allocate) const
+        -> FsResult<empty> {
+#if RSTD_OS_LINUX
+        int flags = 0;
+        switch (mode) {
+        case AllocMode::Allocate: break;
+        case AllocMode::KeepSize: flags = libc::FALLOC_FL_KEEP_SIZE; break;
+        case AllocMode::PunchHole:
+            flags = libc::FALLOC_FL_PUNCH_HOLE | libc::FALLOC_FL_KEEP_SIZE;
+            break;
+        case AllocMode::ZeroRange: flags = libc::FALLOC_FL_ZERO_RANGE; break;
+        }
+        int fd = fd_.as_raw_fd();
+        while (true) {
+            if (libc::fallocate(fd, flags, libc::off_t(offset), libc::off_t(len)) == 0)
+                return Ok(empty {});
+            if (libc::get_errno() == libc::EINTR) continue;
+            return Err(Error::from_raw_os_error(libc::get_errno()));
+        }
+#else
+        (void)offset;
+        (void)len;
+        (void)mode;
+        return Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }));
+#endif
+    }
+
+    /// posix_fadvise(2) — tells the kernel how `[offset, offset + len)` will be read. `len`
+    /// of 0 means "to end of file".
+    auto advise(FileAdvice advice, u64 offset = 0, u64 len = 0) const -> FsResult<empty> {
+#if RSTD_OS_UNIX
+        int adv = libc::POSIX_FADV_NORMAL;
+        switch (advice) {
+        case FileAdvice::Normal: adv = libc::POSIX_FADV_NORMAL; break;
+        case FileAdvice::Sequential: adv = libc::POSIX_FADV_SEQUENTIAL; break;
+        case FileAdvice::Random: adv = libc::POSIX_FADV_RANDOM; break;
+        case FileAdvice::NoReuse: adv = libc::POSIX_FADV_NOREUSE; break;
+        case FileAdvice::WillNeed: adv = libc::POSIX_FADV_WILLNEED; break;
+        case FileAdvice::DontNeed: adv = libc::POSIX_FADV_DONTNEED; break;
+        }
+        // Returns the error number instead of setting errno.
+        int err =
+            libc::posix_fadvise(fd_.as_raw_fd(), libc::off_t(offset), libc::off_t(len), adv);
+        if (err != 0) return Err(Error::from_raw_os_error(err));
+        return Ok(empty {});
+#else
+        (void)advice;
+        (void)offset;
+        (void)len;
+        return Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }));
+#endif
+    }
+
+    /// sync_file_range(2) — starts writeback of dirty pages in `[offset, offset + len)`
+    /// (`len` 0 means to EOF). With `wait`, also blocks until that writeback completes. Does
+    /// not flush metadata or the disk cache, so it is no substitute for `sync_data`; it keeps
+    /// an append-only writer from building up a large dirty backlog.
+    auto sync_range(u64 offset, u64 len, bool wait) const -> FsResult<empty> {
+#if RSTD_OS_LINUX
+        unsigned flags = libc::SYNC_FILE_RANGE_WRITE;
+        if (wait) flags |= libc::SYNC_FILE_RANGE_WAIT_BEFORE | libc::SYNC_FILE_RANGE_WAIT_AFTER;
+        int fd = fd_.as_raw_fd();
+        while (true) {
+            if (libc::sync_file_range(fd, libc::off_t(offset), libc::off_t(len), flags) == 0)
+                return Ok(empty {});
+            if (libc::get_errno() == libc::EINTR) continue;
+            return Err(Error::from_raw_os_error(libc::get_errno()));
+        }
+#else
+        (void)offset;
+        (void)len;
+        (void)wait;
+        return Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }));
+#endif
+    }
+
     /// flock(2) LOCK_EX (exclusive, blocking).
     auto lock() -> FsResult<empty> {
 #if RSTD_OS_UNIX
@@ -646,6 +928,12 @@ inline auto OpenOptions::open(ref<Path> path) const -> FsResult<File> {
 
     int flags =
         access.unwrap_unchecked() | creation.unwrap_unchecked() | custom_flags_ | libc::O_CLOEXEC;
+    if (direct_) {
+        if constexpr (! libc::HAS_O_DIRECT) {
+            return Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }));
+        }
+        flags |= libc::O_DIRECT;
+    }
     auto path_ptr = reinterpret_cast<const char*>(cs.to_bytes_with_nul().p);
 
     while (true) {
@@ -965,8 +1253,7 @@ export inline auto set_permissions(ref<Path> path, Permissions perm) -> FsResult
 }
 
 /// Read `from` and write its contents to `to`. Returns the number of bytes copied.
-/// First cut: simple read/write loop. Phase-4-fast (later) can swap in
-/// `copy_file_range` on Linux.
+/// On Linux the data stays in the kernel (`copy_file_range`); otherwise a read/write loop.
 export inline auto copy(ref<Path> from, ref<Path> to) -> FsResult<u64> {
     auto fres = File::open(from);
     if (fres.is_err()) return Err(fres.unwrap_err_unchecked());
@@ -981,6 +1268,13 @@ export inline auto copy(ref<Path> from, ref<Path> to) -> FsResult<u64> {
     if (dres.is_err()) return Err(dres.unwrap_err_unchecked());
     auto dst = rstd::move(dres).unwrap_unchecked();
 
+#if RSTD_OS_UNIX
+    auto kernel = rstd::sys::io::kernel_copy::copy_fd(src.as_raw_fd(), dst.as_raw_fd());
+    if (kernel.is_err()) return Err(kernel.unwrap_err_unchecked());
+    auto copied = kernel.unwrap_unchecked();
+    if (copied.is_some()) return Ok(*copied);
+#endif
+
     u8  chunk[8192];
     u64 total = 0;
     while (true) {
@@ -1125,6 +1419,44 @@ export inline auto read_dir(ref<Path> path) -> FsResult<ReadDir> {
 #endif
 }
 
+} // namespace rstd::fs
+
+#if RSTD_OS_LINUX
+/// Removes the directory `name` under `parent` and everything in it, addressing each child by
+/// name relative to its directory fd so no full paths are rebuilt or re-resolved.
+inline auto remove_dir_all_at(int parent, const char* name) -> FsResult<empty> {
+    using rstd::sys::fs::dir::RawDir;
+    auto opened = RawDir::open_at(parent, name, false);
+    if (opened.is_err()) return Err(opened.unwrap_err_unchecked());
+    auto dir = rstd::move(opened).unwrap_unchecked();
+    while (true) {
+        auto next = dir.next();
+        if (next.is_none()) break;
+        auto er = rstd::move(next).unwrap_unchecked();
+        if (er.is_err()) return Err(er.unwrap_err_unchecked());
+        auto ent  = er.unwrap_unchecked();
+        auto mode = rstd::sys::fs::dir::dtype_to_mode(ent.d_type);
+        if (mode == 0) {
+            auto st = dir.stat_at(ent.name, false);
+            if (st.is_err()) return Err(st.unwrap_err_unchecked());
+            mode = u32(st.unwrap_unchecked().st_mode) & u32(libc::S_IFMT);
+        }
+        if (mode == u32(libc::S_IFDIR)) {
+            auto r = remove_dir_all_at(dir.as_raw_fd(), ent.name);
+            if (r.is_err()) return Err(r.unwrap_err_unchecked());
+        } else if (libc::unlinkat(dir.as_raw_fd(), ent.name, 0) < 0) {
+            return Err(Error::from_raw_os_error(libc::get_errno()));
+        }
+    }
+    if (libc::unlinkat(parent, name, libc::AT_REMOVEDIR) < 0)
+        return Err(Error::from_raw_os_error(libc::get_errno()));
+    return Ok(empty {});
+}
+#endif
+
+namespace rstd::fs
+{
+
 /// Recursively remove `path` (a directory) and everything inside it.
 /// Symlinks at the leaf are unlinked, not followed.
 export inline auto remove_dir_all(ref<Path> path) -> FsResult<empty> {
@@ -1135,6 +1467,13 @@ export inline auto remove_dir_all(ref<Path> path) -> FsResult<empty> {
         // Rust's behaviour: treat symlinks-to-dirs as files for removal.
         return remove_file(path);
     }
+#if RSTD_OS_LINUX
+    auto cs = path_cstring(path);
+    if (cs.is_err()) return Err(cs.unwrap_err_unchecked());
+    auto csv = rstd::move(cs).unwrap_unchecked();
+    return remove_dir_all_at(libc::AT_FDCWD,
+                             reinterpret_cast<const char*>(csv.to_bytes_with_nul().p));
+#else
     auto rd_res = read_dir(path);
     if (rd_res.is_err()) return Err(rd_res.unwrap_err_unchecked());
     auto rd = rstd::move(rd_res).unwrap_unchecked();
@@ -1157,6 +1496,7 @@ export inline auto remove_dir_all(ref<Path> path) -> FsResult<empty> {
         }
     }
     return remove_dir(path);
+#endif
 }
 
 } // namespace rstd::fs
@@ -0,0 +1,545 @@
+module;
+#include <rstd/macro.hpp>
+export module rstd:fs.async;
+export import :fs;
+export import :async;
+export import :bytes;
+import :thread.blocking_task_group;
+import :sync.mutex;
+
+using rstd::io::Error;
+using rstd::io::ErrorKind;
+using rstd::io::SeekFrom;
+using rstd::path::Path;
+using rstd::path::PathBuf;
+using namespace rstd::prelude;
+
+template<typename T>
+using FsResult = rstd::io::Result<T>;
+
+namespace rstd::async::fs
+{
+
+/// Threads in the shared file-I/O pool. Regular files never report readiness, so every
+/// operation in flight holds a thread; this caps how many run at once.
+export inline constexpr usize POOL_WORKERS = 8;
+
+/// Most queued operations a pool thread takes per lock. A burst of small operations (stat,
+/// short reads) shares one wakeup instead of paying a thread handoff each.
+export inline constexpr usize POOL_BATCH = 32;
+
+/// Largest single read or write a `File` hands to the pool.
+export inline constexpr usize MAX_BUF = 2 * 1024 * 1024;
+
+// ── Blocking pool ─────────────────────────────────────────────────────────
+
+namespace pool
+{
+
+using Job = Box<dyn<FnMut<void()>>>;
+
+struct Fields {
+    Vec<Option<Job>>                         staged;
+    usize                                    head { 0 };
+    usize                                    drainers { 0 };
+    Option<thread::BlockingTaskGroup<empty>> group;
+};
+
+/// Staging queue in front of a `BlockingTaskGroup`. Submitting only queues the job; a pool
+/// thread is woken when fewer than `workers` are already draining, and each wakeup runs up to
+/// `POOL_BATCH` jobs before taking the lock again.
+class BlockingPool {
+    sync::Mutex<Fields> m_fields;
+    usize               m_workers;
+
+public:
+    explicit BlockingPool(usize workers): m_fields(Fields {}), m_workers(workers) {}
+
+    BlockingPool(const BlockingPool&)                    = delete;
+    auto operator=(const BlockingPool&) -> BlockingPool& = delete;
+
+    /// The process-wide pool, created on first use.
+    static auto global() -> BlockingPool&;
+
+    auto submit(Job job) -> FsResult<empty> {
+        auto fields = m_fields.lock().unwrap_unchecked();
+        fields->staged.push(Some(rstd::move(job)));
+        if (fields->drainers >= m_workers) return Ok(empty {});
+
+        if (fields->group.is_none()) {
+            auto made = thread::BlockingTaskGroup<empty>::make(m_workers, m_workers);
+            if (made.is_err()) {
+                (void)fields->staged.pop();
+                return Err(rstd::move(made).unwrap_err_unchecked());
+            }
+            fields->group.insert(rstd::move(made).unwrap_unchecked());
+        }
+
+        // Never blocks: at most `m_workers` drainers are queued or running, which is exactly
+        // the group's queue capacity.
+        auto queued = fields->group->submit_detached([this]() -> empty {
+            drain();
+            return empty {};
+        });
+        if (queued.is_err()) {
+            (void)fields->staged.pop();
+            return Err(Error::new_const(ErrorKind { ErrorKind::Other },
+                                        "async fs blocking pool is shut down"));
+        }
+        ++fields->drainers;
+        return Ok(empty {});
+    }
+
+private:
+    void drain() {
+        auto batch = Vec<Job>::with_capacity(POOL_BATCH);
+        while (true) {
+            {
+                auto  fields = m_fields.lock().unwrap_unchecked();
+                usize staged = fields->staged.len() - fields->head;
+                if (staged == 0) {
+                    --fields->drainers;
+                    return;
+                }
+
+                // Spread a backlog over the drainers already awake rather than letting the
+                // first one serialize it.
+                usize take = (staged + fields->drainers - 1) / fields->drainers;
+                take       = rstd::min(take, POOL_BATCH);
+                for (usize i = 0; i < take; ++i) {
+                    batch.push(fields->staged[fields->head++].take().unwrap_unchecked());
+                }
+                compact(*fields);
+            }
+
+            for (usize i = 0; i < batch.len(); ++i) batch[i]->operator()();
+            batch.clear();
+        }
+    }
+
+    // Drops the consumed prefix once it outweighs the live tail, keeping the queue O(1)
+    // amortized per job.
+    static void compact(Fields& fields) {
+        if (fields.head == fields.staged.len()) {
+            fields.staged.clear();
+            fields.head = 0;
+            return;
+        }
+        if (fields.head * 2 < fields.staged.len()) return;
+
+        auto live = Vec<Option<Job>>::with_capacity(fields.staged.len() - fields.head);
+        for (usize i = fields.head; i < fields.staged.len(); ++i) {
+            live.push(fields.staged[i].take());
+        }
+        fields.staged = rstd::move(live);
+        fields.head   = 0;
+    }
+};
+
+inline rstd::sync::atomic::Atomic<BlockingPool*> GLOBAL_POOL { nullptr };
+
+// Never torn down: a job stuck in a blocking syscall (a FIFO, a hung NFS mount) must not hang
+// process exit.
+inline auto BlockingPool::global() -> BlockingPool& {
+    BlockingPool* pool = GLOBAL_POOL.load(rstd::sync::atomic::Ordering::Acquire);
+    if (pool) return *pool;
+
+    BlockingPool* fresh    = Box<BlockingPool>::make(POOL_WORKERS).into_raw();
+    BlockingPool* expected = nullptr;
+    if (GLOBAL_POOL.compare_exchange_strong(expected,
+                                            fresh,
+                                            rstd::sync::atomic::Ordering::AcqRel,
+                                            rstd::sync::atomic::Ordering::Acquire)) {
+        return *fresh;
+    }
+    // Lost the race; the loser never spawned a thread, so dropping it is cheap.
+    (void)Box<BlockingPool>::from_raw(mut_ptr<BlockingPool>::from_raw_parts(fresh));
+    return *expected;
+}
+
+inline auto abandoned() -> Error {
+    return Error::new_const(ErrorKind { ErrorKind::Other },
+                            "blocking file operation was dropped before completing");
+}
+
+/// Queues `f` on the global pool and returns the receiving side of its result.
+template<typename T, typename F>
+auto dispatch(F f) -> FsResult<Completion<T>> {
+    auto made = Completion<T>::make();
+    if (made.is_err()) return Err(rstd::move(made).unwrap_err_unchecked());
+
+    auto pair      = rstd::move(made).unwrap_unchecked();
+    auto submitted = BlockingPool::global().submit(
+        Job::make([f = rstd::move(f), handle = rstd::move(pair.template get<1>())]() mutable {
+            (void)handle.complete(f());
+        }));
+    if (submitted.is_err()) return Err(rstd::move(submitted).unwrap_err_unchecked());
+    return Ok(rstd::move(pair.template get<0>()));
+}
+
+/// Runs `f` on the pool and resolves with what it returns. Only the calling task waits; the
+/// runtime worker moves on to other tasks.
+template<typename T, typename F>
+auto run(F f) -> coro<FsResult<T>> {
+    auto dispatched = dispatch<FsResult<T>>(rstd::move(f));
+    if (dispatched.is_err()) co_return Err(rstd::move(dispatched).unwrap_err_unchecked());
+
+    auto out = co_await rstd::move(dispatched).unwrap_unchecked();
+    if (out.is_err()) co_return Err(abandoned());
+    co_return rstd::move(out).unwrap_unchecked();
+}
+
+} // namespace pool
+
+// ── Free functions ────────────────────────────────────────────────────────
+
+/// `rstd::fs::read` on the blocking pool.
+export inline auto read(ref<Path> path) -> coro<FsResult<Vec<u8>>> {
+    return pool::run<Vec<u8>>(
+        [path = PathBuf::from(path)]() { return ::rstd::fs::read(path.as_path()); });
+}
+
+/// `rstd::fs::read_to_string` on the blocking pool.
+export inline auto read_to_string(ref<Path> path) -> coro<FsResult<String>> {
+    return pool::run<String>(
+        [path = PathBuf::from(path)]() { return ::rstd::fs::read_to_string(path.as_path()); });
+}
+
+/// `rstd::fs::write` on the blocking pool. Takes ownership of `contents`, so no copy is made.
+export inline auto write(ref<Path> path, Vec<u8> contents) -> coro<FsResult<empty>> {
+    return pool::run<empty>([path = PathBuf::from(path), contents = rstd::move(contents)]() {
+        return ::rstd::fs::write(path.as_path(), contents.as_slice());
+    });
+}
+
+/// Copies `contents` and writes them on the blocking pool.
+export inline auto write(ref<Path> path, slice<u8> contents) -> coro<FsResult<empty>> {
+    auto owned = Vec<u8>::with_capacity(contents.len());
+    owned.extend_from_slice(contents);
+    return write(path, rstd::move(owned));
+}
+
+/// `rstd::fs::metadata` on the blocking pool.
+export inline auto metadata(ref<Path> path) -> coro<FsResult<::rstd::fs::Metadata>> {
+    return pool::run<::rstd::fs::Metadata>(
+        [path = PathBuf::from(path)]() { return ::rstd::fs::metadata(path.as_path()); });
+}
+
+/// `rstd::fs::symlink_metadata` on the blocking pool.
+export inline auto symlink_metadata(ref<Path> path) -> coro<FsResult<::rstd::fs::Metadata>> {
+    return pool::run<::rstd::fs::Metadata>(
+        [path = PathBuf::from(path)]() { return ::rstd::fs::symlink_metadata(path.as_path()); });
+}
+
+/// Lists `path` in one pool job. The whole listing comes back at once, so a large directory
+/// costs a single handoff rather than one per entry.
+export inline auto read_dir(ref<Path> path) -> coro<FsResult<Vec<::rstd::fs::DirEntry>>> {
+    using ::rstd::fs::DirEntry;
+    return pool::run<Vec<DirEntry>>([path = PathBuf::from(path)]() -> FsResult<Vec<DirEntry>> {
+        auto dir = ::rstd::fs::read_dir(path.as_path());
+        if (dir.is_err()) return Err(rstd::move(dir).unwrap_err_unchecked());
+
+        auto iter    = rstd::move(dir).unwrap_unchecked();
+        auto entries = Vec<DirEntry>::make();
+        while (true) {
+            auto next = iter.next();
+            if (next.is_none()) break;
+            auto entry = rstd::move(next).unwrap_unchecked();
+            if (entry.is_err()) return Err(rstd::move(entry).unwrap_err_unchecked());
+            entries.push(rstd::move(entry).unwrap_unchecked());
+        }
+        return Ok(rstd::move(entries));
+    });
+}
+
+/// `rstd::fs::create_dir_all` on the blocking pool.
+export inline auto create_dir_all(ref<Path> path) -> coro<FsResult<empty>> {
+    return pool::run<empty>(
+        [path = PathBuf::from(path)]() { return ::rstd::fs::create_dir_all(path.as_path()); });
+}
+
+/// `rstd::fs::remove_file` on the blocking pool.
+export inline auto remove_file(ref<Path> path) -> coro<FsResult<empty>> {
+    return pool::run<empty>(
+        [path = PathBuf::from(path)]() { return ::rstd::fs::remove_file(path.as_path()); });
+}
+
+/// `rstd::fs::remove_dir_all` on the blocking pool.
+export inline auto remove_dir_all(ref<Path> path) -> coro<FsResult<empty>> {
+    return pool::run<empty>(
+        [path = PathBuf::from(path)]() { return ::rstd::fs::remove_dir_all(path.as_path()); });
+}
+
+/// `rstd::fs::rename` on the blocking pool.
+export inline auto rename(ref<Path> from, ref<Path> to) -> coro<FsResult<empty>> {
+    return pool::run<empty>([from = PathBuf::from(from), to = PathBuf::from(to)]() {
+        return ::rstd::fs::rename(from.as_path(), to.as_path());
+    });
+}
+
+/// `rstd::fs::copy` on the blocking pool; keeps the in-kernel copy path.
+export inline auto copy(ref<Path> from, ref<Path> to) -> coro<FsResult<u64>> {
+    return pool::run<u64>([from = PathBuf::from(from), to = PathBuf::from(to)]() {
+        return ::rstd::fs::copy(from.as_path(), to.as_path());
+    });
+}
+
+// ── File ──────────────────────────────────────────────────────────────────
+
+/// An open file driven from async code. Every syscall runs on the blocking pool while the task
+/// waits on a completion.
+///
+/// At most one operation is in flight, so reads and writes keep their order. Writes are
+/// write-behind: `poll_write` copies the bytes and returns at once, and a failure surfaces on
+/// the next operation. Flush before dropping to learn whether the last write landed.
+export class File {
+    enum class Op : u8
+    {
+        Read,
+        Write,
+    };
+
+    struct Done {
+        FsResult<usize> result;
+        Vec<u8>         buf;
+    };
+
+    using Shared = sync::Arc<sync::Mutex<::rstd::fs::File>>;
+
+    Shared                   m_file;
+    Option<Completion<Done>> m_inflight;
+    Op                       m_op { Op::Read };
+    Vec<u8>                  m_buf;       // read-ahead bytes; spare storage otherwise
+    usize                    m_pos { 0 }; // consumed prefix of m_buf
+    bool                     m_eof { false };
+
+public:
+    explicit File(::rstd::fs::File file): m_file(Shared::make(rstd::move(file))) {}
+
+    File(File&&) noexcept                    = default;
+    auto operator=(File&&) noexcept -> File& = default;
+
+    static auto open(ref<Path> path) -> coro<FsResult<File>> {
+        return open_with(::rstd::fs::OpenOptions::make().read(true), path);
+    }
+
+    static auto create(ref<Path> path) -> coro<FsResult<File>> {
+        return open_with(
+            ::rstd::fs::OpenOptions::make().write(true).create(true).truncate(true), path);
+    }
+
+    static auto open_with(::rstd::fs::OpenOptions options, ref<Path> path)
+        -> coro<FsResult<File>> {
+        return pool::run<File>([options, path = PathBuf::from(path)]() -> FsResult<File> {
+            auto file = options.open(path.as_path());
+            if (file.is_err()) return Err(rstd::move(file).unwrap_err_unchecked());
+            return Ok(File { rstd::move(file).unwrap_unchecked() });
+        });
+    }
+
+    auto metadata() -> coro<FsResult<::rstd::fs::Metadata>> {
+        return with_file<::rstd::fs::Metadata>(
+            [](::rstd::fs::File& file) { return file.metadata(); });
+    }
+
+    auto sync_all() -> coro<FsResult<empty>> {
+        return with_file<empty>([](::rstd::fs::File& file) { return file.sync_all(); });
+    }
+
+    auto sync_data() -> coro<FsResult<empty>> {
+        return with_file<empty>([](::rstd::fs::File& file) { return file.sync_data(); });
+    }
+
+    auto set_len(u64 size) -> coro<FsResult<empty>> {
+        return with_file<empty>([size](::rstd::fs::File& file) { return file.set_len(size); });
+    }
+
+    /// Seeks relative to the position the caller has observed; bytes read ahead but not yet
+    /// returned are discarded.
+    auto seek(SeekFrom pos) -> coro<FsResult<u64>> {
+        auto flushed = co_await async::io::flush(*this);
+        if (flushed.is_err()) co_return Err(rstd::move(flushed).unwrap_err_unchecked());
+
+        if (pos.which == SeekFrom::Which::Current) pos.offset -= i64(m_buf.len() - m_pos);
+        discard_read_ahead();
+        co_return co_await pool::run<u64>([file = m_file.clone(), pos]() {
+            auto guard = file->lock().unwrap_unchecked();
+            return guard->seek(pos);
+        });
+    }
+
+    auto poll_read(mut_ref<File> self, task::Context& cx, bytes::BytesMut& buf)
+        -> task::Poll<FsResult<usize>> {
+        auto& file = *self;
+        while (true) {
+            if (file.m_pos < file.m_buf.len()) {
+                return task::Poll<FsResult<usize>>::Ready(Ok(file.take_read_ahead(buf)));
+            }
+            if (file.m_eof) {
+                file.m_eof = false;
+                return task::Poll<FsResult<usize>>::Ready(Ok(usize(0)));
+            }
+
+            auto settled = file.poll_settle(cx);
+            if (settled.is_pending()) return task::Poll<FsResult<usize>>::Pending();
+            auto outcome = rstd::move(settled).take();
+            if (outcome.is_err()) {
+                return task::Poll<FsResult<usize>>::Ready(
+                    Err(rstd::move(outcome).unwrap_err_unchecked()));
+            }
+            if (outcome.unwrap_unchecked()) continue;
+
+            auto want = rstd::min(buf.chunk_mut().len(), MAX_BUF);
+            if (want == 0) return task::Poll<FsResult<usize>>::Ready(Ok(usize(0)));
+            auto started = file.start_read(want);
+            if (started.is_err()) {
+                return task::Poll<FsResult<usize>>::Ready(
+                    Err(rstd::move(started).unwrap_err_unchecked()));
+            }
+        }
+    }
+
+    auto poll_write(mut_ref<File> self, task::Context& cx, bytes::Bytes const& buf)
+        -> task::Poll<FsResult<usize>> {
+        auto& file    = *self;
+        auto  settled = file.poll_settle(cx);
+        if (settled.is_pending()) return task::Poll<FsResult<usize>>::Pending();
+        auto outcome = rstd::move(settled).take();
+        if (outcome.is_err()) {
+            return task::Poll<FsResult<usize>>::Ready(
+                Err(rstd::move(outcome).unwrap_err_unchecked()));
+        }
+
+        auto n = rstd::min(buf.len(), MAX_BUF);
+        if (n == 0) return task::Poll<FsResult<usize>>::Ready(Ok(usize(0)));
+        auto started = file.start_write(buf.data(), n);
+        if (started.is_err()) {
+            return task::Poll<FsResult<usize>>::Ready(
+                Err(rstd::move(started).unwrap_err_unchecked()));
+        }
+        return task::Poll<FsResult<usize>>::Ready(Ok(n));
+    }
+
+    auto poll_flush(mut_ref<File> self, task::Context& cx) -> task::Poll<FsResult<empty>> {
+        auto settled = (*self).poll_settle(cx);
+        if (settled.is_pending()) return task::Poll<FsResult<empty>>::Pending();
+        auto outcome = rstd::move(settled).take();
+        if (outcome.is_err()) {
+            return task::Poll<FsResult<empty>>::Ready(
+                Err(rstd::move(outcome).unwrap_err_unchecked()));
+        }
+        return task::Poll<FsResult<empty>>::Ready(Ok(empty {}));
+    }
+
+    auto poll_shutdown(mut_ref<File> self, task::Context& cx) -> task::Poll<FsResult<empty>> {
+        return poll_flush(self, cx);
+    }
+
+private:
+    template<typename T, typename F>
+    auto with_file(F f) -> coro<FsResult<T>> {
+        auto flushed = co_await async::io::flush(*this);
+        if (flushed.is_err()) co_return Err(rstd::move(flushed).unwrap_err_unchecked());
+
+        co_return co_await pool::run<T>([file = m_file.clone(), f = rstd::move(f)]() mutable {
+            auto guard = file->lock().unwrap_unchecked();
+            return f(*guard);
+        });
+    }
+
+    template<typename F>
+    auto start(Op op, F f) -> FsResult<empty> {
+        auto dispatched = pool::dispatch<Done>(rstd::move(f));
+        if (dispatched.is_err()) return Err(rstd::move(dispatched).unwrap_err_unchecked());
+        m_inflight.insert(rstd::move(dispatched).unwrap_unchecked());
+        m_op = op;
+        return Ok(empty {});
+    }
+
+    auto start_read(usize want) -> FsResult<empty> {
+        auto buf = rstd::exchange(m_buf, Vec<u8>::make());
+        m_pos    = 0;
+        return start(Op::Read, [file = m_file.clone(), buf = rstd::move(buf), want]() mutable {
+            if (buf.capacity() < want) buf = Vec<u8>::with_capacity(want);
+            buf.clear();
+            auto guard = file->lock().unwrap_unchecked();
+            auto n     = guard->read(buf.begin(), want);
+            if (n.is_ok()) buf.set_len_unchecked(n.unwrap_unchecked());
+            return Done { rstd::move(n), rstd::move(buf) };
+        });
+    }
+
+    auto start_write(const u8* data, usize len) -> FsResult<empty> {
+        // Read-ahead bytes were never handed out; rewind over them so the write lands where
+        // the caller believes the cursor is.
+        auto rewind = i64(m_buf.len() - m_pos);
+        auto buf    = rstd::exchange(m_buf, Vec<u8>::make());
+        m_pos       = 0;
+        m_eof       = false;
+        buf.clear();
+        buf.extend_from_slice(data, len);
+        return start(Op::Write, [file = m_file.clone(), buf = rstd::move(buf), rewind]() mutable {
+            auto guard = file->lock().unwrap_unchecked();
+            if (rewind != 0) {
+                auto sought = guard->seek(SeekFrom::from_current(-rewind));
+                if (sought.is_err()) {
+                    return Done { Err(rstd::move(sought).unwrap_err_unchecked()), rstd::move(buf) };
+                }
+            }
+            usize off = 0;
+            while (off < buf.len()) {
+                auto n = guard->write(buf.begin() + off, buf.len() - off);
+                if (n.is_err()) return Done { rstd::move(n), rstd::move(buf) };
+                if (n.unwrap_unchecked() == 0) {
+                    return Done { Err(rstd::io::error::Error_WRITE_ALL_EOF), rstd::move(buf) };
+                }
+                off += n.unwrap_unchecked();
+            }
+            return Done { Ok(off), rstd::move(buf) };
+        });
+    }
+
+    // Drives the in-flight operation, if any, and folds its outcome into the read-ahead state.
+    // `Ok(false)` means nothing was in flight.
+    auto poll_settle(task::Context& cx) -> task::Poll<FsResult<bool>> {
+        if (m_inflight.is_none()) return task::Poll<FsResult<bool>>::Ready(Ok(false));
+
+        auto out = m_inflight->poll_complete(cx);
+        if (out.is_pending()) return task::Poll<FsResult<bool>>::Pending();
+        (void)m_inflight.take();
+
+        auto finished = rstd::move(out).take();
+        if (finished.is_err()) return task::Poll<FsResult<bool>>::Ready(Err(pool::abandoned()));
+
+        auto done = rstd::move(finished).unwrap_unchecked();
+        m_buf     = rstd::move(done.buf); // the storage comes back for reuse either way
+        m_pos     = 0;
+        if (m_op == Op::Write || done.result.is_err()) m_buf.clear();
+        if (done.result.is_err()) {
+            return task::Poll<FsResult<bool>>::Ready(
+                Err(rstd::move(done.result).unwrap_err_unchecked()));
+        }
+        if (m_op == Op::Read && m_buf.is_empty()) m_eof = true;
+        return task::Poll<FsResult<bool>>::Ready(Ok(true));
+    }
+
+    auto take_read_ahead(bytes::BytesMut& buf) -> usize {
+        auto chunk = buf.chunk_mut();
+        auto n     = rstd::min(chunk.len(), m_buf.len() - m_pos);
+        rstd::mem::memcpy(chunk.as_raw_ptr(), m_buf.begin() + m_pos, n);
+        buf.advance_mut(n);
+        m_pos += n;
+        return n;
+    }
+
+    void discard_read_ahead() {
+        m_buf.clear();
+        m_pos = 0;
+        m_eof = false;
+    }
+};
+
+static_assert(Impled<File, async::io::AsyncRead>);
+static_assert(Impled<File, async::io::AsyncWrite>);
+
+} // namespace rstd::async::fs
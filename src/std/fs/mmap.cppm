@@ -0,0 +1,429 @@
+module;
+#include <rstd/macro.hpp>
+export module rstd:fs.mmap;
+export import :fs;
+#if RSTD_OS_UNIX
+import :sys.libc.unix;
+#endif
+
+#if RSTD_OS_UNIX
+namespace libc = rstd::sys::libc;
+#endif
+
+using rstd::io::Error;
+using rstd::io::ErrorKind;
+using namespace rstd::prelude;
+
+template<typename T>
+using FsResult = rstd::io::Result<T>;
+
+namespace rstd::fs
+{
+
+export class Mmap;
+export class MmapMut;
+
+// ── Advice ────────────────────────────────────────────────────────────────
+
+/// Access-pattern hint for a mapping, forwarded to madvise(2).
+export enum class Advice : u8
+{
+    /// No special treatment; the kernel's default readahead.
+    Normal,
+    /// Expect random access; readahead is disabled.
+    Random,
+    /// Expect a front-to-back scan; aggressive readahead, pages freed soon after use.
+    Sequential,
+    /// Start paging the range in now.
+    WillNeed,
+    /// The range is not needed soon; clean pages may be dropped.
+    DontNeed,
+    /// Back the range with transparent huge pages where the kernel allows it.
+    HugePage,
+};
+
+} // namespace rstd::fs
+
+#if RSTD_OS_UNIX
+inline auto mmap_page_size() noexcept -> usize { return usize(libc::sysconf(libc::SC_PAGESIZE)); }
+
+inline auto mmap_advice(rstd::fs::Advice advice) noexcept -> int {
+    using rstd::fs::Advice;
+    switch (advice) {
+    case Advice::Normal: return libc::MADV_NORMAL;
+    case Advice::Random: return libc::MADV_RANDOM;
+    case Advice::Sequential: return libc::MADV_SEQUENTIAL;
+    case Advice::WillNeed: return libc::MADV_WILLNEED;
+    case Advice::DontNeed: return libc::MADV_DONTNEED;
+    case Advice::HugePage: return libc::HAS_MADV_HUGEPAGE ? libc::MADV_HUGEPAGE : -1;
+    }
+    return -1;
+}
+#endif
+
+namespace rstd::fs
+{
+
+// ── MmapInner ─────────────────────────────────────────────────────────────
+
+/// Owns one mapping. The kernel wants page-aligned offsets, so a request for `[offset, len)`
+/// maps from the page boundary below `offset` and hides the leading `skip_` bytes.
+class MmapInner {
+    u8*   base_ { nullptr };
+    usize map_len_ { 0 };
+    usize skip_ { 0 };
+
+public:
+    MmapInner() noexcept = default;
+    MmapInner(u8* base, usize map_len, usize skip) noexcept
+        : base_(base), map_len_(map_len), skip_(skip) {}
+
+    MmapInner(MmapInner&& o) noexcept
+        : base_(rstd::exchange(o.base_, nullptr)),
+          map_len_(rstd::exchange(o.map_len_, 0)),
+          skip_(rstd::exchange(o.skip_, 0)) {}
+
+    auto operator=(MmapInner&& o) noexcept -> MmapInner& {
+        if (this != &o) {
+            unmap();
+            base_    = rstd::exchange(o.base_, nullptr);
+            map_len_ = rstd::exchange(o.map_len_, 0);
+            skip_    = rstd::exchange(o.skip_, 0);
+        }
+        return *this;
+    }
+
+    MmapInner(const MmapInner&)                    = delete;
+    auto operator=(const MmapInner&) -> MmapInner& = delete;
+
+    ~MmapInner() { unmap(); }
+
+    /// Maps `len` bytes of `fd` starting at `offset`. `fd < 0` requests an anonymous mapping.
+    static auto map(int fd, u64 offset, usize len, int prot, int flags) -> FsResult<MmapInner> {
+#if RSTD_OS_UNIX
+        // mmap(2) rejects zero-length mappings; an empty view needs no pages at all.
+        if (len == 0) return Ok(MmapInner {});
+
+        usize page    = mmap_page_size();
+        usize skip    = usize(offset % page);
+        u64   aligned = offset - skip;
+        usize map_len = len + skip;
+        if (fd < 0) flags |= libc::MAP_ANONYMOUS;
+
+        void* p = libc::mmap(nullptr, map_len, prot, flags, fd, libc::off_t(aligned));
+        if (p == libc::MAP_FAILED) return Err(Error::from_raw_os_error(libc::get_errno()));
+        return Ok(MmapInner { static_cast<u8*>(p), map_len, skip });
+#else
+        (void)fd;
+        (void)offset;
+        (void)len;
+        (void)prot;
+        (void)flags;
+        return Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }));
+#endif
+    }
+
+    auto ptr() const noexcept -> u8* { return base_ == nullptr ? nullptr : base_ + skip_; }
+    auto len() const noexcept -> usize { return map_len_ - skip_; }
+
+    auto advise(Advice advice, usize offset, usize len) const -> FsResult<empty> {
+#if RSTD_OS_UNIX
+        int native = mmap_advice(advice);
+        if (native < 0) return Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }));
+        auto range = page_range(offset, len);
+        if (range.is_err()) return Err(range.unwrap_err_unchecked());
+        auto [start, span] = range.unwrap_unchecked();
+        if (span == 0) return Ok(empty {});
+        if (libc::madvise(start, span, native) < 0)
+            return Err(Error::from_raw_os_error(libc::get_errno()));
+        return Ok(empty {});
+#else
+        (void)advice;
+        (void)offset;
+        (void)len;
+        return Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }));
+#endif
+    }
+
+    auto flush(usize offset, usize len, bool sync) const -> FsResult<empty> {
+#if RSTD_OS_UNIX
+        auto range = page_range(offset, len);
+        if (range.is_err()) return Err(range.unwrap_err_unchecked());
+        auto [start, span] = range.unwrap_unchecked();
+        if (span == 0) return Ok(empty {});
+        if (libc::msync(start, span, sync ? libc::MS_SYNC : libc::MS_ASYNC) < 0)
+            return Err(Error::from_raw_os_error(libc::get_errno()));
+        return Ok(empty {});
+#else
+        (void)offset;
+        (void)len;
+        (void)sync;
+        return Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }));
+#endif
+    }
+
+    auto protect(int prot) const -> FsResult<empty> {
+#if RSTD_OS_UNIX
+        if (base_ == nullptr) return Ok(empty {});
+        if (libc::mprotect(base_, map_len_, prot) < 0)
+            return Err(Error::from_raw_os_error(libc::get_errno()));
+        return Ok(empty {});
+#else
+        (void)prot;
+        return Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }));
+#endif
+    }
+
+private:
+    struct PageRange {
+        u8*   start;
+        usize span;
+    };
+
+    /// Widens the visible range `[offset, offset + len)` to the enclosing pages.
+    auto page_range(usize offset, usize len) const -> FsResult<PageRange> {
+        if (offset > this->len() || len > this->len() - offset)
+            return Err(Error::from_kind(ErrorKind { ErrorKind::InvalidInput }));
+        if (len == 0) return Ok(PageRange { nullptr, 0 });
+#if RSTD_OS_UNIX
+        usize page  = mmap_page_size();
+        usize begin = skip_ + offset;
+        usize lead  = begin % page;
+        return Ok(PageRange { base_ + (begin - lead), len + lead });
+#else
+        return Ok(PageRange { base_ + skip_ + offset, len });
+#endif
+    }
+
+    void unmap() noexcept {
+#if RSTD_OS_UNIX
+        if (base_ != nullptr) libc::munmap(base_, map_len_);
+#endif
+        base_    = nullptr;
+        map_len_ = 0;
+        skip_    = 0;
+    }
+};
+
+// ── MmapOptions ───────────────────────────────────────────────────────────
+
+/// Builder for file mappings. Mirrors the `memmap2::MmapOptions` shape.
+export class MmapOptions {
+public:
+    u64           offset_ { 0 };
+    Option<usize> len_ {};
+    bool          populate_ { false };
+
+    static auto make() noexcept -> MmapOptions { return {}; }
+
+    /// Byte offset into the file where the mapping starts. Need not be page-aligned.
+    auto offset(u64 v) noexcept -> MmapOptions& {
+        offset_ = v;
+        return *this;
+    }
+    /// Length of the mapping. Defaults to the rest of the file after `offset`.
+    auto len(usize v) noexcept -> MmapOptions& {
+        len_ = Some(v);
+        return *this;
+    }
+    /// Prefault the whole mapping up front (MAP_POPULATE) instead of on first touch.
+    auto populate(bool v) noexcept -> MmapOptions& {
+        populate_ = v;
+        return *this;
+    }
+
+    /// Read-only shared mapping of `file`. Pages come straight from the page cache.
+    auto map(File const& file) const -> FsResult<Mmap>;
+
+    /// Writable shared mapping of `file`; stores reach the file. `file` must be open read-write.
+    auto map_mut(File const& file) const -> FsResult<MmapMut>;
+
+    /// Private copy-on-write mapping of `file`; stores stay in this process.
+    auto map_copy(File const& file) const -> FsResult<MmapMut>;
+
+    /// Anonymous zero-filled mapping of `len` bytes, not backed by any file.
+    auto map_anon() const -> FsResult<MmapMut>;
+
+private:
+    auto map_file(File const& file, int prot, int flags) const -> FsResult<MmapInner> {
+#if RSTD_OS_UNIX
+        usize len = 0;
+        if (len_.is_some()) {
+            len = *len_;
+        } else {
+            auto meta = file.metadata();
+            if (meta.is_err()) return Err(meta.unwrap_err_unchecked());
+            u64 size = meta.unwrap_unchecked().len();
+            if (offset_ > size) return Err(Error::from_kind(ErrorKind { ErrorKind::InvalidInput }));
+            if (size - offset_ > u64(rstd::numeric_limits<usize>::max()))
+                return Err(Error::from_kind(ErrorKind { ErrorKind::InvalidInput }));
+            len = usize(size - offset_);
+        }
+        if (populate_) flags |= libc::MAP_POPULATE;
+        return MmapInner::map(file.as_raw_fd(), offset_, len, prot, flags);
+#else
+        (void)file;
+        (void)prot;
+        (void)flags;
+        return Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }));
+#endif
+    }
+};
+
+// ── Mmap ──────────────────────────────────────────────────────────────────
+
+/// A read-only memory map. Derefs to `u8[]`, so the bytes feed any `slice<u8>` API such as
+/// `str_::from_utf8` or `json::from_slice` without a copy.
+///
+/// The bytes are only stable while no one else truncates or rewrites the file.
+export class Mmap {
+    MmapInner inner_;
+
+    friend class MmapOptions;
+    friend class MmapMut;
+    explicit Mmap(MmapInner inner) noexcept: inner_(rstd::move(inner)) {}
+
+public:
+    USE_TRAIT(Mmap)
+    using Target = u8[];
+
+    Mmap() noexcept = default;
+
+    /// Maps all of `file` read-only.
+    static auto map(File const& file) -> FsResult<Mmap> { return MmapOptions::make().map(file); }
+
+    auto len() const noexcept -> usize { return inner_.len(); }
+    auto is_empty() const noexcept -> bool { return len() == 0; }
+    auto as_ptr() const noexcept -> const u8* { return inner_.ptr(); }
+    auto as_slice() const noexcept -> slice<u8> {
+        if (is_empty()) return {};
+        return slice<u8>::from_raw_parts(as_ptr(), len());
+    }
+    auto deref() const noexcept -> ref<Target> { return as_slice(); }
+
+    /// Applies `advice` to the whole mapping.
+    auto advise(Advice advice) const -> FsResult<empty> { return inner_.advise(advice, 0, len()); }
+
+    /// Applies `advice` to `[offset, offset + len)`; the range is widened to whole pages.
+    auto advise_range(Advice advice, usize offset, usize len) const -> FsResult<empty> {
+        return inner_.advise(advice, offset, len);
+    }
+};
+
+// ── MmapMut ───────────────────────────────────────────────────────────────
+
+/// A writable memory map, either shared with the file, private copy-on-write, or anonymous.
+export class MmapMut {
+    MmapInner inner_;
+
+    friend class MmapOptions;
+    explicit MmapMut(MmapInner inner) noexcept: inner_(rstd::move(inner)) {}
+
+public:
+    USE_TRAIT(MmapMut)
+    using Target = u8[];
+
+    MmapMut() noexcept = default;
+
+    /// Maps all of `file` read-write and shared. `file` must be open read-write.
+    static auto map_mut(File const& file) -> FsResult<MmapMut> {
+        return MmapOptions::make().map_mut(file);
+    }
+
+    /// Anonymous zero-filled mapping of `len` bytes.
+    static auto map_anon(usize len) -> FsResult<MmapMut> {
+        return MmapOptions::make().len(len).map_anon();
+    }
+
+    auto len() const noexcept -> usize { return inner_.len(); }
+    auto is_empty() const noexcept -> bool { return len() == 0; }
+    auto as_ptr() const noexcept -> const u8* { return inner_.ptr(); }
+    auto as_mut_ptr() noexcept -> u8* { return inner_.ptr(); }
+    auto as_slice() const noexcept -> slice<u8> {
+        if (is_empty()) return {};
+        return slice<u8>::from_raw_parts(as_ptr(), len());
+    }
+    auto as_mut_slice() noexcept -> mut_ptr<u8[]> {
+        if (is_empty()) return {};
+        return mut_ptr<u8[]>::from_raw_parts(as_mut_ptr(), len());
+    }
+    auto deref() const noexcept -> ref<Target> { return as_slice(); }
+    auto deref_mut() noexcept -> mut_ref<Target> { return as_mut_slice().as_mut_ref(); }
+
+    /// msync(MS_SYNC): writes dirty pages back to the file and waits for completion.
+    auto flush() const -> FsResult<empty> { return inner_.flush(0, len(), true); }
+
+    /// msync(MS_ASYNC): schedules write-back without waiting.
+    auto flush_async() const -> FsResult<empty> { return inner_.flush(0, len(), false); }
+
+    /// Synchronously flushes `[offset, offset + len)` only.
+    auto flush_range(usize offset, usize len) const -> FsResult<empty> {
+        return inner_.flush(offset, len, true);
+    }
+
+    auto advise(Advice advice) const -> FsResult<empty> { return inner_.advise(advice, 0, len()); }
+
+    auto advise_range(Advice advice, usize offset, usize len) const -> FsResult<empty> {
+        return inner_.advise(advice, offset, len);
+    }
+
+    /// Drops write access and returns the same pages as a read-only `Mmap`.
+    auto make_read_only() && -> FsResult<Mmap> {
+#if RSTD_OS_UNIX
+        auto r = inner_.protect(libc::PROT_READ);
+        if (r.is_err()) return Err(r.unwrap_err_unchecked());
+        return Ok(Mmap { rstd::move(inner_) });
+#else
+        return Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }));
+#endif
+    }
+};
+
+#if RSTD_OS_UNIX
+inline auto MmapOptions::map(File const& file) const -> FsResult<Mmap> {
+    auto r = map_file(file, libc::PROT_READ, libc::MAP_SHARED);
+    if (r.is_err()) return Err(r.unwrap_err_unchecked());
+    return Ok(Mmap { rstd::move(r).unwrap_unchecked() });
+}
+
+inline auto MmapOptions::map_mut(File const& file) const -> FsResult<MmapMut> {
+    auto r = map_file(file, libc::PROT_READ | libc::PROT_WRITE, libc::MAP_SHARED);
+    if (r.is_err()) return Err(r.unwrap_err_unchecked());
+    return Ok(MmapMut { rstd::move(r).unwrap_unchecked() });
+}
+
+inline auto MmapOptions::map_copy(File const& file) const -> FsResult<MmapMut> {
+    auto r = map_file(file, libc::PROT_READ | libc::PROT_WRITE, libc::MAP_PRIVATE);
+    if (r.is_err()) return Err(r.unwrap_err_unchecked());
+    return Ok(MmapMut { rstd::move(r).unwrap_unchecked() });
+}
+
+inline auto MmapOptions::map_anon() const -> FsResult<MmapMut> {
+    int flags = libc::MAP_PRIVATE | (populate_ ? libc::MAP_POPULATE : 0);
+    auto r = MmapInner::map(-1, 0, len_.is_some() ? *len_ : 0, libc::PROT_READ | libc::PROT_WRITE,
+                            flags);
+    if (r.is_err()) return Err(r.unwrap_err_unchecked());
+    return Ok(MmapMut { rstd::move(r).unwrap_unchecked() });
+}
+#else
+inline auto MmapOptions::map(File const& file) const -> FsResult<Mmap> {
+    (void)file;
+    return Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }));
+}
+
+inline auto MmapOptions::map_mut(File const& file) const -> FsResult<MmapMut> {
+    (void)file;
+    return Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }));
+}
+
+inline auto MmapOptions::map_copy(File const& file) const -> FsResult<MmapMut> {
+    (void)file;
+    return Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }));
+}
+
+inline auto MmapOptions::map_anon() const -> FsResult<MmapMut> {
+    return Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }));
+}
+#endif
+
+} // namespace rstd::fs
@@ -0,0 +1,567 @@
+module;
+#include <rstd/macro.hpp>
+export module rstd:fs.walk;
+export import :fs;
+export import :thread.functions;
+import :sync.condvar;
+import :sync.mutex;
+import :sys.fs.dir;
+#if RSTD_OS_UNIX
+import :sys.libc.unix;
+#endif
+
+#if RSTD_OS_UNIX
+namespace libc = rstd::sys::libc;
+#endif
+
+using ::alloc::sync::Arc;
+using rstd::io::Error;
+using rstd::io::ErrorKind;
+using rstd::path::Path;
+using rstd::path::PathBuf;
+using namespace rstd::prelude;
+
+template<typename T>
+using FsResult = rstd::io::Result<T>;
+
+namespace rstd::fs
+{
+
+export class WalkDirIter;
+
+// ── WalkEntry ─────────────────────────────────────────────────────────────
+
+/// One entry yielded by `WalkDir`. The file type comes from getdents64's `d_type`, so no
+/// stat(2) was issued for it unless the filesystem left the type blank.
+export class WalkEntry {
+public:
+    PathBuf path_;
+    usize   depth_ { 0 };
+    u32     type_ { 0 }; // S_IFMT bits
+    u64     ino_ { 0 };
+    bool    follow_ { false };
+
+    auto path() const noexcept -> ref<Path> { return path_.as_path(); }
+    auto into_path() && -> PathBuf { return rstd::move(path_); }
+
+    /// Last path component; the root entry reports its whole path.
+    auto file_name() const noexcept -> ref<rstd::ffi::OsStr> {
+        auto name = path().file_name();
+        return name.is_some() ? *name : path().as_os_str();
+    }
+
+    /// Distance from the walk root, which is depth 0.
+    auto depth() const noexcept -> usize { return depth_; }
+    auto file_type() const noexcept -> FileType { return FileType { type_ }; }
+    /// Inode number as reported by the directory listing.
+    auto ino() const noexcept -> u64 { return ino_; }
+
+    /// stat(2) of the entry, following symlinks only if the walk does.
+    auto metadata() const -> FsResult<Metadata> {
+        return follow_ ? fs::metadata(path()) : fs::symlink_metadata(path());
+    }
+};
+
+// ── WalkDir ───────────────────────────────────────────────────────────────
+
+/// Recursive directory walker. Mirrors the `walkdir` crate's builder.
+///
+/// Directories are read with getdents64 into a large buffer, and children are opened and
+/// stat'ed relative to their parent's fd, so the kernel never re-resolves a full path. The
+/// walk is pre-order: a directory is yielded before its contents.
+export class WalkDir {
+public:
+    PathBuf root_;
+    usize   min_depth_ { 0 };
+    usize   max_depth_ { rstd::numeric_limits<usize>::max() };
+    bool    follow_links_ { false };
+    usize   buf_size_ { rstd::sys::fs::dir::DEFAULT_BUF_SIZE };
+
+    static auto make(ref<Path> root) -> WalkDir {
+        WalkDir w;
+        w.root_ = PathBuf::from(root);
+        return w;
+    }
+
+    /// Skip entries shallower than `v`. The root is depth 0.
+    auto min_depth(usize v) noexcept -> WalkDir& {
+        min_depth_ = v;
+        return *this;
+    }
+    /// Do not descend below depth `v`; `max_depth(1)` lists the root's children only.
+    auto max_depth(usize v) noexcept -> WalkDir& {
+        max_depth_ = v;
+        return *this;
+    }
+    /// Follow symlinks to directories. Cycles are reported as `FilesystemLoop` errors.
+    auto follow_links(bool v) noexcept -> WalkDir& {
+        follow_links_ = v;
+        return *this;
+    }
+    /// getdents64 buffer size per open directory.
+    auto buffer_size(usize v) noexcept -> WalkDir& {
+        buf_size_ = v;
+        return *this;
+    }
+
+    /// Sequential iterator over the tree. Holds one open fd per directory level.
+    auto iter() const -> WalkDirIter;
+
+    /// Walks the tree on up to `workers` threads (the caller counts as one) and calls
+    /// `f(const WalkEntry&)` for every entry, concurrently and in no particular order.
+    ///
+    /// Each directory is a unit of work; its listing and child stats are issued against that
+    /// directory's fd. The first error stops the walk and is returned.
+    template<typename F>
+        requires mtp::is_invocable_v<F&, WalkEntry const&>
+    auto par_for_each(usize workers, F&& f) const -> FsResult<empty>;
+
+private:
+    auto copy_options() const -> WalkDir {
+        WalkDir w;
+        w.root_         = root_.clone();
+        w.min_depth_    = min_depth_;
+        w.max_depth_    = max_depth_;
+        w.follow_links_ = follow_links_;
+        w.buf_size_     = buf_size_;
+        return w;
+    }
+};
+
+} // namespace rstd::fs
+
+namespace rstd::fs::walk_dir
+{
+
+using rstd::sys::fs::dir::RawDir;
+
+struct DevIno {
+    u64 dev { 0 };
+    u64 ino { 0 };
+};
+
+inline auto make_entry(const Vec<u8>& path, usize depth, u32 mode, u64 ino, bool follow)
+    -> WalkEntry {
+    WalkEntry e;
+    e.path_   = PathBuf::from(ref<Path>::from_raw_parts(path.begin(), path.len()));
+    e.depth_  = depth;
+    e.type_   = mode;
+    e.ino_    = ino;
+    e.follow_ = follow;
+    return e;
+}
+
+// Appends "/name" to `path`, without doubling a trailing separator.
+inline void push_component(Vec<u8>& path, const char* name, usize len) {
+    if (path.len() > 0 && path[path.len() - 1] != u8('/')) path.push(u8('/'));
+    path.extend_from_slice(reinterpret_cast<const u8*>(name), len);
+}
+
+#if RSTD_OS_LINUX
+
+inline auto identity(int fd) -> FsResult<DevIno> {
+    libc::stat_t st {};
+    if (libc::fstat(fd, &st) < 0) return Err(Error::from_raw_os_error(libc::get_errno()));
+    return Ok(DevIno { u64(st.st_dev), u64(st.st_ino) });
+}
+
+inline auto is_loop(slice<DevIno> ancestors, DevIno id) noexcept -> bool {
+    for (usize i = 0; i < ancestors.len(); i++) {
+        if (ancestors[i].dev == id.dev && ancestors[i].ino == id.ino) return true;
+    }
+    return false;
+}
+
+inline auto loop_error() -> Error {
+    return Error::from_kind(ErrorKind { ErrorKind::FilesystemLoop });
+}
+
+struct Root {
+    u32            mode { 0 };
+    u64            ino { 0 };
+    Option<RawDir> dir;
+};
+
+// Stats the root (always following a symlink, like `walkdir`) and opens it if it is a directory
+// the walk will descend into.
+inline auto open_root(const WalkDir& opts, Vec<u8>& path) -> FsResult<Root> {
+    path.clear();
+    path.extend_from_slice(opts.root_.as_path().data(), opts.root_.len());
+    path.push(0);
+    auto cpath = reinterpret_cast<const char*>(path.begin());
+
+    libc::stat_t st {};
+    int          rc = libc::fstatat(libc::AT_FDCWD, cpath, &st, 0);
+    if (rc < 0) {
+        path.pop();
+        return Err(Error::from_raw_os_error(libc::get_errno()));
+    }
+
+    Root root;
+    root.mode = u32(st.st_mode) & u32(libc::S_IFMT);
+    root.ino  = u64(st.st_ino);
+    if (root.mode == u32(libc::S_IFDIR) && opts.max_depth_ > 0) {
+        auto opened = RawDir::open_at(libc::AT_FDCWD, cpath, true, opts.buf_size_);
+        if (opened.is_err()) {
+            path.pop();
+            return Err(opened.unwrap_err_unchecked());
+        }
+        root.dir = Some(rstd::move(opened).unwrap_unchecked());
+    }
+    path.pop();
+    return Ok(rstd::move(root));
+}
+
+/// Resolves the S_IFMT bits of `ent`, stat'ing relative to `dir` only when `d_type` is missing
+/// or a symlink has to be followed.
+inline auto entry_mode(const RawDir& dir, const rstd::sys::fs::dir::RawEntry& ent, bool follow)
+    -> FsResult<u32> {
+    u32 mode = rstd::sys::fs::dir::dtype_to_mode(ent.d_type);
+    if (mode != 0 && ! (follow && mode == u32(libc::S_IFLNK))) return Ok(mode);
+    auto st = dir.stat_at(ent.name, follow);
+    if (st.is_err()) {
+        // A dangling symlink is still a symlink; report it rather than failing the walk.
+        if (follow && mode == u32(libc::S_IFLNK)) return Ok(mode);
+        return Err(st.unwrap_err_unchecked());
+    }
+    return Ok(u32(st.unwrap_unchecked().st_mode) & u32(libc::S_IFMT));
+}
+
+#endif
+
+} // namespace rstd::fs::walk_dir
+
+namespace rstd::fs
+{
+
+/// Iterator returned by `WalkDir::iter`. Yields `FsResult<WalkEntry>`.
+export class WalkDirIter : public rstd::DefaultInClass<WalkDirIter, rstd::iter::Iterator> {
+public:
+    using Item = FsResult<WalkEntry>;
+
+    explicit WalkDirIter(WalkDir opts): opts_(rstd::move(opts)) {}
+
+    auto next() -> Option<Item> {
+#if RSTD_OS_LINUX
+        if (pending_.is_some()) return Some(Item(Err(pending_.take().unwrap_unchecked())));
+        if (! started_) {
+            started_ = true;
+            auto root = start();
+            if (root.is_some()) return root;
+        }
+        return advance();
+#else
+        if (started_) return None();
+        started_ = true;
+        return Some(Item(Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }))));
+#endif
+    }
+
+private:
+#if RSTD_OS_LINUX
+    struct Frame {
+        walk_dir::RawDir dir;
+        usize            path_len { 0 };
+        usize            depth { 0 };
+    };
+
+    WalkDir               opts_;
+    Vec<u8>               path_;
+    Vec<Frame>            stack_;
+    Vec<walk_dir::DevIno> ancestors_;
+    Option<Error>         pending_;
+    bool                  started_ { false };
+
+    auto start() -> Option<Item> {
+        auto opened = walk_dir::open_root(opts_, path_);
+        if (opened.is_err()) return Some(Item(Err(opened.unwrap_err_unchecked())));
+        auto root = rstd::move(opened).unwrap_unchecked();
+        if (root.dir.is_some()) {
+            auto dir = rstd::move(root.dir).unwrap_unchecked();
+            if (opts_.follow_links_) {
+                auto id = walk_dir::identity(dir.as_raw_fd());
+                if (id.is_err()) return Some(Item(Err(id.unwrap_err_unchecked())));
+                ancestors_.push(id.unwrap_unchecked());
+            }
+            stack_.push(Frame { rstd::move(dir), path_.len(), 0 });
+        }
+        if (opts_.min_depth_ > 0) return None();
+        auto entry = walk_dir::make_entry(path_, 0, root.mode, root.ino, opts_.follow_links_);
+        return Some(Item(Ok(rstd::move(entry))));
+    }
+
+    void pop_frame() {
+        stack_.pop();
+        if (opts_.follow_links_ && ancestors_.len() > stack_.len()) ancestors_.pop();
+    }
+
+    // Opens `name` under the top frame and pushes it. Errors are deferred so the directory's own
+    // entry is still yielded first.
+    void descend(const char* name, usize depth) {
+        int  parent = stack_[stack_.len() - 1].dir.as_raw_fd();
+        auto opened = walk_dir::RawDir::open_at(parent, name, opts_.follow_links_, opts_.buf_size_);
+        if (opened.is_err()) {
+            pending_ = Some(opened.unwrap_err_unchecked());
+            return;
+        }
+        auto dir = rstd::move(opened).unwrap_unchecked();
+        if (opts_.follow_links_) {
+            auto id = walk_dir::identity(dir.as_raw_fd());
+            if (id.is_err()) {
+                pending_ = Some(id.unwrap_err_unchecked());
+                return;
+            }
+            if (walk_dir::is_loop(ancestors_.as_slice(), id.unwrap_unchecked())) {
+                pending_ = Some(walk_dir::loop_error());
+                return;
+            }
+            ancestors_.push(id.unwrap_unchecked());
+        }
+        stack_.push(Frame { rstd::move(dir), path_.len(), depth });
+    }
+
+    auto advance() -> Option<Item> {
+        while (! stack_.is_empty()) {
+            auto& top  = stack_[stack_.len() - 1];
+            auto  next = top.dir.next();
+            if (next.is_none()) {
+                pop_frame();
+                continue;
+            }
+            auto er = rstd::move(next).unwrap_unchecked();
+            if (er.is_err()) return Some(Item(Err(er.unwrap_err_unchecked())));
+            auto  ent   = er.unwrap_unchecked();
+            usize depth = top.depth + 1;
+
+            path_.truncate(top.path_len);
+            walk_dir::push_component(path_, ent.name, ent.name_len);
+
+            auto mode = walk_dir::entry_mode(top.dir, ent, opts_.follow_links_);
+            if (mode.is_err()) return Some(Item(Err(mode.unwrap_err_unchecked())));
+            u32 m = mode.unwrap_unchecked();
+
+            // `top` may dangle after this: descend() pushes onto stack_.
+            if (m == u32(libc::S_IFDIR) && depth < opts_.max_depth_) descend(ent.name, depth);
+            if (depth < opts_.min_depth_) {
+                if (pending_.is_some()) return Some(Item(Err(pending_.take().unwrap_unchecked())));
+                continue;
+            }
+            auto entry = walk_dir::make_entry(path_, depth, m, ent.ino, opts_.follow_links_);
+            return Some(Item(Ok(rstd::move(entry))));
+        }
+        return None();
+    }
+#else
+    WalkDir opts_;
+    bool    started_ { false };
+#endif
+};
+
+inline auto WalkDir::iter() const -> WalkDirIter { return WalkDirIter { copy_options() }; }
+
+} // namespace rstd::fs
+
+namespace rstd::fs::walk_dir
+{
+
+#if RSTD_OS_LINUX
+
+// The chain of directories above a job, for loop checks when following links. Each link is
+// shared by everything below it rather than copied into every job.
+struct ParAncestor {
+    DevIno                   id;
+    Option<Arc<ParAncestor>> parent;
+};
+
+inline auto is_loop(const Option<Arc<ParAncestor>>& chain, DevIno id) noexcept -> bool {
+    const auto* link = chain.is_some() ? chain->as_ptr().as_raw_ptr() : nullptr;
+    while (link != nullptr) {
+        if (link->id.dev == id.dev && link->id.ino == id.ino) return true;
+        link = link->parent.is_some() ? link->parent->as_ptr().as_raw_ptr() : nullptr;
+    }
+    return false;
+}
+
+// A listed directory whose subdirectories are still queued. They are opened by name relative to
+// `fd`, which stays open until the last of them is.
+struct ParParent {
+    sys::fd::OwnedFd         fd;
+    Option<Arc<ParAncestor>> ancestors;
+};
+
+// One directory waiting to be listed by a `par_for_each` worker. `path` is only used to name
+// entries; the directory itself is opened as `path[name_at..]` under `parent`, or by path for
+// the root, which has no parent.
+struct ParJob {
+    Option<Arc<ParParent>> parent;
+    Vec<u8>                path;
+    usize                  name_at { 0 };
+    usize                  depth { 0 };
+};
+
+struct ParFields {
+    Vec<ParJob>   queue;
+    usize         active { 0 };
+    bool          stop { false };
+    Option<Error> error;
+};
+
+struct ParShared {
+    sync::Mutex<ParFields> fields;
+    sync::Condvar          work;
+
+    ParShared(): fields(ParFields {}), work(sync::Condvar::make()) {}
+};
+
+inline auto par_open(const WalkDir& opts, ParJob& job) -> FsResult<RawDir> {
+    job.path.push(0);
+    auto name   = reinterpret_cast<const char*>(job.path.begin());
+    auto opened = job.parent.is_some()
+                      ? RawDir::open_at(job.parent->fd.as_raw_fd(),
+                                        name + job.name_at,
+                                        opts.follow_links_,
+                                        opts.buf_size_)
+                      : RawDir::open_at(libc::AT_FDCWD, name, true, opts.buf_size_);
+    job.path.pop();
+    return opened;
+}
+
+// Lists one directory, reports its children to `f`, and collects subdirectories into `found`.
+template<typename F>
+auto par_scan(const WalkDir& opts, ParJob& job, F& f, Vec<ParJob>& found) -> FsResult<empty> {
+    auto opened = par_open(opts, job);
+    if (opened.is_err()) return Err(opened.unwrap_err_unchecked());
+    auto dir = rstd::move(opened).unwrap_unchecked();
+
+    auto ancestors = Option<Arc<ParAncestor>> {};
+    if (job.parent.is_some()) ancestors = job.parent->ancestors.clone();
+    if (opts.follow_links_) {
+        auto id = identity(dir.as_raw_fd());
+        if (id.is_err()) return Err(id.unwrap_err_unchecked());
+        if (is_loop(ancestors, id.unwrap_unchecked())) return Err(loop_error());
+        ancestors = Some(Arc<ParAncestor>::make(
+            ParAncestor { id.unwrap_unchecked(), rstd::move(ancestors) }));
+    }
+
+    usize depth = job.depth + 1;
+    usize base  = job.path.len();
+    auto& path  = job.path;
+    while (true) {
+        auto next = dir.next();
+        if (next.is_none()) break;
+        auto er = rstd::move(next).unwrap_unchecked();
+        if (er.is_err()) return Err(er.unwrap_err_unchecked());
+        auto ent = er.unwrap_unchecked();
+
+        path.truncate(base);
+        push_component(path, ent.name, ent.name_len);
+
+        auto mode = entry_mode(dir, ent, opts.follow_links_);
+        if (mode.is_err()) return Err(mode.unwrap_err_unchecked());
+        u32 m = mode.unwrap_unchecked();
+
+        if (depth >= opts.min_depth_) f(make_entry(path, depth, m, ent.ino, opts.follow_links_));
+        if (m == u32(libc::S_IFDIR) && depth < opts.max_depth_) {
+            ParJob child { None(), Vec<u8>::make(), path.len() - ent.name_len, depth };
+            child.path.extend_from_slice(path.as_slice());
+            found.push(rstd::move(child));
+        }
+    }
+    if (found.is_empty()) return Ok(empty {});
+
+    auto parent =
+        Arc<ParParent>::make(ParParent { rstd::move(dir).into_fd(), rstd::move(ancestors) });
+    for (usize i = 0; i < found.len(); i++) found[i].parent = Some(parent.clone());
+    return Ok(empty {});
+}
+
+template<typename F>
+void par_worker(const WalkDir& opts, ParShared& shared, F& f) {
+    while (true) {
+        ParJob job;
+        {
+            auto fields = shared.fields.lock().unwrap_unchecked();
+            shared.work.wait_while(fields, [](const ParFields& fields) {
+                return fields.queue.is_empty() && fields.active > 0 && ! fields.stop;
+            });
+            if (fields->stop || fields->queue.is_empty()) return;
+            // LIFO keeps the walk depth-first, which bounds the queue on wide trees.
+            job = fields->queue.pop().unwrap_unchecked();
+            ++fields->active;
+        }
+
+        auto found = Vec<ParJob>::make();
+        auto r     = par_scan(opts, job, f, found);
+
+        bool wake_all = false;
+        {
+            auto fields = shared.fields.lock().unwrap_unchecked();
+            --fields->active;
+            if (r.is_err() && ! fields->stop) {
+                fields->stop  = true;
+                fields->error = Some(r.unwrap_err_unchecked());
+            }
+            while (! found.is_empty()) fields->queue.push(found.pop().unwrap_unchecked());
+            wake_all = fields->stop || fields->active == 0 || fields->queue.len() > 1;
+        }
+        if (wake_all) {
+            shared.work.notify_all();
+        } else {
+            shared.work.notify_one();
+        }
+    }
+}
+
+#endif
+
+} // namespace rstd::fs::walk_dir
+
+namespace rstd::fs
+{
+
+template<typename F>
+    requires mtp::is_invocable_v<F&, WalkEntry const&>
+auto WalkDir::par_for_each(usize workers, F&& f) const -> FsResult<empty> {
+#if RSTD_OS_LINUX
+    auto path   = Vec<u8>::make();
+    auto opened = walk_dir::open_root(*this, path);
+    if (opened.is_err()) return Err(opened.unwrap_err_unchecked());
+    auto root = rstd::move(opened).unwrap_unchecked();
+    if (min_depth_ == 0) f(walk_dir::make_entry(path, 0, root.mode, root.ino, follow_links_));
+    if (root.dir.is_none()) return Ok(empty {});
+    // The workers reopen the root by path; drop this handle rather than keep it open.
+    (void)root.dir.take();
+
+    auto shared = Arc<walk_dir::ParShared>::make();
+    {
+        auto fields = shared->fields.lock().unwrap_unchecked();
+        fields->queue.push(walk_dir::ParJob { None(), rstd::move(path), 0, 0 });
+    }
+
+    auto  handles = Vec<thread::JoinHandle<void>>::make();
+    auto* visit   = &f;
+    for (usize i = 1; i < workers; i++) {
+        auto spawned = thread::spawn([this, state = shared.clone(), visit]() mutable {
+            walk_dir::par_worker(*this, *state, *visit);
+        });
+        // Fewer threads only lowers parallelism; the caller still drains the queue.
+        if (spawned.is_err()) break;
+        handles.push(rstd::move(spawned).unwrap_unchecked());
+    }
+    walk_dir::par_worker(*this, *shared, f);
+    while (! handles.is_empty()) {
+        auto handle = handles.pop().unwrap_unchecked();
+        (void)rstd::move(handle).join();
+    }
+
+    auto fields = shared->fields.lock().unwrap_unchecked();
+    if (fields->error.is_some()) return Err(fields->error.take().unwrap_unchecked());
+    return Ok(empty {});
+#else
+    (void)workers;
+    (void)f;
+    return Err(Error::from_kind(ErrorKind { ErrorKind::Unsupported }));
+#endif
+}
+
+} // namespace rstd::fs
@@ -0,0 +1,136 @@
+module;
+#include <rstd/macro.hpp>
+export module rstd:intern;
+export import rstd.alloc;
+import :sync.mutex;
+
+using ::alloc::collections::HashMap;
+using ::alloc::string::ArcStr;
+using ::alloc::vec::Vec;
+using namespace rstd::prelude;
+
+namespace rstd::string
+{
+
+/// A compact handle to an interned string.
+///
+/// Comparing or hashing two symbols is an integer operation, and a symbol is a quarter the size
+/// of a `String`. Symbols are only meaningful to the interner that produced them.
+export struct Symbol {
+    u32 id { 0 };
+
+    constexpr auto as_u32() const noexcept -> u32 { return id; }
+
+    friend constexpr bool operator==(Symbol, Symbol) noexcept  = default;
+    friend constexpr auto operator<=>(Symbol, Symbol) noexcept = default;
+};
+
+// Borrowed key pointing into an `ArcStr` owned by the same interner, so lookups hash the
+// caller's bytes without allocating.
+struct InternKey {
+    ref<str> s;
+
+    friend bool operator==(const InternKey& a, const InternKey& b) noexcept { return a.s == b.s; }
+};
+
+} // namespace rstd::string
+
+namespace rstd
+{
+template<>
+struct Impl<hash::Hash, string::InternKey> : ImplBase<string::InternKey> {
+    void hash(hash::DefaultHasher& state) const noexcept {
+        auto s = this->self().s;
+        state.write(s.data(), s.size());
+    }
+};
+} // namespace rstd
+
+namespace rstd::string
+{
+
+/// Maps strings to dense `Symbol` ids and back.
+///
+/// Each distinct string is stored once as an `ArcStr`; ids are assigned in first-seen order
+/// starting at 0, so they can index side tables directly.
+export class Interner {
+    Vec<ArcStr>             m_strings;
+    HashMap<InternKey, u32> m_ids;
+
+public:
+    USE_TRAIT(Interner)
+
+    Interner() = default;
+
+    static auto make() -> Interner { return {}; }
+
+    /// Returns the symbol for `s`, storing it on first sight.
+    auto intern(ref<str> s) -> Symbol {
+        // Hash and probe once; the key that is stored must point into the owned copy, so it is
+        // only built on a miss.
+        auto probe = InternKey { s };
+        auto entry = m_ids.raw_entry_mut(m_ids.hash_of(probe), [&](const InternKey& stored) {
+            return stored == probe;
+        });
+        if (entry.is_occupied()) return Symbol { **entry.get() };
+
+        rstd_assert(m_strings.len() < usize(numeric_limits<u32>::max()));
+        auto id    = u32(m_strings.len());
+        auto owned = ArcStr::make(s);
+        auto key   = InternKey { owned.as_str() };
+        m_strings.push(rstd::move(owned));
+        (void)rstd::move(entry).or_insert(key, id);
+        return Symbol { id };
+    }
+
+    /// Returns the symbol for `s` if it was interned before. Never allocates.
+    auto get(ref<str> s) const -> Option<Symbol> {
+        auto found = m_ids.get(InternKey { s });
+        if (found.is_none()) return None();
+        return Some(Symbol { **found });
+    }
+
+    /// Returns the string behind `sym`. Panics if `sym` did not come from this interner.
+    auto resolve(Symbol sym) const -> ref<str> { return m_strings[sym.id].as_str(); }
+
+    /// Returns a shared handle to the string behind `sym`.
+    auto resolve_shared(Symbol sym) const -> ArcStr { return m_strings[sym.id].clone(); }
+
+    /// Number of distinct strings interned.
+    auto len() const noexcept -> usize { return m_strings.len(); }
+    auto is_empty() const noexcept -> bool { return m_strings.is_empty(); }
+};
+
+inline rstd::sync::atomic::Atomic<sync::Mutex<Interner>*> GLOBAL_INTERNER { nullptr };
+
+// Never torn down, so strings resolved from the global interner stay valid for the whole run.
+inline auto global_interner() -> sync::Mutex<Interner>& {
+    auto* current = GLOBAL_INTERNER.load(rstd::sync::atomic::Ordering::Acquire);
+    if (current) return *current;
+
+    auto* fresh    = Box<sync::Mutex<Interner>>::make(Interner::make()).into_raw();
+    auto* expected = static_cast<sync::Mutex<Interner>*>(nullptr);
+    if (GLOBAL_INTERNER.compare_exchange_strong(expected,
+                                                fresh,
+                                                rstd::sync::atomic::Ordering::AcqRel,
+                                                rstd::sync::atomic::Ordering::Acquire)) {
+        return *fresh;
+    }
+    (void)Box<sync::Mutex<Interner>>::from_raw(
+        mut_ptr<sync::Mutex<Interner>>::from_raw_parts(fresh));
+    return *expected;
+}
+
+/// Interns `s` in the process-wide interner.
+export inline auto intern(ref<str> s) -> Symbol {
+    auto guard = global_interner().lock().unwrap_unchecked();
+    return guard->intern(s);
+}
+
+/// Resolves a symbol from `intern`. The returned slice lives until the process exits.
+export inline auto resolve(Symbol sym) -> ref<str> {
+    auto guard = global_interner().lock().unwrap_unchecked();
+    return guard->resolve(sym);
+}
+
+} // namespace rstd::string
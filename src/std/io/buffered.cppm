@@ -5,6 +5,7 @@ export import :io.traits;
 import rstd.alloc;
 import :forward;
 
+using rstd_alloc::string::String;
 using rstd_alloc::vec::Vec;
 
 namespace rstd::io
@@ -16,7 +17,8 @@ namespace rstd::io
 export template<typename R>
     requires Impled<R, io::Read>
 class BufReader {
-    R       inner_;
+    R inner_;
+    // Only the capacity is used; `len()` stays 0 and `filled_` tracks the initialized prefix.
     Vec<u8> buf_;
     usize   pos_    = 0;
     usize   filled_ = 0;
@@ -25,7 +27,7 @@ class BufReader {
     auto fill_inner() -> Result<usize> {
         pos_     = 0;
         filled_  = 0;
-        auto res = as<Read>(inner_).read(buf_.begin(), buf_.len());
+        auto res = as<Read>(inner_).read(buf_.begin(), buf_.capacity());
         if (res.is_ok()) filled_ = res.unwrap_unchecked();
         return res;
     }
@@ -37,16 +39,14 @@ public:
     /// \param inner The underlying reader.
     /// \param capacity The buffer size in bytes (defaults to DEFAULT_BUF_SIZE).
     explicit BufReader(R inner, usize capacity = DEFAULT_BUF_SIZE)
-        : inner_(rstd::move(inner)), buf_(Vec<u8>::with_capacity(capacity)) {
-        for (usize i = 0; i < capacity; ++i) buf_.push(u8(0));
-    }
+        : inner_(rstd::move(inner)), buf_(Vec<u8>::with_capacity(capacity)) {}
 
     /// Returns a reference to the underlying reader.
     auto get_ref() const noexcept -> const R& { return inner_; }
     /// Returns a mutable reference to the underlying reader.
     auto get_mut() noexcept -> R& { return inner_; }
     /// Returns the total capacity of the internal buffer.
-    auto capacity() const noexcept -> usize { return buf_.len(); }
+    auto capacity() const noexcept -> usize { return buf_.capacity(); }
     /// Returns a slice of the buffered data that has been read but not yet consumed.
     auto buffer() const noexcept -> slice<u8> {
         return slice<u8>::from_raw_parts(buf_.begin() + pos_, filled_ - pos_);
@@ -72,20 +72,15 @@ class BufWriter {
         usize rem = buf_.len();
         usize off = 0;
         while (rem > 0) {
-            auto res = as<Write>(inner_).write(buf_.begin() + off, rem);
-            if (res.is_err()) {
-                // Remove already-written bytes.
-                if (off > 0) {
-                    usize left = buf_.len() - off;
-                    for (usize i = 0; i < left; ++i) buf_.begin()[i] = buf_.begin()[off + i];
-                    buf_.clear();
-                    for (usize i = 0; i < left; ++i) buf_.push(u8(0));
-                } else {
-                    buf_.clear();
-                }
-                return Err(res.unwrap_err_unchecked());
+            auto  res = as<Write>(inner_).write(buf_.begin() + off, rem);
+            usize n   = res.is_ok() ? res.unwrap_unchecked() : 0;
+            if (res.is_err() || n == 0) {
+                // Keep the unwritten tail at the front so the next flush resumes from it.
+                if (off > 0) rstd::mem::memmove(buf_.begin(), buf_.begin() + off, rem);
+                buf_.set_len_unchecked(rem);
+                if (res.is_err()) return Err(res.unwrap_err_unchecked());
+                return Err(error::Error_WRITE_ALL_EOF);
             }
-            usize n = res.unwrap_unchecked();
             off += n;
             rem -= n;
         }
@@ -120,6 +115,77 @@ public:
     auto into_inner() && -> W { return rstd::move(inner_); }
 };
 
+// ── Line-oriented helpers ─────────────────────────────────────────────────
+
+/// Read bytes into `out` until `delim` (included) or EOF.  Returns bytes appended.
+/// Each buffered chunk is scanned with `memchr` and appended in one copy.
+export template<typename B>
+    requires Impled<B, BufRead>
+auto read_until(B& reader, u8 delim, Vec<u8>& out) -> Result<usize> {
+    usize total = 0;
+    while (true) {
+        auto filled = as<BufRead>(reader).fill_buf();
+        if (filled.is_err()) {
+            auto e = filled.unwrap_err_unchecked();
+            if (e.kind() == error::ErrorKind { error::ErrorKind::Interrupted }) continue;
+            return Err(rstd::move(e));
+        }
+        auto  available = filled.unwrap_unchecked();
+        auto  hit       = rstd::memchr::memchr(delim, available);
+        usize used      = hit.is_some() ? *hit + 1 : available.len();
+        out.extend_from_slice(available.p, used);
+        as<BufRead>(reader).consume(used);
+        total += used;
+        if (hit.is_some() || used == 0) return Ok(total);
+    }
+}
+
+/// Read one line, including its trailing `\n`, and append it to `out`.
+/// Returns InvalidData (and leaves `out` untouched) if the line is not UTF-8.
+export template<typename B>
+    requires Impled<B, BufRead>
+auto read_line(B& reader, String& out) -> Result<usize> {
+    auto bytes = Vec<u8>::make();
+    auto res   = read_until(reader, u8('\n'), bytes);
+    if (res.is_err()) return res;
+    auto line = rstd::str_::from_utf8(bytes.as_slice());
+    if (line.is_none()) return Err(error::Error_INVALID_UTF8);
+    out.push_str(*line);
+    return res;
+}
+
+/// Iterator over the lines of a `BufRead`, without the trailing `\n` / `\r\n`.
+export template<typename B>
+    requires Impled<B, BufRead>
+struct Lines : rstd::DefaultInClass<Lines<B>, rstd::iter::Iterator> {
+    using Item = Result<String>;
+    B reader;
+
+    explicit Lines(B r): reader(rstd::move(r)) {}
+
+    auto next() -> Option<Item> {
+        auto bytes = Vec<u8>::make();
+        auto res   = read_until(reader, u8('\n'), bytes);
+        if (res.is_err()) return Some(Item(Err(res.unwrap_err_unchecked())));
+        if (res.unwrap_unchecked() == 0) return None();
+        if (bytes[bytes.len() - 1] == u8('\n')) {
+            bytes.truncate(bytes.len() - 1);
+            if (bytes.len() > 0 && bytes[bytes.len() - 1] == u8('\r'))
+                bytes.truncate(bytes.len() - 1);
+        }
+        auto line = String::from_utf8(rstd::move(bytes));
+        if (line.is_err()) return Some(Item(Err(error::Error_INVALID_UTF8)));
+        return Some(Item(Ok(rstd::move(line).unwrap_unchecked())));
+    }
+};
+
+/// Returns an iterator over the lines of `reader`.
+export template<typename B>
+    requires Impled<B, BufRead>
+auto lines(B reader) -> Lines<B> {
+    return Lines<B>(rstd::move(reader));
+}
+
 } // namespace rstd::io
 
 // ── Impl specialisations (must live in namespace rstd) ────────────────────
@@ -132,7 +198,7 @@ struct Impl<io::Read, io::BufReader<R>> : ImplBase<io::BufReader<R>> {
     auto read(u8* buf, usize len) -> io::Result<usize> {
         auto& self = this->self();
         // Bypass buffer for large reads when buffer is empty.
-        if (self.pos_ == self.filled_ && len >= self.buf_.len()) {
+        if (self.pos_ == self.filled_ && len >= self.buf_.capacity()) {
             return as<io::Read>(self.inner_).read(buf, len);
         }
         if (self.pos_ == self.filled_) {
@@ -184,10 +250,13 @@ struct Impl<io::Write, io::BufWriter<W>> : ImplBase<io::BufWriter<W>> {
             auto res = self.flush_buf();
             if (res.is_err()) return Err(res.unwrap_err_unchecked());
         }
+        // Bypass buffer for writes that would not fit anyway.
         if (len >= self.buf_.capacity()) {
             return as<io::Write>(self.inner_).write(buf, len);
         }
-        for (usize i = 0; i < len; ++i) self.buf_.push(u8(buf[i]));
+        usize used = self.buf_.len();
+        rstd::mem::memcpy(self.buf_.begin() + used, buf, len);
+        self.buf_.set_len_unchecked(used + len);
         return Ok(len);
     }
     auto flush() -> io::Result<empty> {
@@ -75,6 +75,26 @@ export struct SeekFrom {
     static auto from_current(i64 n) noexcept -> SeekFrom { return { Which::Current, n }; }
 };
 
+// ── IoSlice ───────────────────────────────────────────────────────────────
+/// A borrowed buffer for vectored writes. Laid out like `struct iovec`, so a run of them is
+/// passed to writev/pwritev without conversion.
+export struct IoSlice {
+    const u8* base { nullptr };
+    usize     len { 0 };
+
+    static constexpr auto make(const u8* base, usize len) noexcept -> IoSlice {
+        return { base, len };
+    }
+};
+
+/// A borrowed buffer for vectored reads. Laid out like `struct iovec`.
+export struct IoSliceMut {
+    u8*   base { nullptr };
+    usize len { 0 };
+
+    static constexpr auto make(u8* base, usize len) noexcept -> IoSliceMut { return { base, len }; }
+};
+
 // ── Seek ──────────────────────────────────────────────────────────────────
 /// Trait for types with a notion of current position.
 /// Required: `seek(SeekFrom) -> Result<u64>` — returns new absolute position.
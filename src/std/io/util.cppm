@@ -2,6 +2,8 @@ module;
 #include <rstd/macro.hpp>
 export module rstd:io.util;
 export import :io.traits;
+import :sys.fd;
+import :sys.io.kernel_copy;
 
 namespace rstd::io
 {
@@ -37,29 +39,73 @@ export inline auto sink() noexcept -> Sink {
 }
 
 // ── copy ──────────────────────────────────────────────────────────────────
-/// Copy all bytes from `reader` into `writer`.  Returns bytes copied.
-export template<typename R, typename W>
-    requires Impled<R, io::Read> && Impled<W, io::Write>
-auto copy(R& reader, W& writer) -> Result<u64> {
-    constexpr usize BUF_SIZE = DEFAULT_BUF_SIZE;
-    u8              buf[BUF_SIZE];
-    u64             total = 0;
+/// Types backed by a single OS file descriptor, e.g. `fs::File`.
+template<typename T>
+concept FdBacked = requires(const T& t) {
+    { t.as_raw_fd() } -> mtp::same_as<sys::fd::RawFd>;
+};
+
+/// Drains `reader`'s own buffer into `writer` without an intermediate copy.
+template<typename R, typename W>
+    requires Impled<R, io::BufRead> && Impled<W, io::Write>
+auto copy_buffered(R& reader, W& writer) -> Result<u64> {
+    u64 total = 0;
     while (true) {
-        auto rres = as<Read>(reader).read(buf, BUF_SIZE);
-        if (rres.is_err()) {
-            auto e = rres.unwrap_err_unchecked();
+        auto filled = as<BufRead>(reader).fill_buf();
+        if (filled.is_err()) {
+            auto e = filled.unwrap_err_unchecked();
             if (e.kind() == error::ErrorKind { error::ErrorKind::Interrupted }) continue;
             return Err(rstd::move(e));
         }
-        usize n = rres.unwrap_unchecked();
-        if (n == 0) break;
-        auto wres = io::write_all(writer, buf, n);
+        auto chunk = filled.unwrap_unchecked();
+        if (chunk.len() == 0) break;
+        auto wres = io::write_all(writer, chunk.p, chunk.len());
         if (wres.is_err()) return Err(wres.unwrap_err_unchecked());
-        total += n;
+        as<BufRead>(reader).consume(chunk.len());
+        total += chunk.len();
     }
     return Ok(total);
 }
 
+/// Copy all bytes from `reader` into `writer`.  Returns bytes copied.
+///
+/// When both ends are file descriptors the copy stays in the kernel (`copy_file_range`,
+/// `sendfile` or `splice`). Buffered readers hand over their buffer directly; anything else
+/// goes through a stack buffer.
+export template<typename R, typename W>
+    requires Impled<R, io::Read> && Impled<W, io::Write>
+auto copy(R& reader, W& writer) -> Result<u64> {
+#if RSTD_OS_UNIX
+    if constexpr (FdBacked<R> && FdBacked<W>) {
+        auto kernel = sys::io::kernel_copy::copy_fd(reader.as_raw_fd(), writer.as_raw_fd());
+        if (kernel.is_err()) return Err(kernel.unwrap_err_unchecked());
+        auto copied = kernel.unwrap_unchecked();
+        if (copied.is_some()) return Ok(*copied);
+    }
+#endif
+    if constexpr (Impled<R, io::BufRead>) {
+        return copy_buffered(reader, writer);
+    } else {
+        constexpr usize BUF_SIZE = DEFAULT_BUF_SIZE;
+        u8              buf[BUF_SIZE];
+        u64             total = 0;
+        while (true) {
+            auto rres = as<Read>(reader).read(buf, BUF_SIZE);
+            if (rres.is_err()) {
+                auto e = rres.unwrap_err_unchecked();
+                if (e.kind() == error::ErrorKind { error::ErrorKind::Interrupted }) continue;
+                return Err(rstd::move(e));
+            }
+            usize n = rres.unwrap_unchecked();
+            if (n == 0) break;
+            auto wres = io::write_all(writer, buf, n);
+            if (wres.is_err()) return Err(wres.unwrap_err_unchecked());
+            total += n;
+        }
+        return Ok(total);
+    }
+}
+
 } // namespace rstd::io
 
 // ── Impl specialisations (must be in namespace rstd) ─────────────────────
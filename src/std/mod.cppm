@@ -12,7 +12,13 @@ export import :bytes;
 export import :net;
 export import :process;
 export import :env;
+export import :intern;
+export import :slice;
+export import :par;
 export import :path;
 export import :panicking;
 export import :alloc;
 export import :fs;
+export import :fs.mmap;
+export import :fs.walk;
+export import :fs.async;
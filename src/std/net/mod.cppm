@@ -1,2 +1,4 @@
 export module rstd:net;
 export import :net.tcp;
+export import :net.udp;
+export import :net.unix;
@@ -14,17 +14,90 @@ export using SocketAddr = sys::socket::SocketAddr;
 using namespace rstd::prelude;
 using rstd::sys::socket::Socket;
 
-inline auto tcp_is_error_kind(rstd::io::Error const&      error,
+// Helpers shared by the socket types of the net partitions, which all import this one.
+
+inline auto net_is_error_kind(rstd::io::Error const&      error,
                               rstd::io::ErrorKind::Entity kind) noexcept -> bool {
     return error.kind() == rstd::io::ErrorKind { kind };
 }
 
-inline auto tcp_is_would_block(rstd::io::Error const& error) noexcept -> bool {
-    return tcp_is_error_kind(error, rstd::io::ErrorKind::WouldBlock);
+inline auto net_is_would_block(rstd::io::Error const& error) noexcept -> bool {
+    return net_is_error_kind(error, rstd::io::ErrorKind::WouldBlock);
+}
+
+inline auto net_is_in_progress(rstd::io::Error const& error) noexcept -> bool {
+    return net_is_error_kind(error, rstd::io::ErrorKind::InProgress);
+}
+
+// Clears `ready` from `registration` when `result` reports `WouldBlock`, so the next wait
+// parks until the reactor sees fresh readiness.
+template<typename T>
+auto net_cleared(rstd::async::Registration& registration,
+                 rstd::io::Result<T>        result,
+                 rstd::async::Ready         ready) -> rstd::io::Result<T> {
+    if (result.is_ok()) return result;
+
+    auto error = rstd::move(result).unwrap_err_unchecked();
+    if (net_is_would_block(error)) registration.clear_readiness(ready);
+    return Err(rstd::move(error));
 }
 
-inline auto tcp_is_in_progress(rstd::io::Error const& error) noexcept -> bool {
-    return tcp_is_error_kind(error, rstd::io::ErrorKind::InProgress);
+// Runs `attempt` until it stops failing with `WouldBlock`, waiting for `interest` in between.
+template<typename T, typename F>
+auto net_retry(rstd::async::Registration& registration,
+               rstd::async::Interest      interest,
+               F                          attempt) -> rstd::async::coro<rstd::io::Result<T>> {
+    auto event = Option<rstd::async::ReadyEvent> {};
+    while (true) {
+        auto result = attempt();
+        if (result.is_ok()) co_return result;
+
+        auto error = rstd::move(result).unwrap_err_unchecked();
+        if (! net_is_would_block(error)) co_return Err(rstd::move(error));
+
+        if (event.is_some()) {
+            auto previous = event.take();
+            registration.clear_readiness(rstd::move(previous).unwrap_unchecked());
+        }
+
+        auto ready = co_await rstd::async::ReadinessFuture { registration, interest };
+        if (ready.is_err()) co_return Err(rstd::move(ready).unwrap_err_unchecked());
+        event.insert(rstd::move(ready).unwrap_unchecked());
+    }
+}
+
+// The poll-based form of `net_retry`, behind the streams' `poll_read` and `poll_write`.
+// `waiter_id` keeps the waiter registered across polls and is reset once it fires.
+template<typename F>
+auto net_poll_io(rstd::async::Registration& registration,
+                 rstd::task::Context&       cx,
+                 rstd::async::Interest      interest,
+                 usize&                     waiter_id,
+                 F                          attempt) -> rstd::task::Poll<rstd::io::Result<usize>> {
+    using Polled = rstd::task::Poll<rstd::io::Result<usize>>;
+    auto event   = Option<rstd::async::ReadyEvent> {};
+    while (true) {
+        auto result = attempt();
+        if (result.is_ok()) return Polled::Ready(rstd::move(result));
+
+        auto error = rstd::move(result).unwrap_err_unchecked();
+        if (! net_is_would_block(error)) return Polled::Ready(Err(rstd::move(error)));
+
+        if (event.is_some()) {
+            auto previous = event.take();
+            registration.clear_readiness(rstd::move(previous).unwrap_unchecked());
+        }
+
+        auto ready = registration.poll_readiness(cx, interest, waiter_id);
+        if (ready.is_pending()) return Polled::Pending();
+
+        waiter_id         = 0;
+        auto ready_result = rstd::move(ready).take();
+        if (ready_result.is_err()) {
+            return Polled::Ready(Err(rstd::move(ready_result).unwrap_err_unchecked()));
+        }
+        event.insert(rstd::move(ready_result).unwrap_unchecked());
+    }
 }
 
 namespace rstd::net
@@ -41,10 +114,8 @@ export class TcpStream {
     TcpStream(Socket socket, async::Registration registration)
         : m_socket(rstd::move(socket)), m_registration(rstd::move(registration)) {}
 
+    // `socket` must already be nonblocking, as `Socket::tcp` and `Socket::accept` return it.
     static auto from_socket(Socket socket) -> io::Result<TcpStream> {
-        auto nonblocking = socket.set_nonblocking(true);
-        if (nonblocking.is_err()) return Err(rstd::move(nonblocking).unwrap_err_unchecked());
-
         auto registration = async::Registration::register_fd(socket.as_raw_fd());
         if (registration.is_err()) return Err(rstd::move(registration).unwrap_err_unchecked());
         return Ok(TcpStream { rstd::move(socket), rstd::move(registration).unwrap_unchecked() });
@@ -67,7 +138,7 @@ public:
         auto connect_result = socket.connect(addr);
         if (connect_result.is_err()) {
             auto error = rstd::move(connect_result).unwrap_err_unchecked();
-            if (! tcp_is_in_progress(error)) {
+            if (! net_is_in_progress(error)) {
                 co_return Err(rstd::move(error));
             }
             connecting = true;
@@ -97,7 +168,10 @@ public:
     }
 
     static auto from_owned_fd(sys::fd::OwnedFd fd) -> io::Result<TcpStream> {
-        return from_socket(Socket::from_owned_fd(rstd::move(fd)));
+        auto socket      = Socket::from_owned_fd(rstd::move(fd));
+        auto nonblocking = socket.set_nonblocking(true);
+        if (nonblocking.is_err()) return Err(rstd::move(nonblocking).unwrap_err_unchecked());
+        return from_socket(rstd::move(socket));
     }
 
     auto into_owned_fd() noexcept -> sys::fd::OwnedFd { return m_socket.into_owned_fd(); }
@@ -119,99 +193,40 @@ public:
     auto try_read(bytes::BytesMut& buf) -> io::Result<usize> {
         auto chunk  = buf.chunk_mut();
         auto result = m_socket.recv(chunk.as_raw_ptr(), chunk.len());
-        if (result.is_ok()) {
-            auto n = rstd::move(result).unwrap_unchecked();
-            buf.advance_mut(n);
-            return Ok(n);
-        }
-
-        auto error = rstd::move(result).unwrap_err_unchecked();
-        if (tcp_is_would_block(error)) {
-            m_registration.clear_readiness(async::Ready::readable());
-        }
-        return Err(rstd::move(error));
+        if (result.is_ok()) buf.advance_mut(*result);
+        return net_cleared(m_registration, rstd::move(result), async::Ready::readable());
     }
 
     auto try_write(bytes::Bytes const& buf) -> io::Result<usize> {
-        auto result = m_socket.send(buf.data(), buf.len());
-        if (result.is_ok()) return result;
-
-        auto error = rstd::move(result).unwrap_err_unchecked();
-        if (tcp_is_would_block(error)) {
-            m_registration.clear_readiness(async::Ready::writable());
-        }
-        return Err(rstd::move(error));
+        return net_cleared(
+            m_registration, m_socket.send(buf.data(), buf.len()), async::Ready::writable());
     }
 
     auto poll_read(mut_ref<TcpStream> self, task::Context& cx, bytes::BytesMut& buf)
         -> task::Poll<io::Result<usize>> {
         auto& stream = *self;
-        auto  event  = Option<async::ReadyEvent> {};
-        while (true) {
-            auto chunk  = buf.chunk_mut();
-            auto result = stream.m_socket.recv(chunk.as_raw_ptr(), chunk.len());
-            if (result.is_ok()) {
-                auto n = rstd::move(result).unwrap_unchecked();
-                buf.advance_mut(n);
-                return task::Poll<io::Result<usize>>::Ready(Ok(n));
-            }
-
-            auto error = rstd::move(result).unwrap_err_unchecked();
-            if (! tcp_is_would_block(error)) {
-                return task::Poll<io::Result<usize>>::Ready(Err(rstd::move(error)));
-            }
-
-            if (event.is_some()) {
-                auto previous = event.take();
-                stream.m_registration.clear_readiness(rstd::move(previous).unwrap_unchecked());
-            }
-
-            auto ready = stream.m_registration.poll_readiness(
-                cx, async::Interest::readable(), stream.m_read_waiter_id);
-            if (ready.is_pending()) return task::Poll<io::Result<usize>>::Pending();
-
-            stream.m_read_waiter_id = 0;
-            auto ready_result       = rstd::move(ready).take();
-            if (ready_result.is_err()) {
-                return task::Poll<io::Result<usize>>::Ready(
-                    Err(rstd::move(ready_result).unwrap_err_unchecked()));
-            }
-            event.insert(rstd::move(ready_result).unwrap_unchecked());
-        }
+        return net_poll_io(stream.m_registration,
+                           cx,
+                           async::Interest::readable(),
+                           stream.m_read_waiter_id,
+                           [&stream, &buf]() {
+                               auto chunk  = buf.chunk_mut();
+                               auto result = stream.m_socket.recv(chunk.as_raw_ptr(), chunk.len());
+                               if (result.is_ok()) buf.advance_mut(*result);
+                               return result;
+                           });
     }
 
     auto poll_write(mut_ref<TcpStream> self, task::Context& cx, bytes::Bytes const& buf)
         -> task::Poll<io::Result<usize>> {
         auto& stream = *self;
-        auto  event  = Option<async::ReadyEvent> {};
-        while (true) {
-            auto result = stream.m_socket.send(buf.data(), buf.len());
-            if (result.is_ok()) {
-                return task::Poll<io::Result<usize>>::Ready(rstd::move(result));
-            }
-
-            auto error = rstd::move(result).unwrap_err_unchecked();
-            if (! tcp_is_would_block(error)) {
-                return task::Poll<io::Result<usize>>::Ready(Err(rstd::move(error)));
-            }
-
-            if (event.is_some()) {
-                auto previous = event.take();
-                stream.m_registration.clear_readiness(rstd::move(previous).unwrap_unchecked());
-            }
-
-            auto ready = stream.m_registration.poll_readiness(
-                cx, async::Interest::writable(), stream.m_write_waiter_id);
-            if (ready.is_pending()) return task::Poll<io::Result<usize>>::Pending();
-
-            stream.m_write_waiter_id = 0;
-            auto ready_result        = rstd::move(ready).take();
-            if (ready_result.is_err()) {
-                return task::Poll<io::Result<usize>>::Ready(
-                    Err(rstd::move(ready_result).unwrap_err_unchecked()));
-            }
-            event.insert(rstd::move(ready_result).unwrap_unchecked());
-        }
+        return net_poll_io(stream.m_registration,
+                           cx,
+                           async::Interest::writable(),
+                           stream.m_write_waiter_id,
+                           [&stream, &buf]() {
+                               return stream.m_socket.send(buf.data(), buf.len());
+                           });
     }
 
     auto poll_flush(mut_ref<TcpStream>, task::Context&) -> task::Poll<io::Result<empty>> {
@@ -231,24 +246,23 @@ export class TcpListener {
     TcpListener(Socket socket, async::Registration registration)
         : m_socket(rstd::move(socket)), m_registration(rstd::move(registration)) {}
 
-public:
-    TcpListener(const TcpListener&)                        = delete;
-    auto operator=(const TcpListener&) -> TcpListener&     = delete;
-    TcpListener(TcpListener&&) noexcept                    = default;
-    auto operator=(TcpListener&&) noexcept -> TcpListener& = default;
-
-    static auto bind(SocketAddr addr) -> io::Result<TcpListener> {
+    static auto bind_socket(SocketAddr const& addr, i32 backlog, bool reuse_port)
+        -> io::Result<TcpListener> {
         auto socket = Socket::tcp(addr);
         if (socket.is_err()) return Err(rstd::move(socket).unwrap_err_unchecked());
 
         auto raw   = rstd::move(socket).unwrap_unchecked();
         auto reuse = raw.set_reuseaddr(true);
         if (reuse.is_err()) return Err(rstd::move(reuse).unwrap_err_unchecked());
+        if (reuse_port) {
+            auto shared = raw.set_reuseport(true);
+            if (shared.is_err()) return Err(rstd::move(shared).unwrap_err_unchecked());
+        }
 
         auto bound = raw.bind(addr);
         if (bound.is_err()) return Err(rstd::move(bound).unwrap_err_unchecked());
 
-        auto listening = raw.listen();
+        auto listening = raw.listen(backlog);
         if (listening.is_err()) return Err(rstd::move(listening).unwrap_err_unchecked());
 
         auto registration = async::Registration::register_fd(raw.as_raw_fd());
@@ -257,59 +271,92 @@ public:
         return Ok(TcpListener { rstd::move(raw), rstd::move(registration).unwrap_unchecked() });
     }
 
-    auto local_addr() const -> io::Result<SocketAddr> { return m_socket.local_addr(); }
-
-    auto ready(async::Interest interest) -> async::ReadinessFuture {
-        return async::ReadinessFuture { m_registration, interest };
-    }
-
-    auto readable() -> async::ReadinessFuture { return ready(async::Interest::readable()); }
-
-    auto try_accept() -> io::Result<tuple<TcpStream, SocketAddr>> {
+    auto accept_ready() -> io::Result<Option<tuple<TcpStream, SocketAddr>>> {
         auto accepted = m_socket.accept();
         if (accepted.is_err()) {
             auto error = rstd::move(accepted).unwrap_err_unchecked();
-            if (tcp_is_would_block(error)) {
-                m_registration.clear_readiness(async::Ready::readable());
-            }
+            if (net_is_would_block(error)) return Ok(Option<tuple<TcpStream, SocketAddr>> {});
             return Err(rstd::move(error));
         }
 
         auto accepted_tuple = rstd::move(accepted).unwrap_unchecked();
-        auto socket         = rstd::move(accepted_tuple.template get<0>());
-        auto addr           = rstd::move(accepted_tuple.template get<1>());
-
-        auto stream = TcpStream::from_socket(rstd::move(socket));
+        auto stream = TcpStream::from_socket(rstd::move(accepted_tuple.template get<0>()));
         if (stream.is_err()) return Err(rstd::move(stream).unwrap_err_unchecked());
 
-        return Ok(tuple<TcpStream, SocketAddr> {
+        return Ok(Some(tuple<TcpStream, SocketAddr> {
             rstd::move(stream).unwrap_unchecked(),
-            rstd::move(addr),
-        });
+            rstd::move(accepted_tuple.template get<1>()),
+        }));
+    }
+
+public:
+    /// The listen backlog `bind` uses.
+    static constexpr i32 DEFAULT_BACKLOG { 128 };
+
+    TcpListener(const TcpListener&)                        = delete;
+    auto operator=(const TcpListener&) -> TcpListener&     = delete;
+    TcpListener(TcpListener&&) noexcept                    = default;
+    auto operator=(TcpListener&&) noexcept -> TcpListener& = default;
+
+    static auto bind(SocketAddr addr) -> io::Result<TcpListener> {
+        return bind_socket(addr, DEFAULT_BACKLOG, false);
+    }
+
+    /// Like `bind`, with a listen backlog of `backlog` pending connections, which the kernel
+    /// caps at `net.core.somaxconn`.
+    static auto bind_with_backlog(SocketAddr addr, i32 backlog) -> io::Result<TcpListener> {
+        return bind_socket(addr, backlog, false);
+    }
+
+    /// Binds `shards` listeners to `addr` with `SO_REUSEPORT`, so the kernel spreads incoming
+    /// connections across them. A listener's readiness is tied to the runtime worker that
+    /// first waits on it, so run listener `i`'s accept loop with `async::spawn_on(i, ...)` to
+    /// give every shard its own accept queue. A port of 0 is resolved by the first listener
+    /// and shared by the rest.
+    static auto bind_sharded(SocketAddr addr, usize shards, i32 backlog = DEFAULT_BACKLOG)
+        -> io::Result<Vec<TcpListener>> {
+        auto listeners = Vec<TcpListener>::with_capacity(shards);
+        for (usize i = 0; i < shards; ++i) {
+            auto listener = bind_socket(addr, backlog, true);
+            if (listener.is_err()) return Err(rstd::move(listener).unwrap_err_unchecked());
+            if (i == 0) {
+                auto local = listener->local_addr();
+                if (local.is_err()) return Err(rstd::move(local).unwrap_err_unchecked());
+                addr = rstd::move(local).unwrap_unchecked();
+            }
+            listeners.push(rstd::move(listener).unwrap_unchecked());
+        }
+        return Ok(rstd::move(listeners));
+    }
+
+    auto local_addr() const -> io::Result<SocketAddr> { return m_socket.local_addr(); }
+
+    auto ready(async::Interest interest) -> async::ReadinessFuture {
+        return async::ReadinessFuture { m_registration, interest };
+    }
+
+    auto readable() -> async::ReadinessFuture { return ready(async::Interest::readable()); }
+
+    auto try_accept() -> io::Result<tuple<TcpStream, SocketAddr>> {
+        auto accepted = accept_ready();
+        if (accepted.is_err()) return Err(rstd::move(accepted).unwrap_err_unchecked());
+
+        auto connection = rstd::move(accepted).unwrap_unchecked();
+        if (connection.is_none()) {
+            m_registration.clear_readiness(async::Ready::readable());
+            return Err(io::Error::from_kind(io::ErrorKind { io::ErrorKind::WouldBlock }));
+        }
+        return Ok(rstd::move(connection).unwrap_unchecked());
     }
 
     auto accept() -> async::coro<io::Result<tuple<TcpStream, SocketAddr>>> {
         auto event = Option<async::ReadyEvent> {};
         while (true) {
-            auto accepted = m_socket.accept();
-            if (accepted.is_ok()) {
-                auto accepted_tuple = rstd::move(accepted).unwrap_unchecked();
-                auto socket         = rstd::move(accepted_tuple.template get<0>());
-                auto addr           = rstd::move(accepted_tuple.template get<1>());
-
-                auto stream = TcpStream::from_socket(rstd::move(socket));
-                if (stream.is_err()) co_return Err(rstd::move(stream).unwrap_err_unchecked());
-
-                co_return Ok(tuple<TcpStream, SocketAddr> {
-                    rstd::move(stream).unwrap_unchecked(),
-                    rstd::move(addr),
-                });
-            }
+            auto accepted = accept_ready();
+            if (accepted.is_err()) co_return Err(rstd::move(accepted).unwrap_err_unchecked());
 
-            auto error = rstd::move(accepted).unwrap_err_unchecked();
-            if (! tcp_is_would_block(error)) {
-                co_return Err(rstd::move(error));
-            }
+            auto connection = rstd::move(accepted).unwrap_unchecked();
+            if (connection.is_some()) co_return Ok(rstd::move(connection).unwrap_unchecked());
 
             if (event.is_some()) {
                 auto previous = event.take();
@@ -323,6 +370,31 @@ public:
             event.insert(rstd::move(ready).unwrap_unchecked());
         }
     }
+
+    /// Waits for at least one connection, then drains the backlog without waiting again, up to
+    /// `max` connections per call. An error after the first connection ends the batch early;
+    /// a lasting one comes back from the next call.
+    auto accept_batch(usize max) -> async::coro<io::Result<Vec<tuple<TcpStream, SocketAddr>>>> {
+        auto batch = Vec<tuple<TcpStream, SocketAddr>>::make();
+        if (max == 0) co_return Ok(rstd::move(batch));
+
+        auto first = co_await accept();
+        if (first.is_err()) co_return Err(rstd::move(first).unwrap_err_unchecked());
+        batch.push(rstd::move(first).unwrap_unchecked());
+
+        while (batch.len() < max) {
+            auto accepted = accept_ready();
+            if (accepted.is_err()) break;
+
+            auto connection = rstd::move(accepted).unwrap_unchecked();
+            if (connection.is_none()) {
+                m_registration.clear_readiness(async::Ready::readable());
+                break;
+            }
+            batch.push(rstd::move(connection).unwrap_unchecked());
+        }
+        co_return Ok(rstd::move(batch));
+    }
 };
 
 static_assert(Impled<TcpStream, async::io::AsyncRead>);
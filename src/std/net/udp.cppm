@@ -0,0 +1,181 @@
+export module rstd:net.udp;
+export import :async;
+export import :bytes;
+export import :io;
+export import :sys.socket;
+import :net.tcp;
+
+namespace rstd::net
+{
+
+export using RecvMeta = sys::socket::RecvMeta;
+
+} // namespace rstd::net
+
+using namespace rstd::prelude;
+using rstd::sys::socket::RecvBuf;
+using rstd::sys::socket::SendBuf;
+using rstd::sys::socket::Socket;
+
+namespace rstd::net
+{
+
+/// A nonblocking UDP socket driven by the async runtime.
+///
+/// Besides one datagram per call, it moves up to `sys::socket::MAX_MMSG_BATCH` datagrams per
+/// syscall with `recv_batch`/`send_batch`, and lets the kernel split and coalesce datagrams
+/// with `send_segmented` and `set_gro` (UDP GSO and GRO, Linux 5.0+).
+export class UdpSocket {
+    Socket              m_socket;
+    async::Registration m_registration;
+
+    UdpSocket(Socket socket, async::Registration registration)
+        : m_socket(rstd::move(socket)), m_registration(rstd::move(registration)) {}
+
+    template<typename T, typename F>
+    auto retry(async::Interest interest, F attempt) -> async::coro<io::Result<T>> {
+        return net_retry<T>(m_registration, interest, rstd::move(attempt));
+    }
+
+    template<typename T>
+    auto cleared(io::Result<T> result, async::Ready ready) -> io::Result<T> {
+        return net_cleared(m_registration, rstd::move(result), ready);
+    }
+
+public:
+    UdpSocket(const UdpSocket&)                        = delete;
+    auto operator=(const UdpSocket&) -> UdpSocket&     = delete;
+    UdpSocket(UdpSocket&&) noexcept                    = default;
+    auto operator=(UdpSocket&&) noexcept -> UdpSocket& = default;
+
+    static auto bind(SocketAddr addr) -> io::Result<UdpSocket> {
+        auto socket = Socket::udp(addr);
+        if (socket.is_err()) return Err(rstd::move(socket).unwrap_err_unchecked());
+
+        auto raw   = rstd::move(socket).unwrap_unchecked();
+        auto bound = raw.bind(addr);
+        if (bound.is_err()) return Err(rstd::move(bound).unwrap_err_unchecked());
+
+        auto registration = async::Registration::register_fd(raw.as_raw_fd());
+        if (registration.is_err()) return Err(rstd::move(registration).unwrap_err_unchecked());
+
+        return Ok(UdpSocket { rstd::move(raw), rstd::move(registration).unwrap_unchecked() });
+    }
+
+    /// Sets the default peer for `send`-style calls without a target and filters received
+    /// datagrams to that peer. UDP connects complete immediately.
+    auto connect(SocketAddr const& addr) -> io::Result<empty> { return m_socket.connect(addr); }
+
+    auto local_addr() const -> io::Result<SocketAddr> { return m_socket.local_addr(); }
+    auto peer_addr() const -> io::Result<SocketAddr> { return m_socket.peer_addr(); }
+    auto take_error() -> io::Result<Option<io::Error>> { return m_socket.take_error(); }
+
+    /// Lets the kernel coalesce back-to-back datagrams of one flow into one receive, reported
+    /// through `RecvMeta::segment_size`; receive buffers should then hold 64 KiB.
+    auto set_gro(bool enabled) -> io::Result<empty> { return m_socket.set_udp_gro(enabled); }
+    /// Reports each datagram's IPv4 destination address in `RecvMeta::local_ip`; IPv6 sockets
+    /// get none.
+    auto set_recv_pktinfo(bool enabled) -> io::Result<empty> {
+        return m_socket.set_recv_pktinfo(enabled);
+    }
+    auto set_recv_timestamps(bool enabled) -> io::Result<empty> {
+        return m_socket.set_recv_timestamps(enabled);
+    }
+
+    auto ready(async::Interest interest) -> async::ReadinessFuture {
+        return async::ReadinessFuture { m_registration, interest };
+    }
+
+    auto readable() -> async::ReadinessFuture { return ready(async::Interest::readable()); }
+
+    auto writable() -> async::ReadinessFuture { return ready(async::Interest::writable()); }
+
+    auto try_send_to(bytes::Bytes const& buf, SocketAddr const& target) -> io::Result<usize> {
+        return cleared(m_socket.send_to(buf.data(), buf.len(), target), async::Ready::writable());
+    }
+
+    /// Receives one datagram into the spare capacity of `buf`, along with its metadata.
+    auto try_recv_from(bytes::BytesMut& buf) -> io::Result<RecvMeta> {
+        auto chunk = buf.chunk_mut();
+        auto meta  = m_socket.recv_msg(RecvBuf { chunk.as_raw_ptr(), chunk.len() });
+        if (meta.is_ok()) buf.advance_mut(meta->len);
+        return cleared(rstd::move(meta), async::Ready::readable());
+    }
+
+    auto send_to(bytes::Bytes const& buf, SocketAddr target) -> async::coro<io::Result<usize>> {
+        return retry<usize>(async::Interest::writable(), [this, &buf, target]() {
+            return try_send_to(buf, target);
+        });
+    }
+
+    auto recv_from(bytes::BytesMut& buf) -> async::coro<io::Result<RecvMeta>> {
+        return retry<RecvMeta>(async::Interest::readable(), [this, &buf]() {
+            return try_recv_from(buf);
+        });
+    }
+
+    /// Receives up to one datagram per buffer in `bufs` with a single `recvmmsg` call.
+    /// Datagram `i` is appended to `bufs[i]` and described by `metas[i]`; `metas` is
+    /// overwritten. Returns how many datagrams arrived.
+    auto try_recv_batch(Vec<bytes::BytesMut>& bufs, Vec<RecvMeta>& metas) -> io::Result<usize> {
+        usize count = bufs.len();
+        if (count > sys::socket::MAX_MMSG_BATCH) count = sys::socket::MAX_MMSG_BATCH;
+
+        RecvBuf  raw[sys::socket::MAX_MMSG_BATCH];
+        RecvMeta out[sys::socket::MAX_MMSG_BATCH];
+        for (usize i = 0; i < count; ++i) {
+            auto chunk = bufs[i].chunk_mut();
+            raw[i]     = RecvBuf { chunk.as_raw_ptr(), chunk.len() };
+        }
+
+        auto received = cleared(m_socket.recv_mmsg(raw, out, count), async::Ready::readable());
+        if (received.is_err()) return received;
+
+        metas.clear();
+        for (usize i = 0; i < *received; ++i) {
+            bufs[i].advance_mut(out[i].len);
+            metas.push(rstd::move(out[i]));
+        }
+        return received;
+    }
+
+    /// Sends every buffer in `bufs` as one datagram, to `target` or to the connected peer,
+    /// with a single `sendmmsg` call. Returns how many were sent, which may be fewer than
+    /// `bufs.len()`.
+    auto try_send_batch(Vec<bytes::Bytes> const& bufs, Option<SocketAddr> const& target)
+        -> io::Result<usize> {
+        usize count = bufs.len();
+        if (count > sys::socket::MAX_MMSG_BATCH) count = sys::socket::MAX_MMSG_BATCH;
+
+        SendBuf raw[sys::socket::MAX_MMSG_BATCH];
+        for (usize i = 0; i < count; ++i) raw[i] = SendBuf { bufs[i].data(), bufs[i].len() };
+        return cleared(m_socket.send_mmsg(raw, count, target), async::Ready::writable());
+    }
+
+    auto recv_batch(Vec<bytes::BytesMut>& bufs, Vec<RecvMeta>& metas)
+        -> async::coro<io::Result<usize>> {
+        return retry<usize>(async::Interest::readable(), [this, &bufs, &metas]() {
+            return try_recv_batch(bufs, metas);
+        });
+    }
+
+    auto send_batch(Vec<bytes::Bytes> const& bufs, Option<SocketAddr> target)
+        -> async::coro<io::Result<usize>> {
+        return retry<usize>(async::Interest::writable(), [this, &bufs, target]() {
+            return try_send_batch(bufs, target);
+        });
+    }
+
+    /// Sends `buf` as datagrams of `segment_size` bytes, the last one possibly shorter, with a
+    /// single syscall; the kernel or the NIC does the split (UDP GSO). `buf` may hold at most
+    /// 64 segments.
+    auto send_segmented(bytes::Bytes const& buf, u16 segment_size, Option<SocketAddr> target)
+        -> async::coro<io::Result<usize>> {
+        return retry<usize>(async::Interest::writable(), [this, &buf, segment_size, target]() {
+            return cleared(m_socket.send_segmented(buf.data(), buf.len(), segment_size, target),
+                           async::Ready::writable());
+        });
+    }
+};
+
+} // namespace rstd::net
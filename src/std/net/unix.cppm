@@ -0,0 +1,431 @@
+export module rstd:net.unix;
+export import :async;
+export import :bytes;
+export import :io;
+export import :path;
+export import :sys.socket;
+import :net.tcp;
+
+namespace rstd::net
+{
+
+export using PeerCred = sys::socket::PeerCred;
+
+} // namespace rstd::net
+
+using namespace rstd::prelude;
+using rstd::sys::socket::Socket;
+
+inline auto unix_path_addr(ref<rstd::path::Path> path)
+    -> rstd::io::Result<rstd::net::SocketAddr> {
+    auto bytes = slice<u8>::from_raw_parts(path.data(), path.len());
+    return rstd::net::SocketAddr::from_unix_path(bytes);
+}
+
+inline auto unix_register(Socket& socket) -> rstd::io::Result<rstd::async::Registration> {
+    return rstd::async::Registration::register_fd(socket.as_raw_fd());
+}
+
+namespace rstd::net
+{
+
+/// A connected Unix stream socket driven by the async runtime.
+///
+/// Besides bytes, it carries file descriptors between processes (`send_with_fds` and
+/// `recv_with_fds`), for example to hand an accepted `TcpStream` to another process.
+export class UnixStream {
+    Socket              m_socket;
+    async::Registration m_registration;
+    usize               m_read_waiter_id {};
+    usize               m_write_waiter_id {};
+
+    friend class UnixListener;
+
+    UnixStream(Socket socket, async::Registration registration)
+        : m_socket(rstd::move(socket)), m_registration(rstd::move(registration)) {}
+
+    // `socket` must already be nonblocking.
+    static auto from_socket(Socket socket) -> io::Result<UnixStream> {
+        auto registration = unix_register(socket);
+        if (registration.is_err()) return Err(rstd::move(registration).unwrap_err_unchecked());
+        return Ok(UnixStream { rstd::move(socket), rstd::move(registration).unwrap_unchecked() });
+    }
+
+public:
+    UnixStream(const UnixStream&)                        = delete;
+    auto operator=(const UnixStream&) -> UnixStream&     = delete;
+    UnixStream(UnixStream&&) noexcept                    = default;
+    auto operator=(UnixStream&&) noexcept -> UnixStream& = default;
+
+    static auto connect(ref<path::Path> path) -> async::coro<io::Result<UnixStream>> {
+        auto addr = unix_path_addr(path);
+        if (addr.is_err()) co_return Err(rstd::move(addr).unwrap_err_unchecked());
+        co_return co_await connect_addr(rstd::move(addr).unwrap_unchecked());
+    }
+
+    /// Connects to `addr`, which may be an abstract address.
+    static auto connect_addr(SocketAddr addr) -> async::coro<io::Result<UnixStream>> {
+        auto socket_result = Socket::unix_socket(sys::libc::SOCK_STREAM);
+        if (socket_result.is_err()) {
+            co_return Err(rstd::move(socket_result).unwrap_err_unchecked());
+        }
+
+        auto socket         = rstd::move(socket_result).unwrap_unchecked();
+        bool connecting     = false;
+        auto connect_result = socket.connect(addr);
+        if (connect_result.is_err()) {
+            auto error = rstd::move(connect_result).unwrap_err_unchecked();
+            if (! net_is_in_progress(error)) {
+                co_return Err(rstd::move(error));
+            }
+            connecting = true;
+        }
+
+        auto stream_result = UnixStream::from_socket(rstd::move(socket));
+        if (stream_result.is_err()) {
+            co_return Err(rstd::move(stream_result).unwrap_err_unchecked());
+        }
+
+        auto stream = rstd::move(stream_result).unwrap_unchecked();
+        if (connecting) {
+            auto ready = co_await stream.writable();
+            if (ready.is_err()) co_return Err(rstd::move(ready).unwrap_err_unchecked());
+
+            auto socket_error = stream.m_socket.take_error();
+            if (socket_error.is_err()) {
+                co_return Err(rstd::move(socket_error).unwrap_err_unchecked());
+            }
+            auto error = rstd::move(socket_error).unwrap_unchecked();
+            if (error.is_some()) co_return Err(rstd::move(error).unwrap_unchecked());
+        }
+
+        co_return Ok(rstd::move(stream));
+    }
+
+    /// Two streams connected to each other, with no address.
+    static auto pair() -> io::Result<tuple<UnixStream, UnixStream>> {
+        auto sockets = Socket::unix_pair(sys::libc::SOCK_STREAM);
+        if (sockets.is_err()) return Err(rstd::move(sockets).unwrap_err_unchecked());
+
+        auto both  = rstd::move(sockets).unwrap_unchecked();
+        auto first = from_socket(rstd::move(both.template get<0>()));
+        if (first.is_err()) return Err(rstd::move(first).unwrap_err_unchecked());
+        auto second = from_socket(rstd::move(both.template get<1>()));
+        if (second.is_err()) return Err(rstd::move(second).unwrap_err_unchecked());
+
+        return Ok(tuple<UnixStream, UnixStream> { rstd::move(first).unwrap_unchecked(),
+                                                  rstd::move(second).unwrap_unchecked() });
+    }
+
+    static auto from_owned_fd(sys::fd::OwnedFd fd) -> io::Result<UnixStream> {
+        auto socket      = Socket::from_owned_fd(rstd::move(fd));
+        auto nonblocking = socket.set_nonblocking(true);
+        if (nonblocking.is_err()) return Err(rstd::move(nonblocking).unwrap_err_unchecked());
+        return from_socket(rstd::move(socket));
+    }
+
+    auto into_owned_fd() noexcept -> sys::fd::OwnedFd { return m_socket.into_owned_fd(); }
+
+    auto local_addr() const -> io::Result<SocketAddr> { return m_socket.local_addr(); }
+    auto peer_addr() const -> io::Result<SocketAddr> { return m_socket.peer_addr(); }
+    auto peer_cred() const -> io::Result<PeerCred> { return m_socket.peer_cred(); }
+    auto take_error() -> io::Result<Option<io::Error>> { return m_socket.take_error(); }
+    auto shutdown() -> io::Result<empty> { return m_socket.shutdown_write(); }
+
+    auto ready(async::Interest interest) -> async::ReadinessFuture {
+        return async::ReadinessFuture { m_registration, interest };
+    }
+
+    auto readable() -> async::ReadinessFuture { return ready(async::Interest::readable()); }
+
+    auto writable() -> async::ReadinessFuture { return ready(async::Interest::writable()); }
+
+    auto try_read(bytes::BytesMut& buf) -> io::Result<usize> {
+        auto chunk  = buf.chunk_mut();
+        auto result = m_socket.recv(chunk.as_raw_ptr(), chunk.len());
+        if (result.is_ok()) buf.advance_mut(*result);
+        return net_cleared(m_registration, rstd::move(result), async::Ready::readable());
+    }
+
+    auto try_write(bytes::Bytes const& buf) -> io::Result<usize> {
+        return net_cleared(m_registration,
+                           m_socket.send(buf.data(), buf.len()),
+                           async::Ready::writable());
+    }
+
+    /// Sends `buf`, which must not be empty, with `fds` attached; see
+    /// `sys::socket::Socket::send_with_fds`. The descriptors travel with the first byte, so on
+    /// a partial write the rest of `buf` is sent without them.
+    auto try_send_with_fds(bytes::Bytes const& buf, slice<sys::fd::RawFd> fds)
+        -> io::Result<usize> {
+        return net_cleared(m_registration,
+                           m_socket.send_with_fds(buf.data(), buf.len(), fds.p, fds.len()),
+                           async::Ready::writable());
+    }
+
+    /// Reads into the spare capacity of `buf` and appends any descriptors that came along to
+    /// `fds`, at most `sys::socket::MAX_PASSED_FDS` per call. More than that fails with
+    /// `InvalidData` and the descriptors of that message are closed.
+    auto try_recv_with_fds(bytes::BytesMut& buf, Vec<sys::fd::OwnedFd>& fds) -> io::Result<usize> {
+        sys::fd::RawFd raw[sys::socket::MAX_PASSED_FDS];
+
+        auto chunk  = buf.chunk_mut();
+        auto result = net_cleared(m_registration,
+                                  m_socket.recv_with_fds(chunk.as_raw_ptr(), chunk.len(), raw),
+                                  async::Ready::readable());
+        if (result.is_err()) return Err(rstd::move(result).unwrap_err_unchecked());
+
+        auto received = rstd::move(result).unwrap_unchecked();
+        for (usize i = 0; i < received.template get<1>(); ++i) {
+            fds.push(sys::fd::OwnedFd::from_raw_fd(raw[i]));
+        }
+        buf.advance_mut(received.template get<0>());
+        return Ok(received.template get<0>());
+    }
+
+    auto send_with_fds(bytes::Bytes const& buf, slice<sys::fd::RawFd> fds)
+        -> async::coro<io::Result<usize>> {
+        return net_retry<usize>(m_registration, async::Interest::writable(), [this, &buf, fds]() {
+            return try_send_with_fds(buf, fds);
+        });
+    }
+
+    auto recv_with_fds(bytes::BytesMut& buf, Vec<sys::fd::OwnedFd>& fds)
+        -> async::coro<io::Result<usize>> {
+        return net_retry<usize>(m_registration, async::Interest::readable(), [this, &buf, &fds]() {
+            return try_recv_with_fds(buf, fds);
+        });
+    }
+
+    auto poll_read(mut_ref<UnixStream> self, task::Context& cx, bytes::BytesMut& buf)
+        -> task::Poll<io::Result<usize>> {
+        auto& stream = *self;
+        return net_poll_io(stream.m_registration,
+                           cx,
+                           async::Interest::readable(),
+                           stream.m_read_waiter_id,
+                           [&stream, &buf]() {
+                               auto chunk  = buf.chunk_mut();
+                               auto result = stream.m_socket.recv(chunk.as_raw_ptr(), chunk.len());
+                               if (result.is_ok()) buf.advance_mut(*result);
+                               return result;
+                           });
+    }
+
+    auto poll_write(mut_ref<UnixStream> self, task::Context& cx, bytes::Bytes const& buf)
+        -> task::Poll<io::Result<usize>> {
+        auto& stream = *self;
+        return net_poll_io(stream.m_registration,
+                           cx,
+                           async::Interest::writable(),
+                           stream.m_write_waiter_id,
+                           [&stream, &buf]() {
+                               return stream.m_socket.send(buf.data(), buf.len());
+                           });
+    }
+
+    auto poll_flush(mut_ref<UnixStream>, task::Context&) -> task::Poll<io::Result<empty>> {
+        return task::Poll<io::Result<empty>>::Ready(Ok(empty {}));
+    }
+
+    auto poll_shutdown(mut_ref<UnixStream> self, task::Context&) -> task::Poll<io::Result<empty>> {
+        auto& stream = *self;
+        return task::Poll<io::Result<empty>>::Ready(stream.shutdown());
+    }
+};
+
+export class UnixListener {
+    Socket              m_socket;
+    async::Registration m_registration;
+
+    UnixListener(Socket socket, async::Registration registration)
+        : m_socket(rstd::move(socket)), m_registration(rstd::move(registration)) {}
+
+    auto accept_ready() -> io::Result<tuple<UnixStream, SocketAddr>> {
+        auto accepted = net_cleared(m_registration, m_socket.accept(), async::Ready::readable());
+        if (accepted.is_err()) return Err(rstd::move(accepted).unwrap_err_unchecked());
+
+        auto accepted_tuple = rstd::move(accepted).unwrap_unchecked();
+        auto stream = UnixStream::from_socket(rstd::move(accepted_tuple.template get<0>()));
+        if (stream.is_err()) return Err(rstd::move(stream).unwrap_err_unchecked());
+
+        return Ok(tuple<UnixStream, SocketAddr> {
+            rstd::move(stream).unwrap_unchecked(),
+            rstd::move(accepted_tuple.template get<1>()),
+        });
+    }
+
+public:
+    UnixListener(const UnixListener&)                        = delete;
+    auto operator=(const UnixListener&) -> UnixListener&     = delete;
+    UnixListener(UnixListener&&) noexcept                    = default;
+    auto operator=(UnixListener&&) noexcept -> UnixListener& = default;
+
+    /// Binds to the file at `path`, which must not exist yet; the file stays behind after the
+    /// listener is dropped.
+    static auto bind(ref<path::Path> path) -> io::Result<UnixListener> {
+        auto addr = unix_path_addr(path);
+        if (addr.is_err()) return Err(rstd::move(addr).unwrap_err_unchecked());
+        return bind_addr(rstd::move(addr).unwrap_unchecked());
+    }
+
+    /// Binds to `addr`, which may be an abstract address.
+    static auto bind_addr(SocketAddr addr) -> io::Result<UnixListener> {
+        auto socket = Socket::unix_socket(sys::libc::SOCK_STREAM);
+        if (socket.is_err()) return Err(rstd::move(socket).unwrap_err_unchecked());
+
+        auto raw   = rstd::move(socket).unwrap_unchecked();
+        auto bound = raw.bind(addr);
+        if (bound.is_err()) return Err(rstd::move(bound).unwrap_err_unchecked());
+
+        auto listening = raw.listen(TcpListener::DEFAULT_BACKLOG);
+        if (listening.is_err()) return Err(rstd::move(listening).unwrap_err_unchecked());
+
+        auto registration = unix_register(raw);
+        if (registration.is_err()) return Err(rstd::move(registration).unwrap_err_unchecked());
+
+        return Ok(UnixListener { rstd::move(raw), rstd::move(registration).unwrap_unchecked() });
+    }
+
+    auto local_addr() const -> io::Result<SocketAddr> { return m_socket.local_addr(); }
+
+    auto ready(async::Interest interest) -> async::ReadinessFuture {
+        return async::ReadinessFuture { m_registration, interest };
+    }
+
+    auto readable() -> async::ReadinessFuture { return ready(async::Interest::readable()); }
+
+    auto try_accept() -> io::Result<tuple<UnixStream, SocketAddr>> { return accept_ready(); }
+
+    auto accept() -> async::coro<io::Result<tuple<UnixStream, SocketAddr>>> {
+        return net_retry<tuple<UnixStream, SocketAddr>>(
+            m_registration, async::Interest::readable(), [this]() {
+                return accept_ready();
+            });
+    }
+};
+
+/// A Unix datagram socket driven by the async runtime. Datagrams keep their boundaries and,
+/// unlike UDP, are never dropped or reordered; a full peer makes sends wait.
+export class UnixDatagram {
+    Socket              m_socket;
+    async::Registration m_registration;
+
+    UnixDatagram(Socket socket, async::Registration registration)
+        : m_socket(rstd::move(socket)), m_registration(rstd::move(registration)) {}
+
+    static auto from_socket(Socket socket) -> io::Result<UnixDatagram> {
+        auto registration = unix_register(socket);
+        if (registration.is_err()) return Err(rstd::move(registration).unwrap_err_unchecked());
+        return Ok(UnixDatagram { rstd::move(socket), rstd::move(registration).unwrap_unchecked() });
+    }
+
+public:
+    UnixDatagram(const UnixDatagram&)                        = delete;
+    auto operator=(const UnixDatagram&) -> UnixDatagram&     = delete;
+    UnixDatagram(UnixDatagram&&) noexcept                    = default;
+    auto operator=(UnixDatagram&&) noexcept -> UnixDatagram& = default;
+
+    static auto bind(ref<path::Path> path) -> io::Result<UnixDatagram> {
+        auto addr = unix_path_addr(path);
+        if (addr.is_err()) return Err(rstd::move(addr).unwrap_err_unchecked());
+        return bind_addr(rstd::move(addr).unwrap_unchecked());
+    }
+
+    static auto bind_addr(SocketAddr addr) -> io::Result<UnixDatagram> {
+        auto socket = unbound();
+        if (socket.is_err()) return socket;
+
+        auto bound = socket->m_socket.bind(addr);
+        if (bound.is_err()) return Err(rstd::move(bound).unwrap_err_unchecked());
+        return socket;
+    }
+
+    /// A socket with no address; peers cannot reply to it.
+    static auto unbound() -> io::Result<UnixDatagram> {
+        auto socket = Socket::unix_socket(sys::libc::SOCK_DGRAM);
+        if (socket.is_err()) return Err(rstd::move(socket).unwrap_err_unchecked());
+        return from_socket(rstd::move(socket).unwrap_unchecked());
+    }
+
+    /// Two sockets connected to each other, with no address.
+    static auto pair() -> io::Result<tuple<UnixDatagram, UnixDatagram>> {
+        auto sockets = Socket::unix_pair(sys::libc::SOCK_DGRAM);
+        if (sockets.is_err()) return Err(rstd::move(sockets).unwrap_err_unchecked());
+
+        auto both  = rstd::move(sockets).unwrap_unchecked();
+        auto first = from_socket(rstd::move(both.template get<0>()));
+        if (first.is_err()) return Err(rstd::move(first).unwrap_err_unchecked());
+        auto second = from_socket(rstd::move(both.template get<1>()));
+        if (second.is_err()) return Err(rstd::move(second).unwrap_err_unchecked());
+
+        return Ok(tuple<UnixDatagram, UnixDatagram> { rstd::move(first).unwrap_unchecked(),
+                                                      rstd::move(second).unwrap_unchecked() });
+    }
+
+    auto connect(ref<path::Path> path) -> io::Result<empty> {
+        auto addr = unix_path_addr(path);
+        if (addr.is_err()) return Err(rstd::move(addr).unwrap_err_unchecked());
+        return m_socket.connect(*addr);
+    }
+
+    auto connect_addr(SocketAddr const& addr) -> io::Result<empty> {
+        return m_socket.connect(addr);
+    }
+
+    auto local_addr() const -> io::Result<SocketAddr> { return m_socket.local_addr(); }
+    auto peer_addr() const -> io::Result<SocketAddr> { return m_socket.peer_addr(); }
+    auto peer_cred() const -> io::Result<PeerCred> { return m_socket.peer_cred(); }
+
+    auto ready(async::Interest interest) -> async::ReadinessFuture {
+        return async::ReadinessFuture { m_registration, interest };
+    }
+
+    auto readable() -> async::ReadinessFuture { return ready(async::Interest::readable()); }
+
+    auto writable() -> async::ReadinessFuture { return ready(async::Interest::writable()); }
+
+    auto try_send(bytes::Bytes const& buf) -> io::Result<usize> {
+        return net_cleared(m_registration,
+                           m_socket.send(buf.data(), buf.len()),
+                           async::Ready::writable());
+    }
+
+    auto try_send_to(bytes::Bytes const& buf, SocketAddr const& target) -> io::Result<usize> {
+        return net_cleared(m_registration,
+                           m_socket.send_to(buf.data(), buf.len(), target),
+                           async::Ready::writable());
+    }
+
+    auto try_recv_from(bytes::BytesMut& buf) -> io::Result<tuple<usize, SocketAddr>> {
+        auto chunk  = buf.chunk_mut();
+        auto result = m_socket.recv_from(chunk.as_raw_ptr(), chunk.len());
+        if (result.is_ok()) buf.advance_mut(result->template get<0>());
+        return net_cleared(m_registration, rstd::move(result), async::Ready::readable());
+    }
+
+    auto send(bytes::Bytes const& buf) -> async::coro<io::Result<usize>> {
+        return net_retry<usize>(m_registration, async::Interest::writable(), [this, &buf]() {
+            return try_send(buf);
+        });
+    }
+
+    auto send_to(bytes::Bytes const& buf, SocketAddr target) -> async::coro<io::Result<usize>> {
+        return net_retry<usize>(
+            m_registration, async::Interest::writable(), [this, &buf, target]() {
+                return try_send_to(buf, target);
+            });
+    }
+
+    auto recv_from(bytes::BytesMut& buf) -> async::coro<io::Result<tuple<usize, SocketAddr>>> {
+        return net_retry<tuple<usize, SocketAddr>>(
+            m_registration, async::Interest::readable(), [this, &buf]() {
+                return try_recv_from(buf);
+            });
+    }
+};
+
+static_assert(Impled<UnixStream, async::io::AsyncRead>);
+static_assert(Impled<UnixStream, async::io::AsyncWrite>);
+
+} // namespace rstd::net
@@ -0,0 +1,509 @@
+module;
+#include <rstd/macro.hpp>
+export module rstd:par.iter;
+export import :par.pool;
+export import rstd.alloc;
+
+using ::alloc::vec::Vec;
+using namespace rstd::prelude;
+
+// Parallel iterators: a pipeline of adapters over a splittable source, driven by `join`.
+//
+// A producer is a source plus its adapters. It knows how many source positions it covers, can
+// split itself in two at a position, and can push all of its items into a sink sequentially.
+// A consumer is the terminal operation: it splits alongside the producer, folds one leaf into
+// a result, and combines the results of two halves.
+namespace rstd::par::plumbing
+{
+
+// Adaptive splitting: start with one split per worker, and whenever a half turns out to run on
+// a different worker than its parent (it was stolen, so somebody is idle), allow that many
+// splits again. Pipelines over cheap items therefore end up with few, large leaves, while
+// uneven work keeps being broken up where it is needed.
+struct Splitter {
+    usize splits;
+    usize min_len;
+
+    auto try_split(usize len, bool migrated) -> bool {
+        if (len / 2 < min_len) return false;
+        if (migrated) {
+            usize threads = current_num_threads();
+            splits        = splits / 2 > threads ? splits / 2 : threads;
+            return true;
+        }
+        if (splits == 0) return false;
+        splits /= 2;
+        return true;
+    }
+};
+
+template<typename P, typename C>
+auto bridge(P& producer, C& consumer, Splitter splitter, bool migrated) -> typename C::Result {
+    usize len = producer.len();
+    if (! splitter.try_split(len, migrated)) return consumer.consume(producer);
+
+    usize mid            = len / 2;
+    auto  right          = producer.split_off(mid);
+    auto  right_consumer = consumer.split_off(mid);
+    auto [left_result, right_result] = join_context(
+        [&](bool m) { return bridge(producer, consumer, splitter, m); },
+        [&](bool m) { return bridge(right, right_consumer, splitter, m); });
+    return consumer.reduce(rstd::move(left_result), rstd::move(right_result));
+}
+
+// ── Sources ─────────────────────────────────────────────────────────────
+
+template<typename T>
+struct SliceProducer {
+    using Item                    = const T&;
+    static constexpr bool INDEXED = true;
+
+    const T* p;
+    usize    n;
+
+    auto len() const -> usize { return n; }
+    auto split_off(usize mid) -> SliceProducer {
+        auto right = SliceProducer { p + mid, n - mid };
+        n          = mid;
+        return right;
+    }
+    template<typename S>
+    void drive(S& sink) {
+        for (usize i = 0; i < n; ++i) sink(p[i]);
+    }
+};
+
+template<typename T>
+struct SliceMutProducer {
+    using Item                    = T&;
+    static constexpr bool INDEXED = true;
+
+    T*    p;
+    usize n;
+
+    auto len() const -> usize { return n; }
+    auto split_off(usize mid) -> SliceMutProducer {
+        auto right = SliceMutProducer { p + mid, n - mid };
+        n          = mid;
+        return right;
+    }
+    template<typename S>
+    void drive(S& sink) {
+        for (usize i = 0; i < n; ++i) sink(p[i]);
+    }
+};
+
+// Moves the elements out of a buffer whose owning `Vec` no longer counts them.
+template<typename T>
+struct VecProducer {
+    using Item                    = T;
+    static constexpr bool INDEXED = true;
+
+    T*    p;
+    usize n;
+
+    auto len() const -> usize { return n; }
+    auto split_off(usize mid) -> VecProducer {
+        auto right = VecProducer { p + mid, n - mid };
+        n          = mid;
+        return right;
+    }
+    template<typename S>
+    void drive(S& sink) {
+        for (usize i = 0; i < n; ++i) {
+            sink(rstd::move(p[i]));
+            rstd::destroy_at(p + i);
+        }
+    }
+};
+
+template<typename T>
+struct RangeProducer {
+    using Item                    = T;
+    static constexpr bool INDEXED = true;
+
+    T     start;
+    usize n;
+
+    auto len() const -> usize { return n; }
+    auto split_off(usize mid) -> RangeProducer {
+        auto right = RangeProducer { T(start + T(mid)), n - mid };
+        n          = mid;
+        return right;
+    }
+    template<typename S>
+    void drive(S& sink) {
+        for (usize i = 0; i < n; ++i) sink(T(start + T(i)));
+    }
+};
+
+// Positions are chunks; only the last chunk may be shorter than `size`.
+template<typename T, typename Chunk>
+struct ChunksProducer {
+    using Item                    = Chunk;
+    static constexpr bool INDEXED = true;
+
+    T*    p;
+    usize n;
+    usize size;
+
+    auto len() const -> usize { return (n + size - 1) / size; }
+    auto split_off(usize mid) -> ChunksProducer {
+        usize at    = mid * size;
+        auto  right = ChunksProducer { p + at, n - at, size };
+        n           = at;
+        return right;
+    }
+    template<typename S>
+    void drive(S& sink) {
+        for (usize at = 0; at < n; at += size) {
+            sink(Chunk::from_raw_parts(p + at, n - at < size ? n - at : size));
+        }
+    }
+};
+
+// Keeps a consumed `Vec`'s buffer alive for the pipeline. `release` runs when a terminal
+// operation starts: from then on the producers own the elements and the vector only frees the
+// allocation.
+template<typename T>
+struct VecOwner {
+    Vec<T> vec;
+
+    void release() { vec.set_len_unchecked(0); }
+};
+
+struct NoOwner {
+    void release() {}
+};
+
+// ── Adapters ────────────────────────────────────────────────────────────
+
+template<typename P, typename F>
+struct MapProducer {
+    using Item                    = mtp::invoke_result_t<F&, typename P::Item>;
+    static constexpr bool INDEXED = P::INDEXED;
+
+    P base;
+    F f;
+
+    auto len() const -> usize { return base.len(); }
+    auto split_off(usize mid) -> MapProducer { return MapProducer { base.split_off(mid), f }; }
+    template<typename S>
+    void drive(S& sink) {
+        auto inner = [&](auto&& x) { sink(f(rstd::forward<decltype(x)>(x))); };
+        base.drive(inner);
+    }
+};
+
+template<typename P, typename F>
+struct FilterProducer {
+    using Item                    = typename P::Item;
+    static constexpr bool INDEXED = false;
+
+    P base;
+    F pred;
+
+    auto len() const -> usize { return base.len(); }
+    auto split_off(usize mid) -> FilterProducer {
+        return FilterProducer { base.split_off(mid), pred };
+    }
+    template<typename S>
+    void drive(S& sink) {
+        auto inner = [&](auto&& x) {
+            if (pred(x)) sink(rstd::forward<decltype(x)>(x));
+        };
+        base.drive(inner);
+    }
+};
+
+// Folds each leaf into one accumulator, so the pipeline yields one item per leaf.
+template<typename P, typename Id, typename F>
+struct FoldProducer {
+    using Item                    = mtp::invoke_result_t<Id&>;
+    static constexpr bool INDEXED = false;
+
+    P  base;
+    Id identity;
+    F  fold_op;
+
+    auto len() const -> usize { return base.len(); }
+    auto split_off(usize mid) -> FoldProducer {
+        return FoldProducer { base.split_off(mid), identity, fold_op };
+    }
+    template<typename S>
+    void drive(S& sink) {
+        Item acc   = identity();
+        auto inner = [&](auto&& x) {
+            acc = fold_op(rstd::move(acc), rstd::forward<decltype(x)>(x));
+        };
+        base.drive(inner);
+        sink(rstd::move(acc));
+    }
+};
+
+// ── Consumers ───────────────────────────────────────────────────────────
+
+template<typename F>
+struct ForEachConsumer {
+    using Result = empty;
+
+    F* f;
+
+    auto split_off(usize) -> ForEachConsumer { return *this; }
+    template<typename P>
+    auto consume(P& producer) -> Result {
+        auto sink = [this](auto&& x) { (*f)(rstd::forward<decltype(x)>(x)); };
+        producer.drive(sink);
+        return {};
+    }
+    auto reduce(empty, empty) -> Result { return {}; }
+};
+
+template<typename T, typename Id, typename Op>
+struct ReduceConsumer {
+    using Result = T;
+
+    Id* identity;
+    Op* op;
+
+    auto split_off(usize) -> ReduceConsumer { return *this; }
+    template<typename P>
+    auto consume(P& producer) -> Result {
+        T    acc  = (*identity)();
+        auto sink = [&](auto&& x) { acc = (*op)(rstd::move(acc), rstd::forward<decltype(x)>(x)); };
+        producer.drive(sink);
+        return acc;
+    }
+    auto reduce(T left, T right) -> Result { return (*op)(rstd::move(left), rstd::move(right)); }
+};
+
+// Writes items straight to their final slots; only valid for indexed producers, whose split
+// positions are item positions.
+template<typename T>
+struct CollectConsumer {
+    using Result = usize;
+
+    T*    dst;
+    usize n;
+
+    auto split_off(usize mid) -> CollectConsumer {
+        auto right = CollectConsumer { dst + mid, n - mid };
+        n          = mid;
+        return right;
+    }
+    template<typename P>
+    auto consume(P& producer) -> Result {
+        usize written = 0;
+        auto  sink    = [&](auto&& x) {
+            rstd::construct_at(dst + written, rstd::forward<decltype(x)>(x));
+            ++written;
+        };
+        producer.drive(sink);
+        return written;
+    }
+    auto reduce(usize left, usize right) -> Result { return left + right; }
+};
+
+// Collects each leaf into its own vector; the chunks are concatenated once at the end.
+template<typename T>
+struct ChunkListConsumer {
+    using Result = Vec<Vec<T>>;
+
+    auto split_off(usize) -> ChunkListConsumer { return *this; }
+    template<typename P>
+    auto consume(P& producer) -> Result {
+        auto chunk = Vec<T>::make();
+        auto sink  = [&](auto&& x) { chunk.push(T(rstd::forward<decltype(x)>(x))); };
+        producer.drive(sink);
+        auto out = Vec<Vec<T>>::make();
+        out.push(rstd::move(chunk));
+        return out;
+    }
+    auto reduce(Result left, Result right) -> Result {
+        left.append(right);
+        return left;
+    }
+};
+
+template<typename B>
+struct CollectTarget;
+
+template<typename T>
+struct CollectTarget<Vec<T>> {
+    using Elem = T;
+};
+
+} // namespace rstd::par::plumbing
+
+namespace rstd::par
+{
+
+/// A parallel iterator: a source with adapters, run on the global pool by a terminal method.
+///
+/// Adapter closures are copied into each piece of work and may run concurrently on several
+/// workers. Terminal methods return once every item was processed, so closures may borrow
+/// from the caller. Items of filtered or folded pipelines arrive at `collect` in source order
+/// as well.
+export template<typename P, typename Owner = plumbing::NoOwner>
+class ParIter {
+    P     m_producer;
+    Owner m_owner;
+    usize m_min_len { 1 };
+
+    template<typename, typename>
+    friend class ParIter;
+
+    template<typename C>
+    auto run(C& consumer) -> typename C::Result {
+        m_owner.release();
+        auto splitter = plumbing::Splitter { current_num_threads(), m_min_len };
+        return plumbing::bridge(m_producer, consumer, splitter, false);
+    }
+
+    template<typename Q>
+    auto with_producer(Q producer) -> ParIter<Q, Owner> {
+        auto out      = ParIter<Q, Owner>(rstd::move(producer), rstd::move(m_owner));
+        out.m_min_len = m_min_len;
+        return out;
+    }
+
+public:
+    using Item = typename P::Item;
+
+    ParIter(P producer, Owner owner)
+        : m_producer(rstd::move(producer)), m_owner(rstd::move(owner)) {}
+
+    /// Stops splitting below `min` source positions per piece of work.
+    auto with_min_len(usize min) && -> ParIter {
+        m_min_len = min == 0 ? 1 : min;
+        return rstd::move(*this);
+    }
+
+    /// Applies `f` to every item.
+    template<typename F>
+    auto map(F f) && {
+        return with_producer(plumbing::MapProducer<P, F> { rstd::move(m_producer), rstd::move(f) });
+    }
+
+    /// Keeps the items for which `pred` returns true.
+    template<typename F>
+    auto filter(F pred) && {
+        return with_producer(
+            plumbing::FilterProducer<P, F> { rstd::move(m_producer), rstd::move(pred) });
+    }
+
+    /// Folds each piece of work into an accumulator seeded by `identity()`, yielding one
+    /// accumulator per piece; follow with `reduce` or `sum` to combine them.
+    template<typename Id, typename F>
+    auto fold(Id identity, F fold_op) && {
+        return with_producer(plumbing::FoldProducer<P, Id, F> {
+            rstd::move(m_producer), rstd::move(identity), rstd::move(fold_op) });
+    }
+
+    /// Calls `f` on every item.
+    template<typename F>
+    void for_each(F f) && {
+        auto consumer = plumbing::ForEachConsumer<F> { &f };
+        (void)run(consumer);
+    }
+
+    /// Combines all items with `op`, seeding every piece of work with `identity()`. `op` must
+    /// be associative and `identity()` neutral for it, since the grouping is not fixed.
+    template<typename Id, typename Op>
+    auto reduce(Id identity, Op op) && -> mtp::invoke_result_t<Id&> {
+        using T       = mtp::invoke_result_t<Id&>;
+        auto consumer = plumbing::ReduceConsumer<T, Id, Op> { &identity, &op };
+        return run(consumer);
+    }
+
+    /// Adds up all items.
+    template<typename S = mtp::rm_cvf<Item>>
+    auto sum() && -> S {
+        return rstd::move(*this).reduce([] { return S {}; }, [](S a, S b) { return S(a + b); });
+    }
+
+    /// Counts the items.
+    auto count() && -> usize {
+        return rstd::move(*this).map([](auto&&) { return usize(1); }).sum();
+    }
+
+    /// Collects the items into a `Vec`, in source order.
+    ///
+    /// Pipelines without `filter` or `fold` know their length, so the vector is allocated once
+    /// and every worker writes straight into its part of it.
+    template<typename B>
+    auto collect() && -> B {
+        using T = typename plumbing::CollectTarget<B>::Elem;
+        if constexpr (P::INDEXED) {
+            usize n        = m_producer.len();
+            auto  out      = Vec<T>::with_capacity(n);
+            auto  consumer = plumbing::CollectConsumer<T> { out.begin(), n };
+            usize written  = run(consumer);
+            rstd_assert(written == n);
+            out.set_len_unchecked(n);
+            return out;
+        } else {
+            auto  consumer = plumbing::ChunkListConsumer<T> {};
+            auto  chunks   = run(consumer);
+            usize total    = 0;
+            for (usize i = 0; i < chunks.len(); ++i) total += chunks[i].len();
+            auto out = Vec<T>::with_capacity(total);
+            for (usize i = 0; i < chunks.len(); ++i) out.append(chunks[i]);
+            return out;
+        }
+    }
+};
+
+/// Iterates over `&T` of a slice in parallel.
+export template<typename T>
+auto par_iter(slice<T> s) -> ParIter<plumbing::SliceProducer<T>> {
+    return { plumbing::SliceProducer<T> { s.p, s.len() }, {} };
+}
+
+export template<typename T>
+auto par_iter(const Vec<T>& v) -> ParIter<plumbing::SliceProducer<T>> {
+    return par_iter(v.as_slice());
+}
+
+/// Iterates over `&mut T` of a slice in parallel.
+export template<typename T>
+auto par_iter_mut(mut_ref<T[]> s) -> ParIter<plumbing::SliceMutProducer<T>> {
+    return { plumbing::SliceMutProducer<T> { s.p, s.length }, {} };
+}
+
+export template<typename T>
+auto par_iter_mut(Vec<T>& v) -> ParIter<plumbing::SliceMutProducer<T>> {
+    return par_iter_mut(v.deref_mut());
+}
+
+/// Iterates over the elements of `v` by value in parallel; the buffer is freed when the
+/// pipeline is dropped.
+export template<typename T>
+auto into_par_iter(Vec<T> v) -> ParIter<plumbing::VecProducer<T>, plumbing::VecOwner<T>> {
+    auto producer = plumbing::VecProducer<T> { v.begin(), v.len() };
+    return { producer, plumbing::VecOwner<T> { rstd::move(v) } };
+}
+
+/// Iterates over the integers of `r` in parallel.
+export template<typename T>
+auto into_par_iter(iter::Range<T> r) -> ParIter<plumbing::RangeProducer<T>> {
+    usize n = r.fin > r.start ? usize(r.fin - r.start) : 0;
+    return { plumbing::RangeProducer<T> { r.start, n }, {} };
+}
+
+/// Iterates over `size`-element subslices of `s` in parallel; the last one may be shorter.
+export template<typename T>
+auto par_chunks(slice<T> s, usize size) -> ParIter<plumbing::ChunksProducer<const T, slice<T>>> {
+    rstd_assert(size != 0);
+    return { plumbing::ChunksProducer<const T, slice<T>> { s.p, s.len(), size }, {} };
+}
+
+/// Iterates over mutable `size`-element subslices of `s` in parallel.
+export template<typename T>
+auto par_chunks_mut(mut_ref<T[]> s, usize size)
+    -> ParIter<plumbing::ChunksProducer<T, mut_ref<T[]>>> {
+    rstd_assert(size != 0);
+    return { plumbing::ChunksProducer<T, mut_ref<T[]>> { s.p, s.length, size }, {} };
+}
+
+} // namespace rstd::par
@@ -0,0 +1,4 @@
+/// Data parallelism: `join` and parallel iterators on a global work-stealing pool.
+export module rstd:par;
+export import :par.pool;
+export import :par.iter;
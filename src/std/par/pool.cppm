@@ -0,0 +1,378 @@
+module;
+#include <rstd/macro.hpp>
+export module rstd:par.pool;
+export import :thread.functions;
+export import rstd.alloc;
+import :env;
+import :sync.condvar;
+import :sync.mutex;
+
+using ::alloc::vec::Vec;
+using rstd::sync::atomic::Atomic;
+using rstd::sync::atomic::fence;
+using namespace rstd::prelude;
+
+// The global work-stealing pool behind the parallel iterators.
+//
+// Every worker owns a deque of jobs. `join` pushes its second closure onto the calling
+// worker's deque, runs the first one, and then takes the second back unless an idle worker
+// stole it in the meantime. Jobs live on the stack of the thread that called `join`; a job
+// reference is only a pointer and an entry function, so scheduling never allocates.
+namespace rstd::par::pool
+{
+
+struct JobRef {
+    void* data;
+    void (*execute)(void*);
+
+    void run() const { execute(data); }
+};
+
+// Pending joins nest at most logarithmically deep, so a small fixed ring is enough. A push
+// onto a full ring fails and the caller runs the job itself.
+inline constexpr usize DEQUE_CAPACITY = 256;
+
+// Idle workers yield this many times before they go to sleep.
+inline constexpr usize SPIN_ROUNDS = 64;
+
+// A worker's job deque. The owner pushes and pops at the back, so it keeps working on the
+// most recent, cache-warm piece; thieves take from the front, which holds the largest pending
+// pieces. Each operation is a few instructions, so a spin lock guards it.
+struct alignas(64) Deque {
+    Atomic<bool>  locked { false };
+    Atomic<usize> head { 0 };
+    Atomic<usize> tail { 0 };
+    JobRef        slots[DEQUE_CAPACITY];
+
+    void lock() noexcept {
+        while (locked.exchange(true, Ordering::Acquire)) {
+            while (locked.load(Ordering::Relaxed)) rstd::hint::spin_loop();
+        }
+    }
+    void unlock() noexcept { locked.store(false, Ordering::Release); }
+
+    auto is_empty() const noexcept -> bool {
+        return head.load(Ordering::Relaxed) == tail.load(Ordering::Relaxed);
+    }
+
+    auto push(JobRef job) noexcept -> bool {
+        lock();
+        usize h = head.load(Ordering::Relaxed);
+        usize t = tail.load(Ordering::Relaxed);
+        bool  ok = t - h < DEQUE_CAPACITY;
+        if (ok) {
+            slots[t % DEQUE_CAPACITY] = job;
+            tail.store(t + 1, Ordering::Relaxed);
+        }
+        unlock();
+        return ok;
+    }
+
+    auto pop() noexcept -> Option<JobRef> {
+        lock();
+        usize h   = head.load(Ordering::Relaxed);
+        usize t   = tail.load(Ordering::Relaxed);
+        auto  out = Option<JobRef> {};
+        if (h != t) {
+            out = Some(slots[(t - 1) % DEQUE_CAPACITY]);
+            tail.store(t - 1, Ordering::Relaxed);
+        }
+        unlock();
+        return out;
+    }
+
+    auto steal() noexcept -> Option<JobRef> {
+        if (is_empty()) return None();
+        lock();
+        usize h   = head.load(Ordering::Relaxed);
+        usize t   = tail.load(Ordering::Relaxed);
+        auto  out = Option<JobRef> {};
+        if (h != t) {
+            out = Some(slots[h % DEQUE_CAPACITY]);
+            head.store(h + 1, Ordering::Relaxed);
+        }
+        unlock();
+        return out;
+    }
+};
+
+class Registry;
+
+inline thread_local Registry* CURRENT_REGISTRY { nullptr };
+inline thread_local usize     CURRENT_WORKER { 0 };
+
+class Registry {
+    usize                         m_num_threads;
+    Deque*                        m_deques;
+    sync::Mutex<Vec<JobRef>>      m_injected;
+    Atomic<usize>                 m_injected_len { 0 };
+    sync::Mutex<empty>            m_sleep_lock;
+    sync::Condvar                 m_wake;
+    Atomic<usize>                 m_sleeping { 0 };
+    Vec<thread::JoinHandle<void>> m_workers;
+
+public:
+    explicit Registry(usize num_threads)
+        : m_num_threads(num_threads),
+          m_deques(new Deque[num_threads]),
+          m_injected(Vec<JobRef>::make()),
+          m_sleep_lock(empty {}),
+          m_wake(sync::Condvar::make()),
+          m_workers(Vec<thread::JoinHandle<void>>::with_capacity(num_threads)) {}
+
+    Registry(const Registry&)            = delete;
+    Registry& operator=(const Registry&) = delete;
+
+    /// Returns the process-wide pool, starting its workers on first use.
+    ///
+    /// The pool has one worker per available core, or `RSTD_NUM_THREADS` workers when that
+    /// variable holds a positive number. It lives until the process exits.
+    static auto global() -> Registry& {
+        static Registry* registry = start();
+        return *registry;
+    }
+
+    auto num_threads() const noexcept -> usize { return m_num_threads; }
+
+    /// Returns the worker index of the calling thread if it belongs to this pool.
+    auto current_worker() const noexcept -> Option<usize> {
+        if (CURRENT_REGISTRY != this) return None();
+        return Some(CURRENT_WORKER);
+    }
+
+    auto deque(usize index) noexcept -> Deque& { return m_deques[index]; }
+
+    /// Queues a job from a thread outside the pool.
+    void inject(JobRef job) {
+        {
+            auto queue = m_injected.lock().unwrap_unchecked();
+            queue->push(job);
+            m_injected_len.fetch_add(1, Ordering::Relaxed);
+        }
+        notify_work();
+    }
+
+    /// Wakes one sleeping worker, if any, after new work was published.
+    void notify_work() {
+        // Pairs with the fence in `sleep`: either the sleeper sees the new job, or this sees
+        // the sleeper and wakes it.
+        fence(Ordering::SeqCst);
+        if (m_sleeping.load(Ordering::Relaxed) == 0) return;
+        auto guard = m_sleep_lock.lock().unwrap_unchecked();
+        m_wake.notify_one();
+    }
+
+    /// Finds a job for worker `index`: its own newest job first, then the oldest job of
+    /// another worker, then work injected from outside the pool.
+    auto find_work(usize index) -> Option<JobRef> {
+        if (auto job = m_deques[index].pop(); job.is_some()) return job;
+        for (usize i = 1; i < m_num_threads; ++i) {
+            auto job = m_deques[(index + i) % m_num_threads].steal();
+            if (job.is_some()) return job;
+        }
+        if (m_injected_len.load(Ordering::Relaxed) == 0) return None();
+        auto queue = m_injected.lock().unwrap_unchecked();
+        if (queue->is_empty()) return None();
+        m_injected_len.fetch_sub(1, Ordering::Relaxed);
+        return queue->pop();
+    }
+
+    /// Runs other jobs until `done()` holds, so a worker waiting on a stolen job keeps busy.
+    template<typename F>
+    void wait_until(usize index, F&& done) {
+        while (! done()) {
+            if (auto job = find_work(index); job.is_some()) {
+                job->run();
+            } else {
+                thread::yield_now();
+            }
+        }
+    }
+
+private:
+    static auto start() -> Registry* {
+        usize n = thread::available_parallelism();
+        if (auto var = env::var("RSTD_NUM_THREADS"); var.is_some()) {
+            usize parsed = 0;
+            auto  digits = rstd::str_::as_bytes(var->as_str());
+            for (usize i = 0; i < digits.len(); ++i) {
+                u8 c = digits[i];
+                if (c < '0' || c > '9') {
+                    parsed = 0;
+                    break;
+                }
+                parsed = parsed * 10 + usize(c - '0');
+            }
+            if (parsed > 0) n = parsed;
+        }
+
+        auto* registry = new Registry(n);
+        for (usize i = 0; i < n; ++i) {
+            auto spawned = thread::spawn([registry, i]() { registry->main_loop(i); });
+            if (spawned.is_err()) panic { "failed to spawn a parallel iterator worker" };
+            // The pool is never torn down, so the handles are never joined.
+            registry->m_workers.push(rstd::move(spawned).unwrap_unchecked());
+        }
+        return registry;
+    }
+
+    auto has_work() const noexcept -> bool {
+        if (m_injected_len.load(Ordering::Relaxed) != 0) return true;
+        for (usize i = 0; i < m_num_threads; ++i) {
+            if (! m_deques[i].is_empty()) return true;
+        }
+        return false;
+    }
+
+    void sleep() {
+        auto guard = m_sleep_lock.lock().unwrap_unchecked();
+        m_sleeping.fetch_add(1, Ordering::Relaxed);
+        fence(Ordering::SeqCst);
+        if (! has_work()) m_wake.wait(guard);
+        m_sleeping.fetch_sub(1, Ordering::Relaxed);
+    }
+
+    void main_loop(usize index) {
+        CURRENT_REGISTRY = this;
+        CURRENT_WORKER   = index;
+        usize idle       = 0;
+        while (true) {
+            if (auto job = find_work(index); job.is_some()) {
+                job->run();
+                idle = 0;
+            } else if (++idle < SPIN_ROUNDS) {
+                thread::yield_now();
+            } else {
+                sleep();
+                idle = 0;
+            }
+        }
+    }
+};
+
+// A job whose closure and result live on the stack of the thread that will wait for it.
+// `migrated` tells the closure whether it ended up on a different worker than the one that
+// created it, which drives adaptive splitting.
+template<typename F, typename R>
+struct StackJob {
+    F*           func;
+    usize        origin;
+    Option<R>    result;
+    Atomic<bool> done { false };
+
+    StackJob(F* f, usize worker): func(f), origin(worker) {}
+
+    static void execute(void* data) {
+        auto* job   = static_cast<StackJob*>(data);
+        job->result = Some((*job->func)(CURRENT_WORKER != job->origin));
+        // The waiting thread may free the job as soon as it sees `done`.
+        job->done.store(true, Ordering::Release);
+    }
+
+    auto as_job_ref() noexcept -> JobRef { return JobRef { this, &execute }; }
+    auto is_done() const noexcept -> bool { return done.load(Ordering::Acquire); }
+};
+
+// A job submitted from outside the pool; the submitting thread blocks on a condvar.
+template<typename F, typename R>
+struct InjectedJob {
+    F*                func;
+    Option<R>         result;
+    sync::Mutex<bool> finished;
+    sync::Condvar     finished_cvar;
+
+    explicit InjectedJob(F* f): func(f), finished(false), finished_cvar(sync::Condvar::make()) {}
+
+    static void execute(void* data) {
+        auto* job   = static_cast<InjectedJob*>(data);
+        job->result = Some((*job->func)(true));
+        auto guard  = job->finished.lock().unwrap_unchecked();
+        *guard      = true;
+        job->finished_cvar.notify_one();
+    }
+
+    auto as_job_ref() noexcept -> JobRef { return JobRef { this, &execute }; }
+
+    void wait() {
+        auto guard = finished.lock().unwrap_unchecked();
+        finished_cvar.wait_while(guard, [](bool done) { return ! done; });
+    }
+};
+
+template<typename F, typename... Args>
+auto call(F& f, Args... args) -> mtp::void_empty_t<mtp::invoke_result_t<F&, Args...>> {
+    if constexpr (mtp::is_void<mtp::invoke_result_t<F&, Args...>>) {
+        f(args...);
+        return empty {};
+    } else {
+        return f(args...);
+    }
+}
+
+// Runs `op(injected)` on a worker of `registry`: directly when already on one, otherwise by
+// injecting it and blocking until a worker has run it.
+template<typename F>
+auto in_worker(Registry& registry, F&& op) -> mtp::invoke_result_t<F&, bool> {
+    if (registry.current_worker().is_some()) return op(false);
+    using R  = mtp::invoke_result_t<F&, bool>;
+    auto job = InjectedJob<mtp::rm_ref<F>, R>(&op);
+    registry.inject(job.as_job_ref());
+    job.wait();
+    return rstd::move(job.result).unwrap_unchecked();
+}
+
+} // namespace rstd::par::pool
+
+namespace rstd::par
+{
+
+/// Returns the number of worker threads in the global pool.
+export inline auto current_num_threads() -> usize { return pool::Registry::global().num_threads(); }
+
+/// Runs `a` and `b`, potentially in parallel, and returns both results.
+///
+/// Both closures receive `migrated`, which is true when the closure runs on a different
+/// worker than the one that called `join_context` (or when the call came from outside the
+/// pool). `b` is offered to idle workers while the caller runs `a`; if nobody took it, the
+/// caller runs it too, so an unloaded pool costs one deque push and pop. Closures returning
+/// `void` produce `empty`.
+export template<typename A, typename B>
+auto join_context(A&& a, B&& b) {
+    using RA = mtp::void_empty_t<mtp::invoke_result_t<A&, bool>>;
+    using RB = mtp::void_empty_t<mtp::invoke_result_t<B&, bool>>;
+
+    auto& registry = pool::Registry::global();
+    return pool::in_worker(registry, [&](bool injected) -> rstd::tuple<RA, RB> {
+        usize index  = pool::CURRENT_WORKER;
+        auto  call_b = [&](bool migrated) { return pool::call(b, migrated); };
+        auto  job_b  = pool::StackJob<decltype(call_b), RB>(&call_b, index);
+        auto& deque  = registry.deque(index);
+
+        if (! deque.push(job_b.as_job_ref())) {
+            RA ra = pool::call(a, injected);
+            return rstd::tuple<RA, RB> { rstd::move(ra), call_b(false) };
+        }
+        registry.notify_work();
+
+        RA ra = pool::call(a, injected);
+        while (! job_b.is_done()) {
+            auto job = deque.pop();
+            if (job.is_none()) {
+                // Stolen: help with other work until the thief finishes it.
+                registry.wait_until(index, [&] { return job_b.is_done(); });
+                break;
+            }
+            if (job->data == &job_b) return rstd::tuple<RA, RB> { rstd::move(ra), call_b(false) };
+            job->run();
+        }
+        return rstd::tuple<RA, RB> { rstd::move(ra), rstd::move(job_b.result).unwrap_unchecked() };
+    });
+}
+
+/// Runs `a` and `b`, potentially in parallel, and returns both results.
+export template<typename A, typename B>
+auto join(A&& a, B&& b) {
+    return join_context([&](bool) { return a(); }, [&](bool) { return b(); });
+}
+
+} // namespace rstd::par
@@ -0,0 +1,114 @@
+module;
+#include <rstd/macro.hpp>
+export module rstd:slice;
+export import rstd.alloc;
+export import :thread.functions;
+
+using ::alloc::slice_::ScratchBuf;
+using ::alloc::vec::Vec;
+namespace sort_detail = rstd::slice_::sort_detail;
+using namespace rstd::prelude;
+
+namespace rstd::slice_::par_detail
+{
+
+// Chunks smaller than this are not worth a thread: spawning costs more than sorting them.
+inline constexpr usize MIN_CHUNK = usize(1) << 13;
+
+// Runs `job(0)` .. `job(count - 1)` concurrently and returns once all of them finished. Job 0
+// runs on the calling thread; a job whose thread fails to spawn runs inline too.
+template<typename F>
+void run_all(usize count, F& job) {
+    auto  handles = Vec<thread::JoinHandle<void>>::with_capacity(count);
+    auto* shared  = &job;
+    for (usize i = 1; i < count; i++) {
+        auto spawned = thread::spawn([shared, i]() { (*shared)(i); });
+        if (spawned.is_err()) {
+            job(i);
+            continue;
+        }
+        handles.push(rstd::move(spawned).unwrap_unchecked());
+    }
+    job(0);
+    while (! handles.is_empty()) {
+        auto handle = handles.pop().unwrap_unchecked();
+        (void)rstd::move(handle).join();
+    }
+}
+
+// Sorts equal chunks on `workers` threads, then merges neighbouring runs pairwise, each round
+// in parallel, until one run is left. Merging is stable, so a stable chunk sort makes the
+// whole sort stable.
+template<bool Stable, typename T, typename F>
+void par_sort(T* v, usize n, usize workers, F& is_less) {
+    usize chunks = n / MIN_CHUNK < workers ? n / MIN_CHUNK : workers;
+    if (chunks < 2) {
+        if constexpr (Stable) ::alloc::slice_::stable_sort_by_less(v, n, is_less);
+        else sort_detail::quicksort(v, n, is_less);
+        return;
+    }
+
+    auto bounds = Vec<usize>::with_capacity(chunks + 1);
+    for (usize i = 0; i <= chunks; i++) bounds.push(n * i / chunks);
+
+    auto sort_chunk = [&](usize i) {
+        T*    start = v + bounds[i];
+        usize len   = bounds[i + 1] - bounds[i];
+        if constexpr (Stable) ::alloc::slice_::stable_sort_by_less(start, len, is_less);
+        else sort_detail::quicksort(start, len, is_less);
+    };
+    run_all(chunks, sort_chunk);
+
+    // Each merge of [a, b) uses buf[a, b), so concurrent merges never share scratch.
+    ScratchBuf<T> buf(n);
+    while (bounds.len() > 2) {
+        usize runs       = bounds.len() - 1;
+        auto  merge_pair = [&](usize p) {
+            usize a = bounds[2 * p];
+            usize m = bounds[2 * p + 1];
+            usize b = bounds[2 * p + 2];
+            sort_detail::merge(v + a, m - a, b - a, buf.get() + a, is_less);
+        };
+        run_all(runs / 2, merge_pair);
+
+        auto next = Vec<usize>::with_capacity(runs / 2 + 2);
+        for (usize i = 0; i < bounds.len(); i += 2) next.push(bounds[i]);
+        if (runs % 2 == 1) next.push(n);
+        bounds = rstd::move(next);
+    }
+}
+
+} // namespace rstd::slice_::par_detail
+
+namespace rstd::slice_
+{
+
+/// Stable sort split across `workers` threads.
+///
+/// The slice is cut into one chunk per worker; chunks are sorted concurrently and then merged
+/// pairwise, each round of merges again in parallel. All threads are joined before this
+/// returns, so they may borrow the slice. Inputs too small to amortize a thread fall back to
+/// `sort`. Allocates `len` elements of scratch for the merges, and comparisons run on several
+/// threads at once.
+export template<typename T>
+void par_sort(mut_ref<T[]> v, usize workers) {
+    auto is_less = [](const T& a, const T& b) { return a < b; };
+    par_detail::par_sort<true>(v.p, v.length, workers, is_less);
+}
+
+/// `par_sort` with a three-way comparator returning an ordering (`a <=> b` style).
+export template<typename T, typename F>
+void par_sort_by(mut_ref<T[]> v, usize workers, F&& compare) {
+    auto is_less = [&compare](const T& a, const T& b) { return compare(a, b) < 0; };
+    par_detail::par_sort<true>(v.p, v.length, workers, is_less);
+}
+
+/// Like `par_sort`, but chunks are sorted with `sort_unstable`, so equal elements may be
+/// reordered and only the merge rounds allocate.
+export template<typename T>
+void par_sort_unstable(mut_ref<T[]> v, usize workers) {
+    auto is_less = [](const T& a, const T& b) { return a < b; };
+    par_detail::par_sort<false>(v.p, v.length, workers, is_less);
+}
+
+} // namespace rstd::slice_
@@ -15,5 +15,9 @@ export {
     using ::alloc::sync::ArcRaw;
     /// A weak reference to an Arc-managed allocation.
     using ::alloc::sync::Weak;
+    /// An Arc handle with non-atomic clones on its owner thread.
+    using ::alloc::sync::LocalArc;
+    /// A reference-counted header and slice behind one thin pointer.
+    using ::alloc::sync::ThinArc;
 }
 } // namespace rstd::sync
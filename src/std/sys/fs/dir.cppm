@@ -0,0 +1,152 @@
+module;
+#include <rstd/macro.hpp>
+export module rstd:sys.fs.dir;
+export import :io.error;
+export import :sys.fd;
+export import rstd.alloc;
+export import rstd.core;
+import :sys.libc;
+
+namespace rstd::sys::fs::dir
+{
+
+using rstd::io::Result;
+using rstd::io::error::Error;
+using rstd::sys::fd::OwnedFd;
+namespace libc = rstd::sys::libc;
+
+/// getdents64 buffer size. Large enough that a typical directory is read in one or two calls.
+export inline constexpr usize DEFAULT_BUF_SIZE = 64 * 1024;
+
+/// One record returned by getdents64.
+///
+/// `name` points into the reader's buffer and is only valid until the next call to
+/// `RawDir::next`. It is NUL-terminated, so it can go straight to the `*at` syscalls.
+export struct RawEntry {
+    u64         ino { 0 };
+    u8          d_type { 0 };
+    const char* name { nullptr };
+    usize       name_len { 0 };
+};
+
+#if RSTD_OS_LINUX
+
+// Fixed prefix of `struct linux_dirent64`, which glibc does not declare. The name follows at
+// byte 19; every record is padded to 8 bytes, so reading the whole prefix stays in bounds.
+struct Dirent64Head {
+    u64 d_ino;
+    i64 d_off;
+    u16 d_reclen;
+    u8  d_type;
+};
+inline constexpr usize DIRENT64_NAME_OFFSET = 19;
+
+/// Maps a `d_type` tag to `S_IFMT` bits, or 0 when the filesystem did not fill it in.
+export inline auto dtype_to_mode(u8 d_type) noexcept -> u32 {
+    switch (d_type) {
+    case libc::DT_REG: return u32(libc::S_IFREG);
+    case libc::DT_DIR: return u32(libc::S_IFDIR);
+    case libc::DT_LNK: return u32(libc::S_IFLNK);
+    case libc::DT_FIFO: return u32(libc::S_IFIFO);
+    case libc::DT_BLK: return u32(libc::S_IFBLK);
+    case libc::DT_CHR: return u32(libc::S_IFCHR);
+    case libc::DT_SOCK: return u32(libc::S_IFSOCK);
+    default: return 0;
+    }
+}
+
+/// Directory reader over an owned fd. Pulls many entries per getdents64 call instead of one
+/// `readdir` at a time, and exposes the fd so callers can `openat`/`fstatat` children by name.
+export class RawDir {
+    OwnedFd fd_;
+    Vec<u8> buf_;
+    usize   pos_ { 0 };
+    usize   end_ { 0 };
+    bool    eof_ { false };
+
+public:
+    RawDir() noexcept = default;
+    RawDir(OwnedFd fd, usize buf_size)
+        : fd_(rstd::move(fd)), buf_(Vec<u8>::with_capacity(buf_size)) {}
+
+    /// Opens `name` relative to `dirfd` as a directory. `AT_FDCWD` resolves against the cwd.
+    /// \param follow If false, a symlink at `name` fails with ELOOP/ENOTDIR instead of being
+    ///        followed.
+    static auto open_at(int dirfd, const char* name, bool follow,
+                        usize buf_size = DEFAULT_BUF_SIZE) -> Result<RawDir> {
+        int flags = libc::O_RDONLY | libc::O_DIRECTORY | libc::O_CLOEXEC;
+        if (! follow) flags |= libc::O_NOFOLLOW;
+        while (true) {
+            int fd = libc::openat(dirfd, name, flags);
+            if (fd >= 0) return Ok(RawDir { OwnedFd { fd }, buf_size });
+            if (libc::get_errno() == libc::EINTR) continue;
+            return Err(Error::from_raw_os_error(libc::get_errno()));
+        }
+    }
+
+    auto as_raw_fd() const noexcept -> int { return fd_.as_raw_fd(); }
+
+    /// Keeps only the fd, freeing the getdents64 buffer.
+    auto into_fd() && -> OwnedFd { return rstd::move(fd_); }
+
+    /// Returns the next entry, skipping "." and "..". `None` at end of stream.
+    auto next() -> Option<Result<RawEntry>> {
+        while (true) {
+            if (pos_ >= end_) {
+                if (eof_) return None();
+                auto filled = fill();
+                if (filled.is_err()) {
+                    eof_ = true;
+                    return Some(Result<RawEntry>(Err(filled.unwrap_err_unchecked())));
+                }
+                if (filled.unwrap_unchecked() == 0) {
+                    eof_ = true;
+                    return None();
+                }
+            }
+
+            const u8*    rec = buf_.begin() + pos_;
+            Dirent64Head head;
+            rstd::mem::memcpy(&head, rec, sizeof(head));
+            pos_ += head.d_reclen;
+
+            auto name = reinterpret_cast<const char*>(rec + DIRENT64_NAME_OFFSET);
+            if (name[0] == '.' && (name[1] == 0 || (name[1] == '.' && name[2] == 0))) continue;
+            return Some(Result<RawEntry>(Ok(RawEntry {
+                .ino      = head.d_ino,
+                .d_type   = head.d_type,
+                .name     = name,
+                .name_len = rstd::strlen(name),
+            })));
+        }
+    }
+
+    /// fstatat(2) on `name` inside this directory. Does not follow a final symlink unless
+    /// `follow` is set.
+    auto stat_at(const char* name, bool follow) const -> Result<libc::stat_t> {
+        libc::stat_t st {};
+        int          flags = follow ? 0 : libc::AT_SYMLINK_NOFOLLOW;
+        if (libc::fstatat(fd_.as_raw_fd(), name, &st, flags) < 0)
+            return Err(Error::from_raw_os_error(libc::get_errno()));
+        return Ok(st);
+    }
+
+private:
+    auto fill() -> Result<usize> {
+        while (true) {
+            auto n = libc::syscall(
+                libc::SYS_getdents64, fd_.as_raw_fd(), buf_.begin(), buf_.capacity());
+            if (n >= 0) {
+                pos_ = 0;
+                end_ = usize(n);
+                return Ok(end_);
+            }
+            if (libc::get_errno() == libc::EINTR) continue;
+            return Err(Error::from_raw_os_error(libc::get_errno()));
+        }
+    }
+};
+
+#endif
+
+} // namespace rstd::sys::fs::dir
@@ -0,0 +1,112 @@
+module;
+#include <rstd/macro.hpp>
+export module rstd:sys.io.kernel_copy;
+export import :io.error;
+export import rstd.core;
+import :sys.libc;
+
+namespace rstd::sys::io::kernel_copy
+{
+
+using rstd::io::Result;
+using rstd::io::error::Error;
+namespace libc = rstd::sys::libc;
+
+#if RSTD_OS_LINUX
+
+// Largest count the kernel moves per call (MAX_RW_COUNT); larger requests are clamped anyway.
+inline constexpr usize MAX_CHUNK = 0x7ffff000;
+
+enum class Strategy : u8
+{
+    CopyFileRange,
+    Sendfile,
+    Splice,
+};
+
+inline auto file_kind(int fd) noexcept -> Option<u32> {
+    libc::stat_t st {};
+    if (libc::fstat(fd, &st) < 0) return None();
+    return Some(u32(st.st_mode) & u32(libc::S_IFMT));
+}
+
+// Errnos meaning "this syscall cannot serve this fd pair", as opposed to a real I/O failure.
+inline auto is_unsupported(int err) noexcept -> bool {
+    return err == libc::ENOSYS || err == libc::EXDEV || err == libc::EINVAL ||
+           err == libc::EOPNOTSUPP || err == libc::EPERM || err == libc::EBADF ||
+           err == libc::ETXTBSY;
+}
+
+inline auto step(Strategy strategy, int reader, int writer) noexcept -> libc::ssize_t {
+    switch (strategy) {
+    case Strategy::CopyFileRange:
+        return libc::copy_file_range(reader, nullptr, writer, nullptr, MAX_CHUNK, 0);
+    case Strategy::Sendfile: return libc::sendfile(writer, reader, nullptr, MAX_CHUNK);
+    case Strategy::Splice: return libc::splice(reader, nullptr, writer, nullptr, MAX_CHUNK, 0);
+    }
+    return -1;
+}
+
+// Runs one strategy to EOF, producing `copy_fd`'s result. `None` means the kernel rejected it
+// before any byte moved, so the next strategy may be tried.
+inline auto drive(Strategy strategy, int reader, int writer) noexcept
+    -> Option<Result<Option<u64>>> {
+    u64 written = 0;
+    while (true) {
+        auto n = step(strategy, reader, writer);
+        if (n > 0) {
+            written += u64(n);
+            continue;
+        }
+        if (n == 0) {
+            // procfs/sysfs files report a zero size and copy_file_range returns 0 for them even
+            // when they have content; let the read/write loop decide whether the source is empty.
+            // sendfile reads them the same way, so no other strategy is tried.
+            if (written == 0 && strategy == Strategy::CopyFileRange) {
+                return Some(Result<Option<u64>>(Ok(Option<u64> {})));
+            }
+            return Some(Result<Option<u64>>(Ok(Some(written))));
+        }
+        auto err = libc::get_errno();
+        if (err == libc::EINTR) continue;
+        if (written == 0 && is_unsupported(err)) return None();
+        return Some(Result<Option<u64>>(Err(Error::from_raw_os_error(err))));
+    }
+}
+
+#endif
+
+/// Copies everything from `reader` to `writer` without bouncing through userspace.
+///
+/// Tries `copy_file_range` between regular files, then `sendfile` from a regular file or block
+/// device to any fd, then `splice` when either end is a pipe. Both fds' offsets advance as with
+/// `read`/`write`.
+/// \return `Ok(Some(n))` after reaching EOF, or `Ok(None)` if no in-kernel path applies (or
+///         `copy_file_range` saw a zero-length pseudo file) and the caller should fall back to
+///         a read/write loop. No bytes have moved in that case.
+export inline auto copy_fd(int reader, int writer) noexcept -> Result<Option<u64>> {
+#if RSTD_OS_LINUX
+    auto reader_kind = file_kind(reader);
+    auto writer_kind = file_kind(writer);
+    if (reader_kind.is_none() || writer_kind.is_none()) return Ok(Option<u64> {});
+
+    u32  in       = *reader_kind;
+    u32  out      = *writer_kind;
+    bool in_file  = in == u32(libc::S_IFREG) || in == u32(libc::S_IFBLK);
+    bool out_file = out == u32(libc::S_IFREG);
+    bool any_pipe = in == u32(libc::S_IFIFO) || out == u32(libc::S_IFIFO);
+
+    auto done = Option<Result<Option<u64>>> {};
+    if (in_file && out_file) done = drive(Strategy::CopyFileRange, reader, writer);
+    if (done.is_none() && in_file) done = drive(Strategy::Sendfile, reader, writer);
+    if (done.is_none() && any_pipe) done = drive(Strategy::Splice, reader, writer);
+    if (done.is_none()) return Ok(Option<u64> {});
+    return rstd::move(done).unwrap_unchecked();
+#else
+    (void)reader;
+    (void)writer;
+    return Ok(Option<u64> {});
+#endif
+}
+
+} // namespace rstd::sys::io::kernel_copy
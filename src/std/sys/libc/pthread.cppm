@@ -29,6 +29,7 @@ using ::pthread_condattr_t;
 using ::pthread_attr_init;
 using ::pthread_attr_destroy;
 using ::pthread_attr_setstacksize;
+using ::pthread_attr_setaffinity_np;
 using ::pthread_attr_t;
 
 using ::pthread_create;
@@ -40,6 +41,21 @@ using ::pthread_t;
 
 using ::pthread_setname_np;
 
+using ::cpu_set_t;
+using ::sched_getaffinity;
+inline constexpr ::size_t CPU_SET_CAPACITY = CPU_SETSIZE;
+
+inline auto cpu_set_single(::size_t cpu) noexcept -> cpu_set_t {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return set;
+}
+
+inline auto cpu_set_contains(const cpu_set_t& set, ::size_t cpu) noexcept -> bool {
+    return CPU_ISSET(cpu, &set) != 0;
+}
+
 constexpr auto pthread_mutex_initializer() noexcept -> pthread_mutex_t {
     return PTHREAD_MUTEX_INITIALIZER;
 }
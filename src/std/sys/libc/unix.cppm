@@ -6,14 +6,19 @@ module;
 #include <linux/futex.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
+#include <netinet/udp.h>
 #include <sys/syscall.h>
 #include <sys/wait.h>
 #include <sys/stat.h>
 #include <sys/epoll.h>
 #include <sys/eventfd.h>
 #include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/sendfile.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
+#include <sys/un.h>
 #include <sys/sysmacros.h>
 #include <sys/timerfd.h>
 #include <unistd.h>
@@ -25,6 +30,8 @@ module;
 #include <signal.h>
 #include <spawn.h>
 #include <fcntl.h>
+#include <linux/falloc.h>
+#include <limits.h>
 #include <dirent.h>
 #endif
 
@@ -32,6 +39,7 @@ export module rstd:sys.libc.unix;
 
 #ifdef RSTD_OS_LINUX
 inline constexpr auto _SYS_futex              = SYS_futex;
+inline constexpr auto _SYS_getdents64         = SYS_getdents64;
 inline constexpr auto _FUTEX_WAIT_BITSET      = FUTEX_WAIT_BITSET;
 inline constexpr auto _FUTEX_PRIVATE_FLAG     = FUTEX_PRIVATE_FLAG;
 inline constexpr auto _FUTEX_WAKE             = FUTEX_WAKE;
@@ -95,6 +103,7 @@ inline constexpr auto _ENOMEM       = ENOMEM;
 inline constexpr auto _ENOBUFS      = ENOBUFS;
 inline constexpr auto _EIO          = EIO;
 inline constexpr auto _EINPROGRESS  = EINPROGRESS;
+inline constexpr auto _EBADF        = EBADF;
 
 inline constexpr auto _SIGKILL = SIGKILL;
 
@@ -119,15 +128,34 @@ inline constexpr auto _SEEK_SET        = SEEK_SET;
 inline constexpr auto _SEEK_CUR        = SEEK_CUR;
 inline constexpr auto _SEEK_END        = SEEK_END;
 
-inline constexpr auto _AF_INET      = AF_INET;
-inline constexpr auto _AF_INET6     = AF_INET6;
-inline constexpr auto _SOCK_STREAM  = SOCK_STREAM;
-inline constexpr auto _SOL_SOCKET   = SOL_SOCKET;
-inline constexpr auto _SO_REUSEADDR = SO_REUSEADDR;
-inline constexpr auto _SO_ERROR     = SO_ERROR;
-inline constexpr auto _IPPROTO_TCP  = IPPROTO_TCP;
-inline constexpr auto _TCP_NODELAY  = TCP_NODELAY;
-inline constexpr auto _SHUT_WR      = SHUT_WR;
+inline constexpr auto _AF_INET         = AF_INET;
+inline constexpr auto _AF_INET6        = AF_INET6;
+inline constexpr auto _SOCK_STREAM     = SOCK_STREAM;
+inline constexpr auto _SOCK_DGRAM      = SOCK_DGRAM;
+inline constexpr auto _SOCK_NONBLOCK   = SOCK_NONBLOCK;
+inline constexpr auto _SOCK_CLOEXEC    = SOCK_CLOEXEC;
+inline constexpr auto _SOL_SOCKET      = SOL_SOCKET;
+inline constexpr auto _SO_REUSEADDR    = SO_REUSEADDR;
+inline constexpr auto _SO_REUSEPORT    = SO_REUSEPORT;
+inline constexpr auto _SO_ERROR        = SO_ERROR;
+inline constexpr auto _IPPROTO_TCP     = IPPROTO_TCP;
+inline constexpr auto _TCP_NODELAY     = TCP_NODELAY;
+inline constexpr auto _SHUT_WR         = SHUT_WR;
+inline constexpr auto _IPPROTO_IP      = IPPROTO_IP;
+inline constexpr auto _IPPROTO_UDP     = IPPROTO_UDP;
+inline constexpr auto _SOL_UDP         = SOL_UDP;
+inline constexpr auto _UDP_SEGMENT     = UDP_SEGMENT;
+inline constexpr auto _UDP_GRO         = UDP_GRO;
+inline constexpr auto _IP_PKTINFO      = IP_PKTINFO;
+inline constexpr auto _SO_TIMESTAMPNS  = SO_TIMESTAMPNS;
+inline constexpr auto _SCM_TIMESTAMPNS = SCM_TIMESTAMPNS;
+inline constexpr auto _MSG_TRUNC       = MSG_TRUNC;
+
+inline constexpr auto _AF_UNIX          = AF_UNIX;
+inline constexpr auto _SCM_RIGHTS       = SCM_RIGHTS;
+inline constexpr auto _SO_PEERCRED      = SO_PEERCRED;
+inline constexpr auto _MSG_CMSG_CLOEXEC = MSG_CMSG_CLOEXEC;
+inline constexpr auto _MSG_CTRUNC       = MSG_CTRUNC;
 #ifdef MSG_NOSIGNAL
 inline constexpr auto _MSG_NOSIGNAL = MSG_NOSIGNAL;
 #else
@@ -149,6 +177,7 @@ inline constexpr auto _EPOLLERR      = EPOLLERR;
 inline constexpr auto _EPOLL_CTL_ADD = EPOLL_CTL_ADD;
 inline constexpr auto _EPOLL_CTL_MOD = EPOLL_CTL_MOD;
 inline constexpr auto _EPOLL_CTL_DEL = EPOLL_CTL_DEL;
+inline constexpr auto _EPOLLET       = EPOLLET;
 inline constexpr auto _EFD_NONBLOCK  = EFD_NONBLOCK;
 inline constexpr auto _EFD_CLOEXEC   = EFD_CLOEXEC;
 inline constexpr auto _TFD_NONBLOCK  = TFD_NONBLOCK;
@@ -178,7 +207,55 @@ inline constexpr auto _LOCK_UN = LOCK_UN;
 
 inline constexpr auto _UTIME_OMIT = UTIME_OMIT;
 
+inline constexpr auto _AT_FDCWD            = AT_FDCWD;
+inline constexpr auto _AT_SYMLINK_NOFOLLOW = AT_SYMLINK_NOFOLLOW;
+inline constexpr auto _AT_REMOVEDIR        = AT_REMOVEDIR;
+
+inline constexpr auto _PROT_READ       = PROT_READ;
+inline constexpr auto _PROT_WRITE      = PROT_WRITE;
+inline constexpr auto _MAP_SHARED      = MAP_SHARED;
+inline constexpr auto _MAP_PRIVATE     = MAP_PRIVATE;
+inline constexpr auto _MAP_ANONYMOUS   = MAP_ANONYMOUS;
+inline constexpr auto _MAP_POPULATE    = MAP_POPULATE;
+inline constexpr auto _MADV_NORMAL     = MADV_NORMAL;
+inline constexpr auto _MADV_RANDOM     = MADV_RANDOM;
+inline constexpr auto _MADV_SEQUENTIAL = MADV_SEQUENTIAL;
+inline constexpr auto _MADV_WILLNEED   = MADV_WILLNEED;
+inline constexpr auto _MADV_DONTNEED   = MADV_DONTNEED;
+#ifdef MADV_HUGEPAGE
+inline constexpr auto _MADV_HUGEPAGE     = MADV_HUGEPAGE;
+inline constexpr bool _HAS_MADV_HUGEPAGE = true;
+#else
+inline constexpr auto _MADV_HUGEPAGE     = -1;
+inline constexpr bool _HAS_MADV_HUGEPAGE = false;
+#endif
+inline constexpr auto _MS_SYNC  = MS_SYNC;
+inline constexpr auto _MS_ASYNC = MS_ASYNC;
+#ifdef O_DIRECT
+inline constexpr auto _O_DIRECT     = O_DIRECT;
+inline constexpr bool _HAS_O_DIRECT = true;
+#else
+inline constexpr auto _O_DIRECT     = 0;
+inline constexpr bool _HAS_O_DIRECT = false;
+#endif
+inline constexpr auto _FALLOC_FL_KEEP_SIZE         = FALLOC_FL_KEEP_SIZE;
+inline constexpr auto _FALLOC_FL_PUNCH_HOLE        = FALLOC_FL_PUNCH_HOLE;
+inline constexpr auto _FALLOC_FL_ZERO_RANGE        = FALLOC_FL_ZERO_RANGE;
+inline constexpr auto _POSIX_FADV_NORMAL           = POSIX_FADV_NORMAL;
+inline constexpr auto _POSIX_FADV_SEQUENTIAL       = POSIX_FADV_SEQUENTIAL;
+inline constexpr auto _POSIX_FADV_RANDOM           = POSIX_FADV_RANDOM;
+inline constexpr auto _POSIX_FADV_NOREUSE          = POSIX_FADV_NOREUSE;
+inline constexpr auto _POSIX_FADV_WILLNEED         = POSIX_FADV_WILLNEED;
+inline constexpr auto _POSIX_FADV_DONTNEED         = POSIX_FADV_DONTNEED;
+inline constexpr auto _SYNC_FILE_RANGE_WAIT_BEFORE = SYNC_FILE_RANGE_WAIT_BEFORE;
+inline constexpr auto _SYNC_FILE_RANGE_WRITE       = SYNC_FILE_RANGE_WRITE;
+inline constexpr auto _SYNC_FILE_RANGE_WAIT_AFTER  = SYNC_FILE_RANGE_WAIT_AFTER;
+inline constexpr auto _IOV_MAX                     = IOV_MAX;
+// MAP_FAILED expands to a pointer cast, so it cannot be constexpr.
+inline void* const _MAP_FAILED = MAP_FAILED;
+
 #undef SYS_futex
+#undef SYS_getdents64
 #undef FUTEX_WAIT_BITSET
 #undef FUTEX_PRIVATE_FLAG
 #undef FUTEX_WAKE
@@ -228,6 +305,7 @@ inline constexpr auto _UTIME_OMIT = UTIME_OMIT;
 #undef ENOBUFS
 #undef EIO
 #undef EINPROGRESS
+#undef EBADF
 #undef SIGKILL
 #undef O_CLOEXEC
 #undef O_NONBLOCK
@@ -252,12 +330,30 @@ inline constexpr auto _UTIME_OMIT = UTIME_OMIT;
 #undef AF_INET
 #undef AF_INET6
 #undef SOCK_STREAM
+#undef SOCK_DGRAM
+#undef SOCK_NONBLOCK
+#undef SOCK_CLOEXEC
 #undef SOL_SOCKET
 #undef SO_REUSEADDR
+#undef SO_REUSEPORT
 #undef SO_ERROR
 #undef IPPROTO_TCP
 #undef TCP_NODELAY
 #undef SHUT_WR
+#undef IPPROTO_IP
+#undef IPPROTO_UDP
+#undef SOL_UDP
+#undef UDP_SEGMENT
+#undef UDP_GRO
+#undef IP_PKTINFO
+#undef SCM_TIMESTAMPNS
+#undef SO_TIMESTAMPNS
+#undef MSG_TRUNC
+#undef AF_UNIX
+#undef SCM_RIGHTS
+#undef SO_PEERCRED
+#undef MSG_CMSG_CLOEXEC
+#undef MSG_CTRUNC
 #undef MSG_NOSIGNAL
 #undef EPOLL_CLOEXEC
 #undef EPOLLIN
@@ -268,6 +364,7 @@ inline constexpr auto _UTIME_OMIT = UTIME_OMIT;
 #undef EPOLL_CTL_ADD
 #undef EPOLL_CTL_MOD
 #undef EPOLL_CTL_DEL
+#undef EPOLLET
 #undef EFD_NONBLOCK
 #undef EFD_CLOEXEC
 #undef TFD_NONBLOCK
@@ -292,6 +389,38 @@ inline constexpr auto _UTIME_OMIT = UTIME_OMIT;
 #undef LOCK_NB
 #undef LOCK_UN
 #undef UTIME_OMIT
+#undef AT_FDCWD
+#undef AT_SYMLINK_NOFOLLOW
+#undef AT_REMOVEDIR
+#undef PROT_READ
+#undef PROT_WRITE
+#undef MAP_SHARED
+#undef MAP_PRIVATE
+#undef MAP_ANONYMOUS
+#undef MAP_POPULATE
+#undef MAP_FAILED
+#undef MADV_NORMAL
+#undef MADV_RANDOM
+#undef MADV_SEQUENTIAL
+#undef MADV_WILLNEED
+#undef MADV_DONTNEED
+#undef MADV_HUGEPAGE
+#undef MS_SYNC
+#undef MS_ASYNC
+#undef O_DIRECT
+#undef FALLOC_FL_KEEP_SIZE
+#undef FALLOC_FL_PUNCH_HOLE
+#undef FALLOC_FL_ZERO_RANGE
+#undef POSIX_FADV_NORMAL
+#undef POSIX_FADV_SEQUENTIAL
+#undef POSIX_FADV_RANDOM
+#undef POSIX_FADV_NOREUSE
+#undef POSIX_FADV_WILLNEED
+#undef POSIX_FADV_DONTNEED
+#undef SYNC_FILE_RANGE_WAIT_BEFORE
+#undef SYNC_FILE_RANGE_WRITE
+#undef SYNC_FILE_RANGE_WAIT_AFTER
+#undef IOV_MAX
 
 inline auto _rstd_make_dev(unsigned int ma, unsigned int mi) noexcept -> ::dev_t {
     return makedev(ma, mi);
@@ -315,8 +444,10 @@ using ::posix_memalign;
 using ::htons;
 using ::htonl;
 using ::ntohs;
+using ::ntohl;
 
 inline constexpr auto SYS_futex              = _SYS_futex;
+inline constexpr auto SYS_getdents64         = _SYS_getdents64;
 inline constexpr auto FUTEX_WAIT_BITSET      = _FUTEX_WAIT_BITSET;
 inline constexpr auto FUTEX_PRIVATE_FLAG     = _FUTEX_PRIVATE_FLAG;
 inline constexpr auto FUTEX_WAKE             = _FUTEX_WAKE;
@@ -372,6 +503,7 @@ inline constexpr auto ENOMEM          = _ENOMEM;
 inline constexpr auto ENOBUFS         = _ENOBUFS;
 inline constexpr auto EIO             = _EIO;
 inline constexpr auto EINPROGRESS     = _EINPROGRESS;
+inline constexpr auto EBADF           = _EBADF;
 
 inline auto gmtime_utc(::time_t secs) noexcept -> ::tm {
     ::tm out {};
@@ -409,6 +541,13 @@ using ::kill;
 using ::lseek;
 using ::pread;
 using ::pwrite;
+using ::readv;
+using ::writev;
+using ::preadv;
+using ::pwritev;
+using ::fallocate;
+using ::posix_fadvise;
+using ::sync_file_range;
 using ::fsync;
 using ::fdatasync;
 using ::ftruncate;
@@ -432,7 +571,13 @@ using ::lstat;
 using ::opendir;
 using ::readdir;
 using ::closedir;
+using ::openat;
+using ::fstatat;
+using ::unlinkat;
 using ::rename;
+using ::copy_file_range;
+using ::sendfile;
+using ::splice;
 using ::free;
 using ::socket;
 using ::setsockopt;
@@ -440,8 +585,16 @@ using ::bind;
 using ::listen;
 using ::connect;
 using ::accept;
+using ::accept4;
 using ::recv;
 using ::send;
+using ::recvfrom;
+using ::sendto;
+using ::recvmsg;
+using ::sendmsg;
+using ::recvmmsg;
+using ::sendmmsg;
+using ::socketpair;
 using ::shutdown;
 using ::getsockopt;
 using ::getsockname;
@@ -452,6 +605,12 @@ using ::epoll_wait;
 using ::eventfd;
 using ::timerfd_create;
 using ::timerfd_settime;
+using ::mmap;
+using ::munmap;
+using ::madvise;
+using ::msync;
+using ::mprotect;
+using ::sysconf;
 
 // ── Type aliases ─────────────────────────────────────────────────────────
 using ::mode_t;
@@ -461,11 +620,18 @@ using ::time_t;
 using ::dev_t;
 using ::DIR;
 using ::dirent;
+using ::iovec;
 using ::sockaddr;
 using ::sockaddr_storage;
 using ::sockaddr_in;
 using ::sockaddr_in6;
 using ::socklen_t;
+using ::msghdr;
+using ::mmsghdr;
+using ::cmsghdr;
+using ::in_pktinfo;
+using ::sockaddr_un;
+using ::ucred;
 /// `struct stat` aliased to avoid clash with the `::stat()` function.
 using stat_t = struct ::stat;
 /// `struct timespec` aliased to avoid the `struct` keyword leaking into call sites.
@@ -498,12 +664,16 @@ inline constexpr auto SEEK_CUR        = _SEEK_CUR;
 inline constexpr auto SEEK_END        = _SEEK_END;
 
 // ── Sockets / epoll ─────────────────────────────────────────────────────
-inline constexpr auto AF_INET      = _AF_INET;
-inline constexpr auto AF_INET6     = _AF_INET6;
-inline constexpr auto SOCK_STREAM  = _SOCK_STREAM;
-inline constexpr auto SOL_SOCKET   = _SOL_SOCKET;
-inline constexpr auto SO_REUSEADDR = _SO_REUSEADDR;
-inline constexpr auto SO_ERROR     = _SO_ERROR;
+inline constexpr auto AF_INET       = _AF_INET;
+inline constexpr auto AF_INET6      = _AF_INET6;
+inline constexpr auto SOCK_STREAM   = _SOCK_STREAM;
+inline constexpr auto SOCK_DGRAM    = _SOCK_DGRAM;
+inline constexpr auto SOCK_NONBLOCK = _SOCK_NONBLOCK;
+inline constexpr auto SOCK_CLOEXEC  = _SOCK_CLOEXEC;
+inline constexpr auto SOL_SOCKET    = _SOL_SOCKET;
+inline constexpr auto SO_REUSEADDR  = _SO_REUSEADDR;
+inline constexpr auto SO_REUSEPORT  = _SO_REUSEPORT;
+inline constexpr auto SO_ERROR      = _SO_ERROR;
 [[maybe_unused]]
 inline constexpr auto IPPROTO_TCP = _IPPROTO_TCP;
 inline constexpr auto TCP_NODELAY = _TCP_NODELAY;
@@ -512,6 +682,31 @@ inline constexpr auto SHUT_WR = _SHUT_WR;
 [[maybe_unused]]
 inline constexpr auto MSG_NOSIGNAL = _MSG_NOSIGNAL;
 
+inline constexpr auto IPPROTO_IP      = _IPPROTO_IP;
+inline constexpr auto IPPROTO_UDP     = _IPPROTO_UDP;
+inline constexpr auto SOL_UDP         = _SOL_UDP;
+inline constexpr auto UDP_SEGMENT     = _UDP_SEGMENT;
+inline constexpr auto UDP_GRO         = _UDP_GRO;
+inline constexpr auto IP_PKTINFO      = _IP_PKTINFO;
+inline constexpr auto SO_TIMESTAMPNS  = _SO_TIMESTAMPNS;
+inline constexpr auto SCM_TIMESTAMPNS = _SCM_TIMESTAMPNS;
+inline constexpr auto MSG_TRUNC       = _MSG_TRUNC;
+
+inline constexpr auto AF_UNIX          = _AF_UNIX;
+inline constexpr auto SCM_RIGHTS       = _SCM_RIGHTS;
+inline constexpr auto SO_PEERCRED      = _SO_PEERCRED;
+inline constexpr auto MSG_CMSG_CLOEXEC = _MSG_CMSG_CLOEXEC;
+inline constexpr auto MSG_CTRUNC       = _MSG_CTRUNC;
+
+// Control-message walkers; the `CMSG_*` macros they wrap do not cross the module boundary.
+inline auto cmsg_firsthdr(msghdr* msg) noexcept -> cmsghdr* { return CMSG_FIRSTHDR(msg); }
+inline auto cmsg_nxthdr(msghdr* msg, cmsghdr* cmsg) noexcept -> cmsghdr* {
+    return CMSG_NXTHDR(msg, cmsg);
+}
+inline auto cmsg_data(cmsghdr* cmsg) noexcept -> unsigned char* { return CMSG_DATA(cmsg); }
+inline constexpr auto cmsg_space(::size_t len) noexcept -> ::size_t { return CMSG_SPACE(len); }
+inline constexpr auto cmsg_len(::size_t len) noexcept -> ::size_t { return CMSG_LEN(len); }
+
 [[maybe_unused]]
 inline constexpr auto EPOLL_CLOEXEC  = _EPOLL_CLOEXEC;
 inline constexpr auto EPOLLIN        = _EPOLLIN;
@@ -523,6 +718,7 @@ inline constexpr auto EPOLLERR       = _EPOLLERR;
 inline constexpr auto EPOLL_CTL_ADD  = _EPOLL_CTL_ADD;
 inline constexpr auto EPOLL_CTL_MOD  = _EPOLL_CTL_MOD;
 inline constexpr auto EPOLL_CTL_DEL  = _EPOLL_CTL_DEL;
+inline constexpr auto EPOLLET        = _EPOLLET;
 [[maybe_unused]]
 inline constexpr auto EFD_NONBLOCK = _EFD_NONBLOCK;
 [[maybe_unused]]
@@ -567,6 +763,49 @@ inline constexpr auto LOCK_UN = _LOCK_UN;
 // ── utimensat sentinel ───────────────────────────────────────────────────
 inline constexpr auto UTIME_OMIT = _UTIME_OMIT;
 
+// ── *at(2) ───────────────────────────────────────────────────────────────
+inline constexpr auto AT_FDCWD            = _AT_FDCWD;
+inline constexpr auto AT_SYMLINK_NOFOLLOW = _AT_SYMLINK_NOFOLLOW;
+inline constexpr auto AT_REMOVEDIR        = _AT_REMOVEDIR;
+
+// ── mmap ─────────────────────────────────────────────────────────────────
+inline constexpr auto PROT_READ         = _PROT_READ;
+inline constexpr auto PROT_WRITE        = _PROT_WRITE;
+inline constexpr auto MAP_SHARED        = _MAP_SHARED;
+inline constexpr auto MAP_PRIVATE       = _MAP_PRIVATE;
+inline constexpr auto MAP_ANONYMOUS     = _MAP_ANONYMOUS;
+inline constexpr auto MAP_POPULATE      = _MAP_POPULATE;
+inline constexpr auto MADV_NORMAL       = _MADV_NORMAL;
+inline constexpr auto MADV_RANDOM       = _MADV_RANDOM;
+inline constexpr auto MADV_SEQUENTIAL   = _MADV_SEQUENTIAL;
+inline constexpr auto MADV_WILLNEED     = _MADV_WILLNEED;
+inline constexpr auto MADV_DONTNEED     = _MADV_DONTNEED;
+inline constexpr auto MADV_HUGEPAGE     = _MADV_HUGEPAGE;
+inline constexpr auto HAS_MADV_HUGEPAGE = _HAS_MADV_HUGEPAGE;
+inline constexpr auto MS_SYNC           = _MS_SYNC;
+inline constexpr auto MS_ASYNC          = _MS_ASYNC;
+/// `_SC_PAGESIZE` is an enumerator in glibc, so it needs no macro shim.
+inline constexpr auto SC_PAGESIZE       = ::_SC_PAGESIZE;
+inline constexpr auto SC_NPROCESSORS_ONLN = ::_SC_NPROCESSORS_ONLN;
+inline void* const    MAP_FAILED        = _MAP_FAILED;
+
+// ── fallocate / fadvise / sync_file_range / direct I/O ───────────────────
+inline constexpr auto O_DIRECT                    = _O_DIRECT;
+inline constexpr auto HAS_O_DIRECT                = _HAS_O_DIRECT;
+inline constexpr auto FALLOC_FL_KEEP_SIZE         = _FALLOC_FL_KEEP_SIZE;
+inline constexpr auto FALLOC_FL_PUNCH_HOLE        = _FALLOC_FL_PUNCH_HOLE;
+inline constexpr auto FALLOC_FL_ZERO_RANGE        = _FALLOC_FL_ZERO_RANGE;
+inline constexpr auto POSIX_FADV_NORMAL           = _POSIX_FADV_NORMAL;
+inline constexpr auto POSIX_FADV_SEQUENTIAL       = _POSIX_FADV_SEQUENTIAL;
+inline constexpr auto POSIX_FADV_RANDOM           = _POSIX_FADV_RANDOM;
+inline constexpr auto POSIX_FADV_NOREUSE          = _POSIX_FADV_NOREUSE;
+inline constexpr auto POSIX_FADV_WILLNEED         = _POSIX_FADV_WILLNEED;
+inline constexpr auto POSIX_FADV_DONTNEED         = _POSIX_FADV_DONTNEED;
+inline constexpr auto SYNC_FILE_RANGE_WAIT_BEFORE = _SYNC_FILE_RANGE_WAIT_BEFORE;
+inline constexpr auto SYNC_FILE_RANGE_WRITE       = _SYNC_FILE_RANGE_WRITE;
+inline constexpr auto SYNC_FILE_RANGE_WAIT_AFTER  = _SYNC_FILE_RANGE_WAIT_AFTER;
+inline constexpr auto IOV_MAX                     = _IOV_MAX;
+
 /// Returns an lvalue reference to the platform `errno`. Use to read and write.
 inline auto get_errno() noexcept -> int& {
     return errno;
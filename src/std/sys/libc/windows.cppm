@@ -41,7 +41,9 @@ inline constexpr auto _ERROR_OUTOFMEMORY                = ERROR_OUTOFMEMORY;
 inline constexpr auto _ERROR_NOT_SUPPORTED              = ERROR_NOT_SUPPORTED;
 inline constexpr auto _ERROR_CALL_NOT_IMPLEMENTED       = ERROR_CALL_NOT_IMPLEMENTED;
 inline constexpr auto _ERROR_IO_PENDING                 = ERROR_IO_PENDING;
+inline constexpr auto _ALL_PROCESSOR_GROUPS             = ALL_PROCESSOR_GROUPS;
 
+#undef ALL_PROCESSOR_GROUPS
 #undef ERROR_FILE_NOT_FOUND
 #undef ERROR_PATH_NOT_FOUND
 #undef ERROR_ACCESS_DENIED
@@ -83,6 +85,7 @@ export namespace rstd::sys::libc
 // ── Types ────────────────────────────────────────────────────────────────
 using ::HANDLE;
 using ::DWORD;
+using ::DWORD_PTR;
 using ::BOOL;
 using ::LARGE_INTEGER;
 using ::FILETIME;
@@ -101,6 +104,7 @@ constexpr auto    M_STD_OUTPUT_HANDLE                 = STD_OUTPUT_HANDLE;
 constexpr auto    M_STD_ERROR_HANDLE                  = STD_ERROR_HANDLE;
 constexpr auto    M_STACK_SIZE_PARAM_IS_A_RESERVATION = STACK_SIZE_PARAM_IS_A_RESERVATION;
 constexpr auto    M_CP_UTF8                           = CP_UTF8;
+constexpr auto    M_CREATE_SUSPENDED                  = CREATE_SUSPENDED;
 
 // ── Error ────────────────────────────────────────────────────────────────
 using ::GetLastError;
@@ -172,6 +176,12 @@ using ::Sleep;
 using ::SwitchToThread;
 using ::GetCurrentThread;
 using ::SetThreadDescription;
+using ::GetActiveProcessorCount;
+using ::GetCurrentProcess;
+using ::GetProcessAffinityMask;
+using ::SetThreadAffinityMask;
+using ::ResumeThread;
+inline constexpr auto ALL_PROCESSOR_GROUPS = _ALL_PROCESSOR_GROUPS;
 
 // ── IO ───────────────────────────────────────────────────────────────────
 using ::GetStdHandle;
@@ -21,6 +21,10 @@ inline auto socket_unsupported() noexcept -> SocketError {
     return SocketError::from_kind(SocketErrorKind { SocketErrorKind::Unsupported });
 }
 
+inline auto socket_invalid_input() noexcept -> SocketError {
+    return SocketError::from_kind(SocketErrorKind { SocketErrorKind::InvalidInput });
+}
+
 #if RSTD_OS_UNIX
 inline auto socket_last_error() noexcept -> SocketError {
     return SocketError::from_raw_os_error(rstd::sys::io::last_os_error());
@@ -40,10 +44,21 @@ inline auto socket_set_nonblocking(SocketRawFd fd, bool enabled) -> SocketResult
     return rstd::Ok(empty {});
 }
 
-inline auto socket_set_cloexec(SocketRawFd fd) -> SocketResult<empty> {
-    int flags = socket_libc::fcntl(fd, socket_libc::F_GETFD, 0);
-    if (flags < 0) return rstd::Err(socket_last_error());
-    if (socket_libc::fcntl(fd, socket_libc::F_SETFD, flags | socket_libc::FD_CLOEXEC) < 0) {
+// Sockets are created and accepted nonblocking and close-on-exec in the same syscall.
+inline constexpr int SOCKET_FLAGS = socket_libc::SOCK_NONBLOCK | socket_libc::SOCK_CLOEXEC;
+
+// Room for every control message a datagram can carry here: the packet info, the GRO segment
+// size and the receive timestamp.
+inline constexpr usize UDP_CONTROL_LEN =
+    socket_libc::cmsg_space(sizeof(socket_libc::in_pktinfo)) +
+    socket_libc::cmsg_space(sizeof(int)) + socket_libc::cmsg_space(sizeof(socket_libc::timespec_t));
+
+// Bytes of `sockaddr_un` before `sun_path`; an address length at most this is unnamed.
+inline constexpr usize UNIX_PATH_OFFSET = __builtin_offsetof(socket_libc::sockaddr_un, sun_path);
+
+inline auto socket_set_int_option(SocketRawFd fd, int level, int name, int value)
+    -> SocketResult<empty> {
+    if (socket_libc::setsockopt(fd, level, name, &value, sizeof(value)) < 0) {
         return rstd::Err(socket_last_error());
     }
     return rstd::Ok(empty {});
@@ -64,6 +79,31 @@ export struct Ipv4Addr {
     static constexpr auto any() noexcept -> Ipv4Addr { return make(0, 0, 0, 0); }
 };
 
+/// A buffer a batched receive fills: `len` writable bytes at `data`.
+export struct RecvBuf {
+    u8*   data;
+    usize len;
+};
+
+/// One datagram of a batched send.
+export struct SendBuf {
+    const u8* data;
+    usize     len;
+};
+
+/// Datagrams moved by one `recvmmsg`/`sendmmsg` call at most.
+export inline constexpr usize MAX_MMSG_BATCH { 64 };
+
+/// File descriptors passed along one message at most.
+export inline constexpr usize MAX_PASSED_FDS { 16 };
+
+/// The process on the other end of a Unix socket, as of its `connect` or `socketpair` call.
+export struct PeerCred {
+    i32 pid;
+    u32 uid;
+    u32 gid;
+};
+
 export class SocketAddr {
 #if RSTD_OS_UNIX
     socket_libc::sockaddr_storage m_storage {};
@@ -84,6 +124,37 @@ export class SocketAddr {
     auto len_ptr() noexcept -> socket_libc::socklen_t* { return &m_len; }
 #endif
 
+    // `offset` is 1 for abstract names, which start with a NUL byte.
+    static auto unix_addr(slice<u8> name, usize offset) -> SocketResult<SocketAddr> {
+#if RSTD_OS_UNIX
+        auto  out  = SocketAddr {};
+        auto& addr = *reinterpret_cast<socket_libc::sockaddr_un*>(&out.m_storage);
+        if (offset + name.len() == 0 || offset + name.len() > sizeof(addr.sun_path)) {
+            return Err(socket_invalid_input());
+        }
+        addr.sun_family = socket_libc::AF_UNIX;
+        rstd::mem::memcpy(addr.sun_path + offset, name.p, name.len());
+        out.m_len = socket_libc::socklen_t(UNIX_PATH_OFFSET + offset + name.len());
+        return Ok(rstd::move(out));
+#else
+        (void)name;
+        (void)offset;
+        return Err(socket_unsupported());
+#endif
+    }
+
+    // The bytes of `sun_path` in use, including an abstract name's leading NUL.
+    auto unix_name() const noexcept -> slice<u8> {
+#if RSTD_OS_UNIX
+        if (is_unix() && m_len > UNIX_PATH_OFFSET) {
+            auto const& addr = *reinterpret_cast<const socket_libc::sockaddr_un*>(&m_storage);
+            return slice<u8>::from_raw_parts(reinterpret_cast<const u8*>(addr.sun_path),
+                                             usize(m_len) - UNIX_PATH_OFFSET);
+        }
+#endif
+        return slice<u8>::from_raw_parts(nullptr, usize(0));
+    }
+
 public:
     static auto ipv4(Ipv4Addr ip, u16 port) noexcept -> SocketAddr {
         auto out = SocketAddr {};
@@ -109,6 +180,46 @@ public:
 
     static auto ipv4_any(u16 port) noexcept -> SocketAddr { return ipv4(Ipv4Addr::any(), port); }
 
+    /// A Unix socket address naming a file. Fails with `InvalidInput` if `path` is empty,
+    /// holds a NUL byte or does not fit `sun_path`.
+    static auto from_unix_path(slice<u8> path) -> SocketResult<SocketAddr> {
+        for (usize i = 0; i < path.len(); ++i) {
+            if (path.p[i] == 0) return Err(socket_invalid_input());
+        }
+        return unix_addr(path, 0);
+    }
+
+    /// A Unix socket address in Linux's abstract namespace, which needs no file and goes away
+    /// with the last socket bound to it. `name` excludes the leading NUL and may hold any byte.
+    static auto from_abstract_name(slice<u8> name) -> SocketResult<SocketAddr> {
+        return unix_addr(name, 1);
+    }
+
+    auto is_unix() const noexcept -> bool {
+#if RSTD_OS_UNIX
+        return family() == socket_libc::AF_UNIX;
+#else
+        return false;
+#endif
+    }
+
+    /// The file a Unix socket address names; `None` for other, abstract and unnamed addresses.
+    auto as_unix_path() const noexcept -> Option<slice<u8>> {
+        auto name = unix_name();
+        if (name.len() == 0 || name.p[0] == 0) return None();
+        usize len = 0;
+        while (len < name.len() && name.p[len] != 0) ++len;
+        return Some(slice<u8>::from_raw_parts(name.p, len));
+    }
+
+    /// The abstract name of a Unix socket address, without the leading NUL; `None` for other
+    /// addresses.
+    auto as_abstract_name() const noexcept -> Option<slice<u8>> {
+        auto name = unix_name();
+        if (name.len() == 0 || name.p[0] != 0) return None();
+        return Some(slice<u8>::from_raw_parts(name.p + 1, name.len() - 1));
+    }
+
     auto family() const noexcept -> i32 {
 #if RSTD_OS_UNIX
         return as_sockaddr()->sa_family;
@@ -157,16 +268,73 @@ public:
             return Ok(rstd::move(out));
         }
 
+        if (addr->sa_family == socket_libc::AF_UNIX) {
+            if (len < UNIX_PATH_OFFSET || len > sizeof(socket_libc::sockaddr_un)) {
+                return Err(
+                    SocketError::from_kind(SocketErrorKind { SocketErrorKind::InvalidInput }));
+            }
+            rstd::mem::memcpy(&out.m_storage, addr, len);
+            out.m_len = len;
+            return Ok(rstd::move(out));
+        }
+
         return Err(SocketError::from_kind(SocketErrorKind { SocketErrorKind::Unsupported }));
     }
 #endif
 };
 
+/// Where a datagram came from and what the kernel reported about it.
+export struct RecvMeta {
+    /// Bytes written to the buffer.
+    usize len { 0 };
+    /// The sender.
+    SocketAddr addr {};
+    /// With GRO on, the size of each datagram coalesced into the buffer, the last one possibly
+    /// shorter; 0 when the buffer holds a single datagram.
+    usize segment_size { 0 };
+    /// The datagram's destination address, with packet info on.
+    Option<Ipv4Addr> local_ip {};
+    /// The kernel's receive time since the Unix epoch, with timestamps on.
+    Option<rstd::time::Duration> timestamp {};
+    /// Whether the datagram did not fit the buffer and was cut short.
+    bool truncated { false };
+    /// Whether the control messages did not fit (`MSG_CTRUNC`); `segment_size`, `local_ip` and
+    /// `timestamp` may then be missing even though they were enabled.
+    bool control_truncated { false };
+};
+
 export class Socket {
     SocketOwnedFd m_fd;
 
     explicit Socket(SocketOwnedFd fd) noexcept: m_fd(rstd::move(fd)) {}
 
+#if RSTD_OS_UNIX
+    static void read_control(socket_libc::msghdr& msg, RecvMeta& meta) {
+        for (auto* cmsg = socket_libc::cmsg_firsthdr(&msg); cmsg != nullptr;
+             cmsg       = socket_libc::cmsg_nxthdr(&msg, cmsg)) {
+            auto* data = socket_libc::cmsg_data(cmsg);
+            if (cmsg->cmsg_level == socket_libc::SOL_UDP &&
+                cmsg->cmsg_type == socket_libc::UDP_GRO) {
+                int size = 0;
+                rstd::mem::memcpy(&size, data, sizeof(size));
+                meta.segment_size = usize(size);
+            } else if (cmsg->cmsg_level == socket_libc::IPPROTO_IP &&
+                       cmsg->cmsg_type == socket_libc::IP_PKTINFO) {
+                auto info = socket_libc::in_pktinfo {};
+                rstd::mem::memcpy(&info, data, sizeof(info));
+                u32 ip        = socket_libc::ntohl(info.ipi_addr.s_addr);
+                meta.local_ip =
+                    Some(Ipv4Addr::make(u8(ip >> 24), u8(ip >> 16), u8(ip >> 8), u8(ip)));
+            } else if (cmsg->cmsg_level == socket_libc::SOL_SOCKET &&
+                       cmsg->cmsg_type == socket_libc::SCM_TIMESTAMPNS) {
+                auto ts = socket_libc::timespec_t {};
+                rstd::mem::memcpy(&ts, data, sizeof(ts));
+                meta.timestamp = Some(rstd::time::Duration::new_(u64(ts.tv_sec), u32(ts.tv_nsec)));
+            }
+        }
+    }
+#endif
+
 public:
     Socket(const Socket&)                        = delete;
     auto operator=(const Socket&)                = delete;
@@ -191,19 +359,49 @@ public:
 
     static auto tcp(SocketAddr const& addr) -> SocketResult<Socket> {
 #if RSTD_OS_UNIX
-        int raw = socket_libc::socket(addr.family(), socket_libc::SOCK_STREAM, 0);
+        int raw = socket_libc::socket(addr.family(), socket_libc::SOCK_STREAM | SOCKET_FLAGS, 0);
         if (raw < 0) return Err(socket_last_error());
+        return Ok(Socket { SocketOwnedFd::from_raw_fd(raw) });
+#else
+        (void)addr;
+        return Err(socket_unsupported());
+#endif
+    }
 
-        auto fd      = SocketOwnedFd::from_raw_fd(raw);
-        auto cloexec = socket_set_cloexec(raw);
-        if (cloexec.is_err()) return Err(rstd::move(cloexec).unwrap_err_unchecked());
+    static auto udp(SocketAddr const& addr) -> SocketResult<Socket> {
+#if RSTD_OS_UNIX
+        int raw = socket_libc::socket(addr.family(), socket_libc::SOCK_DGRAM | SOCKET_FLAGS, 0);
+        if (raw < 0) return Err(socket_last_error());
+        return Ok(Socket { SocketOwnedFd::from_raw_fd(raw) });
+#else
+        (void)addr;
+        return Err(socket_unsupported());
+#endif
+    }
 
-        auto nonblock = socket_set_nonblocking(raw, true);
-        if (nonblock.is_err()) return Err(rstd::move(nonblock).unwrap_err_unchecked());
+    /// A Unix socket of `type`, `SOCK_STREAM` or `SOCK_DGRAM`.
+    static auto unix_socket(i32 type) -> SocketResult<Socket> {
+#if RSTD_OS_UNIX
+        int raw = socket_libc::socket(socket_libc::AF_UNIX, type | SOCKET_FLAGS, 0);
+        if (raw < 0) return Err(socket_last_error());
+        return Ok(Socket { SocketOwnedFd::from_raw_fd(raw) });
+#else
+        (void)type;
+        return Err(socket_unsupported());
+#endif
+    }
 
-        return Ok(Socket { rstd::move(fd) });
+    /// Two connected, unnamed Unix sockets of `type`.
+    static auto unix_pair(i32 type) -> SocketResult<tuple<Socket, Socket>> {
+#if RSTD_OS_UNIX
+        int raw[2] {};
+        if (socket_libc::socketpair(socket_libc::AF_UNIX, type | SOCKET_FLAGS, 0, raw) < 0) {
+            return Err(socket_last_error());
+        }
+        return Ok(tuple<Socket, Socket> { Socket { SocketOwnedFd::from_raw_fd(raw[0]) },
+                                          Socket { SocketOwnedFd::from_raw_fd(raw[1]) } });
 #else
-        (void)addr;
+        (void)type;
         return Err(socket_unsupported());
 #endif
     }
@@ -225,6 +423,25 @@ public:
 #endif
     }
 
+    /// Lets several sockets bind the same address, with the kernel spreading incoming
+    /// connections across the listening ones.
+    auto set_reuseport(bool enabled) -> SocketResult<empty> {
+#if RSTD_OS_UNIX
+        int value = enabled ? 1 : 0;
+        if (socket_libc::setsockopt(as_raw_fd(),
+                                    socket_libc::SOL_SOCKET,
+                                    socket_libc::SO_REUSEPORT,
+                                    &value,
+                                    sizeof(value)) < 0) {
+            return Err(socket_last_error());
+        }
+        return Ok(empty {});
+#else
+        (void)enabled;
+        return Err(socket_unsupported());
+#endif
+    }
+
     auto set_nodelay(bool enabled) -> SocketResult<empty> {
 #if RSTD_OS_UNIX
         int value = enabled ? 1 : 0;
@@ -282,17 +499,12 @@ public:
 #if RSTD_OS_UNIX
         auto addr  = SocketAddr {};
         addr.m_len = sizeof(addr.m_storage);
-        int raw    = socket_libc::accept(as_raw_fd(), addr.as_sockaddr(), addr.len_ptr());
+        int raw =
+            socket_libc::accept4(as_raw_fd(), addr.as_sockaddr(), addr.len_ptr(), SOCKET_FLAGS);
         if (raw < 0) return Err(socket_last_error());
 
-        auto fd      = SocketOwnedFd::from_raw_fd(raw);
-        auto cloexec = socket_set_cloexec(raw);
-        if (cloexec.is_err()) return Err(rstd::move(cloexec).unwrap_err_unchecked());
-
-        auto nonblock = socket_set_nonblocking(raw, true);
-        if (nonblock.is_err()) return Err(rstd::move(nonblock).unwrap_err_unchecked());
-
-        return Ok(tuple<Socket, SocketAddr> { Socket { rstd::move(fd) }, rstd::move(addr) });
+        return Ok(tuple<Socket, SocketAddr> { Socket { SocketOwnedFd::from_raw_fd(raw) },
+                                              rstd::move(addr) });
 #else
         return Err(socket_unsupported());
 #endif
@@ -322,6 +534,294 @@ public:
 #endif
     }
 
+    auto recv_from(u8* buf, usize len) -> SocketResult<tuple<usize, SocketAddr>> {
+#if RSTD_OS_UNIX
+        auto addr  = SocketAddr {};
+        addr.m_len = sizeof(addr.m_storage);
+        auto n =
+            socket_libc::recvfrom(as_raw_fd(), buf, len, 0, addr.as_sockaddr(), addr.len_ptr());
+        if (n < 0) return Err(socket_last_error());
+        return Ok(tuple<usize, SocketAddr> { usize(n), rstd::move(addr) });
+#else
+        (void)buf;
+        (void)len;
+        return Err(socket_unsupported());
+#endif
+    }
+
+    auto send_to(const u8* buf, usize len, SocketAddr const& addr) -> SocketResult<usize> {
+#if RSTD_OS_UNIX
+        auto n = socket_libc::sendto(
+            as_raw_fd(), buf, len, socket_libc::MSG_NOSIGNAL, addr.as_sockaddr(), addr.m_len);
+        if (n < 0) return Err(socket_last_error());
+        return Ok(usize(n));
+#else
+        (void)buf;
+        (void)len;
+        (void)addr;
+        return Err(socket_unsupported());
+#endif
+    }
+
+    /// Lets the kernel coalesce consecutive datagrams of one flow into a single receive; see
+    /// `RecvMeta::segment_size`.
+    auto set_udp_gro(bool enabled) -> SocketResult<empty> {
+#if RSTD_OS_UNIX
+        return socket_set_int_option(
+            as_raw_fd(), socket_libc::SOL_UDP, socket_libc::UDP_GRO, enabled ? 1 : 0);
+#else
+        (void)enabled;
+        return Err(socket_unsupported());
+#endif
+    }
+
+    /// Reports each datagram's destination address in `RecvMeta::local_ip`. IPv4 only: this
+    /// sets `IP_PKTINFO`, and IPv6 sockets get no packet info.
+    auto set_recv_pktinfo(bool enabled) -> SocketResult<empty> {
+#if RSTD_OS_UNIX
+        return socket_set_int_option(
+            as_raw_fd(), socket_libc::IPPROTO_IP, socket_libc::IP_PKTINFO, enabled ? 1 : 0);
+#else
+        (void)enabled;
+        return Err(socket_unsupported());
+#endif
+    }
+
+    /// Reports each datagram's kernel receive time in `RecvMeta::timestamp`.
+    auto set_recv_timestamps(bool enabled) -> SocketResult<empty> {
+#if RSTD_OS_UNIX
+        return socket_set_int_option(
+            as_raw_fd(), socket_libc::SOL_SOCKET, socket_libc::SO_TIMESTAMPNS, enabled ? 1 : 0);
+#else
+        (void)enabled;
+        return Err(socket_unsupported());
+#endif
+    }
+
+    /// Receives one datagram along with its control messages.
+    auto recv_msg(RecvBuf buf) -> SocketResult<RecvMeta> {
+        auto meta = RecvMeta {};
+        auto n    = recv_mmsg(&buf, &meta, 1);
+        if (n.is_err()) return Err(rstd::move(n).unwrap_err_unchecked());
+        return Ok(rstd::move(meta));
+    }
+
+    /// Receives up to `count` datagrams, at most `MAX_MMSG_BATCH`, with one syscall; datagram
+    /// `i` lands in `bufs[i]` and is described by `metas[i]`. Returns how many arrived, or
+    /// `WouldBlock` if none had.
+    auto recv_mmsg(const RecvBuf* bufs, RecvMeta* metas, usize count) -> SocketResult<usize> {
+#if RSTD_OS_UNIX
+        if (count > MAX_MMSG_BATCH) count = MAX_MMSG_BATCH;
+
+        socket_libc::mmsghdr msgs[MAX_MMSG_BATCH] {};
+        socket_libc::iovec   iovs[MAX_MMSG_BATCH] {};
+        alignas(socket_libc::cmsghdr) u8 control[MAX_MMSG_BATCH][UDP_CONTROL_LEN];
+        for (usize i = 0; i < count; ++i) {
+            metas[i]            = RecvMeta {};
+            metas[i].addr.m_len = sizeof(metas[i].addr.m_storage);
+            iovs[i].iov_base    = bufs[i].data;
+            iovs[i].iov_len     = bufs[i].len;
+            auto& hdr           = msgs[i].msg_hdr;
+            hdr.msg_name        = metas[i].addr.as_sockaddr();
+            hdr.msg_namelen     = metas[i].addr.m_len;
+            hdr.msg_iov         = &iovs[i];
+            hdr.msg_iovlen      = 1;
+            hdr.msg_control     = control[i];
+            hdr.msg_controllen  = UDP_CONTROL_LEN;
+        }
+
+        int n = socket_libc::recvmmsg(as_raw_fd(), msgs, unsigned(count), 0, nullptr);
+        if (n < 0) return Err(socket_last_error());
+
+        for (usize i = 0; i < usize(n); ++i) {
+            auto& hdr                  = msgs[i].msg_hdr;
+            metas[i].len               = msgs[i].msg_len;
+            metas[i].addr.m_len        = hdr.msg_namelen;
+            metas[i].truncated         = (hdr.msg_flags & socket_libc::MSG_TRUNC) != 0;
+            metas[i].control_truncated = (hdr.msg_flags & socket_libc::MSG_CTRUNC) != 0;
+            read_control(hdr, metas[i]);
+        }
+        return Ok(usize(n));
+#else
+        (void)bufs;
+        (void)metas;
+        (void)count;
+        return Err(socket_unsupported());
+#endif
+    }
+
+    /// Sends up to `count` datagrams, at most `MAX_MMSG_BATCH`, with one syscall, to `addr` or
+    /// to the connected peer. Returns how many were sent, which may be fewer than `count`.
+    auto send_mmsg(const SendBuf* bufs, usize count, Option<SocketAddr> const& addr)
+        -> SocketResult<usize> {
+#if RSTD_OS_UNIX
+        if (count > MAX_MMSG_BATCH) count = MAX_MMSG_BATCH;
+
+        socket_libc::mmsghdr msgs[MAX_MMSG_BATCH] {};
+        socket_libc::iovec   iovs[MAX_MMSG_BATCH] {};
+        for (usize i = 0; i < count; ++i) {
+            iovs[i].iov_base = const_cast<u8*>(bufs[i].data);
+            iovs[i].iov_len  = bufs[i].len;
+            auto& hdr        = msgs[i].msg_hdr;
+            hdr.msg_iov      = &iovs[i];
+            hdr.msg_iovlen   = 1;
+            if (addr.is_some()) {
+                hdr.msg_name    = const_cast<socket_libc::sockaddr*>(addr->as_sockaddr());
+                hdr.msg_namelen = addr->m_len;
+            }
+        }
+
+        int n =
+            socket_libc::sendmmsg(as_raw_fd(), msgs, unsigned(count), socket_libc::MSG_NOSIGNAL);
+        if (n < 0) return Err(socket_last_error());
+        return Ok(usize(n));
+#else
+        (void)bufs;
+        (void)count;
+        (void)addr;
+        return Err(socket_unsupported());
+#endif
+    }
+
+    /// Sends `len` bytes as consecutive datagrams of `segment_size` bytes, the last one
+    /// possibly shorter, with one syscall; the kernel or the NIC does the split (UDP GSO).
+    auto send_segmented(const u8* buf, usize len, u16 segment_size, Option<SocketAddr> const& addr)
+        -> SocketResult<usize> {
+#if RSTD_OS_UNIX
+        auto iov = socket_libc::iovec { const_cast<u8*>(buf), len };
+        alignas(socket_libc::cmsghdr) u8 control[socket_libc::cmsg_space(sizeof(u16))] {};
+
+        auto msg           = socket_libc::msghdr {};
+        msg.msg_iov        = &iov;
+        msg.msg_iovlen     = 1;
+        msg.msg_control    = control;
+        msg.msg_controllen = sizeof(control);
+        if (addr.is_some()) {
+            msg.msg_name    = const_cast<socket_libc::sockaddr*>(addr->as_sockaddr());
+            msg.msg_namelen = addr->m_len;
+        }
+
+        auto* cmsg       = socket_libc::cmsg_firsthdr(&msg);
+        cmsg->cmsg_level = socket_libc::SOL_UDP;
+        cmsg->cmsg_type  = socket_libc::UDP_SEGMENT;
+        cmsg->cmsg_len   = socket_libc::cmsg_len(sizeof(u16));
+        rstd::mem::memcpy(socket_libc::cmsg_data(cmsg), &segment_size, sizeof(u16));
+
+        auto n = socket_libc::sendmsg(as_raw_fd(), &msg, socket_libc::MSG_NOSIGNAL);
+        if (n < 0) return Err(socket_last_error());
+        return Ok(usize(n));
+#else
+        (void)buf;
+        (void)len;
+        (void)segment_size;
+        (void)addr;
+        return Err(socket_unsupported());
+#endif
+    }
+
+    /// Sends `len` bytes with `count` file descriptors, at most `MAX_PASSED_FDS`, attached
+    /// (`SCM_RIGHTS`). The receiver gets its own descriptors for the same open files; the
+    /// caller's stay open. `len` must be at least 1 on stream sockets.
+    auto send_with_fds(const u8* buf, usize len, const SocketRawFd* fds, usize count)
+        -> SocketResult<usize> {
+#if RSTD_OS_UNIX
+        if (count > MAX_PASSED_FDS) return Err(socket_invalid_input());
+
+        auto iov = socket_libc::iovec { const_cast<u8*>(buf), len };
+        alignas(socket_libc::cmsghdr) u8 control[socket_libc::cmsg_space(
+            MAX_PASSED_FDS * sizeof(SocketRawFd))] {};
+
+        auto msg       = socket_libc::msghdr {};
+        msg.msg_iov    = &iov;
+        msg.msg_iovlen = 1;
+        if (count != 0) {
+            msg.msg_control    = control;
+            msg.msg_controllen = socket_libc::cmsg_space(count * sizeof(SocketRawFd));
+
+            auto* cmsg       = socket_libc::cmsg_firsthdr(&msg);
+            cmsg->cmsg_level = socket_libc::SOL_SOCKET;
+            cmsg->cmsg_type  = socket_libc::SCM_RIGHTS;
+            cmsg->cmsg_len   = socket_libc::cmsg_len(count * sizeof(SocketRawFd));
+            rstd::mem::memcpy(socket_libc::cmsg_data(cmsg), fds, count * sizeof(SocketRawFd));
+        }
+
+        auto n = socket_libc::sendmsg(as_raw_fd(), &msg, socket_libc::MSG_NOSIGNAL);
+        if (n < 0) return Err(socket_last_error());
+        return Ok(usize(n));
+#else
+        (void)buf;
+        (void)len;
+        (void)fds;
+        (void)count;
+        return Err(socket_unsupported());
+#endif
+    }
+
+    /// Receives up to `len` bytes and the file descriptors sent along with them into `fds`,
+    /// which must have room for `MAX_PASSED_FDS`. Received descriptors are close-on-exec and
+    /// owned by the caller. Returns the byte count and the descriptor count, or `InvalidData`
+    /// when the kernel truncated the descriptors (none are returned then).
+    auto recv_with_fds(u8* buf, usize len, SocketRawFd* fds) -> SocketResult<tuple<usize, usize>> {
+#if RSTD_OS_UNIX
+        auto iov = socket_libc::iovec { buf, len };
+        alignas(socket_libc::cmsghdr) u8 control[socket_libc::cmsg_space(
+            MAX_PASSED_FDS * sizeof(SocketRawFd))] {};
+
+        auto msg           = socket_libc::msghdr {};
+        msg.msg_iov        = &iov;
+        msg.msg_iovlen     = 1;
+        msg.msg_control    = control;
+        msg.msg_controllen = sizeof(control);
+
+        auto n = socket_libc::recvmsg(as_raw_fd(), &msg, socket_libc::MSG_CMSG_CLOEXEC);
+        if (n < 0) return Err(socket_last_error());
+
+        usize count = 0;
+        for (auto* cmsg = socket_libc::cmsg_firsthdr(&msg); cmsg != nullptr;
+             cmsg       = socket_libc::cmsg_nxthdr(&msg, cmsg)) {
+            if (cmsg->cmsg_level != socket_libc::SOL_SOCKET ||
+                cmsg->cmsg_type != socket_libc::SCM_RIGHTS) {
+                continue;
+            }
+            usize bytes = cmsg->cmsg_len - socket_libc::cmsg_len(0);
+            usize found = bytes / sizeof(SocketRawFd);
+            if (count + found > MAX_PASSED_FDS) found = MAX_PASSED_FDS - count;
+            rstd::mem::memcpy(
+                fds + count, socket_libc::cmsg_data(cmsg), found * sizeof(SocketRawFd));
+            count += found;
+        }
+
+        // The kernel dropped descriptors that did not fit; the ones that did are closed rather
+        // than handed out as a partial set.
+        if (msg.msg_flags & socket_libc::MSG_CTRUNC) {
+            for (usize i = 0; i < count; ++i) socket_libc::close(fds[i]);
+            return Err(SocketError::new_const(SocketErrorKind { SocketErrorKind::InvalidData },
+                                              "control message truncated"));
+        }
+        return Ok(tuple<usize, usize> { usize(n), count });
+#else
+        (void)buf;
+        (void)len;
+        (void)fds;
+        return Err(socket_unsupported());
+#endif
+    }
+
+    /// The credentials of the peer of a connected Unix socket (`SO_PEERCRED`).
+    auto peer_cred() const -> SocketResult<PeerCred> {
+#if RSTD_OS_UNIX
+        auto                   cred = socket_libc::ucred {};
+        socket_libc::socklen_t len  = sizeof(cred);
+        if (socket_libc::getsockopt(
+                as_raw_fd(), socket_libc::SOL_SOCKET, socket_libc::SO_PEERCRED, &cred, &len) < 0) {
+            return Err(socket_last_error());
+        }
+        return Ok(PeerCred { i32(cred.pid), u32(cred.uid), u32(cred.gid) });
+#else
+        return Err(socket_unsupported());
+#endif
+    }
+
     auto shutdown_write() -> SocketResult<empty> {
 #if RSTD_OS_UNIX
         if (socket_libc::shutdown(as_raw_fd(), socket_libc::SHUT_WR) < 0)
@@ -21,13 +21,22 @@ namespace rstd::sys::thread::unix
 export struct Thread {
     pthread_t id;
 
-    static auto make(usize stack, Box<ThreadInit>&& init) -> rstd::io::Result<Thread> {
+    static auto make(usize stack, Option<usize> cpu, Box<ThreadInit>&& init)
+        -> rstd::io::Result<Thread> {
+        if (cpu.is_some() && *cpu >= libc::CPU_SET_CAPACITY) {
+            return Err(rstd::io::error::Error::from_raw_os_error(libc::EINVAL));
+        }
+
         libc::pthread_attr_t attr {};
         rstd_assert_eq(libc::pthread_attr_init(&attr), 0);
 
         if (stack != 0) {
             rstd_assert_eq(libc::pthread_attr_setstacksize(&attr, stack), 0);
         }
+        if (cpu.is_some()) {
+            auto set = libc::cpu_set_single(*cpu);
+            rstd_assert_eq(libc::pthread_attr_setaffinity_np(&attr, sizeof(set), &set), 0);
+        }
 
         auto raw = rstd::move(init).into_raw();
 
@@ -76,6 +85,24 @@ export struct Thread {
     }
 
     static void yield_now() { libc::sched_yield(); }
+
+    static auto available_parallelism() -> usize {
+        auto n = libc::sysconf(libc::SC_NPROCESSORS_ONLN);
+        return n > 0 ? usize(n) : 1;
+    }
+
+    static auto affinity_cpus() -> rstd_alloc::vec::Vec<usize> {
+        auto cpus = rstd_alloc::vec::Vec<usize>::make();
+        auto set  = libc::cpu_set_t {};
+        if (libc::sched_getaffinity(0, sizeof(set), &set) != 0) {
+            for (usize i = 0; i < available_parallelism(); ++i) cpus.push(i);
+            return cpus;
+        }
+        for (usize i = 0; i < libc::CPU_SET_CAPACITY; ++i) {
+            if (libc::cpu_set_contains(set, i)) cpus.push(i);
+        }
+        return cpus;
+    }
 };
 
 }; // namespace rstd::sys::thread::unix
@@ -21,17 +21,23 @@ namespace rstd::sys::thread::windows
 export struct Thread {
     HANDLE handle;
 
-    static auto make(usize stack, Box<ThreadInit>&& init) -> rstd::io::Result<Thread> {
+    static auto make(usize stack, Option<usize> cpu, Box<ThreadInit>&& init)
+        -> rstd::io::Result<Thread> {
+        if (cpu.is_some() && *cpu >= sizeof(DWORD_PTR) * 8) {
+            return Err(rstd::io::error::Error::from_raw_os_error((i32)ERROR_INVALID_PARAMETER));
+        }
+
         auto raw = rstd::move(init).into_raw();
 
-        auto h = CreateThread(nullptr,
-                              stack,
-                              rstd_thread_start_win,
-                              raw.p,
-                              M_STACK_SIZE_PARAM_IS_A_RESERVATION,
-                              nullptr);
+        // A pinned thread starts suspended so it never runs a single instruction elsewhere.
+        auto flags = M_STACK_SIZE_PARAM_IS_A_RESERVATION | (cpu.is_some() ? M_CREATE_SUSPENDED : 0);
+        auto h     = CreateThread(nullptr, stack, rstd_thread_start_win, raw.p, flags, nullptr);
 
         if (h != nullptr) {
+            if (cpu.is_some()) {
+                SetThreadAffinityMask(h, DWORD_PTR(1) << *cpu);
+                ResumeThread(h);
+            }
             return Ok(Thread { .handle = h });
         } else {
             Box<ThreadInit>::from_raw(raw);
@@ -77,6 +83,25 @@ export struct Thread {
     }
 
     static void yield_now() { SwitchToThread(); }
+
+    static auto available_parallelism() -> usize {
+        auto n = GetActiveProcessorCount(ALL_PROCESSOR_GROUPS);
+        return n > 0 ? usize(n) : 1;
+    }
+
+    static auto affinity_cpus() -> rstd_alloc::vec::Vec<usize> {
+        auto      cpus    = rstd_alloc::vec::Vec<usize>::make();
+        DWORD_PTR process = 0;
+        DWORD_PTR system  = 0;
+        if (GetProcessAffinityMask(GetCurrentProcess(), &process, &system) == 0) {
+            for (usize i = 0; i < available_parallelism(); ++i) cpus.push(i);
+            return cpus;
+        }
+        for (usize i = 0; i < sizeof(DWORD_PTR) * 8; ++i) {
+            if ((process >> i) & 1) cpus.push(i);
+        }
+        return cpus;
+    }
 };
 
 } // namespace rstd::sys::thread::windows
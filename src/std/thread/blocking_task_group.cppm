@@ -43,6 +43,9 @@ private:
 namespace blocking_task_group
 {
 
+// Entry index for jobs submitted with `submit_detached`; they own no result slot.
+inline constexpr usize DETACHED = rstd::numeric_limits<usize>::max();
+
 template<typename T>
 struct Entry {
     usize                index { 0 };
@@ -104,8 +107,8 @@ void worker(Arc<Shared<T>> shared) {
         auto value = task.job->operator()();
 
         {
-            auto fields                 = shared->fields.lock().unwrap_unchecked();
-            fields->results[task.index] = Some(rstd::move(value));
+            auto fields = shared->fields.lock().unwrap_unchecked();
+            if (task.index != DETACHED) fields->results[task.index] = Some(rstd::move(value));
             --fields->running;
         }
     }
@@ -120,7 +123,7 @@ auto cancel_pending(const Arc<Shared<T>>& shared) -> usize {
     auto queue_index     = fields->queue_head;
     for (usize index = 0; index < fields->queued; ++index) {
         auto entry = fields->queue[queue_index].take();
-        if (entry.is_some()) {
+        if (entry.is_some() && entry->index != DETACHED) {
             fields->cancelled[entry->index] = true;
         }
         queue_index = (queue_index + 1) % shared->queue_capacity;
@@ -209,28 +212,18 @@ public:
     auto submit(F&& task) -> rstd::result::Result<usize, BlockingSubmitError>
         requires mtp::same_as<mtp::invoke_result_t<F>, T>
     {
-        auto fields = m_shared->fields.lock().unwrap_unchecked();
-        m_shared->space_available.wait_while(fields, [this](const auto& fields) {
-            return fields.queued >= m_shared->queue_capacity && ! fields.closed &&
-                   ! fields.cancelling;
-        });
-
-        if (fields->cancelling) return Err(BlockingSubmitError::Cancelled);
-        if (fields->closed) return Err(BlockingSubmitError::Closed);
+        return enqueue(rstd::forward<F>(task), false);
+    }
 
-        const auto index = fields->results.len();
-        fields->results.push(None());
-        fields->cancelled.push(false);
-        fields->queue[fields->queue_tail] = Some(blocking_task_group::Entry<T> {
-            .index = index,
-            .job   = Box<dyn<FnMut<T()>>>::make([task = rstd::forward<F>(task)]() mutable -> T {
-                return task();
-            }),
-        });
-        fields->queue_tail                = (fields->queue_tail + 1) % m_shared->queue_capacity;
-        ++fields->queued;
-        m_shared->work_available.notify_one();
-        return Ok(index);
+    /// Queues `task` without reserving a result slot; its return value is dropped and `join`
+    /// does not report it. For long-lived groups that would otherwise grow one slot per job.
+    template<typename F>
+    auto submit_detached(F&& task) -> rstd::result::Result<empty, BlockingSubmitError>
+        requires mtp::same_as<mtp::invoke_result_t<F>, T>
+    {
+        auto queued = enqueue(rstd::forward<F>(task), true);
+        if (queued.is_err()) return Err(queued.unwrap_err_unchecked());
+        return Ok(empty {});
     }
 
     void close() {
@@ -262,6 +255,35 @@ public:
     }
 
 private:
+    template<typename F>
+    auto enqueue(F&& task, bool detached) -> rstd::result::Result<usize, BlockingSubmitError> {
+        auto fields = m_shared->fields.lock().unwrap_unchecked();
+        m_shared->space_available.wait_while(fields, [this](const auto& fields) {
+            return fields.queued >= m_shared->queue_capacity && ! fields.closed &&
+                   ! fields.cancelling;
+        });
+
+        if (fields->cancelling) return Err(BlockingSubmitError::Cancelled);
+        if (fields->closed) return Err(BlockingSubmitError::Closed);
+
+        auto index = blocking_task_group::DETACHED;
+        if (! detached) {
+            index = fields->results.len();
+            fields->results.push(None());
+            fields->cancelled.push(false);
+        }
+        fields->queue[fields->queue_tail] = Some(blocking_task_group::Entry<T> {
+            .index = index,
+            .job   = Box<dyn<FnMut<T()>>>::make([task = rstd::forward<F>(task)]() mutable -> T {
+                return task();
+            }),
+        });
+        fields->queue_tail                = (fields->queue_tail + 1) % m_shared->queue_capacity;
+        ++fields->queued;
+        m_shared->work_available.notify_one();
+        return Ok(index);
+    }
+
     BlockingTaskGroup(Arc<Shared> shared, usize worker_count)
         : m_shared(rstd::move(shared)), m_worker_count(worker_count) {}
 
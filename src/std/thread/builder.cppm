@@ -21,6 +21,8 @@ export struct Builder {
         Option<String> name;
         /// The size of the stack for the spawned thread in bytes
         Option<usize> stack_size;
+        /// The CPU the spawned thread is pinned to
+        Option<usize> cpu;
         /// Skip running and inheriting the thread spawn hooks
         bool no_hooks;
     };
@@ -34,6 +36,7 @@ export struct Builder {
         return { .d = {
                      .name {},
                      .stack_size {},
+                     .cpu {},
                      .no_hooks = false,
                  } };
     }
@@ -52,6 +55,13 @@ export struct Builder {
         return *this;
     }
 
+    /// Pins the new thread to a single CPU before it starts running.
+    /// \param cpu The CPU index, as listed by `available_cpus`.
+    auto affinity(usize cpu) -> Builder& {
+        d.cpu = Some(cpu);
+        return *this;
+    }
+
     /// Disables running and inheriting thread spawn hooks.
     auto no_hooks() -> Builder& {
         d.no_hooks = true;
@@ -69,8 +79,8 @@ export struct Builder {
     {
         auto stack_size = d.stack_size.unwrap_or(0);
 
-        auto inner =
-            lifecycle::spawn_unchecked(rstd::move(d.name), stack_size, None(), rstd::forward<F>(f));
+        auto inner = lifecycle::spawn_unchecked(
+            rstd::move(d.name), stack_size, d.cpu, None(), rstd::forward<F>(f));
 
         if (inner.is_ok()) {
             return Ok(JoinHandle<mtp::invoke_result_t<F>>::make(inner.unwrap_unchecked()));
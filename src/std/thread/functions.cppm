@@ -31,6 +31,17 @@ export inline void yield_now() {
     sys::thread::Thread::yield_now();
 }
 
+/// Returns an estimate of how many threads can run in parallel, at least 1.
+export inline auto available_parallelism() -> usize {
+    return sys::thread::Thread::available_parallelism();
+}
+
+/// Returns the CPUs the current process may run on, in ascending order; the indices
+/// `Builder::affinity` accepts.
+export inline auto available_cpus() -> rstd_alloc::vec::Vec<usize> {
+    return sys::thread::Thread::affinity_cpus();
+}
+
 /// Blocks the current thread until its token is made available via `unpark`.
 export inline void park() {
     current().park();
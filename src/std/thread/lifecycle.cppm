@@ -55,6 +55,7 @@ struct JoinInner {
 template<typename F>
 auto spawn_unchecked(Option<String>         name,
                      usize                  stack_size,
+                     Option<usize>          cpu,
                      Option<Arc<ScopeData>> scope_data,
                      F&&                    f) -> io::Result<JoinInner<mtp::invoke_result_t<F>>>
 // requires Impled<F, FnOnce<void()>> && mtp::spec_of<mtp::rm_cvf<F>,
@@ -87,7 +88,7 @@ auto spawn_unchecked(Option<String>         name,
         ThreadInit { .handle = as<clone::Clone>(thread).clone(),
                      .start  = Box<dyn<FnMut<void()>>>::make(rstd::move(start)) });
 
-    return imp::Thread::make(stack_size, rstd::move(init)).map([&](auto&& native) {
+    return imp::Thread::make(stack_size, cpu, rstd::move(init)).map([&](auto&& native) {
         return JoinInner<ret_t> {
             .thread_ = rstd::move(thread),
             .packet  = rstd::move(their_packet),
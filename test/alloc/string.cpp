@@ -86,3 +86,75 @@ TEST(String, FromUtf8OwnsValidatedBytes) {
     ASSERT_TRUE(overlong_error.is_err());
     EXPECT_EQ(overlong_error.unwrap_err().valid_up_to(), 1u);
 }
+
+TEST(String, ShortStringsStayInline) {
+    auto text = String::make("short");
+    EXPECT_TRUE(text.is_inline());
+    EXPECT_EQ(text.capacity(), String::INLINE_CAP);
+    EXPECT_EQ(sizeof(String), 24u);
+
+    while (text.len() < String::INLINE_CAP) text.push_back('x');
+    EXPECT_TRUE(text.is_inline());
+
+    text.push_str("-spills");
+    EXPECT_FALSE(text.is_inline());
+    EXPECT_EQ(text.len(), String::INLINE_CAP + 7);
+    EXPECT_EQ(text.as_str().data()[0], 's');
+
+    text.truncate(3);
+    text.shrink_to_fit();
+    EXPECT_TRUE(text.is_inline());
+    EXPECT_EQ(text, "sho");
+}
+
+TEST(String, MoveAndIntoBytesKeepContents) {
+    auto long_text = String::make("a string comfortably longer than the inline buffer");
+    auto heap_ptr  = long_text.as_raw_ptr();
+    auto moved     = rstd::move(long_text);
+    EXPECT_TRUE(long_text.is_empty());
+    EXPECT_EQ(moved.as_raw_ptr(), heap_ptr);
+
+    auto bytes = rstd::move(moved).into_bytes();
+    EXPECT_EQ(bytes.as_ptr().as_raw_ptr(), heap_ptr);
+    auto back = String::from_utf8_unchecked(rstd::move(bytes));
+    EXPECT_EQ(back, "a string comfortably longer than the inline buffer");
+
+    auto short_bytes = String::make("tiny").into_bytes();
+    EXPECT_EQ(short_bytes.len(), 4u);
+    EXPECT_EQ(short_bytes[0], 't');
+}
+
+TEST(ArcStr, CloneSharesAllocation) {
+    auto shared = rstd::string::ArcStr::make("shared payload");
+    auto other  = shared.clone();
+    EXPECT_TRUE(shared.ptr_eq(other));
+    EXPECT_EQ(shared.strong_count(), 2u);
+    EXPECT_EQ(other, rstd::ref<rstd::str>("shared payload"));
+
+    {
+        auto third = other.clone();
+        EXPECT_EQ(shared.strong_count(), 3u);
+    }
+    EXPECT_EQ(shared.strong_count(), 2u);
+
+    auto empty = rstd::string::ArcStr {};
+    EXPECT_TRUE(empty.is_empty());
+    EXPECT_EQ(empty.clone().strong_count(), 0u);
+    EXPECT_EQ(rstd::string::ArcStr::make("x"), rstd::string::ArcStr::make("x"));
+}
+
+TEST(Interner, AssignsDenseIdsOnce) {
+    auto interner = rstd::string::Interner::make();
+    auto a        = interner.intern("alpha");
+    auto b        = interner.intern("beta");
+    EXPECT_EQ(a.as_u32(), 0u);
+    EXPECT_EQ(b.as_u32(), 1u);
+    EXPECT_EQ(interner.intern("alpha"), a);
+    EXPECT_EQ(interner.len(), 2u);
+    EXPECT_EQ(interner.resolve(b), rstd::ref<rstd::str>("beta"));
+    EXPECT_TRUE(interner.get("gamma").is_none());
+
+    auto global = rstd::string::intern("interner-test-key");
+    EXPECT_EQ(rstd::string::intern("interner-test-key"), global);
+    EXPECT_EQ(rstd::string::resolve(global), rstd::ref<rstd::str>("interner-test-key"));
+}
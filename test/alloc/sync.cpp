@@ -9,6 +9,8 @@ import rstd;
 
 using rstd::sync::Arc;
 using rstd::sync::ArcRaw;
+using rstd::sync::LocalArc;
+using rstd::sync::ThinArc;
 using rstd::sync::Weak;
 
 struct ArcDynTrait {
@@ -377,6 +379,115 @@ TEST(ArcPtrEq, ClonesShareAllocation) {
     // EXPECT_NE(a.as_ptr().as_ptr(), c.as_ptr().as_ptr());
 }
 
+TEST(ArcSlice, FromSliceAndFromFnShareOneAllocation) {
+    int  values[] = { 1, 2, 3, 4 };
+    auto copied   = Arc<int[]>::from_slice(rstd::slice<int>::from_raw_parts(values, 4));
+    ASSERT_EQ(copied->len(), 4u);
+    EXPECT_EQ((*copied)[3], 4);
+
+    auto shared = copied.clone();
+    EXPECT_TRUE(Arc<int[]>::ptr_eq(copied, shared));
+    EXPECT_EQ(copied.strong_count(), 2u);
+
+    DropCounter::reset();
+    auto owned = Arc<DropCounter[]>::from_fn(
+        3, [](rstd::usize i) { return DropCounter { static_cast<int>(i) * 10 }; });
+    EXPECT_EQ((*owned)[2].value, 20);
+    EXPECT_EQ(DropCounter::live.load(), 3);
+    owned.reset();
+    EXPECT_EQ(DropCounter::live.load(), 0);
+}
+
+TEST(ArcSlice, UninitSliceAssumeInit) {
+    auto uninit = Arc<int[]>::make_uninit_slice(5);
+    for (rstd::usize i = 0; i < 5; ++i) (*uninit)[i].write(static_cast<int>(i * i));
+
+    auto values = rstd::move(uninit).assume_init();
+    ASSERT_EQ(values->len(), 5u);
+    EXPECT_EQ((*values)[4], 16);
+}
+
+TEST(ArcStr, SharesBytes) {
+    auto a = Arc<rstd::str>::from("shared text");
+    auto b = a.clone();
+    EXPECT_EQ(a.as_str(), rstd::ref<rstd::str>("shared text"));
+    EXPECT_EQ(b.len(), 11u);
+    EXPECT_TRUE(Arc<rstd::str>::ptr_eq(a, b));
+    EXPECT_EQ(a.strong_count(), 2u);
+}
+
+TEST(ArcMakeMut, ClonesOnlyWhenShared) {
+    auto a = Arc<int>::make(1);
+    auto p = a.as_ptr();
+    *a.make_mut() += 1;
+    EXPECT_EQ(a.as_ptr(), p);
+
+    auto b = a.clone();
+    *a.make_mut() += 1;
+    EXPECT_NE(a.as_ptr(), b.as_ptr());
+    EXPECT_EQ(*a, 3);
+    EXPECT_EQ(*b, 2);
+    EXPECT_EQ(b.strong_count(), 1u);
+
+    auto w = b.downgrade();
+    *b.make_mut() = 7;
+    EXPECT_EQ(*b, 7);
+    EXPECT_TRUE(w.expired());
+    EXPECT_EQ(b.strong_count(), 1u);
+}
+
+TEST(LocalArc, ClonesWithoutTouchingSharedCount) {
+    auto local = LocalArc<int>::make(5);
+    EXPECT_EQ(local.strong_count(), 1u);
+
+    auto copy = local.clone();
+    EXPECT_EQ(local.local_count(), 2u);
+    EXPECT_EQ(local.strong_count(), 1u);
+    EXPECT_EQ(*copy, 5);
+
+    auto shared = local.share();
+    EXPECT_EQ(shared.strong_count(), 2u);
+    *shared = 6;
+    EXPECT_EQ(*local, 6);
+
+    {
+        auto moved = rstd::move(local);
+        EXPECT_EQ(moved.local_count(), 2u);
+    }
+    EXPECT_FALSE(local);
+    EXPECT_EQ(copy.local_count(), 1u);
+    EXPECT_EQ(shared.strong_count(), 2u);
+}
+
+TEST(ThinArc, HeaderAndSliceBehindOnePointer) {
+    static_assert(sizeof(ThinArc<int, rstd::u32>) == sizeof(void*));
+
+    rstd::u32 items[] = { 7, 8, 9 };
+    auto      thin    = ThinArc<int, rstd::u32>::from_header_and_slice(
+        42, rstd::slice<rstd::u32>::from_raw_parts(items, 3));
+    EXPECT_EQ(thin.header(), 42);
+    ASSERT_EQ(thin.len(), 3u);
+    EXPECT_EQ(thin.as_slice()[1], 8u);
+
+    auto other = thin.clone();
+    EXPECT_EQ(thin.strong_count(), 2u);
+
+    auto restored = ThinArc<int, rstd::u32>::from_raw(rstd::move(other).into_raw());
+    EXPECT_TRUE((ThinArc<int, rstd::u32>::ptr_eq(thin, restored)));
+
+    DropCounter::reset();
+    {
+        auto owned = ThinArc<int, DropCounter>::from_header_and_fn(
+            1, 2, [](rstd::usize) { return DropCounter { 3 }; });
+        {
+            auto dup = owned.clone();
+            EXPECT_EQ(dup.as_slice()[1].value, 3);
+        }
+        EXPECT_EQ(DropCounter::live.load(), 2);
+    }
+    EXPECT_EQ(DropCounter::live.load(), 0);
+}
+
 TEST(WeakBasic, EmptyWeakIsExpired) {
     auto w = Weak<int>::make();
     EXPECT_TRUE(w.expired());
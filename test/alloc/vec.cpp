@@ -216,3 +216,94 @@ TEST(Vec, CloneOwnsIndependentElements) {
     EXPECT_EQ(abstract[0], "alpha");
     EXPECT_EQ(abstract[1], "beta");
 }
+
+TEST(Vec, CollectReservesFromSizeHint) {
+    auto v = rstd::iter::range(0, 100).collect<Vec<int>>();
+    ASSERT_EQ(v.len(), 100u);
+    EXPECT_EQ(v.capacity(), 100u);
+    EXPECT_EQ(v[99], 99);
+}
+
+TEST(Vec, RepeatedExactExtendGrowsAmortized) {
+    auto  v           = Vec<int>::make();
+    usize reallocated = 0;
+    for (int i = 0; i < 1000; ++i) {
+        auto* before = v.begin();
+        v.extend(rstd::iter::range(i, i + 1));
+        if (v.begin() != before) ++reallocated;
+    }
+    ASSERT_EQ(v.len(), 1000u);
+    EXPECT_EQ(v[999], 999);
+    EXPECT_LT(reallocated, 16u);
+}
+
+TEST(Vec, IntoIterMapCollectsInPlace) {
+    auto ints = rstd::iter::range(0, 8).collect<Vec<int>>();
+    auto* buf = ints.begin();
+    auto  out = rstd::move(ints).into_iter().map([](int x) { return unsigned(x * 2); })
+                   .collect<Vec<unsigned>>();
+    EXPECT_EQ(static_cast<void*>(out.begin()), static_cast<void*>(buf));
+    ASSERT_EQ(out.len(), 8u);
+    EXPECT_EQ(out[7], 14u);
+
+    auto words = Vec<String>::make();
+    words.push(String::make("a"));
+    words.push(String::make("b"));
+    auto* words_buf = words.begin();
+    auto  shouted   = rstd::move(words).into_iter().map([](String s) {
+        s.push_back('!');
+        return s;
+    }).collect<Vec<String>>();
+    EXPECT_EQ(shouted.begin(), words_buf);
+    ASSERT_EQ(shouted.len(), 2u);
+    EXPECT_EQ(shouted[0], "a!");
+    EXPECT_EQ(shouted[1], "b!");
+}
+
+TEST(Vec, ExtendFromWithinAndAppend) {
+    auto v = rstd::iter::range(0, 4).collect<Vec<int>>();
+    v.extend_from_within(1, 3);
+    ASSERT_EQ(v.len(), 6u);
+    EXPECT_EQ(v[4], 1);
+    EXPECT_EQ(v[5], 2);
+
+    auto other = Vec<String>::make();
+    other.push(String::make("x"));
+    auto mine = Vec<String>::make();
+    mine.push(String::make("w"));
+    mine.append(other);
+    EXPECT_TRUE(other.is_empty());
+    ASSERT_EQ(mine.len(), 2u);
+    EXPECT_EQ(mine[1], "x");
+}
+
+TEST(Vec, DrainClosesGapOnDrop) {
+    auto v = Vec<String>::make();
+    for (auto s : { "a", "b", "c", "d", "e" }) v.push(String::make(s));
+    {
+        auto d     = v.drain(1, 4);
+        auto first = d.next();
+        ASSERT_TRUE(first.is_some());
+        EXPECT_EQ(*first, "b");
+        EXPECT_EQ(d.len(), 2u);
+    }
+    ASSERT_EQ(v.len(), 2u);
+    EXPECT_EQ(v[0], "a");
+    EXPECT_EQ(v[1], "e");
+}
+
+TEST(Vec, SpliceGrowsAndShrinks) {
+    auto v       = rstd::iter::range(0, 5).collect<Vec<int>>();
+    auto removed = v.splice(1, 3, rstd::iter::range(10, 14));
+    ASSERT_EQ(removed.len(), 2u);
+    EXPECT_EQ(removed[0], 1);
+    EXPECT_EQ(removed[1], 2);
+    int grown[] { 0, 10, 11, 12, 13, 3, 4 };
+    ASSERT_EQ(v.len(), 7u);
+    for (usize i = 0; i < 7; ++i) EXPECT_EQ(v[i], grown[i]);
+
+    v.splice(1, 6, rstd::iter::range(0, 0));
+    ASSERT_EQ(v.len(), 2u);
+    EXPECT_EQ(v[0], 0);
+    EXPECT_EQ(v[1], 4);
+}
@@ -72,6 +72,20 @@ TEST(RstdAsyncFrame, NestedChildFrameDestroysOwnedStateOnce) {
     EXPECT_EQ(drops, 1);
 }
 
+TEST(RstdAsyncFrame, ReleasedFramesAreRecycledOnSameThread) {
+    int drops = 0;
+
+    EXPECT_EQ(async::block_on(tracked_parent(FrameProbe { drops })), 37);
+    auto before = async::frame_stats();
+    EXPECT_EQ(async::block_on(tracked_parent(FrameProbe { drops })), 37);
+    auto after = async::frame_stats();
+
+    EXPECT_EQ(drops, 2);
+    EXPECT_GE(after.allocated - before.allocated, 2u);
+    EXPECT_GE(after.recycled - before.recycled, 2u);
+    EXPECT_LE(after.recycled - before.recycled, after.allocated - before.allocated);
+}
+
 TEST(RstdAsyncFrame, ShutdownDestroysPendingFutureFrameOnce) {
     int  drops  = 0;
     auto polled = std::atomic<bool> { false };
@@ -78,6 +78,27 @@ TEST(RstdAsyncLifecycle, MoveAssignmentStopsPreviousRuntimeBeforeReplacement) {
     EXPECT_EQ(runtime.block_on(ReadyValue {}), 13);
 }
 
+TEST(RstdAsyncLifecycle, ShutdownAbortsTasksOnEveryWorkerShard) {
+    std::atomic<bool> polled[8] {};
+    auto              handles = vec::Vec<async::JoinHandle<void>>::make();
+    {
+        auto runtime = async::RuntimeBuilder::multi_thread().worker_threads(4).build().unwrap();
+        // External spawns are placed round-robin, so these land in every worker's registry.
+        for (auto& flag : polled) handles.push(runtime.spawn(PendingValue { &flag }));
+        for (auto& flag : polled) {
+            while (! flag.load(std::memory_order_acquire)) hint::spin_loop();
+        }
+    }
+
+    for (usize i = 0; i < handles.len(); ++i) EXPECT_TRUE(handles[i].is_finished());
+    auto runtime = async::RuntimeBuilder::current_thread().build().unwrap();
+    while (! handles.is_empty()) {
+        auto joined = runtime.block_on(handles.pop().unwrap());
+        ASSERT_TRUE(joined.is_err());
+        EXPECT_TRUE(rstd::move(joined).unwrap_err().is_aborted());
+    }
+}
+
 TEST(RstdAsyncLifecycle, ExpiredRuntimeHandleRejectsAdmission) {
     EXPECT_DEATH(
         {
@@ -44,6 +44,30 @@ auto wait_readable_on_owner(async::Registration& registration,
     co_return ready.is_ok() && rstd::move(ready).unwrap_unchecked().is_readable();
 }
 
+// Waits twice on one edge, drains the pipe, then waits for the next edge.
+auto wait_across_edges(async::Registration& registration,
+                       sys::fd::RawFd       reader,
+                       sys::fd::RawFd       writer) -> async::coro<bool> {
+    if (! write_byte(writer)) co_return false;
+    auto first = co_await async::ReadinessFuture { registration, async::Interest::readable() };
+    if (first.is_err() || ! first->is_readable()) co_return false;
+
+    // No new edge arrives, but the readiness stays until a read reports `WouldBlock`.
+    auto second = co_await async::ReadinessFuture { registration, async::Interest::readable() };
+    if (second.is_err() || ! second->is_readable() || second->tick() != first->tick()) {
+        co_return false;
+    }
+
+    u8 buf[4] {};
+    if (sys::libc::read(reader, buf, sizeof(buf)) != 1) co_return false;
+    if (sys::libc::read(reader, buf, sizeof(buf)) >= 0) co_return false;
+    registration.clear_readiness(*second);
+
+    if (! write_byte(writer)) co_return false;
+    auto third = co_await async::ReadinessFuture { registration, async::Interest::readable() };
+    co_return third.is_ok() && third->is_readable() && third->tick() != second->tick();
+}
+
 auto wait_owned_registration(async::Registration registration, std::atomic<bool>& entered)
     -> async::coro<void> {
     entered.store(true, std::memory_order_release);
@@ -72,6 +96,17 @@ TEST(RstdAsyncPoll, PipeReadinessCompletesThroughCurrentWorker) {
     EXPECT_TRUE(rstd::move(writer).join().unwrap());
 }
 
+TEST(RstdAsyncPoll, EdgeTriggeredReadinessStaysUntilCleared) {
+    auto pipe = make_pipe();
+    ASSERT_TRUE(pipe.is_some());
+    auto fds          = rstd::move(pipe).unwrap_unchecked();
+    auto registration = async::Registration::register_fd(fds.reader.as_raw_fd()).unwrap();
+    auto runtime      = async::RuntimeBuilder::current_thread().enable_io().build().unwrap();
+
+    EXPECT_TRUE(runtime.block_on(
+        wait_across_edges(registration, fds.reader.as_raw_fd(), fds.writer.as_raw_fd())));
+}
+
 TEST(RstdAsyncPoll, ReadinessWithoutIoReturnsUnsupported) {
     auto pipe = make_pipe();
     ASSERT_TRUE(pipe.is_some());
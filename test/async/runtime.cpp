@@ -109,6 +109,150 @@ auto join_thread_pool_child(std::atomic<int>& runs) -> async::coro<int> {
     co_return result.unwrap();
 }
 
+auto join_local_child() -> async::coro<int> {
+    auto handle = async::spawn_local(ReadyValue { 5 });
+    auto result = co_await rstd::move(handle);
+    co_return result.unwrap();
+}
+
+auto report_shard() -> async::coro<usize> {
+    co_await async::yield_now();
+    co_return async::current_shard().unwrap_or(usize(-1));
+}
+
+auto hop_to_shard(usize shard) -> async::coro<usize> {
+    auto result = co_await async::spawn_on(shard, report_shard());
+    co_return result.unwrap();
+}
+
+auto visit_every_shard(usize shards) -> async::coro<usize> {
+    usize visited = 0;
+    for (usize shard = 0; shard < shards; ++shard) {
+        if (co_await hop_to_shard(shard) == shard) visited += 1;
+    }
+    co_return visited;
+}
+
+struct HookCounts {
+    std::atomic<int> spawns { 0 };
+    std::atomic<int> poll_starts { 0 };
+    std::atomic<int> poll_ends { 0 };
+};
+
+auto counting_hooks(HookCounts& counts) -> async::RuntimeHooks {
+    auto hooks          = async::RuntimeHooks {};
+    hooks.context       = rstd::addressof(counts);
+    hooks.on_task_spawn = [](voidp context, usize, usize) {
+        static_cast<HookCounts*>(context)->spawns.fetch_add(1, std::memory_order_relaxed);
+    };
+    hooks.on_poll_start = [](voidp context, usize, usize) {
+        static_cast<HookCounts*>(context)->poll_starts.fetch_add(1, std::memory_order_relaxed);
+    };
+    hooks.on_poll_end = [](voidp context, usize, usize, time::Duration) {
+        static_cast<HookCounts*>(context)->poll_ends.fetch_add(1, std::memory_order_relaxed);
+    };
+    return hooks;
+}
+
+constexpr usize PLACEMENT_WORKERS { 4 };
+
+struct UnparkLog {
+    std::atomic<int>  unparks[PLACEMENT_WORKERS] {};
+    std::atomic<bool> hold { false };
+};
+
+// Counts unparks per worker. While `hold` is set, an unparking worker waits in the hook, which
+// keeps it counted as the runtime's searching worker.
+auto holding_unpark_hooks(UnparkLog& log) -> async::RuntimeHooks {
+    auto hooks      = async::RuntimeHooks {};
+    hooks.context   = rstd::addressof(log);
+    hooks.on_unpark = [](voidp context, usize worker) {
+        auto* log = static_cast<UnparkLog*>(context);
+        log->unparks[worker].fetch_add(1, std::memory_order_relaxed);
+        while (log->hold.load(std::memory_order_acquire)) thread::yield_now();
+    };
+    return hooks;
+}
+
+auto all_workers_parked(const async::Runtime& runtime) -> bool {
+    auto metrics = runtime.metrics();
+    for (usize i = 0; i < metrics.workers.len(); ++i) {
+        if (! metrics.workers[i].parked) return false;
+    }
+    return true;
+}
+
+auto count_run(std::atomic<int>& runs) -> async::coro<void> {
+    runs.fetch_add(1, std::memory_order_release);
+    co_return;
+}
+
+// Keeps spawning children from a worker until shutdown aborts it.
+auto spawn_until_aborted(std::atomic<int>& runs) -> async::coro<void> {
+    for (;;) {
+        (void)async::spawn(count_run(runs));
+        co_await async::yield_now();
+    }
+}
+
+auto wait_for_runs(std::atomic<int>& runs, int expected) -> bool {
+    for (int attempt = 0; attempt < 1000; ++attempt) {
+        if (runs.load(std::memory_order_acquire) == expected) return true;
+        thread::sleep(time::Duration::from_millis(1));
+    }
+    return false;
+}
+
+struct Gate {
+    bool                open { false };
+    Option<task::Waker> waiter {};
+};
+
+struct WaitGate {
+    using Output = void;
+
+    Gate* gate;
+
+    auto poll(mut_ref<WaitGate> self, task::Context& cx) -> task::Poll<void> {
+        if (self->gate->open) {
+            return task::Poll<void>::Ready();
+        }
+        self->gate->waiter = Some(cx.waker().clone());
+        return task::Poll<void>::Pending();
+    }
+};
+
+struct RunOrder {
+    int ids[2] {};
+    int len { 0 };
+
+    void record(int id) { ids[len++] = id; }
+};
+
+auto gated_record(Gate& gate, RunOrder& order) -> async::coro<void> {
+    co_await WaitGate { &gate };
+    order.record(1);
+}
+
+auto record_run(RunOrder& order) -> async::coro<void> {
+    order.record(2);
+    co_return;
+}
+
+// Parks a waiter, queues a filler behind it, then wakes the waiter from the running task.
+auto wake_after_spawn(Gate& gate, RunOrder& order) -> async::coro<void> {
+    auto waiter = async::spawn_local(gated_record(gate, order));
+    co_await async::yield_now();
+    auto filler = async::spawn_local(record_run(order));
+    gate.open   = true;
+    auto waker  = gate.waiter.take();
+    if (waker.is_some()) {
+        rstd::move(*waker).wake();
+    }
+    (void)co_await rstd::move(waiter);
+    (void)co_await rstd::move(filler);
+}
+
 TEST(RstdAsyncRuntime, ReadyFutureRunsThroughBlockOn) {
     EXPECT_EQ(async::block_on(ReadyValue { 7 }), 7);
 }
@@ -165,4 +309,160 @@ TEST(RstdAsyncRuntime, ThreadPoolSpawnAndJoinCompleteOnRuntime) {
     EXPECT_EQ(runs.load(std::memory_order_relaxed), 2);
 }
 
+TEST(RstdAsyncRuntime, TaskWokenByRunningTaskRunsNext) {
+    auto gate  = Gate {};
+    auto order = RunOrder {};
+
+    async::block_on(wake_after_spawn(gate, order));
+    ASSERT_EQ(order.len, 2);
+    EXPECT_EQ(order.ids[0], 1);
+    EXPECT_EQ(order.ids[1], 2);
+}
+
+TEST(RstdAsyncRuntime, DisabledLifoSlotKeepsWakesInOrder) {
+    auto gate    = Gate {};
+    auto order   = RunOrder {};
+    auto runtime = async::RuntimeBuilder::current_thread().disable_lifo_slot().build().unwrap();
+
+    runtime.block_on(wake_after_spawn(gate, order));
+    ASSERT_EQ(order.len, 2);
+    EXPECT_EQ(order.ids[0], 2);
+    EXPECT_EQ(order.ids[1], 1);
+}
+
+TEST(RstdAsyncRuntime, BalancedPlacementRunsWorkerSpawns) {
+    auto runs    = std::atomic<int> { 0 };
+    auto runtime = async::RuntimeBuilder::multi_thread()
+                       .worker_threads(2)
+                       .spawn_placement(async::SpawnPlacement::Balanced)
+                       .build()
+                       .unwrap();
+
+    EXPECT_EQ(runtime.block_on(join_thread_pool_child(runs)), 31);
+    EXPECT_EQ(runs.load(std::memory_order_relaxed), 2);
+}
+
+TEST(RstdAsyncRuntime, SpinningWorkersPickUpCrossShardWakes) {
+    auto runtime = async::RuntimeBuilder::multi_thread()
+                       .worker_threads(2)
+                       .spin_before_park(time::Duration::from_millis(2))
+                       .enable_metrics()
+                       .build()
+                       .unwrap();
+
+    for (usize round = 0; round < 50; ++round) {
+        EXPECT_EQ(runtime.block_on(visit_every_shard(runtime.shard_count())), 2u);
+    }
+    auto metrics      = runtime.metrics();
+    u64  spin_wakeups = 0;
+    for (usize i = 0; i < metrics.workers.len(); ++i) {
+        spin_wakeups += metrics.workers[i].spin_wakeups;
+    }
+    EXPECT_GT(spin_wakeups, 0u);
+}
+
+TEST(RstdAsyncRuntime, SpawnBurstWakesOneParkedWorker) {
+    auto log     = UnparkLog {};
+    auto runtime = async::RuntimeBuilder::multi_thread()
+                       .worker_threads(PLACEMENT_WORKERS)
+                       .hooks(holding_unpark_hooks(log))
+                       .build()
+                       .unwrap();
+    while (! all_workers_parked(runtime)) thread::sleep(time::Duration::from_millis(1));
+    thread::sleep(time::Duration::from_millis(20));
+    ASSERT_TRUE(all_workers_parked(runtime));
+
+    int before[PLACEMENT_WORKERS] {};
+    for (usize i = 0; i < PLACEMENT_WORKERS; ++i) before[i] = log.unparks[i].load();
+
+    constexpr int BURST { 32 };
+    auto          runs = std::atomic<int> { 0 };
+    log.hold.store(true, std::memory_order_release);
+    for (int i = 0; i < BURST; ++i) (void)runtime.spawn(count_run(runs));
+    // Give a wrongly woken worker time to show up before counting.
+    thread::sleep(time::Duration::from_millis(20));
+
+    usize woken = 0;
+    for (usize i = 0; i < PLACEMENT_WORKERS; ++i) {
+        if (log.unparks[i].load() != before[i]) woken += 1;
+    }
+    log.hold.store(false, std::memory_order_release);
+    EXPECT_EQ(woken, 1u);
+    EXPECT_TRUE(wait_for_runs(runs, BURST));
+}
+
+TEST(RstdAsyncRuntime, ShutdownRacingWorkerSpawnsFinishes) {
+    // A spawn registered while shutdown collects and aborts the tasks must be counted before
+    // it can be retired, or shutdown waits forever; a hang here is the failure.
+    for (int round = 0; round < 200; ++round) {
+        auto runs    = std::atomic<int> { 0 };
+        auto runtime = async::RuntimeBuilder::multi_thread().worker_threads(2).build().unwrap();
+        (void)runtime.spawn(spawn_until_aborted(runs));
+        (void)runtime.spawn(spawn_until_aborted(runs));
+        thread::sleep(time::Duration::from_micros(u64(round % 8) * 100));
+    }
+}
+
+TEST(RstdAsyncRuntime, SpawnOnKeepsTaskOnRequestedShard) {
+    auto runtime = async::RuntimeBuilder::multi_thread().worker_threads(2).build().unwrap();
+    ASSERT_EQ(runtime.shard_count(), 2u);
+
+    EXPECT_EQ(runtime.block_on(hop_to_shard(1)), 1u);
+    EXPECT_EQ(runtime.block_on(hop_to_shard(0)), 0u);
+    EXPECT_EQ(runtime.block_on(runtime.spawn_on(1, report_shard())).unwrap(), 1u);
+}
+
+TEST(RstdAsyncRuntime, ThreadPerCoreRunsOnePinnedShardPerCpu) {
+    auto cpus    = thread::available_cpus();
+    auto runtime = async::RuntimeBuilder::thread_per_core().build().unwrap();
+    ASSERT_EQ(runtime.shard_count(), cpus.len());
+
+    EXPECT_EQ(runtime.block_on(visit_every_shard(runtime.shard_count())), cpus.len());
+}
+
+TEST(RstdAsyncRuntime, MetricsCountSpawnsAndPolls) {
+    auto runtime =
+        async::RuntimeBuilder::current_thread().enable_poll_time_histogram().build().unwrap();
+
+    EXPECT_EQ(runtime.block_on(join_local_child()), 5);
+    auto metrics = runtime.metrics();
+    ASSERT_EQ(metrics.workers.len(), 1u);
+    EXPECT_EQ(metrics.spawned_tasks, 2u);
+    EXPECT_EQ(metrics.live_tasks, 0u);
+
+    const auto& worker = metrics.workers[0];
+    EXPECT_GE(worker.polls, 3u);
+    u64 timed = 0;
+    for (usize i = 0; i < async::POLL_TIME_BUCKETS; ++i) timed += worker.poll_times[i];
+    EXPECT_EQ(timed, worker.polls);
+}
+
+TEST(RstdAsyncRuntime, MetricsStayZeroWhenDisabled) {
+    auto runtime = async::Runtime {};
+
+    EXPECT_EQ(runtime.block_on(join_local_child()), 5);
+    auto metrics = runtime.metrics();
+    ASSERT_EQ(metrics.workers.len(), 1u);
+    EXPECT_EQ(metrics.spawned_tasks, 0u);
+    EXPECT_EQ(metrics.workers[0].polls, 0u);
+}
+
+TEST(RstdAsyncRuntime, HooksSeeEverySpawnAndPoll) {
+    auto counts = HookCounts {};
+    {
+        auto runtime = async::RuntimeBuilder::multi_thread()
+                           .worker_threads(2)
+                           .hooks(counting_hooks(counts))
+                           .build()
+                           .unwrap();
+        auto runs = std::atomic<int> { 0 };
+        EXPECT_EQ(runtime.block_on(join_thread_pool_child(runs)), 31);
+    }
+
+    EXPECT_EQ(counts.spawns.load(std::memory_order_relaxed), 2);
+    EXPECT_GE(counts.poll_starts.load(std::memory_order_relaxed), 3);
+    EXPECT_EQ(counts.poll_starts.load(std::memory_order_relaxed),
+              counts.poll_ends.load(std::memory_order_relaxed));
+}
+
 } // namespace
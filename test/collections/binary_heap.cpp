@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+import rstd;
+
+using namespace rstd::prelude;
+using rstd::collections::BinaryHeap;
+using rstd::collections::HandleHeap;
+
+namespace
+{
+
+struct Greater {
+    auto operator()(i32 left, i32 right) const noexcept -> bool { return right < left; }
+};
+
+} // namespace
+
+TEST(BinaryHeap, PopsGreatestFirst) {
+    auto heap = BinaryHeap<i32>::make();
+    EXPECT_TRUE(heap.pop().is_none());
+    for (i32 value : { 5, 1, 8, 3, 9, 2, 8 }) heap.push(value);
+    EXPECT_EQ(heap.len(), 7u);
+    EXPECT_EQ(*heap.peek().unwrap(), 9);
+
+    i32 previous = 100;
+    while (! heap.is_empty()) {
+        auto value = heap.pop().unwrap();
+        EXPECT_LE(value, previous);
+        previous = value;
+    }
+}
+
+TEST(BinaryHeap, FromVecAndIntoSortedVec) {
+    auto values = rstd::vec::Vec<i32>::make();
+    for (i32 value : { 4, 7, 1, 9, 3, 3, 0 }) values.push(value);
+    auto heap = BinaryHeap<i32>::from_vec(rstd::move(values));
+    EXPECT_EQ(*heap.peek().unwrap(), 9);
+
+    auto sorted = rstd::move(heap).into_sorted_vec();
+    ASSERT_EQ(sorted.len(), 7u);
+    i32 expected[] = { 0, 1, 3, 3, 4, 7, 9 };
+    for (usize i = 0; i < sorted.len(); ++i) EXPECT_EQ(sorted[i], expected[i]);
+}
+
+TEST(BinaryHeap, PeekMutRestoresOrder) {
+    auto heap = BinaryHeap<i32>::make();
+    for (i32 value : { 10, 6, 8 }) heap.push(value);
+    {
+        auto top = heap.peek_mut().unwrap();
+        *top     = 1;
+    }
+    EXPECT_EQ(*heap.peek().unwrap(), 8);
+    EXPECT_EQ(heap.peek_mut().unwrap().pop(), 8);
+    EXPECT_EQ(heap.len(), 2u);
+
+    auto min_heap = BinaryHeap<i32, Greater>::make();
+    for (i32 value : { 10, 6, 8 }) min_heap.push(value);
+    EXPECT_EQ(min_heap.pop().unwrap(), 6);
+}
+
+TEST(HandleHeap, UpdatesAndRemovesThroughHandles) {
+    auto heap = HandleHeap<i32, Greater>::make();
+    auto a    = heap.push(30);
+    auto b    = heap.push(10);
+    auto c    = heap.push(20);
+    EXPECT_EQ(heap.peek_handle().unwrap(), b);
+
+    // Decrease a key past the current minimum.
+    EXPECT_EQ(heap.update(a, 5).unwrap(), 30);
+    EXPECT_EQ(heap.peek_handle().unwrap(), a);
+    EXPECT_EQ(*heap.get(a).unwrap(), 5);
+
+    EXPECT_EQ(heap.remove(b).unwrap(), 10);
+    EXPECT_FALSE(heap.contains(b));
+    EXPECT_TRUE(heap.remove(b).is_none());
+    EXPECT_TRUE(heap.update(b, 1).is_none());
+
+    EXPECT_EQ(heap.pop().unwrap(), 5);
+    EXPECT_FALSE(heap.contains(a));
+    EXPECT_EQ(heap.pop().unwrap(), 20);
+    EXPECT_FALSE(heap.contains(c));
+    EXPECT_TRUE(heap.is_empty());
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+import rstd;
+
+using namespace rstd::prelude;
+using rstd::collections::BitSet;
+using rstd::collections::BitVec;
+
+TEST(BitSet, InsertRemoveAndIterate) {
+    auto set = BitSet::make();
+    EXPECT_TRUE(set.is_empty());
+    EXPECT_TRUE(set.insert(3));
+    EXPECT_TRUE(set.insert(64));
+    EXPECT_TRUE(set.insert(200));
+    EXPECT_FALSE(set.insert(64));
+    EXPECT_EQ(set.len(), 3u);
+    EXPECT_TRUE(set.contains(200));
+    EXPECT_FALSE(set.contains(1000));
+
+    EXPECT_TRUE(set.remove(64));
+    EXPECT_FALSE(set.remove(64));
+    EXPECT_FALSE(set.remove(1000));
+
+    usize expected[] = { 3, 200 };
+    usize count      = 0;
+    auto  it         = set.iter();
+    for (auto value = it.next(); value.is_some(); value = it.next()) {
+        ASSERT_LT(count, 2u);
+        EXPECT_EQ(*value, expected[count++]);
+    }
+    EXPECT_EQ(count, 2u);
+}
+
+TEST(BitSet, SetOperations) {
+    auto a = BitSet::make();
+    auto b = BitSet::make();
+    for (usize v : { 1, 2, 70, 130 }) (void)a.insert(v);
+    for (usize v : { 2, 70, 300 }) (void)b.insert(v);
+
+    auto both = a.clone();
+    both.intersect_with(b);
+    EXPECT_EQ(both.len(), 2u);
+    EXPECT_TRUE(both.is_subset(a));
+    EXPECT_TRUE(both.is_subset(b));
+    EXPECT_FALSE(a.is_subset(b));
+
+    auto either = a.clone();
+    either.union_with(b);
+    EXPECT_EQ(either.len(), 5u);
+
+    auto only_a = a.clone();
+    only_a.difference_with(b);
+    EXPECT_EQ(only_a.len(), 2u);
+    EXPECT_TRUE(only_a.contains(1));
+    EXPECT_TRUE(only_a.contains(130));
+}
+
+TEST(BitVec, PushResizeAndCount) {
+    auto bits = BitVec::make();
+    for (usize i = 0; i < 70; ++i) bits.push(i % 3 == 0);
+    EXPECT_EQ(bits.len(), 70u);
+    EXPECT_EQ(bits.count_ones(), 24u);
+    EXPECT_EQ(bits.get(69).unwrap(), true);
+    EXPECT_TRUE(bits.get(70).is_none());
+
+    EXPECT_EQ(bits.pop().unwrap(), true);
+    EXPECT_EQ(bits.count_ones(), 23u);
+
+    bits.resize(130, true);
+    EXPECT_EQ(bits.count_ones(), 23u + 61u);
+    bits.resize(10, false);
+    EXPECT_EQ(bits.count_ones(), 4u);
+    bits.set(1, true);
+    EXPECT_EQ(bits.iter_ones().next().unwrap(), 0u);
+    EXPECT_EQ(bits.count_zeros(), 5u);
+
+    auto ones = BitVec::repeat(true, 65);
+    EXPECT_EQ(ones.count_ones(), 65u);
+    ones.fill(false);
+    EXPECT_FALSE(ones.any());
+}
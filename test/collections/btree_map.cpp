@@ -348,3 +348,114 @@ TEST(BTreeMap, CloneAndEqualityUseOwnedEntries) {
     EXPECT_EQ(**direct.get(ref<rstd::str>("a")), "changed");
     EXPECT_EQ(**abstract.get(ref<rstd::str>("a")), "one");
 }
+
+TEST(BTreeMap, FromSortedIterBuildsBalancedTree) {
+    for (i32 count : { 0, 1, 5, 63, 1000, 4097 }) {
+        auto map = BTreeMap<i32, i32>::from_sorted_iter(iter::range(0, count).map([](i32 key) {
+            return rstd::tuple<i32, i32>(key, key * 3);
+        }));
+        ASSERT_EQ(map.len(), usize(count));
+
+        auto items = map.iter();
+        for (i32 expected = 0; expected < count; ++expected) {
+            auto item = items.next();
+            ASSERT_TRUE(item.is_some());
+            EXPECT_EQ(*item->get<0>(), expected);
+            EXPECT_EQ(*item->get<1>(), expected * 3);
+        }
+        EXPECT_TRUE(items.next().is_none());
+
+        // The bulk-built tree must keep working under ordinary edits.
+        for (i32 key = 0; key < count; key += 3) EXPECT_TRUE(map.remove(key).is_some());
+        EXPECT_TRUE(map.insert(count, 0).is_none());
+    }
+
+    auto repeated = BTreeMap<i32, i32>::from_sorted_iter(iter::range(0, 40).map([](i32 i) {
+        return rstd::tuple<i32, i32>(i / 4, i);
+    }));
+    EXPECT_EQ(repeated.len(), 10u);
+    EXPECT_EQ(**repeated.get(2), 11);
+}
+
+TEST(BTreeMap, RangeYieldsHalfOpenInterval) {
+    auto map = BTreeMap<i32, i32>::make();
+    for (i32 i = 0; i < 500; ++i) map.insert(i * 2, i);
+
+    auto range    = map.range(101, 121);
+    i32  expected = 102;
+    for (auto item = range.next(); item.is_some(); item = range.next()) {
+        EXPECT_EQ(*item->get<0>(), expected);
+        expected += 2;
+    }
+    EXPECT_EQ(expected, 122);
+
+    EXPECT_TRUE(map.range(2000, 3000).next().is_none());
+    EXPECT_TRUE(map.range(10, 10).next().is_none());
+    EXPECT_EQ(*map.range(-5, 1).next()->get<0>(), 0);
+}
+
+TEST(BTreeMap, AppendAndSplitOffMoveWholeRuns) {
+    auto left  = BTreeMap<i32, i32>::make();
+    auto right = BTreeMap<i32, i32>::make();
+    for (i32 i = 0; i < 300; ++i) left.insert(i * 2, 1);
+    for (i32 i = 0; i < 300; ++i) right.insert(i * 3, 2);
+
+    left.append(right);
+    EXPECT_TRUE(right.is_empty());
+    EXPECT_EQ(left.len(), 300u + 300u - 100u);
+    EXPECT_EQ(**left.get(6), 2);
+    EXPECT_EQ(**left.get(4), 1);
+    EXPECT_EQ(**left.get(897), 2);
+
+    auto upper = left.split_off(450);
+    EXPECT_EQ(left.len() + upper.len(), 500u);
+    EXPECT_EQ(*left.last_key_value()->get<0>(), 448);
+    EXPECT_EQ(*upper.first_key_value()->get<0>(), 450);
+
+    auto everything = left.split_off(-1);
+    EXPECT_TRUE(left.is_empty());
+    EXPECT_EQ(*everything.first_key_value()->get<0>(), 0);
+    EXPECT_TRUE(upper.split_off(100000).is_empty());
+}
+
+TEST(BTreeMap, SplitOffAndDisjointAppendCutAndJoinNodes) {
+    // Large enough for a three-level tree, so cuts and joins cross internal borders.
+    constexpr i32 count = 8000;
+    for (i32 cut = 1; cut < count; cut += 797) {
+        auto map = BTreeMap<i32, i32>::make();
+        for (i32 i = 0; i < count; ++i) map.insert(i, i * 2);
+
+        auto upper = map.split_off(cut);
+        EXPECT_EQ(map.len(), usize(cut));
+        EXPECT_EQ(upper.len(), usize(count - cut));
+        EXPECT_EQ(*map.last_key_value()->get<0>(), cut - 1);
+        EXPECT_EQ(*upper.first_key_value()->get<0>(), cut);
+
+        // Join back in both directions; the shorter tree hangs off the taller one.
+        if (cut % 2 == 0) {
+            map.append(upper);
+        } else {
+            upper.append(map);
+            map = rstd::move(upper);
+        }
+        EXPECT_EQ(map.len(), usize(count));
+        auto items = map.iter();
+        for (i32 expected = 0; expected < count; ++expected) {
+            auto item = items.next();
+            ASSERT_TRUE(item.is_some());
+            EXPECT_EQ(*item->get<0>(), expected);
+            EXPECT_EQ(*item->get<1>(), expected * 2);
+        }
+        EXPECT_TRUE(map.remove(cut).is_some());
+        EXPECT_TRUE(map.insert(cut, 0).is_none());
+    }
+
+    auto small = BTreeMap<i32, i32>::make();
+    small.insert(-1, 0);
+    auto large = BTreeMap<i32, i32>::make();
+    for (i32 i = 0; i < 200; ++i) large.insert(i, i);
+    small.append(large);
+    EXPECT_EQ(small.len(), 201u);
+    EXPECT_EQ(*small.first_key_value()->get<0>(), -1);
+    EXPECT_EQ(*small.last_key_value()->get<0>(), 199);
+}
@@ -208,3 +208,78 @@ TEST(HashMap, CustomHashKeepsTheStoredEquivalentKey) {
     EXPECT_EQ(*entry->get<1>(), 500);
     EXPECT_EQ(map.remove(lookup), Some(500));
 }
+
+TEST(HashMap, EntryCountsAndUpdatesInPlace) {
+    auto counts = HashMap<i32, i32, ConstantHasher>::make();
+    for (i32 i = 0; i < 400; ++i) *counts.entry(i % 37).or_insert(0) += 1;
+    EXPECT_EQ(counts.len(), 37u);
+    for (i32 key = 0; key < 37; ++key) EXPECT_EQ(**counts.get(key), key < 400 % 37 ? 11 : 10);
+
+    auto entry = counts.entry(100);
+    EXPECT_TRUE(entry.is_vacant());
+    EXPECT_EQ(entry.key(), 100);
+    EXPECT_TRUE(entry.get().is_none());
+    auto doubled = rstd::move(entry).or_insert_with_key([](const i32& key) {
+        return key * 2;
+    });
+    EXPECT_EQ(*doubled, 200);
+
+    *counts.entry(100)
+         .and_modify([](i32& value) {
+             value += 1;
+         })
+         .or_insert(0) += 1;
+    EXPECT_EQ(**counts.get(100), 202);
+    EXPECT_EQ(*counts.entry(5).insert(-5), -5);
+    EXPECT_EQ(counts.entry(5).remove(), Some(-5));
+    EXPECT_TRUE(counts.entry(5).remove().is_none());
+    EXPECT_FALSE(counts.contains_key(5));
+
+    // Vacant entries reuse tombstones left by removals.
+    for (i32 key = 0; key < 37; ++key) (void)counts.remove(key);
+    usize capacity = counts.capacity();
+    for (i32 key = 0; key < 37; ++key) *counts.entry(key).or_default() += key;
+    EXPECT_EQ(counts.capacity(), capacity);
+    for (i32 key = 0; key < 37; ++key) EXPECT_EQ(**counts.get(key), key);
+}
+
+TEST(HashMap, RawEntryUsesTheCallersHash) {
+    auto map  = HashMap<rstd::string::String, i32>::make();
+    auto name = rstd::string::String::make("gamma");
+    u64  hash = map.hash_of(name);
+
+    auto missing = map.raw_entry_mut(hash, [&](const rstd::string::String& key) {
+        return key == name;
+    });
+    EXPECT_TRUE(missing.is_vacant());
+    EXPECT_EQ(*rstd::move(missing).or_insert(name.clone(), 3), 3);
+
+    auto present = map.raw_entry_mut(hash, [&](const rstd::string::String& key) {
+        return key == name;
+    });
+    ASSERT_TRUE(present.is_occupied());
+    **present.get() = 4;
+    auto found = map.raw_entry(hash, [&](const rstd::string::String& key) {
+        return key == name;
+    });
+    ASSERT_TRUE(found.is_some());
+    EXPECT_EQ(*found->get<1>(), 4);
+    EXPECT_EQ(**map.get(name), 4);
+}
+
+TEST(HashMap, GetManyMutAndExtend) {
+    auto map = HashMap<i32, i32>::make();
+    map.extend(iter::range(0, 100).map([](i32 key) {
+        return rstd::tuple<i32, i32>(key, key);
+    }));
+    EXPECT_EQ(map.len(), 100u);
+    EXPECT_GE(map.capacity(), 100u);
+
+    auto values = map.get_many_mut({ 3, 7 });
+    ASSERT_TRUE(values.is_some());
+    rstd::swap(*(*values)[0], *(*values)[1]);
+    EXPECT_EQ(**map.get(3), 7);
+    EXPECT_EQ(**map.get(7), 3);
+    EXPECT_TRUE(map.get_many_mut({ 3, 3 }).is_none());
+    EXPECT_TRUE(map.get_many_mut({ 3, 1000 }).is_none());
+}
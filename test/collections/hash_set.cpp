@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+import rstd;
+
+using namespace rstd::prelude;
+using rstd::collections::HashSet;
+namespace iter = rstd::iter;
+
+TEST(HashSet, InsertContainsAndRemove) {
+    auto set = HashSet<i32>::make();
+    EXPECT_TRUE(set.insert(1));
+    EXPECT_TRUE(set.insert(2));
+    EXPECT_FALSE(set.insert(1));
+    EXPECT_EQ(set.len(), 2u);
+    EXPECT_TRUE(set.contains(2));
+    EXPECT_FALSE(set.contains(3));
+    EXPECT_EQ(*set.get(1).unwrap(), 1);
+
+    EXPECT_TRUE(set.remove(1));
+    EXPECT_FALSE(set.remove(1));
+    EXPECT_EQ(set.take(2), Some(2));
+    EXPECT_TRUE(set.is_empty());
+}
+
+TEST(HashSet, CollectRetainAndSubsets) {
+    auto evens = iter::range(0, 200)
+                     .map([](i32 value) {
+                         return value * 2;
+                     })
+                     .collect<HashSet<i32>>();
+    EXPECT_EQ(evens.len(), 200u);
+
+    auto small = HashSet<i32>::make();
+    small.extend(iter::range(0, 10).map([](i32 value) {
+        return value * 4;
+    }));
+    EXPECT_TRUE(small.is_subset(evens));
+    EXPECT_FALSE(evens.is_subset(small));
+
+    auto odds = HashSet<i32>::with_capacity(4);
+    (void)odds.insert(1);
+    (void)odds.insert(3);
+    EXPECT_TRUE(odds.is_disjoint(evens));
+    EXPECT_FALSE(small.is_disjoint(evens));
+
+    usize capacity = evens.capacity();
+    evens.retain([](const i32& value) {
+        return value % 3 == 0;
+    });
+    EXPECT_EQ(evens.capacity(), capacity);
+    EXPECT_EQ(evens.len(), 67u);
+    EXPECT_TRUE(evens.contains(6));
+    EXPECT_FALSE(evens.contains(4));
+
+    u64 hash = evens.hash_of(12);
+    auto twelve = evens.get_with_hash(hash, [](const i32& value) {
+        return value == 12;
+    });
+    EXPECT_TRUE(twelve.is_some());
+
+    usize count = 0;
+    auto  owned = evens.into_iter();
+    for (auto value = owned.next(); value.is_some(); value = owned.next()) {
+        EXPECT_EQ(*value % 6, 0);
+        ++count;
+    }
+    EXPECT_EQ(count, 67u);
+}
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+import rstd;
+
+using namespace rstd::prelude;
+using rstd::collections::IntrusiveLink;
+using rstd::collections::IntrusiveList;
+using rstd::collections::Slab;
+using rstd::collections::SlotKey;
+using rstd::collections::SlotMap;
+
+namespace
+{
+
+struct TrackedSlabValue {
+    static inline i32 live = 0;
+    i32               value;
+
+    explicit TrackedSlabValue(i32 v): value(v) { ++live; }
+    TrackedSlabValue(const TrackedSlabValue&)            = delete;
+    TrackedSlabValue& operator=(const TrackedSlabValue&) = delete;
+    TrackedSlabValue(TrackedSlabValue&& other) noexcept: value(other.value) { ++live; }
+    TrackedSlabValue& operator=(TrackedSlabValue&& other) noexcept {
+        value = other.value;
+        return *this;
+    }
+    ~TrackedSlabValue() { --live; }
+};
+
+struct ReadyTag {};
+struct TimerTag {};
+
+struct ListNode : IntrusiveLink<ListNode, ReadyTag>, IntrusiveLink<ListNode, TimerTag> {
+    i32 id;
+
+    explicit ListNode(i32 node_id): id(node_id) {}
+};
+
+} // namespace
+
+TEST(Slab, ReusesVacatedKeys) {
+    auto slab = Slab<i32>::make();
+    auto a    = slab.insert(10);
+    auto b    = slab.insert(20);
+    auto c    = slab.insert(30);
+    EXPECT_EQ(slab.len(), 3u);
+    EXPECT_EQ(*slab.get(b).unwrap(), 20);
+
+    EXPECT_EQ(slab.remove(b), 20);
+    EXPECT_FALSE(slab.contains(b));
+    EXPECT_TRUE(slab.try_remove(b).is_none());
+    EXPECT_EQ(slab.vacant_key(), b);
+    EXPECT_EQ(slab.insert(40), b);
+
+    *slab.get_mut(a).unwrap() = 11;
+    i32  sum = 0;
+    auto it  = slab.iter();
+    for (auto entry = it.next(); entry.is_some(); entry = it.next()) {
+        sum += *entry->template get<1>();
+    }
+    EXPECT_EQ(sum, 11 + 40 + 30);
+    EXPECT_EQ(slab.remove(c), 30);
+    EXPECT_EQ(slab.len(), 2u);
+}
+
+TEST(Slab, DropsValuesOnRemoveRetainAndClear) {
+    TrackedSlabValue::live = 0;
+    {
+        auto slab = Slab<TrackedSlabValue>::make();
+        for (i32 i = 0; i < 6; ++i) (void)slab.insert(TrackedSlabValue { i });
+        EXPECT_EQ(TrackedSlabValue::live, 6);
+
+        slab.retain([](usize, TrackedSlabValue& value) { return value.value % 2 == 0; });
+        EXPECT_EQ(slab.len(), 3u);
+        EXPECT_EQ(TrackedSlabValue::live, 3);
+
+        slab.clear();
+        EXPECT_EQ(TrackedSlabValue::live, 0);
+        (void)slab.insert(TrackedSlabValue { 9 });
+    }
+    EXPECT_EQ(TrackedSlabValue::live, 0);
+}
+
+TEST(SlotMap, StaleKeysMissAfterSlotReuse) {
+    auto map   = SlotMap<i32>::make();
+    auto first = map.insert(1);
+    EXPECT_EQ(*map.get(first).unwrap(), 1);
+    EXPECT_EQ(map.remove(first).unwrap(), 1);
+
+    auto second = map.insert(2);
+    EXPECT_EQ(second.index, first.index);
+    EXPECT_NE(second, first);
+    EXPECT_FALSE(map.contains_key(first));
+    EXPECT_TRUE(map.get(first).is_none());
+    EXPECT_TRUE(map.remove(first).is_none());
+    EXPECT_EQ(*map.get(second).unwrap(), 2);
+
+    EXPECT_TRUE(SlotKey::null().is_null());
+    EXPECT_TRUE(map.get(SlotKey::null()).is_none());
+
+    auto third = map.insert_with_key([](SlotKey key) { return i32(key.index) * 100; });
+    EXPECT_EQ(*map.get(third).unwrap(), i32(third.index) * 100);
+
+    map.clear();
+    EXPECT_TRUE(map.is_empty());
+    EXPECT_FALSE(map.contains_key(second));
+}
+
+TEST(SlotMap, RemovesOneOfManyWithoutDisturbingOthers) {
+    auto map  = SlotMap<usize>::with_capacity(1000);
+    auto keys = rstd::vec::Vec<SlotKey>::make();
+    for (usize i = 0; i < 1000; ++i) keys.push(map.insert(i));
+
+    for (usize i = 0; i < 1000; i += 3) EXPECT_EQ(map.remove(keys[i]).unwrap(), i);
+    for (usize i = 0; i < 1000; ++i) EXPECT_EQ(map.contains_key(keys[i]), i % 3 != 0);
+
+    usize seen = 0;
+    auto  it   = map.iter();
+    for (auto entry = it.next(); entry.is_some(); entry = it.next()) {
+        auto [key, value] = rstd::move(entry).unwrap_unchecked();
+        EXPECT_EQ(keys[*value], key);
+        ++seen;
+    }
+    EXPECT_EQ(seen, map.len());
+}
+
+TEST(IntrusiveList, UnlinksInConstantTimeAcrossTags) {
+    ListNode a { 1 }, b { 2 }, c { 3 };
+
+    auto ready  = IntrusiveList<ListNode, ReadyTag>::make();
+    auto timers = IntrusiveList<ListNode, TimerTag>::make();
+    ready.push_back(a);
+    ready.push_back(b);
+    ready.push_front(c);
+    timers.push_back(b);
+    EXPECT_EQ(ready.len(), 3u);
+    EXPECT_EQ(ready.front().unwrap()->id, 3);
+    EXPECT_EQ(ready.back().unwrap()->id, 2);
+
+    EXPECT_TRUE(ready.remove(a));
+    EXPECT_FALSE(ready.remove(a));
+    EXPECT_TRUE(static_cast<IntrusiveLink<ListNode, TimerTag>&>(b).is_linked());
+
+    i32 order = 0;
+    ready.for_each([&](ListNode& node) { order = order * 10 + node.id; });
+    EXPECT_EQ(order, 32);
+
+    EXPECT_EQ(ready.pop_front().unwrap()->id, 3);
+    EXPECT_EQ(ready.pop_back().unwrap()->id, 2);
+    EXPECT_TRUE(ready.pop_front().is_none());
+    EXPECT_TRUE(ready.is_empty());
+
+    ready.push_back(a);
+    ready.clear();
+    EXPECT_FALSE(static_cast<IntrusiveLink<ListNode, ReadyTag>&>(a).is_linked());
+    timers.clear();
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+import rstd;
+
+using namespace rstd::prelude;
+using rstd::collections::VecDeque;
+
+namespace
+{
+
+struct TrackedDequeValue {
+    static inline i32 live = 0;
+    i32               value;
+
+    explicit TrackedDequeValue(i32 v): value(v) { ++live; }
+    TrackedDequeValue(const TrackedDequeValue&)            = delete;
+    TrackedDequeValue& operator=(const TrackedDequeValue&) = delete;
+    TrackedDequeValue(TrackedDequeValue&& other) noexcept: value(other.value) { ++live; }
+    TrackedDequeValue& operator=(TrackedDequeValue&& other) noexcept {
+        value = other.value;
+        return *this;
+    }
+    ~TrackedDequeValue() { --live; }
+};
+
+} // namespace
+
+TEST(VecDeque, PushesAndPopsAtBothEnds) {
+    auto deque = VecDeque<i32>::make();
+    EXPECT_TRUE(deque.pop_front().is_none());
+    EXPECT_TRUE(deque.pop_back().is_none());
+
+    deque.push_back(2);
+    deque.push_back(3);
+    deque.push_front(1);
+    deque.push_front(0);
+    EXPECT_EQ(deque.len(), 4u);
+    EXPECT_EQ(*deque.front().unwrap(), 0);
+    EXPECT_EQ(*deque.back().unwrap(), 3);
+    for (i32 i = 0; i < 4; ++i) EXPECT_EQ(deque[usize(i)], i);
+
+    EXPECT_EQ(deque.pop_front().unwrap(), 0);
+    EXPECT_EQ(deque.pop_back().unwrap(), 3);
+    EXPECT_EQ(deque.len(), 2u);
+    EXPECT_TRUE(deque.get(2).is_none());
+}
+
+TEST(VecDeque, WrapsAndGrowsInOrder) {
+    auto deque = VecDeque<i32>::with_capacity(4);
+    // Rotate the head around the ring so the contents wrap before growing.
+    for (i32 i = 0; i < 3; ++i) deque.push_back(i);
+    for (i32 i = 0; i < 3; ++i) {
+        EXPECT_EQ(deque.pop_front().unwrap(), i);
+        deque.push_back(i + 3);
+    }
+    auto [front, back] = deque.as_slices();
+    EXPECT_EQ(front.len() + back.len(), 3u);
+    EXPECT_GT(back.len(), 0u);
+
+    for (i32 i = 6; i < 40; ++i) deque.push_back(i);
+    EXPECT_EQ(deque.len(), 37u);
+    i32  expected = 3;
+    auto it       = deque.iter();
+    EXPECT_EQ(it.len(), 37u);
+    for (auto value = it.next(); value.is_some(); value = it.next()) EXPECT_EQ(**value, expected++);
+    EXPECT_EQ(expected, 40);
+
+    auto contiguous = deque.make_contiguous();
+    ASSERT_EQ(contiguous.len(), 37u);
+    for (usize i = 0; i < contiguous.len(); ++i) EXPECT_EQ(contiguous[i], i32(i) + 3);
+}
+
+TEST(VecDeque, FromVecAndDropsElements) {
+    {
+        auto values = rstd::vec::Vec<TrackedDequeValue>::make();
+        for (i32 i = 0; i < 5; ++i) values.push(TrackedDequeValue { i });
+        auto deque = VecDeque<TrackedDequeValue>::from_vec(rstd::move(values));
+        EXPECT_EQ(deque.len(), 5u);
+        deque.push_front(TrackedDequeValue { -1 });
+        EXPECT_EQ(deque.front().unwrap()->value, -1);
+        EXPECT_EQ(deque.back().unwrap()->value, 4);
+        deque.truncate(3);
+        EXPECT_EQ(TrackedDequeValue::live, 3);
+        auto moved = rstd::move(deque);
+        EXPECT_EQ(moved.len(), 3u);
+        EXPECT_TRUE(deque.is_empty());
+    }
+    EXPECT_EQ(TrackedDequeValue::live, 0);
+}
@@ -1,3 +1,4 @@
+#include <atomic>
 #include <cstring>
 #include <gtest/gtest.h>
 import rstd;
@@ -298,6 +299,21 @@ TEST(FsFreeFn, CopyDuplicates) {
     libc::unlink(dst_buf);
 }
 
+TEST(FsFreeFn, CopyReadsZeroSizedProcFiles) {
+    // procfs reports a zero size; the copy must still see the content.
+    char dst_buf[] = "/tmp/rstd-fs-copy-proc-XXXXXX";
+    int  fd        = libc::mkstemp(dst_buf);
+    libc::close(fd);
+
+    auto n = rstd::fs::copy(rstd::ref<rstd::path::Path>("/proc/self/status"),
+                            rstd::ref<rstd::path::Path>(dst_buf))
+                 .unwrap_unchecked();
+    EXPECT_GT(n, 0u);
+    auto v = rstd::fs::read(rstd::ref<rstd::path::Path>(dst_buf)).unwrap_unchecked();
+    EXPECT_EQ(v.len(), n);
+    libc::unlink(dst_buf);
+}
+
 TEST(FsFreeFn, CreateAndRemoveDir) {
     char dir_buf[] = "/tmp/rstd-fs-dir-XXXXXX";
     auto p         = libc::mkdtemp(dir_buf);
@@ -436,6 +452,63 @@ TEST(FsFile, ReadAtWriteAt) {
     EXPECT_EQ(std::memcmp(trait_buf, "WORLD", 5), 0);
 }
 
+TEST(FsFile, VectoredAtRoundTrip) {
+    TempPath tp;
+    auto     f = OpenOptions::make().read(true).write(true).open(tp.as_path()).unwrap_unchecked();
+
+    rstd::io::IoSlice out[2] = {
+        rstd::io::IoSlice::make(reinterpret_cast<const rstd::u8*>("head-"), 5),
+        rstd::io::IoSlice::make(reinterpret_cast<const rstd::u8*>("tail"), 4),
+    };
+    auto written = f.write_vectored_at(rstd::slice<rstd::io::IoSlice>::from_raw_parts(out, 2), 10);
+    ASSERT_TRUE(written.is_ok());
+    EXPECT_EQ(written.unwrap_unchecked(), 9u);
+
+    rstd::u8               a[3] = {};
+    rstd::u8               b[6] = {};
+    rstd::io::IoSliceMut in[2]  = { rstd::io::IoSliceMut::make(a, 3),
+                                    rstd::io::IoSliceMut::make(b, 6) };
+    auto read = f.read_vectored_at(rstd::slice<rstd::io::IoSliceMut>::from_raw_parts(in, 2), 10);
+    ASSERT_TRUE(read.is_ok());
+    EXPECT_EQ(read.unwrap_unchecked(), 9u);
+    EXPECT_EQ(std::memcmp(a, "hea", 3), 0);
+    EXPECT_EQ(std::memcmp(b, "d-tail", 6), 0);
+}
+
+TEST(FsFile, AllocateAdviseAndSyncRange) {
+    TempPath tp;
+    auto     f = OpenOptions::make().read(true).write(true).open(tp.as_path()).unwrap_unchecked();
+
+    auto allocated = f.allocate(0, 8192);
+    if (allocated.is_err()) GTEST_SKIP() << "filesystem does not support fallocate";
+    EXPECT_EQ(f.metadata().unwrap_unchecked().len(), 8192u);
+    EXPECT_TRUE(f.allocate(8192, 4096, rstd::fs::AllocMode::KeepSize).is_ok());
+    EXPECT_EQ(f.metadata().unwrap_unchecked().len(), 8192u);
+
+    EXPECT_TRUE(f.advise(rstd::fs::FileAdvice::Sequential).is_ok());
+    EXPECT_TRUE(f.write_all_at(reinterpret_cast<const rstd::u8*>("seg"), 3, 0).is_ok());
+    EXPECT_TRUE(f.sync_range(0, 0, true).is_ok());
+}
+
+TEST(FsFile, AlignedBufferForDirectIo) {
+    auto buf = OpenOptions::aligned_buffer(8192).unwrap_unchecked();
+    EXPECT_EQ(buf.len(), 8192u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(buf.as_ptr()) % rstd::fs::DIRECT_IO_ALIGN, 0u);
+    EXPECT_EQ(buf.as_slice()[0], 0);
+    EXPECT_TRUE(OpenOptions::aligned_buffer(64, 3).is_err());
+
+    TempPath tp;
+    auto     opened = OpenOptions::make().read(true).write(true).direct(true).open(tp.as_path());
+    if (opened.is_err()) GTEST_SKIP() << "filesystem does not support O_DIRECT";
+    auto f = rstd::move(opened).unwrap_unchecked();
+
+    rstd::mem::memset(buf.as_mut_ptr(), 'd', 4096);
+    EXPECT_TRUE(f.write_all_at(buf.as_ptr(), 4096, 0).is_ok());
+    auto back = OpenOptions::aligned_buffer(4096).unwrap_unchecked();
+    EXPECT_TRUE(f.read_exact_at(back.as_mut_ptr(), 4096, 0).is_ok());
+    EXPECT_EQ(back.as_slice()[4095], 'd');
+}
+
 TEST(FsFile, FlockExclusiveBlocks) {
     TempPath tp;
     auto     f1 = File::create(tp.as_path()).unwrap_unchecked();
@@ -465,3 +538,279 @@ TEST(Fs, ReadTraitImplCanBeUsed) {
     ASSERT_TRUE(res.is_ok());
     EXPECT_EQ(res.unwrap_unchecked(), 3u);
 }
+
+TEST(Fs, IoCopyBetweenFiles) {
+    TempPath src_path;
+    TempPath dst_path;
+    auto     payload = rstd::slice<rstd::u8>::from_raw_parts(
+        reinterpret_cast<const rstd::u8*>("kernel copy payload"), 19);
+    ASSERT_TRUE(rstd::fs::write(src_path.as_path(), payload).is_ok());
+
+    auto src = File::open(src_path.as_path()).unwrap_unchecked();
+    auto dst = File::create(dst_path.as_path()).unwrap_unchecked();
+    auto res = rstd::io::copy(src, dst);
+    ASSERT_TRUE(res.is_ok());
+    EXPECT_EQ(res.unwrap_unchecked(), 19u);
+
+    auto back = rstd::fs::read(dst_path.as_path());
+    ASSERT_TRUE(back.is_ok());
+    auto bytes = rstd::move(back).unwrap_unchecked();
+    ASSERT_EQ(bytes.len(), 19u);
+    EXPECT_EQ(std::memcmp(bytes.as_slice().p, "kernel copy payload", 19), 0);
+}
+
+TEST(FsMmap, MapReadOnlyExposesFileBytes) {
+    TempPath tp;
+    auto     payload = rstd::slice<rstd::u8>::from_raw_parts(
+        reinterpret_cast<const rstd::u8*>("mapped text"), 11);
+    ASSERT_TRUE(rstd::fs::write(tp.as_path(), payload).is_ok());
+
+    auto f   = File::open(tp.as_path()).unwrap_unchecked();
+    auto res = rstd::fs::Mmap::map(f);
+    ASSERT_TRUE(res.is_ok());
+    auto map = rstd::move(res).unwrap_unchecked();
+    ASSERT_EQ(map.len(), 11u);
+    EXPECT_TRUE(map.advise(rstd::fs::Advice::Sequential).is_ok());
+
+    auto text = rstd::str_::from_utf8(map.as_slice());
+    ASSERT_TRUE(text.is_some());
+    EXPECT_EQ(text.unwrap(), rstd::ref<rstd::str>("mapped text"));
+}
+
+TEST(FsMmap, UnalignedOffsetAndLength) {
+    TempPath tp;
+    auto     payload = rstd::slice<rstd::u8>::from_raw_parts(
+        reinterpret_cast<const rstd::u8*>("0123456789"), 10);
+    ASSERT_TRUE(rstd::fs::write(tp.as_path(), payload).is_ok());
+
+    auto f   = File::open(tp.as_path()).unwrap_unchecked();
+    auto res = rstd::fs::MmapOptions::make().offset(3).len(4).populate(true).map(f);
+    ASSERT_TRUE(res.is_ok());
+    auto map = rstd::move(res).unwrap_unchecked();
+    ASSERT_EQ(map.len(), 4u);
+    EXPECT_EQ(std::memcmp(map.as_ptr(), "3456", 4), 0);
+}
+
+TEST(FsMmap, MapMutWritesThrough) {
+    TempPath tp;
+    auto     payload = rstd::slice<rstd::u8>::from_raw_parts(
+        reinterpret_cast<const rstd::u8*>("aaaa"), 4);
+    ASSERT_TRUE(rstd::fs::write(tp.as_path(), payload).is_ok());
+
+    {
+        auto f = rstd::fs::OpenOptions::make()
+                     .read(true)
+                     .write(true)
+                     .open(tp.as_path())
+                     .unwrap_unchecked();
+        auto map = rstd::fs::MmapMut::map_mut(f).unwrap_unchecked();
+        map.as_mut_ptr()[1] = 'b';
+        EXPECT_TRUE(map.flush().is_ok());
+    }
+
+    auto back = rstd::fs::read(tp.as_path()).unwrap_unchecked();
+    EXPECT_EQ(std::memcmp(back.as_slice().p, "abaa", 4), 0);
+}
+
+TEST(FsMmap, EmptyFileMapsToEmptySlice) {
+    TempPath tp;
+    auto     f   = File::open(tp.as_path()).unwrap_unchecked();
+    auto     res = rstd::fs::Mmap::map(f);
+    ASSERT_TRUE(res.is_ok());
+    EXPECT_TRUE(res.unwrap_unchecked().is_empty());
+}
+
+namespace
+{
+
+// base/a, base/sub/b, base/sub/deeper/c
+void make_walk_tree(const char* base) {
+    auto one = rstd::slice<rstd::u8>::from_raw_parts(reinterpret_cast<const rstd::u8*>("z"), 1);
+    rstd::path::PathBuf deeper = rstd::path::PathBuf::from(base);
+    deeper.push(rstd::ref<rstd::path::Path>("sub"));
+    deeper.push(rstd::ref<rstd::path::Path>("deeper"));
+    rstd::fs::create_dir_all(deeper).unwrap_unchecked();
+
+    for (const char* rel : { "a", "sub/b", "sub/deeper/c" }) {
+        rstd::path::PathBuf f = rstd::path::PathBuf::from(base);
+        f.push(rstd::ref<rstd::path::Path>(rel));
+        rstd::fs::write(f, one).unwrap_unchecked();
+    }
+}
+
+auto count_walk(rstd::fs::WalkDir const& walk) -> int {
+    auto it    = walk.iter();
+    int  count = 0;
+    while (true) {
+        auto next = it.next();
+        if (next.is_none()) break;
+        EXPECT_TRUE((*next).is_ok());
+        count++;
+    }
+    return count;
+}
+
+} // namespace
+
+TEST(FsWalkDir, VisitsWholeTreePreOrder) {
+    char base[] = "/tmp/rstd-fs-walk-XXXXXX";
+    libc::mkdtemp(base);
+    make_walk_tree(base);
+
+    auto it    = rstd::fs::WalkDir::make(rstd::ref<rstd::path::Path>(base)).iter();
+    auto first = it.next();
+    ASSERT_TRUE(first.is_some());
+    auto root = rstd::move(first).unwrap_unchecked().unwrap_unchecked();
+    EXPECT_EQ(root.depth(), 0u);
+    EXPECT_TRUE(root.file_type().is_dir());
+
+    int files = 0;
+    int dirs  = 0;
+    while (true) {
+        auto next = it.next();
+        if (next.is_none()) break;
+        auto e = rstd::move(next).unwrap_unchecked().unwrap_unchecked();
+        if (e.file_type().is_file()) files++;
+        if (e.file_type().is_dir()) dirs++;
+        EXPECT_TRUE(e.path().starts_with(rstd::ref<rstd::path::Path>(base)));
+    }
+    EXPECT_EQ(files, 3);
+    EXPECT_EQ(dirs, 2);
+
+    rstd::fs::remove_dir_all(rstd::ref<rstd::path::Path>(base)).unwrap_unchecked();
+}
+
+TEST(FsWalkDir, DepthLimits) {
+    char base[] = "/tmp/rstd-fs-walk-XXXXXX";
+    libc::mkdtemp(base);
+    make_walk_tree(base);
+
+    auto walk = rstd::fs::WalkDir::make(rstd::ref<rstd::path::Path>(base));
+    EXPECT_EQ(count_walk(walk), 6);
+    EXPECT_EQ(count_walk(walk.max_depth(1)), 3);
+    EXPECT_EQ(count_walk(walk.max_depth(2).min_depth(2)), 2);
+
+    rstd::fs::remove_dir_all(rstd::ref<rstd::path::Path>(base)).unwrap_unchecked();
+}
+
+TEST(FsWalkDir, ParallelVisitsEveryEntry) {
+    char base[] = "/tmp/rstd-fs-walk-XXXXXX";
+    libc::mkdtemp(base);
+    make_walk_tree(base);
+
+    std::atomic<int> files { 0 };
+    std::atomic<int> total { 0 };
+    auto             res = rstd::fs::WalkDir::make(rstd::ref<rstd::path::Path>(base))
+                   .par_for_each(4, [&](rstd::fs::WalkEntry const& e) {
+                       total++;
+                       if (e.file_type().is_file()) files++;
+                   });
+    ASSERT_TRUE(res.is_ok());
+    EXPECT_EQ(total.load(), 6);
+    EXPECT_EQ(files.load(), 3);
+
+    rstd::fs::remove_dir_all(rstd::ref<rstd::path::Path>(base)).unwrap_unchecked();
+}
+
+TEST(FsWalkDir, ParallelFollowsSymlinkedDirsOnlyWhenAsked) {
+    char base[] = "/tmp/rstd-fs-walk-XXXXXX";
+    libc::mkdtemp(base);
+    make_walk_tree(base);
+    rstd::path::PathBuf link = rstd::path::PathBuf::from(base);
+    link.push(rstd::ref<rstd::path::Path>("link"));
+    rstd::fs::soft_link(rstd::ref<rstd::path::Path>("sub"), link).unwrap_unchecked();
+
+    auto walk  = rstd::fs::WalkDir::make(rstd::ref<rstd::path::Path>(base));
+    auto count = [](rstd::fs::WalkDir const& w) {
+        std::atomic<int> total { 0 };
+        auto res = w.par_for_each(4, [&](rstd::fs::WalkEntry const&) { total++; });
+        EXPECT_TRUE(res.is_ok());
+        return total.load();
+    };
+    EXPECT_EQ(count(walk), 7);
+    EXPECT_EQ(count(walk.follow_links(true)), 10);
+
+    rstd::fs::remove_dir_all(rstd::ref<rstd::path::Path>(base)).unwrap_unchecked();
+}
+
+TEST(FsWalkDir, MissingRootIsError) {
+    auto it   = rstd::fs::WalkDir::make(rstd::ref<rstd::path::Path>("/nonexistent/rstd-walk"))
+                  .iter();
+    auto next = it.next();
+    ASSERT_TRUE(next.is_some());
+    EXPECT_TRUE((*next).is_err());
+    EXPECT_TRUE(it.next().is_none());
+}
+
+namespace
+{
+
+auto async_file_round_trip(rstd::ref<rstd::path::Path> path)
+    -> rstd::async::coro<rstd::io::Result<rstd::bytes::BytesMut>> {
+    auto created = co_await rstd::async::fs::File::create(path);
+    if (created.is_err()) co_return rstd::Err(rstd::move(created).unwrap_err_unchecked());
+    auto file = rstd::move(created).unwrap_unchecked();
+
+    auto payload = rstd::bytes::Bytes::copy_from_slice(
+        rstd::slice<rstd::u8>::from_raw_parts(reinterpret_cast<const rstd::u8*>("async!"), 6));
+    auto written = co_await rstd::async::io::write_all(file, payload);
+    if (written.is_err()) co_return rstd::Err(rstd::move(written).unwrap_err_unchecked());
+    auto flushed = co_await rstd::async::io::flush(file);
+    if (flushed.is_err()) co_return rstd::Err(rstd::move(flushed).unwrap_err_unchecked());
+
+    auto opened = co_await rstd::async::fs::File::open(path);
+    if (opened.is_err()) co_return rstd::Err(rstd::move(opened).unwrap_err_unchecked());
+    auto reader = rstd::move(opened).unwrap_unchecked();
+    auto back   = rstd::bytes::BytesMut::with_capacity(16);
+    auto read   = co_await rstd::async::io::read_exact(reader, back, 6);
+    if (read.is_err()) co_return rstd::Err(rstd::move(read).unwrap_err_unchecked());
+
+    auto eof = co_await rstd::async::io::read(reader, back);
+    if (eof.is_err()) co_return rstd::Err(rstd::move(eof).unwrap_err_unchecked());
+    EXPECT_EQ(eof.unwrap_unchecked(), 0u);
+    co_return rstd::Ok(rstd::move(back));
+}
+
+} // namespace
+
+TEST(FsAsync, WriteReadMetadataRoundTrip) {
+    TempPath tp;
+    auto     data =
+        rstd::slice<rstd::u8>::from_raw_parts(reinterpret_cast<const rstd::u8*>("xyz"), 3);
+    ASSERT_TRUE(rstd::async::block_on(rstd::async::fs::write(tp.as_path(), data)).is_ok());
+
+    auto back = rstd::async::block_on(rstd::async::fs::read(tp.as_path()));
+    ASSERT_TRUE(back.is_ok());
+    auto bytes = rstd::move(back).unwrap_unchecked();
+    ASSERT_EQ(bytes.len(), 3u);
+    EXPECT_EQ(std::memcmp(bytes.as_slice().p, "xyz", 3), 0);
+
+    auto meta = rstd::async::block_on(rstd::async::fs::metadata(tp.as_path()));
+    ASSERT_TRUE(meta.is_ok());
+    EXPECT_EQ(meta.unwrap_unchecked().len(), 3u);
+}
+
+TEST(FsAsync, FileImplementsAsyncReadWrite) {
+    TempPath tp;
+    auto     res = rstd::async::block_on(async_file_round_trip(tp.as_path()));
+    ASSERT_TRUE(res.is_ok());
+    auto back = rstd::move(res).unwrap_unchecked();
+    ASSERT_EQ(back.len(), 6u);
+    EXPECT_EQ(std::memcmp(back.data(), "async!", 6), 0);
+}
+
+TEST(FsAsync, ReadDirReturnsWholeListing) {
+    char base[] = "/tmp/rstd-fs-async-XXXXXX";
+    libc::mkdtemp(base);
+    make_walk_tree(base);
+
+    auto res = rstd::async::block_on(rstd::async::fs::read_dir(rstd::ref<rstd::path::Path>(base)));
+    ASSERT_TRUE(res.is_ok());
+    EXPECT_EQ(res.unwrap_unchecked().len(), 2u);
+
+    auto missing = rstd::async::block_on(
+        rstd::async::fs::metadata(rstd::ref<rstd::path::Path>("/nonexistent/x")));
+    EXPECT_TRUE(missing.is_err());
+
+    rstd::fs::remove_dir_all(rstd::ref<rstd::path::Path>(base)).unwrap_unchecked();
+}
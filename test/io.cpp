@@ -416,3 +416,80 @@ TEST(Io, CopyAll) {
     EXPECT_EQ(dst.get_ref()[0], u8(1));
     EXPECT_EQ(dst.get_ref()[4], u8(5));
 }
+
+TEST(Io, CopyFromBufReader) {
+    using rstd::vec::Vec;
+    Vec<u8> src_v = Vec<u8>::with_capacity(10);
+    for (u8 b = 0; b < 10; ++b) src_v.push(u8(b));
+    auto br  = io::BufReader<io::Cursor<Vec<u8>>>(io::Cursor<Vec<u8>>(rstd::move(src_v)), 4);
+    auto dst = io::Cursor<Vec<u8>>(Vec<u8>::with_capacity(0));
+    auto res = io::copy(br, dst);
+    ASSERT_TRUE(res.is_ok());
+    EXPECT_EQ(res.unwrap_unchecked(), u64(10));
+    EXPECT_EQ(dst.get_ref()[9], u8(9));
+}
+
+// ── read_until / read_line / lines ────────────────────────────────────────
+
+namespace
+{
+auto text_reader(const char* text, usize capacity) {
+    using rstd::vec::Vec;
+    Vec<u8> v = Vec<u8>::make();
+    for (const char* p = text; *p != 0; ++p) v.push(u8(*p));
+    return io::BufReader<io::Cursor<Vec<u8>>>(io::Cursor<Vec<u8>>(rstd::move(v)), capacity);
+}
+} // namespace
+
+TEST(Io, ReadUntilSpansBufferRefills) {
+    using rstd::vec::Vec;
+    auto    br  = text_reader("abcdefgh;rest", 3);
+    Vec<u8> out = Vec<u8>::make();
+    auto    res = io::read_until(br, u8(';'), out);
+    ASSERT_TRUE(res.is_ok());
+    EXPECT_EQ(res.unwrap_unchecked(), usize(9));
+    EXPECT_EQ(out.len(), usize(9));
+    EXPECT_EQ(out[8], u8(';'));
+
+    out.clear();
+    res = io::read_until(br, u8(';'), out);
+    ASSERT_TRUE(res.is_ok());
+    EXPECT_EQ(res.unwrap_unchecked(), usize(4));
+    EXPECT_EQ(out[0], u8('r'));
+}
+
+TEST(Io, ReadLineKeepsNewline) {
+    auto br   = text_reader("one\ntwo", 8);
+    auto line = rstd::string::String::make();
+    auto res  = io::read_line(br, line);
+    ASSERT_TRUE(res.is_ok());
+    EXPECT_EQ(res.unwrap_unchecked(), usize(4));
+    EXPECT_EQ(line, "one\n");
+}
+
+TEST(Io, LinesStripsLineEndings) {
+    auto it     = io::lines(text_reader("alpha\r\nbeta\n\ngamma", 4));
+    auto first  = it.next();
+    auto second = it.next();
+    auto empty  = it.next();
+    auto last   = it.next();
+    ASSERT_TRUE(first.is_some() && second.is_some() && empty.is_some() && last.is_some());
+    EXPECT_EQ((*first).unwrap_unchecked(), "alpha");
+    EXPECT_EQ((*second).unwrap_unchecked(), "beta");
+    EXPECT_TRUE((*empty).unwrap_unchecked().is_empty());
+    EXPECT_EQ((*last).unwrap_unchecked(), "gamma");
+    EXPECT_TRUE(it.next().is_none());
+}
+
+TEST(Io, BufWriterBypassesLargeWrites) {
+    using rstd::vec::Vec;
+    auto bw = io::BufWriter<io::Cursor<Vec<u8>>>(io::Cursor<Vec<u8>>(Vec<u8>::make()), 4);
+    const u8 small[] = { 1, 2 };
+    const u8 large[] = { 3, 4, 5, 6, 7, 8 };
+    ASSERT_TRUE(as<io::Write>(bw).write(small, 2).is_ok());
+    EXPECT_EQ(bw.buffer().len(), usize(2));
+    ASSERT_TRUE(as<io::Write>(bw).write(large, 6).is_ok());
+    EXPECT_EQ(bw.buffer().len(), usize(0));
+    EXPECT_EQ(bw.get_ref().get_ref().len(), usize(8));
+    EXPECT_EQ(bw.get_ref().get_ref()[2], u8(3));
+}
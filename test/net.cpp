@@ -187,6 +187,183 @@ async::coro<io::Result<bytes::BytesMut>> repeated_readiness(net::TcpListener& li
     co_return Ok(rstd::move(received));
 }
 
+async::coro<io::Result<usize>> accept_in_batches(net::TcpListener& listener,
+                                                 net::SocketAddr   addr,
+                                                 usize             clients,
+                                                 usize             max,
+                                                 usize&            largest) {
+    auto streams = Vec<net::TcpStream>::make();
+    for (usize i = 0; i < clients; ++i) {
+        auto client = co_await net::TcpStream::connect(addr);
+        if (client.is_err()) co_return Err(rstd::move(client).unwrap_err_unchecked());
+        streams.push(rstd::move(client).unwrap_unchecked());
+    }
+
+    usize accepted = 0;
+    while (accepted < clients) {
+        auto batch = co_await listener.accept_batch(max);
+        if (batch.is_err()) co_return Err(rstd::move(batch).unwrap_err_unchecked());
+        auto len = batch->len();
+        if (len > largest) largest = len;
+        accepted += len;
+    }
+    co_return Ok(accepted);
+}
+
+auto bound_udp() -> net::UdpSocket {
+    return net::UdpSocket::bind(net::SocketAddr::ipv4_loopback(0)).unwrap();
+}
+
+async::coro<io::Result<net::RecvMeta>> udp_roundtrip(net::UdpSocket&  sender,
+                                                     net::UdpSocket&  receiver,
+                                                     bytes::BytesMut& received) {
+    auto target = receiver.local_addr();
+    if (target.is_err()) co_return Err(rstd::move(target).unwrap_err_unchecked());
+
+    const u8 payload[] = { 'p', 'i', 'n', 'g' };
+    auto     bytes     = bytes::Bytes::copy_from_slice(slice<u8>::from_raw_parts(payload, 4));
+    auto     sent      = co_await sender.send_to(bytes, rstd::move(target).unwrap_unchecked());
+    if (sent.is_err()) co_return Err(rstd::move(sent).unwrap_err_unchecked());
+
+    co_return co_await receiver.recv_from(received);
+}
+
+// Sends `count` one-byte datagrams 'a', 'b', ... as one batch and receives them in batches of
+// at most `count`, returning every datagram's metadata in order.
+async::coro<io::Result<Vec<net::RecvMeta>>> udp_batch_roundtrip(net::UdpSocket&        sender,
+                                                               net::UdpSocket&        receiver,
+                                                               usize                  count,
+                                                               Vec<bytes::BytesMut>& received) {
+    auto target = receiver.local_addr();
+    if (target.is_err()) co_return Err(rstd::move(target).unwrap_err_unchecked());
+
+    auto datagrams = Vec<bytes::Bytes>::make();
+    for (usize i = 0; i < count; ++i) {
+        const u8 payload[] = { u8('a' + i) };
+        datagrams.push(bytes::Bytes::copy_from_slice(slice<u8>::from_raw_parts(payload, 1)));
+    }
+    auto sent = co_await sender.send_batch(datagrams, Some(rstd::move(target).unwrap_unchecked()));
+    if (sent.is_err()) co_return Err(rstd::move(sent).unwrap_err_unchecked());
+
+    auto all = Vec<net::RecvMeta>::make();
+    while (all.len() < count) {
+        auto bufs = Vec<bytes::BytesMut>::make();
+        for (usize i = all.len(); i < count; ++i) bufs.push(bytes::BytesMut::with_capacity(8));
+
+        auto metas = Vec<net::RecvMeta>::make();
+        auto got   = co_await receiver.recv_batch(bufs, metas);
+        if (got.is_err()) co_return Err(rstd::move(got).unwrap_err_unchecked());
+        for (usize i = 0; i < metas.len(); ++i) {
+            all.push(rstd::move(metas[i]));
+            received.push(rstd::move(bufs[i]));
+        }
+    }
+    co_return Ok(rstd::move(all));
+}
+
+async::coro<io::Result<Vec<usize>>> udp_segmented_roundtrip(net::UdpSocket& sender,
+                                                            net::UdpSocket& receiver) {
+    auto target = receiver.local_addr();
+    if (target.is_err()) co_return Err(rstd::move(target).unwrap_err_unchecked());
+
+    const u8 payload[] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+    auto     bytes     = bytes::Bytes::copy_from_slice(slice<u8>::from_raw_parts(payload, 10));
+    auto     addr      = rstd::move(target).unwrap_unchecked();
+    auto     sent      = co_await sender.send_segmented(bytes, 4, Some(addr));
+    if (sent.is_err()) co_return Err(rstd::move(sent).unwrap_err_unchecked());
+
+    auto sizes = Vec<usize>::make();
+    while (sizes.len() < 3) {
+        auto buf  = bytes::BytesMut::with_capacity(16);
+        auto meta = co_await receiver.recv_from(buf);
+        if (meta.is_err()) co_return Err(rstd::move(meta).unwrap_err_unchecked());
+        sizes.push(meta->len);
+    }
+    co_return Ok(rstd::move(sizes));
+}
+
+auto text_bytes(const char* text) -> bytes::Bytes {
+    return bytes::Bytes::copy_from_slice(
+        slice<u8>::from_raw_parts(reinterpret_cast<const u8*>(text), rstd::strlen(text)));
+}
+
+async::coro<io::Result<bytes::BytesMut>> unix_roundtrip(net::UnixStream& writer,
+                                                        net::UnixStream& reader,
+                                                        const char*      text) {
+    auto payload = text_bytes(text);
+    auto written = co_await async::io::write_all(writer, payload);
+    if (written.is_err()) co_return Err(rstd::move(written).unwrap_err_unchecked());
+
+    auto received = bytes::BytesMut::with_capacity(payload.len());
+    auto read     = co_await async::io::read_exact(reader, received, payload.len());
+    if (read.is_err()) co_return Err(rstd::move(read).unwrap_err_unchecked());
+    co_return Ok(rstd::move(received));
+}
+
+async::coro<io::Result<bytes::BytesMut>> unix_accept_roundtrip(net::UnixListener& listener,
+                                                               net::SocketAddr    addr) {
+    auto client = co_await net::UnixStream::connect_addr(rstd::move(addr));
+    if (client.is_err()) co_return Err(rstd::move(client).unwrap_err_unchecked());
+
+    auto accepted = co_await listener.accept();
+    if (accepted.is_err()) co_return Err(rstd::move(accepted).unwrap_err_unchecked());
+
+    auto accepted_pair = rstd::move(accepted).unwrap_unchecked();
+    auto server        = rstd::move(accepted_pair.template get<0>());
+    co_return co_await unix_roundtrip(*client, server, "ping");
+}
+
+// Passes one end of a second stream pair across `sender`, then talks through the received
+// copy to show it refers to the same socket.
+async::coro<io::Result<bytes::BytesMut>> unix_pass_fd(net::UnixStream& sender,
+                                                      net::UnixStream& receiver) {
+    auto inner = net::UnixStream::pair();
+    if (inner.is_err()) co_return Err(rstd::move(inner).unwrap_err_unchecked());
+    auto ends = rstd::move(inner).unwrap_unchecked();
+
+    auto passed = ends.template get<0>().into_owned_fd();
+    auto raw    = passed.as_raw_fd();
+    auto sent   = co_await sender.send_with_fds(text_bytes("f"),
+                                              slice<sys::fd::RawFd>::from_raw_parts(&raw, 1));
+    if (sent.is_err()) co_return Err(rstd::move(sent).unwrap_err_unchecked());
+
+    auto buf      = bytes::BytesMut::with_capacity(1);
+    auto fds      = Vec<sys::fd::OwnedFd>::make();
+    auto received = co_await receiver.recv_with_fds(buf, fds);
+    if (received.is_err()) co_return Err(rstd::move(received).unwrap_err_unchecked());
+    if (fds.len() != 1) {
+        co_return Err(io::error::Error::from_kind(
+            io::error::ErrorKind { io::error::ErrorKind::InvalidData }));
+    }
+
+    auto copy = net::UnixStream::from_owned_fd(rstd::move(fds[0]));
+    if (copy.is_err()) co_return Err(rstd::move(copy).unwrap_err_unchecked());
+    co_return co_await unix_roundtrip(*copy, ends.template get<1>(), "moved");
+}
+
+async::coro<io::Result<usize>> unix_recv_fds(net::UnixStream&       receiver,
+                                             Vec<sys::fd::OwnedFd>& fds) {
+    auto buf = bytes::BytesMut::with_capacity(1);
+    co_return co_await receiver.recv_with_fds(buf, fds);
+}
+
+async::coro<io::Result<Vec<usize>>> unix_datagram_sizes(net::UnixDatagram& sender,
+                                                        net::UnixDatagram& receiver) {
+    auto first = co_await sender.send(text_bytes("ab"));
+    if (first.is_err()) co_return Err(rstd::move(first).unwrap_err_unchecked());
+    auto second = co_await sender.send(text_bytes("c"));
+    if (second.is_err()) co_return Err(rstd::move(second).unwrap_err_unchecked());
+
+    auto sizes = Vec<usize>::make();
+    for (usize i = 0; i < 2; ++i) {
+        auto buf      = bytes::BytesMut::with_capacity(8);
+        auto received = co_await receiver.recv_from(buf);
+        if (received.is_err()) co_return Err(rstd::move(received).unwrap_err_unchecked());
+        sizes.push(received->template get<0>());
+    }
+    co_return Ok(rstd::move(sizes));
+}
+
 } // namespace
 
 TEST(NetTcp, LoopbackRoundTrip) {
@@ -342,3 +519,217 @@ TEST(NetTcp, RepeatedWouldBlockWaitsForNextReadiness) {
     ASSERT_EQ(received.len(), 1u);
     EXPECT_EQ(received[0], u8('b'));
 }
+
+TEST(NetTcp, AcceptBatchDrainsBacklogUpToLimit) {
+    auto listener = net::TcpListener::bind_with_backlog(net::SocketAddr::ipv4_loopback(0), 16);
+    ASSERT_TRUE(listener.is_ok());
+
+    auto tcp_listener = rstd::move(listener).unwrap_unchecked();
+    auto addr         = tcp_listener.local_addr();
+    ASSERT_TRUE(addr.is_ok());
+
+    usize largest  = 0;
+    auto  accepted = async::block_on(
+        accept_in_batches(tcp_listener, rstd::move(addr).unwrap_unchecked(), 5, 2, largest));
+    ASSERT_TRUE(accepted.is_ok());
+    EXPECT_EQ(rstd::move(accepted).unwrap_unchecked(), 5u);
+    EXPECT_GE(largest, 1u);
+    EXPECT_LE(largest, 2u);
+}
+
+TEST(NetTcp, BindShardedSharesOnePort) {
+    auto listeners = net::TcpListener::bind_sharded(net::SocketAddr::ipv4_loopback(0), 3);
+    ASSERT_TRUE(listeners.is_ok());
+
+    auto shards = rstd::move(listeners).unwrap_unchecked();
+    ASSERT_EQ(shards.len(), 3u);
+    auto port = shards[0].local_addr().unwrap().port();
+    EXPECT_NE(port, 0);
+    for (usize i = 1; i < shards.len(); ++i) {
+        EXPECT_EQ(shards[i].local_addr().unwrap().port(), port);
+    }
+
+    auto exclusive = net::TcpListener::bind(net::SocketAddr::ipv4_loopback(port));
+    EXPECT_TRUE(exclusive.is_err());
+}
+
+TEST(NetUdp, SendToRecvFromLoopback) {
+    auto sender   = bound_udp();
+    auto receiver = bound_udp();
+    auto received = bytes::BytesMut::with_capacity(4);
+
+    auto meta = async::block_on(udp_roundtrip(sender, receiver, received));
+    ASSERT_TRUE(meta.is_ok());
+    EXPECT_EQ(meta->len, 4u);
+    EXPECT_FALSE(meta->truncated);
+    EXPECT_EQ(meta->addr.port(), sender.local_addr().unwrap().port());
+    ASSERT_EQ(received.len(), 4u);
+    EXPECT_EQ(received[0], u8('p'));
+    EXPECT_EQ(received[3], u8('g'));
+}
+
+TEST(NetUdp, ShortBufferReportsTruncation) {
+    auto sender   = bound_udp();
+    auto receiver = bound_udp();
+    auto received = bytes::BytesMut::with_capacity(2);
+
+    auto meta = async::block_on(udp_roundtrip(sender, receiver, received));
+    ASSERT_TRUE(meta.is_ok());
+    EXPECT_TRUE(meta->truncated);
+    EXPECT_EQ(received.len(), 2u);
+}
+
+TEST(NetUdp, BatchRoundTripCarriesControlMessages) {
+    auto sender   = bound_udp();
+    auto receiver = bound_udp();
+    ASSERT_TRUE(receiver.set_recv_pktinfo(true).is_ok());
+    ASSERT_TRUE(receiver.set_recv_timestamps(true).is_ok());
+
+    auto received = Vec<bytes::BytesMut>::make();
+    auto metas    = async::block_on(udp_batch_roundtrip(sender, receiver, 5, received));
+    ASSERT_TRUE(metas.is_ok());
+    ASSERT_EQ(metas->len(), 5u);
+    for (usize i = 0; i < 5; ++i) {
+        auto const& meta = (*metas)[i];
+        EXPECT_EQ(meta.len, 1u);
+        EXPECT_EQ(received[i][0], u8('a' + i));
+        ASSERT_TRUE(meta.local_ip.is_some());
+        EXPECT_EQ(meta.local_ip->m_octets[0], 127);
+        EXPECT_EQ(meta.local_ip->m_octets[3], 1);
+        EXPECT_TRUE(meta.timestamp.is_some());
+        EXPECT_FALSE(meta.control_truncated);
+    }
+}
+
+TEST(NetUdp, SendSegmentedSplitsIntoDatagrams) {
+    auto sender   = bound_udp();
+    auto receiver = bound_udp();
+
+    auto sizes = async::block_on(udp_segmented_roundtrip(sender, receiver));
+    ASSERT_TRUE(sizes.is_ok());
+    ASSERT_EQ(sizes->len(), 3u);
+    EXPECT_EQ((*sizes)[0], 4u);
+    EXPECT_EQ((*sizes)[1], 4u);
+    EXPECT_EQ((*sizes)[2], 2u);
+}
+
+TEST(NetUnix, StreamPairRoundTripAndPeerCred) {
+    auto pair = net::UnixStream::pair();
+    ASSERT_TRUE(pair.is_ok());
+    auto ends = rstd::move(pair).unwrap_unchecked();
+
+    auto received =
+        async::block_on(unix_roundtrip(ends.template get<0>(), ends.template get<1>(), "ping"));
+    ASSERT_TRUE(received.is_ok());
+    ASSERT_EQ(received->len(), 4u);
+    EXPECT_EQ((*received)[0], u8('p'));
+
+    auto cred = ends.template get<1>().peer_cred();
+    ASSERT_TRUE(cred.is_ok());
+    EXPECT_EQ(u32(cred->pid), process::id());
+}
+
+TEST(NetUnix, SocketAddrRejectsInvalidPaths) {
+    const u8 nul[] = { 'a', 0, 'b' };
+    EXPECT_TRUE(net::SocketAddr::from_unix_path(slice<u8>::from_raw_parts(nul, 3)).is_err());
+    EXPECT_TRUE(net::SocketAddr::from_unix_path(slice<u8>::from_raw_parts(nul, 0)).is_err());
+
+    u8 long_path[200] {};
+    for (auto& byte : long_path) byte = u8('x');
+    EXPECT_TRUE(
+        net::SocketAddr::from_unix_path(slice<u8>::from_raw_parts(long_path, 200)).is_err());
+
+    auto path = net::SocketAddr::from_unix_path(slice<u8>::from_raw_parts(nul, 1));
+    ASSERT_TRUE(path.is_ok());
+    EXPECT_TRUE(path->is_unix());
+    ASSERT_TRUE(path->as_unix_path().is_some());
+    EXPECT_EQ(path->as_unix_path()->len(), 1u);
+    EXPECT_TRUE(path->as_abstract_name().is_none());
+}
+
+TEST(NetUnix, ListenerAcceptsOnAbstractAddress) {
+    const char* name = "rstd-net-unix-test";
+    auto        addr = net::SocketAddr::from_abstract_name(
+        slice<u8>::from_raw_parts(reinterpret_cast<const u8*>(name), rstd::strlen(name)));
+    ASSERT_TRUE(addr.is_ok());
+
+    auto listener = net::UnixListener::bind_addr(*addr);
+    ASSERT_TRUE(listener.is_ok());
+    auto local = listener->local_addr();
+    ASSERT_TRUE(local.is_ok());
+    ASSERT_TRUE(local->as_abstract_name().is_some());
+    EXPECT_EQ(local->as_abstract_name()->len(), rstd::strlen(name));
+
+    auto received =
+        async::block_on(unix_accept_roundtrip(*listener, rstd::move(local).unwrap_unchecked()));
+    ASSERT_TRUE(received.is_ok());
+    EXPECT_EQ(received->len(), 4u);
+}
+
+TEST(NetUnix, PassesFileDescriptors) {
+    auto pair = net::UnixStream::pair();
+    ASSERT_TRUE(pair.is_ok());
+    auto ends = rstd::move(pair).unwrap_unchecked();
+
+    auto received = async::block_on(unix_pass_fd(ends.template get<0>(), ends.template get<1>()));
+    ASSERT_TRUE(received.is_ok());
+    ASSERT_EQ(received->len(), 5u);
+    EXPECT_EQ((*received)[0], u8('m'));
+}
+
+TEST(NetUnix, TooManyDescriptorsFailWithoutLeaking) {
+    int sv[2];
+    ASSERT_EQ(sys::libc::socketpair(sys::libc::AF_UNIX, sys::libc::SOCK_STREAM, 0, sv), 0);
+
+    // `send_with_fds` refuses to attach this many, so the message is built by hand.
+    constexpr usize COUNT = sys::socket::MAX_PASSED_FDS + 4;
+    int             passed[COUNT];
+    for (auto& fd : passed) fd = sv[0];
+    alignas(sys::libc::cmsghdr) u8 control[sys::libc::cmsg_space(sizeof(passed))] {};
+    u8   byte = u8('x');
+    auto iov  = sys::libc::iovec { &byte, 1 };
+    auto msg  = sys::libc::msghdr {};
+
+    msg.msg_iov        = &iov;
+    msg.msg_iovlen     = 1;
+    msg.msg_control    = control;
+    msg.msg_controllen = sizeof(control);
+    auto* cmsg         = sys::libc::cmsg_firsthdr(&msg);
+    cmsg->cmsg_level   = sys::libc::SOL_SOCKET;
+    cmsg->cmsg_type    = sys::libc::SCM_RIGHTS;
+    cmsg->cmsg_len     = sys::libc::cmsg_len(sizeof(passed));
+    rstd::mem::memcpy(sys::libc::cmsg_data(cmsg), passed, sizeof(passed));
+    ASSERT_EQ(sys::libc::sendmsg(sv[0], &msg, 0), 1);
+
+    auto receiver = net::UnixStream::from_owned_fd(sys::fd::OwnedFd::from_raw_fd(sv[1]));
+    ASSERT_TRUE(receiver.is_ok());
+
+    // The lowest free descriptor; a received descriptor left open would take it.
+    int probe = sys::libc::dup(sv[0]);
+    sys::libc::close(probe);
+
+    auto fds    = Vec<sys::fd::OwnedFd>::make();
+    auto result = async::block_on(unix_recv_fds(*receiver, fds));
+    ASSERT_TRUE(result.is_err());
+    EXPECT_EQ(rstd::move(result).unwrap_err_unchecked().kind(),
+              io::error::ErrorKind { io::error::ErrorKind::InvalidData });
+    EXPECT_TRUE(fds.is_empty());
+
+    int after = sys::libc::dup(sv[0]);
+    EXPECT_EQ(after, probe);
+    sys::libc::close(after);
+    sys::libc::close(sv[0]);
+}
+
+TEST(NetUnix, DatagramPairKeepsBoundaries) {
+    auto pair = net::UnixDatagram::pair();
+    ASSERT_TRUE(pair.is_ok());
+    auto ends = rstd::move(pair).unwrap_unchecked();
+
+    auto sizes =
+        async::block_on(unix_datagram_sizes(ends.template get<0>(), ends.template get<1>()));
+    ASSERT_TRUE(sizes.is_ok());
+    ASSERT_EQ(sizes->len(), 2u);
+    EXPECT_EQ((*sizes)[0], 2u);
+    EXPECT_EQ((*sizes)[1], 1u);
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+import rstd;
+
+using namespace rstd::prelude;
+using rstd::string::String;
+using rstd::vec::Vec;
+namespace par = rstd::par;
+
+namespace
+{
+
+auto iota(usize n) -> Vec<u64> {
+    auto v = Vec<u64>::with_capacity(n);
+    for (usize i = 0; i < n; ++i) v.push(u64(i));
+    return v;
+}
+
+auto fib(u64 n) -> u64 {
+    if (n < 2) return n;
+    auto [a, b] = par::join([&] { return fib(n - 1); }, [&] { return fib(n - 2); });
+    return a + b;
+}
+
+} // namespace
+
+TEST(Par, JoinNestsAndReturnsBothResults) {
+    EXPECT_GE(par::current_num_threads(), 1u);
+    EXPECT_EQ(fib(20), 6765u);
+
+    int  touched = 0;
+    auto [unit, value] = par::join([&] { touched = 1; }, [] { return 7; });
+    (void)unit;
+    EXPECT_EQ(touched, 1);
+    EXPECT_EQ(value, 7);
+}
+
+TEST(Par, MapSumAndCountOverSlices) {
+    auto v = iota(1'000'000);
+    EXPECT_EQ(par::par_iter(v).map([](const u64& x) { return x * 2; }).sum(), 999'999'000'000u);
+    EXPECT_EQ(par::par_iter(v).filter([](const u64& x) { return x % 3 == 0; }).count(), 333'334u);
+
+    par::par_iter_mut(v).for_each([](u64& x) { x += 1; });
+    EXPECT_EQ(v[0], 1u);
+    EXPECT_EQ(v[999'999], 1'000'000u);
+}
+
+TEST(Par, CollectKeepsSourceOrder) {
+    auto squares = par::into_par_iter(rstd::iter::range<i64>(-3, 100'000))
+                       .map([](i64 x) { return x * x; })
+                       .collect<Vec<i64>>();
+    ASSERT_EQ(squares.len(), 100'003u);
+    EXPECT_EQ(squares[0], 9);
+    EXPECT_EQ(squares[100'002], i64(99'999) * 99'999);
+
+    auto v     = iota(200'000);
+    auto evens = par::par_iter(v)
+                     .with_min_len(1024)
+                     .filter([](const u64& x) { return x % 2 == 0; })
+                     .collect<Vec<u64>>();
+    ASSERT_EQ(evens.len(), 100'000u);
+    for (usize i = 0; i < evens.len(); ++i) ASSERT_EQ(evens[i], 2 * i);
+}
+
+TEST(Par, IntoParIterMovesElements) {
+    auto words = Vec<String>::make();
+    for (usize i = 0; i < 5000; ++i) words.push(String::make(i % 2 == 0 ? "even" : "odd"));
+
+    auto odd = par::into_par_iter(rstd::move(words))
+                   .filter([](const String& s) { return s.len() == 3; })
+                   .collect<Vec<String>>();
+    ASSERT_EQ(odd.len(), 2500u);
+    EXPECT_EQ(odd[0], "odd");
+}
+
+TEST(Par, FoldReduceAndChunks) {
+    auto total = par::into_par_iter(rstd::iter::range<u64>(0, 100'000))
+                     .fold([] { return u64(0); }, [](u64 acc, u64 x) { return acc + x; })
+                     .reduce([] { return u64(0); }, [](u64 a, u64 b) { return a + b; });
+    EXPECT_EQ(total, 4'999'950'000u);
+
+    auto v = iota(10'000);
+    EXPECT_EQ(par::par_chunks(v.as_slice(), 333).count(), 31u);
+    par::par_chunks_mut(v.deref_mut(), 1000).for_each([](mut_ref<u64[]> chunk) { chunk.p[0] = 0; });
+    EXPECT_EQ(v[1000], 0u);
+    EXPECT_EQ(v[1001], 1001u);
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+import rstd;
+
+using namespace rstd::prelude;
+using rstd::vec::Vec;
+namespace slice_ = rstd::slice_;
+
+namespace
+{
+
+auto xorshift(u64& state) -> u64 {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+enum class Shape { Random, Sorted, Reversed, FewUnique };
+
+auto make_input(usize n, Shape shape) -> Vec<i64> {
+    auto v     = Vec<i64>::with_capacity(n);
+    u64  state = 0x9e3779b97f4a7c15ull;
+    for (usize i = 0; i < n; ++i) {
+        switch (shape) {
+        case Shape::Random: v.push(i64(xorshift(state))); break;
+        case Shape::Sorted: v.push(i64(i)); break;
+        case Shape::Reversed: v.push(i64(n - i)); break;
+        case Shape::FewUnique: v.push(i64(xorshift(state) % 4) - 2); break;
+        }
+    }
+    return v;
+}
+
+auto sum(const Vec<i64>& v) -> i64 {
+    i64 total = 0;
+    for (usize i = 0; i < v.len(); ++i) total += v[i];
+    return total;
+}
+
+struct Keyed {
+    u32   key;
+    usize order;
+};
+
+} // namespace
+
+TEST(Slice, SortUnstableHandlesEveryShape) {
+    for (auto shape : { Shape::Random, Shape::Sorted, Shape::Reversed, Shape::FewUnique }) {
+        for (usize n : { usize(0), usize(1), usize(19), usize(200), usize(5000) }) {
+            auto v      = make_input(n, shape);
+            auto before = sum(v);
+            slice_::sort_unstable(v.deref_mut());
+            EXPECT_TRUE(slice_::is_sorted(v.as_slice()));
+            EXPECT_EQ(sum(v), before);
+        }
+    }
+}
+
+TEST(Slice, SortIsStable) {
+    u64  state = 7;
+    auto v     = Vec<Keyed>::with_capacity(3000);
+    for (usize i = 0; i < 3000; ++i) v.push(Keyed { u32(xorshift(state) % 16), i });
+
+    slice_::sort_by_key(v.deref_mut(), [](const Keyed& k) { return k.key; });
+    for (usize i = 1; i < v.len(); ++i) {
+        ASSERT_LE(v[i - 1].key, v[i].key);
+        if (v[i - 1].key == v[i].key) ASSERT_LT(v[i - 1].order, v[i].order);
+    }
+
+    slice_::sort_by(v.deref_mut(), [](const Keyed& a, const Keyed& b) { return b.key <=> a.key; });
+    for (usize i = 1; i < v.len(); ++i) {
+        ASSERT_GE(v[i - 1].key, v[i].key);
+        if (v[i - 1].key == v[i].key) ASSERT_LT(v[i - 1].order, v[i].order);
+    }
+}
+
+TEST(Slice, RadixSortMatchesComparisonSort) {
+    for (auto shape : { Shape::Random, Shape::Reversed, Shape::FewUnique }) {
+        auto a = make_input(4000, shape);
+        auto b = make_input(4000, shape);
+        slice_::radix_sort(a.deref_mut());
+        slice_::sort(b.deref_mut());
+        for (usize i = 0; i < a.len(); ++i) ASSERT_EQ(a[i], b[i]);
+    }
+
+    auto bytes = Vec<i8>::make();
+    for (int x : { 5, -128, 127, 0, -1, 3, -7 }) bytes.push(i8(x));
+    for (usize i = 0; i < 100; ++i) bytes.push(i8(i * 37));
+    slice_::radix_sort(bytes.deref_mut());
+    EXPECT_TRUE(slice_::is_sorted(bytes.as_slice()));
+    EXPECT_EQ(bytes[0], -128);
+}
+
+TEST(Slice, SelectNthAndBinarySearch) {
+    auto v   = make_input(1001, Shape::Random);
+    auto ref = make_input(1001, Shape::Random);
+    slice_::sort_unstable(ref.deref_mut());
+
+    auto& median = slice_::select_nth_unstable(v.deref_mut(), 500);
+    EXPECT_EQ(median, ref[500]);
+    for (usize i = 0; i < 500; ++i) EXPECT_LE(v[i], median);
+    for (usize i = 501; i < v.len(); ++i) EXPECT_GE(v[i], median);
+
+    auto few = make_input(500, Shape::FewUnique);
+    EXPECT_EQ(slice_::select_nth_unstable(few.deref_mut(), 0), -2);
+
+    auto sorted = make_input(100, Shape::Sorted);
+    EXPECT_EQ(slice_::binary_search(sorted.as_slice(), i64(42)).unwrap(), 42u);
+    EXPECT_EQ(slice_::binary_search(sorted.as_slice(), i64(-3)).unwrap_err(), 0u);
+    EXPECT_EQ(slice_::binary_search(sorted.as_slice(), i64(1000)).unwrap_err(), 100u);
+    EXPECT_EQ(slice_::partition_point(sorted.as_slice(), [](i64 x) { return x < 17; }), 17u);
+}
+
+TEST(Slice, ParSortMatchesSequential) {
+    for (auto shape : { Shape::Random, Shape::FewUnique }) {
+        auto a = make_input(100000, shape);
+        auto b = make_input(100000, shape);
+        auto c = make_input(100000, shape);
+        slice_::par_sort(a.deref_mut(), 4);
+        slice_::par_sort_unstable(b.deref_mut(), 3);
+        slice_::sort(c.deref_mut());
+        for (usize i = 0; i < c.len(); ++i) {
+            ASSERT_EQ(a[i], c[i]);
+            ASSERT_EQ(b[i], c[i]);
+        }
+    }
+}
@@ -97,6 +97,37 @@ TEST(Str, FromUtf8Invalid) {
     EXPECT_TRUE(rstd::str_::from_utf8(sl).is_none());
 }
 
+TEST(Str, ValidateUtf8ReportsOffsetPastAsciiBlocks) {
+    std::vector<rstd::u8> data(100, 'a');
+    data.insert(data.end(), { 0xE2, 0x82, 0xAC, 'b' });
+    auto sl = rstd::slice<rstd::u8>::from_raw_parts(data.data(), data.size());
+    EXPECT_TRUE(rstd::str_::validate_utf8(sl).is_ok());
+
+    // Surrogate half, then an overlong '/', then a truncated 4-byte sequence.
+    for (auto bad : std::vector<std::vector<rstd::u8>> {
+             { 0xED, 0xA0, 0x80 }, { 0xC0, 0xAF }, { 0xF0, 0x9F, 0x98 } }) {
+        auto input = data;
+        input.insert(input.begin() + 70, bad.begin(), bad.end());
+        auto r = rstd::str_::validate_utf8(
+            rstd::slice<rstd::u8>::from_raw_parts(input.data(), input.size()));
+        ASSERT_TRUE(r.is_err());
+        EXPECT_EQ(r.unwrap_err().valid_up_to(), 70u);
+    }
+}
+
+TEST(Str, AsciiCaseHelpers) {
+    EXPECT_TRUE(rstd::str_::is_ascii("a long ascii string crossing the 32 byte block size"));
+    EXPECT_FALSE(rstd::str_::is_ascii("a long ascii string crossing the 32 byte block sizé"));
+    EXPECT_TRUE(
+        rstd::str_::eq_ignore_ascii_case("Content-Length: 42 [HÉ]", "content-LENGTH: 42 [hÉ]"));
+    EXPECT_FALSE(rstd::str_::eq_ignore_ascii_case("Content-Length", "Content-Lengtx"));
+    EXPECT_FALSE(rstd::str_::eq_ignore_ascii_case("@[`{", "`{@["));
+
+    auto s = rstd::string::String::make("Hello, WORLD! Ünïcode stays @[`{ 0123456789");
+    EXPECT_EQ("hello, world! Ünïcode stays @[`{ 0123456789", s.to_ascii_lowercase());
+    EXPECT_EQ("HELLO, WORLD! ÜNïCODE STAYS @[`{ 0123456789", s.to_ascii_uppercase());
+}
+
 TEST(Str, CharsExposesUnconsumedString) {
     auto chars = rstd::str_::chars("é中x");
     EXPECT_EQ(chars.as_str(), "é中x");
@@ -47,6 +47,23 @@ TEST(Thread, BuilderWithName) {
     ASSERT_TRUE(thread_handle.name().is_some());
 }
 
+TEST(Thread, BuilderWithAffinity) {
+    auto cpus = thread::available_cpus();
+    ASSERT_FALSE(cpus.is_empty());
+
+    auto result = thread::builder::Builder::make().affinity(cpus[0]).spawn([] {
+        return 7;
+    });
+    ASSERT_TRUE(result.is_ok());
+    auto joined = rstd::move(result).unwrap().join();
+    ASSERT_TRUE(joined.is_ok());
+    EXPECT_EQ(joined.unwrap(), 7);
+
+    auto invalid = thread::builder::Builder::make().affinity(usize(1) << 20).spawn([] {
+    });
+    EXPECT_TRUE(invalid.is_err());
+}
+
 TEST(Thread, ThreadId) {
     auto id1 = thread::ThreadId::make();
     auto id2 = thread::ThreadId::make();